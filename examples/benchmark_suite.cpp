@@ -0,0 +1,629 @@
+// TS_STL 参数化基准测试套件
+//
+// 工作负载注册表：7 种容器（vector / list / deque / set / unordered_set / map / unordered_map）
+// x 全部锁策略，按线程数、键分布（均匀 / Zipf）、读写比例扫描，输出吞吐量与 p50/p99/p999 延迟。
+// 结果可输出为 JSON / CSV，便于跨版本对比。
+//
+// 用法：benchmark_suite [选项]
+//   --filter <子串>        只运行名称（container/policy）包含子串的工作负载，可重复
+//   --threads 1,2,4,8      线程数列表（默认 1,2,4,8）
+//   --dist uniform,zipf    键分布列表（默认两者）
+//   --zipf-theta 0.99      Zipf 偏斜参数（0 < theta < 1）
+//   --read 90              读操作百分比列表（默认 90）
+//   --ops 50000            每线程操作数
+//   --keys 65536           键空间大小（容器预填充的元素个数）
+//   --sample 8             每 N 个操作计时一次（延迟采样间隔）
+//   --pin                  把线程依次绑定到 CPU（仅 Linux）
+//   --json <文件>          写出 JSON 结果
+//   --csv <文件>           写出 CSV 结果
+//   --quiet                不输出表格
+//   --list                 只列出工作负载
+
+#include "../include/ts_stl.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#if defined(__linux__)
+    #include <pthread.h>
+    #include <sched.h>
+#endif
+
+using namespace ts_stl;
+using bench_clock = std::chrono::steady_clock;
+
+// ==================== 基准测试辅助工具 ====================
+
+// 防止编译器把基准操作的结果优化掉
+template <typename T>
+inline void do_not_optimize(const T& value) {
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "r,m"(value) : "memory");
+#else
+    static volatile const T* sink;
+    sink = &value;
+#endif
+}
+
+// 无锁策略的特化没有 get/set（直接用 operator[]），按成员是否存在选择调用方式
+template <typename C, typename = void>
+struct has_get_set : std::false_type {};
+
+template <typename C>
+struct has_get_set<C, std::void_t<decltype(std::declval<C&>().get(0u)),
+                                  decltype(std::declval<C&>().set(0u, 0u))>> : std::true_type {};
+
+// 加锁容器的 get()/front() 返回引用，锁释放后并发写可能使其失效：有读锁接口时在锁内复制值
+template <typename C, typename = void>
+struct has_read_lock : std::false_type {};
+
+template <typename C>
+struct has_read_lock<C, std::void_t<decltype(std::declval<const C&>().with_read_lock(
+                            std::declval<void (*)(const C&)>()))>> : std::true_type {};
+
+// 每个工作负载对容器执行的两种操作：read(key) 与 write(key)
+class bench_target {
+public:
+    virtual ~bench_target() = default;
+    virtual void read(std::uint32_t key) = 0;
+    virtual void write(std::uint32_t key) = 0;
+};
+
+struct workload {
+    std::string container;
+    std::string policy;
+    bool thread_safe;
+    std::function<std::unique_ptr<bench_target>(std::uint32_t keys)> make;
+
+    std::string name() const {
+        return container + "/" + policy;
+    }
+};
+
+// ==================== 容器适配器 ====================
+
+// 顺序容器按下标读写
+template <typename C>
+class indexed_target : public bench_target {
+public:
+    explicit indexed_target(std::uint32_t keys) : container_(keys) {}
+    void read(std::uint32_t key) override {
+        if constexpr (has_read_lock<C>::value) {
+            container_.with_read_lock([key](const C& c) {
+                const typename C::value_type copy = c.unsafe_ref()[key];
+                do_not_optimize(copy);
+            });
+        } else {
+            do_not_optimize(container_[key]);
+        }
+    }
+    void write(std::uint32_t key) override {
+        if constexpr (has_get_set<C>::value) {
+            container_.set(key, key);
+        } else {
+            container_[key] = key;
+        }
+    }
+
+private:
+    C container_;
+};
+
+// 链表：读队首，写为队尾入队 + 队首出队（长度保持不变）
+template <typename C>
+class queue_target : public bench_target {
+public:
+    explicit queue_target(std::uint32_t keys) {
+        for (std::uint32_t i = 0; i < keys; ++i) {
+            container_.push_back(i);
+        }
+    }
+    void read(std::uint32_t) override {
+        if constexpr (has_read_lock<C>::value) {
+            container_.with_read_lock([](const C& c) {
+                const typename C::value_type copy = c.unsafe_ref().front();
+                do_not_optimize(copy);
+            });
+        } else {
+            do_not_optimize(container_.front());
+        }
+    }
+    void write(std::uint32_t key) override {
+        container_.push_back(key);
+        container_.pop_front();
+    }
+
+private:
+    C container_;
+};
+
+// 集合：读为 contains，写为插入，已存在时删除
+template <typename C>
+class set_target : public bench_target {
+public:
+    explicit set_target(std::uint32_t keys) {
+        for (std::uint32_t i = 0; i < keys; ++i) {
+            container_.insert(i);
+        }
+    }
+    void read(std::uint32_t key) override {
+        do_not_optimize(container_.contains(key));
+    }
+    void write(std::uint32_t key) override {
+        if (!container_.insert(key).second) {
+            container_.erase(key);
+        }
+    }
+
+private:
+    C container_;
+};
+
+// 映射：读为 get，写为 set
+template <typename C>
+class map_target : public bench_target {
+public:
+    explicit map_target(std::uint32_t keys) {
+        for (std::uint32_t i = 0; i < keys; ++i) {
+            write(i);
+        }
+    }
+    void read(std::uint32_t key) override {
+        do_not_optimize(container_.get(key));
+    }
+    void write(std::uint32_t key) override {
+        if constexpr (has_get_set<C>::value) {
+            container_.set(key, key + 1);
+        } else {
+            container_[key] = key + 1;
+        }
+    }
+
+private:
+    C container_;
+};
+
+template <typename Target>
+void add_workload(std::vector<workload>& out, const char* container, const char* policy, bool thread_safe) {
+    out.push_back({container, policy, thread_safe,
+                   [](std::uint32_t keys) { return std::unique_ptr<bench_target>(new Target(keys)); }});
+}
+
+template <LockPolicy Policy>
+void register_policy(std::vector<workload>& out, const char* policy) {
+    constexpr bool thread_safe = Policy != LockPolicy::LockFree;
+    using value = std::uint64_t;
+    add_workload<indexed_target<ts_stl::vector<value, Policy>>>(out, "vector", policy, thread_safe);
+    add_workload<queue_target<ts_stl::list<value, Policy>>>(out, "list", policy, thread_safe);
+    add_workload<indexed_target<ts_stl::deque<value, Policy>>>(out, "deque", policy, thread_safe);
+    add_workload<set_target<ts_stl::set<std::uint32_t, std::less<std::uint32_t>, Policy>>>(
+        out, "set", policy, thread_safe);
+    add_workload<set_target<ts_stl::unordered_set<std::uint32_t, std::hash<std::uint32_t>,
+                                                  std::equal_to<std::uint32_t>, Policy>>>(
+        out, "unordered_set", policy, thread_safe);
+    add_workload<map_target<ts_stl::map<std::uint32_t, value, std::less<std::uint32_t>, Policy>>>(
+        out, "map", policy, thread_safe);
+    add_workload<map_target<ts_stl::unordered_map<std::uint32_t, value, std::hash<std::uint32_t>,
+                                                  std::equal_to<std::uint32_t>, Policy>>>(
+        out, "unordered_map", policy, thread_safe);
+}
+
+std::vector<workload> workload_registry() {
+    std::vector<workload> out;
+    register_policy<LockPolicy::Mutex>(out, "Mutex");
+#if TS_STL_SUPPORT_RW_LOCK
+    register_policy<LockPolicy::ReadWrite>(out, "ReadWrite");
+    register_policy<LockPolicy::ReaderBiased>(out, "ReaderBiased");
+#endif
+    register_policy<LockPolicy::SpinLock>(out, "SpinLock");
+    register_policy<LockPolicy::Adaptive>(out, "Adaptive");
+    register_policy<LockPolicy::Ticket>(out, "Ticket");
+    register_policy<LockPolicy::LockFree>(out, "LockFree");  // 只在单线程下运行
+    return out;
+}
+
+// ==================== 键分布 ====================
+
+/**
+ * Zipf 分布生成器（Gray 等人的方法，YCSB 同款）：rank 0 最热。
+ * 构造时 O(n) 计算 zeta(n)，之后每次采样 O(1)。
+ */
+class zipf_generator {
+public:
+    zipf_generator(std::uint32_t n, double theta)
+        : n_(n), theta_(theta), alpha_(1.0 / (1.0 - theta)), zetan_(zeta(n, theta)) {
+        eta_ = (1.0 - std::pow(2.0 / n_, 1.0 - theta_)) / (1.0 - zeta(2, theta_) / zetan_);
+    }
+
+    template <typename Rng>
+    std::uint32_t operator()(Rng& rng) {
+        double u = uniform_(rng);
+        double uz = u * zetan_;
+        if (uz < 1.0) {
+            return 0;
+        }
+        if (uz < 1.0 + std::pow(0.5, theta_)) {
+            return 1;
+        }
+        auto rank = static_cast<std::uint64_t>(static_cast<double>(n_) * std::pow(eta_ * u - eta_ + 1.0, alpha_));
+        return static_cast<std::uint32_t>(std::min<std::uint64_t>(rank, n_ - 1));
+    }
+
+private:
+    static double zeta(std::uint32_t n, double theta) {
+        double sum = 0;
+        for (std::uint32_t i = 1; i <= n; ++i) {
+            sum += 1.0 / std::pow(static_cast<double>(i), theta);
+        }
+        return sum;
+    }
+
+    std::uint32_t n_;
+    double theta_;
+    double alpha_;
+    double zetan_;
+    double eta_ = 0;
+    std::uniform_real_distribution<double> uniform_{0.0, 1.0};
+};
+
+// 最高位标记写操作，低 31 位为键
+constexpr std::uint32_t write_flag = 0x80000000u;
+
+struct run_config {
+    std::vector<std::string> filters;
+    std::vector<std::size_t> threads = {1, 2, 4, 8};
+    std::vector<std::string> distributions = {"uniform", "zipf"};
+    std::vector<int> read_percents = {90};
+    double zipf_theta = 0.99;
+    std::size_t ops = 50000;
+    std::uint32_t keys = 65536;
+    std::size_t sample = 8;
+    bool pin = false;
+    bool quiet = false;
+    bool list_only = false;
+    std::string json_path;
+    std::string csv_path;
+};
+
+// 预先生成每个线程的操作序列，计时区间内不做随机数计算
+std::vector<std::vector<std::uint32_t>> make_streams(const run_config& config, const zipf_generator* zipf_base,
+                                                     std::size_t threads, int read_percent) {
+    std::vector<std::vector<std::uint32_t>> streams(threads);
+    for (std::size_t t = 0; t < threads; ++t) {
+        std::unique_ptr<zipf_generator> zipf;
+        if (zipf_base) {
+            zipf = std::make_unique<zipf_generator>(*zipf_base);
+        }
+        std::mt19937_64 rng(0x9e3779b97f4a7c15ULL * (t + 1));
+        std::uniform_int_distribution<std::uint32_t> uniform(0, config.keys - 1);
+        std::uniform_int_distribution<int> percent(0, 99);
+        auto& stream = streams[t];
+        stream.reserve(config.ops);
+        for (std::size_t i = 0; i < config.ops; ++i) {
+            std::uint32_t key;
+            if (zipf) {
+                // 打散热点：rank 相邻的热键不落在相邻位置
+                std::uint64_t rank = (*zipf)(rng);
+                key = static_cast<std::uint32_t>((rank * 2654435761ULL) % config.keys);
+            } else {
+                key = uniform(rng);
+            }
+            if (percent(rng) >= read_percent) {
+                key |= write_flag;
+            }
+            stream.push_back(key);
+        }
+    }
+    return streams;
+}
+
+// ==================== 执行与统计 ====================
+
+struct bench_result {
+    std::string container;
+    std::string policy;
+    std::string distribution;
+    std::size_t threads;
+    int read_percent;
+    std::size_t operations;
+    double seconds;
+    double ops_per_sec;
+    std::uint64_t p50_ns;
+    std::uint64_t p99_ns;
+    std::uint64_t p999_ns;
+    std::uint64_t max_ns;
+};
+
+void pin_current_thread(std::size_t index) {
+#if defined(__linux__)
+    unsigned cpus = std::max(1u, std::thread::hardware_concurrency());
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(static_cast<int>(index % cpus), &set);
+    pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+#else
+    (void)index;
+#endif
+}
+
+std::uint64_t percentile(const std::vector<std::uint64_t>& sorted, double p) {
+    if (sorted.empty()) {
+        return 0;
+    }
+    auto index = static_cast<std::size_t>(p * static_cast<double>(sorted.size() - 1));
+    return sorted[index];
+}
+
+bench_result run_one(const workload& w, const run_config& config, const std::string& distribution,
+                     const zipf_generator* zipf, std::size_t threads, int read_percent) {
+    auto streams = make_streams(config, zipf, threads, read_percent);
+    auto target = w.make(config.keys);
+    std::vector<std::vector<std::uint64_t>> latencies(threads);
+
+    std::atomic<std::size_t> ready{0};
+    std::atomic<bool> go{false};
+    std::vector<std::thread> workers;
+    for (std::size_t t = 0; t < threads; ++t) {
+        workers.emplace_back([&, t]() {
+            if (config.pin) {
+                pin_current_thread(t);
+            }
+            const auto& stream = streams[t];
+            auto& samples = latencies[t];
+            samples.reserve(stream.size() / config.sample + 1);
+            ready.fetch_add(1);
+            while (!go.load(std::memory_order_acquire)) {
+                std::this_thread::yield();
+            }
+            for (std::size_t i = 0; i < stream.size(); ++i) {
+                std::uint32_t op = stream[i];
+                bool timed = i % config.sample == 0;
+                bench_clock::time_point start;
+                if (timed) {
+                    start = bench_clock::now();
+                }
+                if (op & write_flag) {
+                    target->write(op & ~write_flag);
+                } else {
+                    target->read(op);
+                }
+                if (timed) {
+                    samples.push_back(static_cast<std::uint64_t>(
+                        std::chrono::duration_cast<std::chrono::nanoseconds>(bench_clock::now() - start).count()));
+                }
+            }
+        });
+    }
+    while (ready.load() != threads) {
+        std::this_thread::yield();
+    }
+    auto begin = bench_clock::now();
+    go.store(true, std::memory_order_release);
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    double seconds = std::chrono::duration<double>(bench_clock::now() - begin).count();
+
+    std::vector<std::uint64_t> all;
+    for (auto& samples : latencies) {
+        all.insert(all.end(), samples.begin(), samples.end());
+    }
+    std::sort(all.begin(), all.end());
+
+    std::size_t operations = config.ops * threads;
+    return {w.container, w.policy, distribution, threads, read_percent, operations, seconds,
+            seconds > 0 ? static_cast<double>(operations) / seconds : 0.0,
+            percentile(all, 0.50), percentile(all, 0.99), percentile(all, 0.999),
+            all.empty() ? 0 : all.back()};
+}
+
+// ==================== 输出 ====================
+
+void print_table_header() {
+    std::cout << std::left << std::setw(16) << "container" << std::setw(14) << "policy" << std::setw(9) << "dist"
+              << std::right << std::setw(8) << "threads" << std::setw(7) << "read%" << std::setw(12) << "Mops/s"
+              << std::setw(10) << "p50 ns" << std::setw(10) << "p99 ns" << std::setw(11) << "p999 ns"
+              << std::setw(11) << "max ns" << "\n";
+}
+
+void print_table_row(const bench_result& r) {
+    std::cout << std::left << std::setw(16) << r.container << std::setw(14) << r.policy << std::setw(9)
+              << r.distribution << std::right << std::setw(8) << r.threads << std::setw(7) << r.read_percent
+              << std::fixed << std::setprecision(3) << std::setw(12) << r.ops_per_sec / 1e6
+              << std::setw(10) << r.p50_ns << std::setw(10) << r.p99_ns << std::setw(11) << r.p999_ns
+              << std::setw(11) << r.max_ns << std::endl;
+}
+
+void write_csv(std::ostream& os, const std::vector<bench_result>& results) {
+    os << "container,policy,distribution,threads,read_percent,operations,seconds,ops_per_sec,"
+          "p50_ns,p99_ns,p999_ns,max_ns\n";
+    for (const auto& r : results) {
+        os << r.container << "," << r.policy << "," << r.distribution << "," << r.threads << ","
+           << r.read_percent << "," << r.operations << "," << std::setprecision(9) << r.seconds << ","
+           << std::setprecision(1) << std::fixed << r.ops_per_sec << std::defaultfloat << ","
+           << r.p50_ns << "," << r.p99_ns << "," << r.p999_ns << "," << r.max_ns << "\n";
+    }
+}
+
+void write_json(std::ostream& os, const run_config& config, const std::vector<bench_result>& results) {
+    os << "{\n  \"meta\": {\n"
+       << "    \"hardware_threads\": " << std::thread::hardware_concurrency() << ",\n"
+#if defined(__VERSION__)
+       << "    \"compiler\": \"" << __VERSION__ << "\",\n"
+#endif
+       << "    \"simd\": \"" << simd::isa_name() << "\",\n"
+       << "    \"ops_per_thread\": " << config.ops << ",\n"
+       << "    \"keys\": " << config.keys << ",\n"
+       << "    \"zipf_theta\": " << config.zipf_theta << ",\n"
+       << "    \"latency_sample_interval\": " << config.sample << ",\n"
+       << "    \"pinned\": " << (config.pin ? "true" : "false") << "\n"
+       << "  },\n  \"results\": [\n";
+    for (std::size_t i = 0; i < results.size(); ++i) {
+        const auto& r = results[i];
+        os << "    {\"container\": \"" << r.container << "\", \"policy\": \"" << r.policy
+           << "\", \"distribution\": \"" << r.distribution << "\", \"threads\": " << r.threads
+           << ", \"read_percent\": " << r.read_percent << ", \"operations\": " << r.operations
+           << ", \"seconds\": " << std::setprecision(9) << r.seconds
+           << ", \"ops_per_sec\": " << std::setprecision(1) << std::fixed << r.ops_per_sec << std::defaultfloat
+           << ", \"p50_ns\": " << r.p50_ns << ", \"p99_ns\": " << r.p99_ns << ", \"p999_ns\": " << r.p999_ns
+           << ", \"max_ns\": " << r.max_ns << "}" << (i + 1 < results.size() ? "," : "") << "\n";
+    }
+    os << "  ]\n}\n";
+}
+
+// ==================== 命令行解析 ====================
+
+std::vector<std::string> split_list(const std::string& text) {
+    std::vector<std::string> out;
+    std::stringstream ss(text);
+    std::string item;
+    while (std::getline(ss, item, ',')) {
+        if (!item.empty()) {
+            out.push_back(item);
+        }
+    }
+    return out;
+}
+
+run_config parse_args(int argc, char** argv) {
+    run_config config;
+    auto value = [&](int& i) -> std::string {
+        if (i + 1 >= argc) {
+            throw std::invalid_argument(std::string("missing value for ") + argv[i]);
+        }
+        return argv[++i];
+    };
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--filter") {
+            config.filters.push_back(value(i));
+        } else if (arg == "--threads") {
+            config.threads.clear();
+            for (const auto& item : split_list(value(i))) {
+                config.threads.push_back(std::stoul(item));
+            }
+        } else if (arg == "--dist") {
+            config.distributions = split_list(value(i));
+        } else if (arg == "--zipf-theta") {
+            config.zipf_theta = std::stod(value(i));
+        } else if (arg == "--read") {
+            config.read_percents.clear();
+            for (const auto& item : split_list(value(i))) {
+                config.read_percents.push_back(std::stoi(item));
+            }
+        } else if (arg == "--ops") {
+            config.ops = std::stoul(value(i));
+        } else if (arg == "--keys") {
+            config.keys = static_cast<std::uint32_t>(std::stoul(value(i)));
+        } else if (arg == "--sample") {
+            config.sample = std::max<std::size_t>(1, std::stoul(value(i)));
+        } else if (arg == "--pin") {
+            config.pin = true;
+        } else if (arg == "--json") {
+            config.json_path = value(i);
+        } else if (arg == "--csv") {
+            config.csv_path = value(i);
+        } else if (arg == "--quiet") {
+            config.quiet = true;
+        } else if (arg == "--list") {
+            config.list_only = true;
+        } else {
+            throw std::invalid_argument("unknown option " + arg);
+        }
+    }
+    for (const auto& dist : config.distributions) {
+        if (dist != "uniform" && dist != "zipf") {
+            throw std::invalid_argument("unknown distribution " + dist);
+        }
+    }
+    if (config.zipf_theta <= 0.0 || config.zipf_theta >= 1.0) {
+        throw std::invalid_argument("--zipf-theta must be in (0, 1)");
+    }
+    if (config.keys < 2 || config.keys >= write_flag) {
+        throw std::invalid_argument("--keys must be in [2, 2^31)");
+    }
+    return config;
+}
+
+bool matches(const workload& w, const run_config& config) {
+    if (config.filters.empty()) {
+        return true;
+    }
+    std::string name = w.name();
+    return std::any_of(config.filters.begin(), config.filters.end(),
+                       [&name](const std::string& f) { return name.find(f) != std::string::npos; });
+}
+
+int main(int argc, char** argv) {
+    run_config config;
+    try {
+        config = parse_args(argc, argv);
+    } catch (const std::exception& e) {
+        std::cerr << "benchmark_suite: " << e.what() << "\n";
+        return 2;
+    }
+
+    auto registry = workload_registry();
+    if (config.list_only) {
+        for (const auto& w : registry) {
+            if (matches(w, config)) {
+                std::cout << w.name() << (w.thread_safe ? "" : " (single thread only)") << "\n";
+            }
+        }
+        return 0;
+    }
+
+    // zeta(n) 的计算与键空间大小成正比，所有工作负载共用一个生成器
+    zipf_generator zipf(config.keys, config.zipf_theta);
+
+    std::vector<bench_result> results;
+    if (!config.quiet) {
+        print_table_header();
+    }
+    for (const auto& w : registry) {
+        if (!matches(w, config)) {
+            continue;
+        }
+        for (const auto& distribution : config.distributions) {
+            for (std::size_t threads : config.threads) {
+                // 无锁策略不是线程安全的，只测单线程
+                if (threads == 0 || (!w.thread_safe && threads != 1)) {
+                    continue;
+                }
+                for (int read_percent : config.read_percents) {
+                    results.push_back(run_one(w, config, distribution, distribution == "zipf" ? &zipf : nullptr,
+                                              threads, read_percent));
+                    if (!config.quiet) {
+                        print_table_row(results.back());
+                    }
+                }
+            }
+        }
+    }
+
+    if (!config.json_path.empty()) {
+        std::ofstream out(config.json_path);
+        write_json(out, config, results);
+    }
+    if (!config.csv_path.empty()) {
+        std::ofstream out(config.csv_path);
+        write_csv(out, results);
+    }
+    return 0;
+}
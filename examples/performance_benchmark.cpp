@@ -1,4 +1,5 @@
 #include "../include/ts_stl.hpp"
+#include <algorithm>
 #include <iostream>
 #include <vector>
 #include <chrono>
@@ -9,6 +10,17 @@
 #include <string>
 #include <sstream>
 #include <map>
+#include <unordered_map>
+#include <list>
+#include <queue>
+#include <functional>
+#include <atomic>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
 
 using namespace ts_stl;
 using namespace std::chrono;
@@ -271,6 +283,29 @@ void run_concurrent_write_benchmarks(std::vector<BenchmarkResult>& results) {
         results.push_back(result);
     }
     
+    // 测试 concurrent_vector（fetch_add 预留槽位，段不移动）
+    {
+        vectorConcurrent<int> vec;
+        auto result = benchmark_concurrent_write(
+            "concurrent_vector",
+            [&]() {
+                std::vector<std::thread> threads;
+                for (size_t t = 0; t < NUM_THREADS; ++t) {
+                    threads.emplace_back([&, t]() {
+                        for (size_t i = 0; i < MULTI_THREAD_OPS; ++i) {
+                            vec.push_back(static_cast<int>(t * MULTI_THREAD_OPS + i));
+                        }
+                    });
+                }
+                for (auto& thread : threads) {
+                    thread.join();
+                }
+            },
+            [&]() { return validate_sequential_write(vec, MULTI_THREAD_OPS * NUM_THREADS); }
+        );
+        results.push_back(result);
+    }
+    
 #if TS_STL_SUPPORT_RW_LOCK
     // 测试 vectorRW
     {
@@ -855,6 +890,357 @@ void run_mixed_read_write_50_50_benchmarks(std::vector<BenchmarkResult>& results
 #endif
 }
 
+// ==================== Unordered Map 混合读写扩展性测试（50:50） ====================
+
+template <typename MapType>
+BenchmarkResult benchmark_unordered_map_mixed_50_50(const std::string& container_name,
+                                                    size_t thread_count) {
+    constexpr size_t KEY_SPACE = 100000;
+    
+    MapType map;
+    for (size_t i = 0; i < KEY_SPACE; ++i) {
+        map.set(i, i);
+    }
+    std::atomic<size_t> sum{0};
+    
+    PerformanceTimer timer;
+    timer.start();
+    
+    // 每个线程交替执行写入和读取，key 跨线程交错以制造真实竞争
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < thread_count; ++t) {
+        threads.emplace_back([&, t]() {
+            size_t local_sum = 0;
+            size_t key = t * 7919;
+            for (size_t i = 0; i < MULTI_THREAD_OPS; ++i) {
+                key = (key + 104729) % KEY_SPACE;
+                if (i % 2 == 0) {
+                    map.set(key, i);
+                } else {
+                    local_sum += map.get(key, 0);
+                }
+            }
+            sum += local_sum;
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    
+    double time = timer.stop();
+    
+    return {
+        "Unordered Map Mixed R/W (50:50) x" + std::to_string(thread_count) + " threads",
+        container_name,
+        time,
+        MULTI_THREAD_OPS * thread_count,
+        map.size() == KEY_SPACE
+    };
+}
+
+void run_unordered_map_mixed_50_50_benchmarks(std::vector<BenchmarkResult>& results) {
+    print_section_header("Unordered Map 多线程混合读写扩展性测试（50%读 + 50%写）");
+    
+    for (size_t thread_count : {1, 2, 4, 8, 16, 32}) {
+        std::vector<BenchmarkResult> round;
+        round.push_back(benchmark_unordered_map_mixed_50_50<
+            unordered_mapMutex<size_t, size_t>>("unordered_mapMutex", thread_count));
+#if TS_STL_SUPPORT_RW_LOCK
+        round.push_back(benchmark_unordered_map_mixed_50_50<
+            unordered_mapRW<size_t, size_t>>("unordered_mapRW", thread_count));
+#endif
+        round.push_back(benchmark_unordered_map_mixed_50_50<
+            sharded_unordered_mapMutex<size_t, size_t>>("sharded_unordered_mapMutex", thread_count));
+        round.push_back(benchmark_unordered_map_mixed_50_50<
+            flat_unordered_mapMutex<size_t, size_t>>("flat_unordered_mapMutex", thread_count));
+        
+        std::cout << "\n线程数: " << thread_count << "\n";
+        for (const auto& result : round) {
+            std::cout << std::fixed << std::setprecision(2);
+            std::cout << "  " << std::left << std::setw(32) << result.container_type
+                      << result.time_ms << "ms, " << std::setprecision(0)
+                      << result.ops_per_ms() << " ops/ms\n";
+            results.push_back(result);
+        }
+    }
+}
+
+// ==================== 小型POD读扩展性测试 ====================
+
+struct ConfigSnapshot {
+    size_t version;
+    size_t limit;
+    size_t timeout_ms;
+    size_t flags;
+};
+
+/**
+ * @brief 多线程反复读取少量 POD 配置（每 1000 次读对应一次写）
+ */
+template <typename ReadFunc, typename WriteFunc>
+BenchmarkResult benchmark_pod_read_scaling(const std::string& container_name, size_t thread_count,
+                                           ReadFunc read, WriteFunc write) {
+    std::atomic<size_t> sum{0};
+    
+    PerformanceTimer timer;
+    timer.start();
+    
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < thread_count; ++t) {
+        threads.emplace_back([&, t]() {
+            size_t local_sum = 0;
+            for (size_t i = 0; i < MULTI_THREAD_OPS; ++i) {
+                if (t == 0 && i % 1000 == 0) {
+                    write(ConfigSnapshot{i, i + 1, i + 2, i + 3});
+                } else {
+                    ConfigSnapshot c = read();
+                    local_sum += c.limit - c.version;
+                }
+            }
+            sum += local_sum;
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    
+    double time = timer.stop();
+    
+    // 每次读取都应看到一致的快照，即 limit - version == 1
+    size_t reads = MULTI_THREAD_OPS * thread_count - (MULTI_THREAD_OPS + 999) / 1000;
+    return {
+        "POD Read Scaling x" + std::to_string(thread_count) + " threads",
+        container_name,
+        time,
+        MULTI_THREAD_OPS * thread_count,
+        sum == reads
+    };
+}
+
+void run_pod_read_scaling_benchmarks(std::vector<BenchmarkResult>& results) {
+    print_section_header("小型POD读扩展性测试（SeqLock vs Mutex / ReadWrite / ReaderBiased）");
+    
+    const ConfigSnapshot initial{0, 1, 2, 3};
+    for (size_t thread_count : {1, 2, 4, 8, 16, 32, 64, 128}) {
+        std::vector<BenchmarkResult> round;
+        {
+            // get() 返回引用，需在锁内完成拷贝才能得到一致快照
+            vectorMutex<ConfigSnapshot> config(1, initial);
+            round.push_back(benchmark_pod_read_scaling("vectorMutex", thread_count,
+                [&]() {
+                    ConfigSnapshot c;
+                    config.with_write_lock([&](auto& v) { c = v.unsafe_ref()[0]; });
+                    return c;
+                },
+                [&](const ConfigSnapshot& c) { config.set(0, c); }));
+        }
+#if TS_STL_SUPPORT_RW_LOCK
+        {
+            vectorRW<ConfigSnapshot> config(1, initial);
+            round.push_back(benchmark_pod_read_scaling("vectorRW", thread_count,
+                [&]() {
+                    ConfigSnapshot c;
+                    config.with_read_lock([&](const auto& v) { c = v.unsafe_ref()[0]; });
+                    return c;
+                },
+                [&](const ConfigSnapshot& c) { config.set(0, c); }));
+        }
+        {
+            vectorReaderBiased<ConfigSnapshot> config(1, initial);
+            round.push_back(benchmark_pod_read_scaling("vectorReaderBiased", thread_count,
+                [&]() {
+                    ConfigSnapshot c;
+                    config.with_read_lock([&](const auto& v) { c = v.unsafe_ref()[0]; });
+                    return c;
+                },
+                [&](const ConfigSnapshot& c) { config.set(0, c); }));
+        }
+#endif
+        {
+            seqlock<ConfigSnapshot> config(initial);
+            round.push_back(benchmark_pod_read_scaling("seqlock", thread_count,
+                [&]() { return config.load(); },
+                [&](const ConfigSnapshot& c) { config.store(c); }));
+        }
+        
+        std::cout << "\n线程数: " << thread_count << "\n";
+        for (const auto& result : round) {
+            std::cout << std::fixed << std::setprecision(2);
+            std::cout << "  " << std::left << std::setw(20) << result.container_type
+                      << result.time_ms << "ms, " << std::setprecision(0)
+                      << result.ops_per_ms() << " ops/ms"
+                      << (result.data_valid ? "" : " (INVALID)") << "\n";
+            results.push_back(result);
+        }
+    }
+}
+
+// ==================== 队列交接测试 ====================
+
+/**
+ * @brief 生产者/消费者交接吞吐：producers 个线程写入，consumers 个线程取出
+ */
+template <typename PushFunc, typename PopFunc>
+BenchmarkResult benchmark_queue_handoff(const std::string& container_name,
+                                        size_t producers, size_t consumers,
+                                        PushFunc push, PopFunc pop) {
+    const size_t total = MULTI_THREAD_OPS * producers;
+    std::atomic<size_t> received{0};
+    std::atomic<size_t> sum{0};
+    
+    PerformanceTimer timer;
+    timer.start();
+    
+    std::vector<std::thread> threads;
+    for (size_t c = 0; c < consumers; ++c) {
+        threads.emplace_back([&]() {
+            size_t local_sum = 0;
+            size_t value = 0;
+            while (received.load(std::memory_order_relaxed) < total) {
+                if (pop(value)) {
+                    local_sum += value;
+                    received.fetch_add(1, std::memory_order_relaxed);
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+            sum += local_sum;
+        });
+    }
+    for (size_t p = 0; p < producers; ++p) {
+        threads.emplace_back([&]() {
+            for (size_t i = 0; i < MULTI_THREAD_OPS; ++i) {
+                while (!push(i)) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    
+    double time = timer.stop();
+    
+    return {
+        "Queue Handoff " + std::to_string(producers) + "P/" + std::to_string(consumers) + "C",
+        container_name,
+        time,
+        total,
+        sum == producers * (MULTI_THREAD_OPS * (MULTI_THREAD_OPS - 1) / 2)
+    };
+}
+
+void run_queue_handoff_benchmarks(std::vector<BenchmarkResult>& results) {
+    print_section_header("队列交接测试（Ring Buffer vs Deque vs 细粒度 List）");
+    
+    constexpr size_t RING_CAPACITY = 1024;
+    std::vector<BenchmarkResult> round;
+    
+    {
+        ring_bufferSPSC<size_t> rb(RING_CAPACITY);
+        round.push_back(benchmark_queue_handoff("ring_bufferSPSC", 1, 1,
+            [&](size_t v) { return rb.try_push(v); },
+            [&](size_t& v) { return rb.try_pop(v); }));
+    }
+    for (size_t threads : {1, 4}) {
+        {
+            ring_bufferMPMC<size_t> rb(RING_CAPACITY);
+            round.push_back(benchmark_queue_handoff("ring_bufferMPMC", threads, threads,
+                [&](size_t v) { return rb.try_push(v); },
+                [&](size_t& v) { return rb.try_pop(v); }));
+        }
+        {
+            dequeSpinLock<size_t> dq;
+            round.push_back(benchmark_queue_handoff("dequeSpinLock", threads, threads,
+                [&](size_t v) { dq.push_back(v); return true; },
+                [&](size_t& v) { return dq.try_pop_front(v); }));
+        }
+        {
+            dequeMutex<size_t> dq;
+            round.push_back(benchmark_queue_handoff("dequeMutex", threads, threads,
+                [&](size_t v) { dq.push_back(v); return true; },
+                [&](size_t& v) { return dq.try_pop_front(v); }));
+        }
+        {
+            // 每节点加锁：队尾插入与队首弹出锁的是不同节点
+            listConcurrent<size_t> cl;
+            round.push_back(benchmark_queue_handoff("listConcurrent", threads, threads,
+                [&](size_t v) { cl.push_back(v); return true; },
+                [&](size_t& v) { return cl.try_pop_front(v); }));
+        }
+    }
+    
+    for (const auto& result : round) {
+        std::cout << std::fixed << std::setprecision(2);
+        std::cout << "  " << std::left << std::setw(24) << result.test_name
+                  << std::setw(20) << result.container_type
+                  << result.time_ms << "ms, " << std::setprecision(0)
+                  << result.ops_per_ms() << " ops/ms"
+                  << (result.data_valid ? "" : " (INVALID)") << "\n";
+        results.push_back(result);
+    }
+}
+
+// ==================== 批量操作测试 ====================
+
+void run_bulk_insert_benchmarks(std::vector<BenchmarkResult>& results) {
+    print_section_header("批量插入测试（逐个加锁 vs 单次加锁）");
+    
+    constexpr size_t BATCH_SIZE = 10000;
+    constexpr size_t BATCHES = 20;
+    std::vector<std::pair<size_t, size_t>> batch;
+    batch.reserve(BATCH_SIZE);
+    for (size_t i = 0; i < BATCH_SIZE; ++i) {
+        batch.emplace_back(i, i);
+    }
+    
+    auto run = [&](const std::string& name, auto&& ingest) {
+        PerformanceTimer timer;
+        size_t final_size = 0;
+        timer.start();
+        for (size_t b = 0; b < BATCHES; ++b) {
+            final_size = ingest();
+        }
+        double time = timer.stop();
+        BenchmarkResult result{"Bulk Insert 10k x" + std::to_string(BATCHES), name, time,
+                               BATCH_SIZE * BATCHES, final_size == BATCH_SIZE};
+        std::cout << std::fixed << std::setprecision(2);
+        std::cout << "  " << std::left << std::setw(42) << name << time << "ms\n";
+        results.push_back(result);
+    };
+    
+    run("unordered_mapMutex insert (per item)", [&]() {
+        unordered_mapMutex<size_t, size_t> map;
+        for (const auto& kv : batch) {
+            map.insert(kv.first, kv.second);
+        }
+        return map.size();
+    });
+    run("unordered_mapMutex insert_bulk", [&]() {
+        unordered_mapMutex<size_t, size_t> map;
+        map.insert_bulk(batch);
+        return map.size();
+    });
+    run("mapMutex insert (per item)", [&]() {
+        mapMutex<size_t, size_t> map;
+        for (const auto& kv : batch) {
+            map.insert(kv.first, kv.second);
+        }
+        return map.size();
+    });
+    run("mapMutex insert_bulk", [&]() {
+        mapMutex<size_t, size_t> map;
+        map.insert_bulk(batch);
+        return map.size();
+    });
+    run("sharded_unordered_mapMutex insert_bulk", [&]() {
+        sharded_unordered_mapMutex<size_t, size_t> map;
+        map.insert_bulk(batch);
+        return map.size();
+    });
+}
+
 // ==================== 结果输出 ====================
 
 void print_results_table(const std::vector<BenchmarkResult>& results) {
@@ -958,6 +1344,67 @@ void generate_markdown_summary(const std::vector<BenchmarkResult>& results) {
 
 // ==================== Map 性能基准测试 ====================
 
+// ==================== 扁平哈希表对比测试 ====================
+
+/**
+ * @brief 单线程插入 + 命中查找 + 未命中查找，对比节点式与扁平哈希表
+ */
+template <typename MapType>
+void benchmark_hash_map_backend(const std::string& name, size_t count, std::vector<BenchmarkResult>& results) {
+    MapType map;
+    PerformanceTimer timer;
+    
+    timer.start();
+    for (size_t i = 0; i < count; ++i) {
+        map.insert((i * 2654435761u) & 0xffffffffu, i);
+    }
+    double insert_time = timer.stop();
+    
+    // 查找顺序与插入顺序不同，避免节点按分配顺序连续排列带来的虚假局部性
+    size_t hits = 0;
+    timer.start();
+    for (size_t i = 0; i < count; ++i) {
+        size_t k = (i * 7919) % count;
+        hits += map.contains((k * 2654435761u) & 0xffffffffu) ? 1 : 0;
+    }
+    double hit_time = timer.stop();
+    
+    size_t misses = 0;
+    timer.start();
+    for (size_t i = 0; i < count; ++i) {
+        // 高于 32 位的键一定不存在
+        size_t k = (i * 7919) % count;
+        misses += map.contains(((k * 2654435761u) & 0xffffffffu) + (size_t{1} << 32)) ? 0 : 1;
+    }
+    double miss_time = timer.stop();
+    
+    bool valid = map.size() == count && hits == count && misses == count;
+    results.push_back({"Hash Map Insert N=" + std::to_string(count), name, insert_time, count, valid});
+    results.push_back({"Hash Map Lookup Hit N=" + std::to_string(count), name, hit_time, count, valid});
+    results.push_back({"Hash Map Lookup Miss N=" + std::to_string(count), name, miss_time, count, valid});
+    
+    // 估算内存：节点式 = 桶指针 + 每元素（节点 + next 指针 + 约16字节 malloc 开销）；扁平式 = 每槽位（元素 + 1 控制字节）
+    using value_type = std::pair<const size_t, size_t>;
+    double bytes = std::is_same<MapType, unordered_mapLockFree<size_t, size_t>>::value
+        ? static_cast<double>(map.bucket_count() * sizeof(void*) + count * (sizeof(value_type) + sizeof(void*) + 16))
+        : static_cast<double>(map.bucket_count() * (sizeof(value_type) + 1));
+    
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "  " << std::left << std::setw(28) << name << "N=" << std::setw(9) << count
+              << "insert " << insert_time << "ms, hit " << hit_time << "ms, miss " << miss_time
+              << "ms, ~" << std::setprecision(1) << bytes / static_cast<double>(count) << " B/elem"
+              << (valid ? "" : " (INVALID)") << "\n";
+}
+
+void run_flat_map_benchmarks(std::vector<BenchmarkResult>& results) {
+    print_section_header("Unordered Map 后端对比（std::unordered_map vs 扁平哈希表）");
+    
+    for (size_t count : {SINGLE_THREAD_OPS / 10, SINGLE_THREAD_OPS, SINGLE_THREAD_OPS * 4}) {
+        benchmark_hash_map_backend<unordered_mapLockFree<size_t, size_t>>("unordered_mapLockFree", count, results);
+        benchmark_hash_map_backend<flat_unordered_mapLockFree<size_t, size_t>>("flat_unordered_mapLockFree", count, results);
+    }
+}
+
 void run_map_insert_benchmarks(std::vector<BenchmarkResult>& results) {
     print_section_header("Map 单线程插入性能测试");
     
@@ -1010,6 +1457,46 @@ void run_map_insert_benchmarks(std::vector<BenchmarkResult>& results) {
                   << (result.data_valid ? "✓" : "✗") << ")\n";
     }
 #endif
+    
+    // 大规模插入：insert 为 O(log n)，而 insert_indexed 需要 O(n) 计算下标
+    auto run_large = [&](const std::string& name, size_t count, auto&& insert_one) {
+        mapMutex<size_t, size_t> map;
+        PerformanceTimer timer;
+        timer.start();
+        for (size_t i = 0; i < count; ++i) {
+            // 乘法哈希在 32 位范围内是双射：键互不相同且插入顺序被打散
+            insert_one(map, (i * 2654435761u) & 0xffffffffu);
+        }
+        double time = timer.stop();
+        
+        BenchmarkResult result{
+            "Map Large Insert N=" + std::to_string(count),
+            name,
+            time,
+            count,
+            map.size() == count
+        };
+        results.push_back(result);
+        
+        std::cout << std::fixed << std::setprecision(2);
+        std::cout << "  " << std::left << std::setw(28) << result.test_name
+                  << std::setw(16) << name << time << "ms"
+                  << (result.data_valid ? "" : " (INVALID)") << "\n";
+    };
+    
+    for (size_t count : {SINGLE_THREAD_OPS / 10, SINGLE_THREAD_OPS, SINGLE_THREAD_OPS * 2}) {
+        run_large("insert", count, [](auto& map, size_t key) { map.insert(key, key); });
+    }
+    for (size_t count : {SINGLE_THREAD_OPS / 1000, SINGLE_THREAD_OPS / 100}) {
+        // 累加下标，避免编译器把未使用的 std::distance 优化掉
+        size_t index_sum = 0;
+        run_large("insert_indexed", count, [&](auto& map, size_t key) {
+            index_sum += map.insert_indexed(key, key).second;
+        });
+        if (index_sum == static_cast<size_t>(-1)) {
+            std::cout << index_sum;
+        }
+    }
 }
 
 void run_map_concurrent_insert_benchmarks(std::vector<BenchmarkResult>& results) {
@@ -1088,6 +1575,42 @@ void run_map_concurrent_insert_benchmarks(std::vector<BenchmarkResult>& results)
                   << map.size() << ", 正确: " << (result.data_valid ? "✓" : "✗") << ")\n";
     }
 #endif
+    
+    // 测试 mapConcurrent（跳表，只锁插入位置的前驱节点）
+    {
+        mapConcurrent<int, int> map;
+        
+        PerformanceTimer timer;
+        timer.start();
+        
+        std::vector<std::thread> threads;
+        for (size_t t = 0; t < NUM_THREADS; ++t) {
+            threads.emplace_back([&, t]() {
+                for (size_t i = 0; i < MULTI_THREAD_OPS / 10; ++i) {
+                    map.insert(static_cast<int>(t * (MULTI_THREAD_OPS / 10) + i), static_cast<int>(i * 2));
+                }
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        
+        double time = timer.stop();
+        size_t expected = NUM_THREADS * (MULTI_THREAD_OPS / 10);
+        
+        BenchmarkResult result{
+            "Map Concurrent Insert",
+            "mapConcurrent",
+            time,
+            expected,
+            map.size() == expected
+        };
+        results.push_back(result);
+        
+        std::cout << std::fixed << std::setprecision(2);
+        std::cout << result.container_type << ": " << time << "ms (大小: " 
+                  << map.size() << ", 正确: " << (result.data_valid ? "✓" : "✗") << ")\n";
+    }
 }
 
 void run_map_concurrent_read_benchmarks(std::vector<BenchmarkResult>& results) {
@@ -1177,11 +1700,834 @@ void run_map_concurrent_read_benchmarks(std::vector<BenchmarkResult>& results) {
         std::cout << std::fixed << std::setprecision(2);
         std::cout << result.container_type << ": " << time << "ms\n";
     }
+    
+    // 初始化 flat_mapRW（批量构建一次，之后只读）
+    {
+        flat_mapRW<int, int> map;
+        std::vector<std::pair<int, int>> items;
+        for (size_t i = 0; i < DATA_SIZE; ++i) {
+            items.emplace_back(static_cast<int>(i), static_cast<int>(i * 2));
+        }
+        map.insert_bulk(items);
+        
+        std::atomic<size_t> sum{0};
+        
+        PerformanceTimer timer;
+        timer.start();
+        
+        std::vector<std::thread> threads;
+        for (size_t t = 0; t < READ_HEAVY_THREADS; ++t) {
+            threads.emplace_back([&]() {
+                size_t local_sum = 0;
+                for (size_t i = 0; i < MULTI_THREAD_OPS; ++i) {
+                    local_sum += static_cast<size_t>(map.get(static_cast<int>(i % DATA_SIZE), 0));
+                }
+                sum += local_sum;
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        
+        double time = timer.stop();
+        
+        BenchmarkResult result{
+            "Map Concurrent Read",
+            "flat_mapRW",
+            time,
+            READ_HEAVY_THREADS * MULTI_THREAD_OPS,
+            sum > 0
+        };
+        results.push_back(result);
+        
+        std::cout << std::fixed << std::setprecision(2);
+        std::cout << result.container_type << ": " << time << "ms\n";
+    }
 #endif
+    
+    // 初始化 snapshot_map（每个线程使用读者句柄）
+    {
+        snapshot_map<int, int> map;
+        map.update([&](auto& m) {
+            for (size_t i = 0; i < DATA_SIZE; ++i) {
+                m[static_cast<int>(i)] = static_cast<int>(i * 2);
+            }
+        });
+        
+        std::atomic<size_t> sum{0};
+        
+        PerformanceTimer timer;
+        timer.start();
+        
+        std::vector<std::thread> threads;
+        for (size_t t = 0; t < READ_HEAVY_THREADS; ++t) {
+            threads.emplace_back([&]() {
+                auto reader = map.get_reader();
+                size_t local_sum = 0;
+                for (size_t i = 0; i < MULTI_THREAD_OPS; ++i) {
+                    const auto& m = reader.get();
+                    auto it = m.find(static_cast<int>(i % DATA_SIZE));
+                    local_sum += it != m.end() ? static_cast<size_t>(it->second) : 0;
+                }
+                sum += local_sum;
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        
+        double time = timer.stop();
+        
+        BenchmarkResult result{
+            "Map Concurrent Read",
+            "snapshot_map",
+            time,
+            READ_HEAVY_THREADS * MULTI_THREAD_OPS,
+            sum > 0
+        };
+        results.push_back(result);
+        
+        std::cout << std::fixed << std::setprecision(2);
+        std::cout << result.container_type << ": " << time << "ms\n";
+    }
+}
+
+/**
+ * @brief 小区间扫描：copy() 后扫描 vs 读锁内 range()
+ */
+void run_map_range_scan_benchmarks(std::vector<BenchmarkResult>& results) {
+    print_section_header("Map 区间扫描性能测试（copy + 扫描 vs range）");
+    
+    constexpr int DATA_SIZE = 100000;
+    constexpr int SCANS = 200;
+    constexpr int WIDTH = 100;
+    
+    mapMutex<int, int> map;
+    for (int i = 0; i < DATA_SIZE; ++i) {
+        map.insert(i, i);
+    }
+    
+    PerformanceTimer timer;
+    long long copy_sum = 0;
+    timer.start();
+    for (int s = 0; s < SCANS; ++s) {
+        int lo = (s * 7919) % (DATA_SIZE - WIDTH);
+        auto snapshot = map.copy();
+        for (auto it = snapshot.lower_bound(lo); it != snapshot.end() && it->first < lo + WIDTH; ++it) {
+            copy_sum += it->second;
+        }
+    }
+    double copy_time = timer.stop();
+    
+    long long range_sum = 0;
+    timer.start();
+    for (int s = 0; s < SCANS; ++s) {
+        int lo = (s * 7919) % (DATA_SIZE - WIDTH);
+        map.range(lo, lo + WIDTH, [&range_sum](const int&, const int& v) { range_sum += v; });
+    }
+    double range_time = timer.stop();
+    
+    bool valid = copy_sum == range_sum;
+    results.push_back({"Map Range Scan", "mapMutex copy()", copy_time, static_cast<size_t>(SCANS), valid});
+    results.push_back({"Map Range Scan", "mapMutex range()", range_time, static_cast<size_t>(SCANS), valid});
+    
+    std::cout << std::fixed << std::setprecision(3);
+    std::cout << "copy() + scan: " << copy_time << "ms\n";
+    std::cout << "range():       " << range_time << "ms" << (valid ? "" : " (INVALID)") << "\n";
+}
+
+void run_parallel_scan_benchmarks(std::vector<BenchmarkResult>& results) {
+    print_section_header("Vector 全量扫描性能测试（for_each vs parallel_reduce）");
+    
+    constexpr size_t DATA_SIZE = 10000000;
+    constexpr int SCANS = 5;
+    
+    vectorRW<float> samples;
+    samples.reserve(DATA_SIZE);
+    for (size_t i = 0; i < DATA_SIZE; ++i) {
+        samples.push_back(static_cast<float>(i % 1000) * 0.001f);
+    }
+    
+    PerformanceTimer timer;
+    double sequential_sum = 0;
+    timer.start();
+    for (int s = 0; s < SCANS; ++s) {
+        samples.for_each([&sequential_sum](float x) { sequential_sum += x; });
+    }
+    double sequential_time = timer.stop();
+    
+    double parallel_sum = 0;
+    timer.start();
+    for (int s = 0; s < SCANS; ++s) {
+        parallel_sum += samples.parallel_reduce(0.0, [](double acc, float x) { return acc + x; },
+                                                [](double a, double b) { return a + b; });
+    }
+    double parallel_time = timer.stop();
+    
+    // 分段求和改变了浮点加法顺序，按相对误差校验
+    bool valid = std::abs(sequential_sum - parallel_sum) <= 1e-6 * sequential_sum;
+    size_t ops = DATA_SIZE * static_cast<size_t>(SCANS);
+    results.push_back({"Vector Full Scan", "vectorRW for_each", sequential_time, ops, valid});
+    results.push_back({"Vector Full Scan", "vectorRW parallel_reduce", parallel_time, ops, valid});
+    
+    std::cout << std::fixed << std::setprecision(3);
+    std::cout << "for_each:        " << sequential_time << "ms\n";
+    std::cout << "parallel_reduce: " << parallel_time << "ms (" << std::thread::hardware_concurrency()
+              << " 硬件线程)" << (valid ? "" : " (INVALID)") << "\n";
+}
+
+void run_simd_scan_benchmarks(std::vector<BenchmarkResult>& results) {
+    print_section_header(std::string("Vector 算术类型扫描（SIMD: ") + simd::isa_name() + " vs 通用谓词）");
+    
+    constexpr size_t DATA_SIZE = 10000000;
+    constexpr int SCANS = 10;
+    
+    vectorRW<int> values;
+    values.reserve(DATA_SIZE);
+    for (size_t i = 0; i < DATA_SIZE; ++i) {
+        values.push_back(static_cast<int>(i % 1000));
+    }
+    const int missing = -1;
+    const size_t ops = DATA_SIZE * static_cast<size_t>(SCANS);
+    
+    // 查找不存在的值：contains 走 SIMD 内核，find_if 逐元素调用谓词
+    PerformanceTimer timer;
+    size_t found = 0;
+    timer.start();
+    for (int s = 0; s < SCANS; ++s) {
+        found += values.contains(missing) ? 1 : 0;
+    }
+    double simd_find_time = timer.stop();
+    
+    timer.start();
+    for (int s = 0; s < SCANS; ++s) {
+        auto guard = values.acquire_read_guard();
+        const auto& raw = values.unsafe_ref();
+        found += std::find_if(raw.begin(), raw.end(), [missing](int x) { return x == missing; }) != raw.end() ? 1 : 0;
+    }
+    double scalar_find_time = timer.stop();
+    
+    size_t simd_count = 0;
+    timer.start();
+    for (int s = 0; s < SCANS; ++s) {
+        simd_count += values.count(7);
+    }
+    double simd_count_time = timer.stop();
+    
+    size_t scalar_count = 0;
+    timer.start();
+    for (int s = 0; s < SCANS; ++s) {
+        values.for_each([&scalar_count](int x) { scalar_count += x == 7 ? 1 : 0; });
+    }
+    double scalar_count_time = timer.stop();
+    
+    bool valid = found == 0 && simd_count == scalar_count;
+    results.push_back({"Vector Find (missing)", "vectorRW contains", simd_find_time, ops, valid});
+    results.push_back({"Vector Find (missing)", "vectorRW find_if", scalar_find_time, ops, valid});
+    results.push_back({"Vector Count", "vectorRW count", simd_count_time, ops, valid});
+    results.push_back({"Vector Count", "vectorRW for_each", scalar_count_time, ops, valid});
+    
+    std::cout << std::fixed << std::setprecision(3);
+    std::cout << "contains: " << simd_find_time << "ms, find_if: " << scalar_find_time << "ms\n";
+    std::cout << "count:    " << simd_count_time << "ms, for_each: " << scalar_count_time << "ms"
+              << (valid ? "" : " (INVALID)") << "\n";
 }
 
 // ==================== 主函数 ====================
 
+// 线程数为硬件线程数的 2 倍：持锁线程经常被调度出去，纯自旋的等待者会空耗整个时间片
+template <LockPolicy Policy>
+BenchmarkResult benchmark_oversubscribed_push_back(const std::string& container_name, size_t threads) {
+    vector<size_t, Policy> vec;
+    PerformanceTimer timer;
+    timer.start();
+    std::vector<std::thread> workers;
+    for (size_t t = 0; t < threads; ++t) {
+        workers.emplace_back([&vec, t]() {
+            for (size_t i = 0; i < MULTI_THREAD_OPS; ++i) {
+                vec.push_back(t * MULTI_THREAD_OPS + i);
+            }
+        });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    double time = timer.stop();
+    return {"Oversubscribed Push Back", container_name, time, MULTI_THREAD_OPS * threads,
+            vec.size() == MULTI_THREAD_OPS * threads};
+}
+
+void run_oversubscribed_lock_benchmarks(std::vector<BenchmarkResult>& results) {
+    const size_t threads = std::max<size_t>(4, 2 * std::thread::hardware_concurrency());
+    print_section_header("超额订阅锁竞争测试（" + std::to_string(threads) + " 线程）");
+    
+    std::vector<BenchmarkResult> section = {
+        benchmark_oversubscribed_push_back<LockPolicy::Mutex>("vectorMutex", threads),
+        benchmark_oversubscribed_push_back<LockPolicy::SpinLock>("vectorSpinLock", threads),
+        benchmark_oversubscribed_push_back<LockPolicy::Adaptive>("vectorAdaptive", threads),
+        benchmark_oversubscribed_push_back<LockPolicy::Ticket>("vector<Ticket>", threads),
+    };
+    std::cout << std::fixed << std::setprecision(3);
+    for (const auto& result : section) {
+        std::cout << std::left << std::setw(18) << result.container_type << result.time_ms << "ms"
+                  << (result.data_valid ? "" : " (INVALID)") << "\n";
+        results.push_back(result);
+    }
+}
+
+// 每线程一个分箱：std::array 中相邻 vector 的锁和指针挤在同一缓存行，array_of 为每个分箱单独占行
+template <typename Bins>
+double benchmark_per_thread_bins(Bins& bins) {
+    PerformanceTimer timer;
+    timer.start();
+    std::vector<std::thread> workers;
+    for (size_t t = 0; t < NUM_THREADS; ++t) {
+        workers.emplace_back([&bins, t]() {
+            auto& bin = bins[t];
+            for (size_t i = 0; i < MULTI_THREAD_OPS; ++i) {
+                bin.push_back(t);
+                if (bin.size() > 1024) {
+                    bin.clear();
+                }
+            }
+        });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    return timer.stop();
+}
+
+void run_false_sharing_benchmarks(std::vector<BenchmarkResult>& results) {
+    print_section_header("每线程分箱伪共享测试（std::array vs array_of）");
+    
+    std::array<vectorSpinLock<size_t>, NUM_THREADS> packed;
+    array_of<vectorSpinLock<size_t>, NUM_THREADS> padded;
+    double packed_time = benchmark_per_thread_bins(packed);
+    double padded_time = benchmark_per_thread_bins(padded);
+    
+    size_t ops = MULTI_THREAD_OPS * NUM_THREADS;
+    results.push_back({"Per-Thread Bins", "std::array<vectorSpinLock>", packed_time, ops, true});
+    results.push_back({"Per-Thread Bins", "array_of<vectorSpinLock>", padded_time, ops, true});
+    
+    std::cout << std::fixed << std::setprecision(3);
+    std::cout << "std::array: " << packed_time << "ms (sizeof vector = " << sizeof(vectorSpinLock<size_t>) << ")\n";
+    std::cout << "array_of:   " << padded_time << "ms\n";
+}
+
+/**
+ * @brief 批量刷出：copy() + clear() vs drain()，以及热/冷两层 map 之间的迁移
+ */
+void run_flush_benchmarks(std::vector<BenchmarkResult>& results) {
+    print_section_header("批量刷出与分层迁移测试（copy + clear vs drain / merge_from）");
+    
+    constexpr int BATCH = 10000;
+    constexpr int ROUNDS = 200;
+    
+    vectorMutex<int> buffer;
+    PerformanceTimer timer;
+    double copy_time = 0;
+    double drain_time = 0;
+    long long copy_sum = 0;
+    long long drain_sum = 0;
+    for (int r = 0; r < ROUNDS; ++r) {
+        for (int i = 0; i < BATCH; ++i) {
+            buffer.push_back(i);
+        }
+        timer.start();
+        std::vector<int> batch = buffer.copy();
+        buffer.clear();
+        copy_time += timer.stop();
+        copy_sum += batch.back();
+        
+        for (int i = 0; i < BATCH; ++i) {
+            buffer.push_back(i);
+        }
+        timer.start();
+        std::vector<int> drained = buffer.drain();
+        drain_time += timer.stop();
+        drain_sum += drained.back();
+    }
+    bool flush_valid = copy_sum == drain_sum && buffer.empty();
+    results.push_back({"Vector Flush", "vectorMutex copy()+clear()", copy_time, static_cast<size_t>(ROUNDS), flush_valid});
+    results.push_back({"Vector Flush", "vectorMutex drain()", drain_time, static_cast<size_t>(ROUNDS), flush_valid});
+    
+    // 热层整体迁往冷层：逐个复制插入再清空 vs 节点 merge
+    auto fill = [](unordered_mapMutex<int, std::string>& hot, int round) {
+        for (int i = 0; i < BATCH; ++i) {
+            hot.insert(round * BATCH + i, "value");
+        }
+    };
+    unordered_mapMutex<int, std::string> hot;
+    unordered_mapMutex<int, std::string> cold_copy;
+    unordered_mapMutex<int, std::string> cold_merge;
+    double copy_migrate_time = 0;
+    double merge_time = 0;
+    constexpr int TIERS = 20;
+    for (int r = 0; r < TIERS; ++r) {
+        fill(hot, r);
+        timer.start();
+        cold_copy.insert_bulk(hot.copy());
+        hot.clear();
+        copy_migrate_time += timer.stop();
+        
+        fill(hot, r);
+        timer.start();
+        cold_merge.merge_from(hot);
+        merge_time += timer.stop();
+    }
+    bool migrate_valid = cold_copy.size() == cold_merge.size() && hot.empty();
+    size_t migrated = static_cast<size_t>(BATCH) * TIERS;
+    results.push_back({"Tier Migration", "unordered_mapMutex copy+insert", copy_migrate_time, migrated, migrate_valid});
+    results.push_back({"Tier Migration", "unordered_mapMutex merge_from", merge_time, migrated, migrate_valid});
+    
+    std::cout << std::fixed << std::setprecision(3);
+    std::cout << "copy()+clear(): " << copy_time << "ms\n";
+    std::cout << "drain():        " << drain_time << "ms" << (flush_valid ? "" : " (INVALID)") << "\n";
+    std::cout << "copy+insert:    " << copy_migrate_time << "ms\n";
+    std::cout << "merge_from():   " << merge_time << "ms" << (migrate_valid ? "" : " (INVALID)") << "\n";
+}
+
+/**
+ * @brief 重启加载：文本转储逐行解析 vs 二进制快照批量构造 vs 直接映射
+ */
+void run_snapshot_load_benchmarks(std::vector<BenchmarkResult>& results) {
+    print_section_header("重启加载测试（文本转储 vs load_snapshot vs map_snapshot）");
+    
+    constexpr std::uint64_t ENTRIES = 1000000;
+    constexpr std::uint64_t LOOKUPS = 100000;
+    const std::string dir = std::filesystem::temp_directory_path().string();
+    const std::string text_path = dir + "/ts_stl_bench_dump.txt";
+    const std::string snap_path = dir + "/ts_stl_bench_dump.snap";
+    
+    unordered_mapRW<std::uint64_t, std::uint64_t> table;
+    table.reserve(ENTRIES);
+    for (std::uint64_t i = 0; i < ENTRIES; ++i) {
+        table.insert(i * 2654435761ULL, i);
+    }
+    {
+        std::ofstream out(text_path);
+        table.for_each([&out](const std::uint64_t& k, const std::uint64_t& v) { out << k << ' ' << v << '\n'; });
+    }
+    
+    PerformanceTimer timer;
+    timer.start();
+    save_snapshot(table, snap_path);
+    double save_time = timer.stop();
+    
+    timer.start();
+    unordered_mapRW<std::uint64_t, std::uint64_t> from_text;
+    {
+        std::ifstream in(text_path);
+        from_text.reserve(ENTRIES);
+        std::uint64_t k = 0;
+        std::uint64_t v = 0;
+        while (in >> k >> v) {
+            from_text.insert(k, v);
+        }
+    }
+    double text_time = timer.stop();
+    
+    timer.start();
+    unordered_mapRW<std::uint64_t, std::uint64_t> from_snapshot;
+    load_snapshot(from_snapshot, snap_path);
+    double load_time = timer.stop();
+    
+    // 映射视图：打开即可服务，计入首批查找时间
+    std::uint64_t hits = 0;
+    timer.start();
+    auto view = map_snapshot<unordered_mapRW<std::uint64_t, std::uint64_t>>(snap_path);
+    for (std::uint64_t i = 0; i < LOOKUPS; ++i) {
+        hits += view.contains((i * 7919 % ENTRIES) * 2654435761ULL) ? 1 : 0;
+    }
+    double map_time = timer.stop();
+    
+    bool valid = from_text.size() == ENTRIES && from_snapshot.size() == ENTRIES && view.size() == ENTRIES &&
+                 hits == LOOKUPS;
+    results.push_back({"Restart Load", "text dump parse", text_time, static_cast<size_t>(ENTRIES), valid});
+    results.push_back({"Restart Load", "load_snapshot", load_time, static_cast<size_t>(ENTRIES), valid});
+    results.push_back({"Restart Load", "map_snapshot + lookups", map_time, static_cast<size_t>(LOOKUPS), valid});
+    
+    std::cout << std::fixed << std::setprecision(3);
+    std::cout << "save_snapshot:          " << save_time << "ms\n";
+    std::cout << "text dump parse:        " << text_time << "ms\n";
+    std::cout << "load_snapshot:          " << load_time << "ms\n";
+    std::cout << "map_snapshot + lookups: " << map_time << "ms" << (valid ? "" : " (INVALID)") << "\n";
+    
+    std::remove(text_path.c_str());
+    std::remove(snap_path.c_str());
+}
+
+// 逐次插入，记录单次插入延迟；返回 {总耗时, 最大单次延迟, p99.9 延迟}（毫秒）
+template <typename Map>
+std::array<double, 3> measure_insert_latency(Map& map, std::uint64_t count) {
+    std::vector<double> samples(count);
+    auto begin = high_resolution_clock::now();
+    for (std::uint64_t i = 0; i < count; ++i) {
+        auto t0 = high_resolution_clock::now();
+        map.insert(i * 2654435761ULL, i);
+        samples[i] = duration<double, std::milli>(high_resolution_clock::now() - t0).count();
+    }
+    double total = duration<double, std::milli>(high_resolution_clock::now() - begin).count();
+    auto p999 = samples.begin() + static_cast<std::ptrdiff_t>(count * 999 / 1000);
+    std::nth_element(samples.begin(), p999, samples.end());
+    return {total, *std::max_element(samples.begin(), samples.end()), *p999};
+}
+
+void run_incremental_rehash_benchmarks(std::vector<BenchmarkResult>& results) {
+    print_section_header("扩容尾延迟测试（一次性重哈希 vs 渐进式扩容）");
+    
+    constexpr std::uint64_t ENTRIES = 2000000;
+    
+    unordered_mapMutex<std::uint64_t, std::uint64_t> standard;
+    auto standard_stats = measure_insert_latency(standard, ENTRIES);
+    
+    incremental_unordered_mapMutex<std::uint64_t, std::uint64_t> incremental;
+    auto incremental_stats = measure_insert_latency(incremental, ENTRIES);
+    auto resize = incremental.resize_stats();
+    
+    bool valid = standard.size() == ENTRIES && incremental.size() == ENTRIES &&
+                 incremental.get(12345 * 2654435761ULL) == 12345;
+    results.push_back({"Insert Tail Latency", "unordered_map (stop-the-world)", standard_stats[0],
+                       static_cast<size_t>(ENTRIES), valid});
+    results.push_back({"Insert Tail Latency", "incremental_unordered_map", incremental_stats[0],
+                       static_cast<size_t>(ENTRIES), valid});
+    
+    std::cout << std::fixed << std::setprecision(3);
+    std::cout << "unordered_map:             total " << standard_stats[0] << "ms, max " << standard_stats[1]
+              << "ms, p99.9 " << standard_stats[2] * 1000.0 << "us\n";
+    std::cout << "incremental_unordered_map: total " << incremental_stats[0] << "ms, max " << incremental_stats[1]
+              << "ms, p99.9 " << incremental_stats[2] * 1000.0 << "us\n";
+    std::cout << "resizes started/completed: " << resize.resizes_started << "/" << resize.resizes_completed
+              << ", forced " << resize.forced_completions << ", nodes migrated " << resize.nodes_migrated
+              << (valid ? "" : " (INVALID)") << "\n";
+}
+
+void run_lru_cache_benchmarks(std::vector<BenchmarkResult>& results) {
+    print_section_header("LRU 缓存测试（外层锁 + 哈希表 + 链表 vs 分片 CLOCK lru_cache）");
+    
+    constexpr int CAPACITY = 50000;
+    constexpr int KEY_SPACE = 80000;
+    constexpr size_t OPS_PER_THREAD = 200000;
+    
+    // 常见写法：一把外层锁保护 unordered_map + list，每次命中都要把节点移到链表头
+    struct classic_lru {
+        std::mutex mtx;
+        std::list<std::pair<int, int>> order;
+        std::unordered_map<int, std::list<std::pair<int, int>>::iterator> index;
+        
+        bool get(int key, int& out) {
+            std::lock_guard<std::mutex> lock(mtx);
+            auto it = index.find(key);
+            if (it == index.end()) {
+                return false;
+            }
+            order.splice(order.begin(), order, it->second);
+            out = it->second->second;
+            return true;
+        }
+        
+        void put(int key, int value) {
+            std::lock_guard<std::mutex> lock(mtx);
+            auto it = index.find(key);
+            if (it != index.end()) {
+                it->second->second = value;
+                order.splice(order.begin(), order, it->second);
+                return;
+            }
+            if (index.size() >= static_cast<size_t>(CAPACITY)) {
+                index.erase(order.back().first);
+                order.pop_back();
+            }
+            order.emplace_front(key, value);
+            index[key] = order.begin();
+        }
+    };
+    
+    // 未命中后回填；rank 偏向低位模拟热点，再打散成不相邻的键
+    auto workload = [&](auto&& get, auto&& put) {
+        std::atomic<size_t> hits{0};
+        std::vector<std::thread> threads;
+        for (size_t t = 0; t < NUM_THREADS; ++t) {
+            threads.emplace_back([&, t]() {
+                std::uint64_t x = 0x9e3779b97f4a7c15ULL * (t + 1);
+                size_t local_hits = 0;
+                for (size_t i = 0; i < OPS_PER_THREAD; ++i) {
+                    x ^= x << 13;
+                    x ^= x >> 7;
+                    x ^= x << 17;
+                    std::uint64_t rank = (x % KEY_SPACE) * (x % KEY_SPACE) / KEY_SPACE;
+                    int key = static_cast<int>((rank * 2654435761ULL) & 0x7fffffff);
+                    if (get(key)) {
+                        ++local_hits;
+                    } else {
+                        put(key);
+                    }
+                }
+                hits += local_hits;
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        return hits.load();
+    };
+    
+    PerformanceTimer timer;
+    classic_lru classic;
+    timer.start();
+    size_t classic_hits = workload([&](int k) { int v = 0; return classic.get(k, v); },
+                                   [&](int k) { classic.put(k, k); });
+    double classic_time = timer.stop();
+    
+    lru_cache<int, int, 16> cache(CAPACITY);
+    timer.start();
+    size_t cache_hits = workload([&](int k) { return cache.visit(k, [](const int&) {}); },
+                                 [&](int k) { cache.put(k, k); });
+    double cache_time = timer.stop();
+    auto stats = cache.stats();
+    
+    lru_cacheMutex<int, int, 16> mutex_cache(CAPACITY);
+    timer.start();
+    workload([&](int k) { return mutex_cache.visit(k, [](const int&) {}); },
+             [&](int k) { mutex_cache.put(k, k); });
+    double mutex_cache_time = timer.stop();
+    
+    const size_t total_ops = NUM_THREADS * OPS_PER_THREAD;
+    bool valid = classic.index.size() <= static_cast<size_t>(CAPACITY) && cache.size() <= cache.capacity() &&
+                 stats.hits == cache_hits;
+    results.push_back({"LRU Cache", "mutex + unordered_map + list", classic_time, total_ops, valid});
+    results.push_back({"LRU Cache", "lru_cache (16 shards, RW, CLOCK)", cache_time, total_ops, valid});
+    results.push_back({"LRU Cache", "lru_cache (16 shards, Mutex, CLOCK)", mutex_cache_time, total_ops, valid});
+    
+    std::cout << std::fixed << std::setprecision(3);
+    std::cout << "mutex + unordered_map + list: " << classic_time << "ms, hit ratio "
+              << static_cast<double>(classic_hits) / static_cast<double>(total_ops) << "\n";
+    std::cout << "lru_cache:                    " << cache_time << "ms, hit ratio " << stats.hit_ratio()
+              << ", evictions " << stats.evictions << (valid ? "" : " (INVALID)") << "\n";
+    std::cout << "lru_cacheMutex:               " << mutex_cache_time << "ms\n";
+}
+
+// ==================== 先查后插（get-or-insert）读扩展性测试 ====================
+
+#if TS_STL_SUPPORT_RW_LOCK
+/**
+ * @brief thread_count 个线程对预热好的 map 做"先查后插"，约 1/1000 的操作访问新键（真正插入）
+ */
+template <typename Map>
+BenchmarkResult benchmark_get_or_insert(const std::string& container_name, size_t thread_count,
+                                        bool use_get_or_insert) {
+    constexpr int KEY_SPACE = 4096;
+    Map map;
+    for (int k = 0; k < KEY_SPACE; ++k) {
+        map.insert(k, k);
+    }
+    std::atomic<long long> sum{0};
+    
+    PerformanceTimer timer;
+    timer.start();
+    
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < thread_count; ++t) {
+        threads.emplace_back([&, t]() {
+            long long local_sum = 0;
+            for (size_t i = 0; i < MULTI_THREAD_OPS; ++i) {
+                // 大部分命中预热的键；每 1000 次访问一个本线程独有的新键
+                const int key = i % 1000 == 999
+                    ? KEY_SPACE + static_cast<int>(t * MULTI_THREAD_OPS + i)
+                    : static_cast<int>((i * 2654435761u + t) % KEY_SPACE);
+                if (use_get_or_insert) {
+                    local_sum += map.get_or_insert(key, [key]() { return key; });
+                } else {
+                    // operator[] 式写法：每次都在写锁内查找或插入
+                    map.with_write_lock([&](auto& m) {
+                        auto it = m.unsafe_ref().try_emplace(key, key).first;
+                        local_sum += it->second;
+                    });
+                }
+            }
+            sum += local_sum;
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    
+    double time = timer.stop();
+    
+    const size_t inserted = thread_count * (MULTI_THREAD_OPS / 1000);
+    return {
+        "Get-or-Insert x" + std::to_string(thread_count) + " threads",
+        container_name,
+        time,
+        MULTI_THREAD_OPS * thread_count,
+        sum > 0 && map.size() == KEY_SPACE + inserted
+    };
+}
+#endif
+
+void run_get_or_insert_benchmarks(std::vector<BenchmarkResult>& results) {
+#if TS_STL_SUPPORT_RW_LOCK
+    print_section_header("先查后插读扩展性测试（写锁 vs ReadWrite vs ReaderBiased 可升级读锁）");
+    
+    for (size_t thread_count : {1, 8, 64, 128}) {
+        std::vector<BenchmarkResult> round;
+        round.push_back(benchmark_get_or_insert<unordered_mapRW<int, int>>(
+            "RW+write_lock", thread_count, false));
+        round.push_back(benchmark_get_or_insert<unordered_mapRW<int, int>>(
+            "RW get_or_insert", thread_count, true));
+        round.push_back(benchmark_get_or_insert<unordered_mapReaderBiased<int, int>>(
+            "ReaderBiased", thread_count, true));
+        
+        std::cout << "\n线程数: " << thread_count << "\n";
+        for (const auto& result : round) {
+            std::cout << std::fixed << std::setprecision(2);
+            std::cout << "  " << std::left << std::setw(20) << result.container_type
+                      << result.time_ms << "ms, " << std::setprecision(0)
+                      << result.ops_per_ms() << " ops/ms"
+                      << (result.data_valid ? "" : " (INVALID)") << "\n";
+            results.push_back(result);
+        }
+    }
+#else
+    (void)results;
+#endif
+}
+
+// ==================== 优先队列测试（严格 vs 松弛 MultiQueue） ====================
+
+/**
+ * @brief thread_count 个线程交替 push / try_pop（调度器式负载），队列预热 PREFILL 个元素
+ */
+template <typename PushFunc, typename PopFunc>
+BenchmarkResult benchmark_priority_queue(const std::string& container_name, size_t thread_count,
+                                         PushFunc push, PopFunc pop) {
+    constexpr size_t PREFILL = 10000;
+    for (size_t i = 0; i < PREFILL; ++i) {
+        push(static_cast<int>(i * 2654435761u % 1000000));
+    }
+    std::atomic<size_t> popped{0};
+    
+    PerformanceTimer timer;
+    timer.start();
+    
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < thread_count; ++t) {
+        threads.emplace_back([&, t]() {
+            size_t local_popped = 0;
+            int value = 0;
+            for (size_t i = 0; i < MULTI_THREAD_OPS / 2; ++i) {
+                push(static_cast<int>((t * MULTI_THREAD_OPS + i) * 2654435761u % 1000000));
+                if (pop(value)) {
+                    ++local_popped;
+                }
+            }
+            popped += local_popped;
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    
+    double time = timer.stop();
+    
+    return {
+        "Priority Queue push/pop x" + std::to_string(thread_count) + " threads",
+        container_name,
+        time,
+        MULTI_THREAD_OPS * thread_count,
+        popped == thread_count * (MULTI_THREAD_OPS / 2)
+    };
+}
+
+void run_priority_queue_benchmarks(std::vector<BenchmarkResult>& results) {
+    print_section_header("优先队列测试（外层锁 + std::priority_queue vs priority_queue vs multi_priority_queue）");
+    
+    for (size_t thread_count : {1, 4, 16, 64}) {
+        std::vector<BenchmarkResult> round;
+        {
+            // 常见写法：一把外层锁保护 std::priority_queue
+            std::mutex mtx;
+            std::priority_queue<int> pq;
+            round.push_back(benchmark_priority_queue("std::pq+mutex", thread_count,
+                [&](int v) { std::lock_guard<std::mutex> lock(mtx); pq.push(v); },
+                [&](int& out) {
+                    std::lock_guard<std::mutex> lock(mtx);
+                    if (pq.empty()) {
+                        return false;
+                    }
+                    out = pq.top();
+                    pq.pop();
+                    return true;
+                }));
+        }
+        {
+            priority_queueSpinLock<int> pq;
+            round.push_back(benchmark_priority_queue("pq<SpinLock>", thread_count,
+                [&](int v) { pq.push(v); }, [&](int& out) { return pq.try_pop(out); }));
+        }
+        {
+            priority_queueAdaptive<int> pq;
+            round.push_back(benchmark_priority_queue("pq<Adaptive>", thread_count,
+                [&](int v) { pq.push(v); }, [&](int& out) { return pq.try_pop(out); }));
+        }
+        {
+            multi_priority_queueMutex<int> pq;
+            round.push_back(benchmark_priority_queue("multi_pq<Mutex>", thread_count,
+                [&](int v) { pq.push(v); }, [&](int& out) { return pq.try_pop(out); }));
+        }
+        {
+            multi_priority_queueAdaptive<int> pq;
+            round.push_back(benchmark_priority_queue("multi_pq<Adaptive>", thread_count,
+                [&](int v) { pq.push(v); }, [&](int& out) { return pq.try_pop(out); }));
+        }
+        
+        std::cout << "\n线程数: " << thread_count << "\n";
+        for (const auto& result : round) {
+            std::cout << std::fixed << std::setprecision(2);
+            std::cout << "  " << std::left << std::setw(20) << result.container_type
+                      << result.time_ms << "ms, " << std::setprecision(0)
+                      << result.ops_per_ms() << " ops/ms"
+                      << (result.data_valid ? "" : " (INVALID)") << "\n";
+            results.push_back(result);
+        }
+    }
+}
+
+#if TS_STL_ENABLE_LOCK_STATS
+// 以 -DTS_STL_ENABLE_LOCK_STATS=1 编译时输出各容器的锁竞争情况
+void run_lock_stats_report() {
+    print_section_header("锁竞争统计（TS_STL_ENABLE_LOCK_STATS）");
+    
+    mapMutex<int, int> orders;
+    unordered_mapRW<int, int> prices;
+    sharded_unordered_map<int, int, 4> sessions;
+    orders.register_lock_stats("orders (mapMutex)");
+    prices.register_lock_stats("prices (unordered_mapRW)");
+    sessions.register_lock_stats("sessions");
+    
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < NUM_THREADS; ++t) {
+        threads.emplace_back([&, t]() {
+            for (size_t i = 0; i < MULTI_THREAD_OPS / 10; ++i) {
+                int key = static_cast<int>(i % 1024);
+                orders.insert(static_cast<int>(t * MULTI_THREAD_OPS + i), key);
+                if (i % 10 == 0) {
+                    prices.set(key, static_cast<int>(i));
+                } else {
+                    prices.get(key, 0);
+                }
+                sessions.set(key, static_cast<int>(t));
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    lock_stats_registry::instance().dump(std::cout);
+}
+#endif
+
 int main() {
     std::cout << "\n";
     std::cout << "╔════════════════════════════════════════════════════════════════╗\n";
@@ -1200,11 +2546,30 @@ int main() {
     run_single_thread_benchmarks(results);
     run_concurrent_write_benchmarks(results);
     run_concurrent_read_benchmarks(results);
+    run_pod_read_scaling_benchmarks(results);
     run_mixed_read_write_90_10_benchmarks(results);
     run_mixed_read_write_50_50_benchmarks(results);
+    run_unordered_map_mixed_50_50_benchmarks(results);
+    run_queue_handoff_benchmarks(results);
     run_map_insert_benchmarks(results);
+    run_flat_map_benchmarks(results);
+    run_bulk_insert_benchmarks(results);
     run_map_concurrent_insert_benchmarks(results);
     run_map_concurrent_read_benchmarks(results);
+    run_map_range_scan_benchmarks(results);
+    run_parallel_scan_benchmarks(results);
+    run_simd_scan_benchmarks(results);
+    run_oversubscribed_lock_benchmarks(results);
+    run_false_sharing_benchmarks(results);
+    run_flush_benchmarks(results);
+    run_snapshot_load_benchmarks(results);
+    run_incremental_rehash_benchmarks(results);
+    run_lru_cache_benchmarks(results);
+    run_get_or_insert_benchmarks(results);
+    run_priority_queue_benchmarks(results);
+#if TS_STL_ENABLE_LOCK_STATS
+    run_lock_stats_report();
+#endif
     
     // 输出结果
     print_results_table(results);
@@ -0,0 +1,134 @@
+#pragma once
+
+#ifndef TS_ARRAY_OF_HPP
+#define TS_ARRAY_OF_HPP
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <stdexcept>
+
+#include "ts_stl_base.hpp"
+
+namespace ts_stl {
+
+namespace detail {
+
+/**
+ * @brief 当前线程的序号：按线程首次调用的先后依次分配 0, 1, 2, ...
+ *
+ * 与哈希线程 id 相比，连续创建的 N 个线程取模 N 后恰好落在 N 个不同的槽位
+ */
+inline std::size_t thread_index() noexcept {
+    static std::atomic<std::size_t> next{0};
+    thread_local const std::size_t index = next.fetch_add(1, std::memory_order_relaxed);
+    return index;
+}
+
+} // namespace detail
+
+/**
+ * @brief 固定个数的容器数组，每个容器独占缓存行
+ * @tparam Container 元素容器类型（如 vectorSpinLock<int>）
+ * @tparam N 容器个数
+ *
+ * 适合每核/每线程分箱（per-core bins）：各线程写自己的容器，
+ * 汇总时再遍历全部容器。与 std::array<Container, N> 相比，相邻容器的锁与元数据
+ * 不会落在同一缓存行上，一个线程加锁不会让邻居的缓存行失效。
+ *
+ * 注意：
+ * - local() 按线程序号取模选择容器，线程数超过 N 时多个线程共享一个容器（仍然线程安全）
+ * - 数组本身不可调整大小；各容器自身的线程安全由其锁策略保证
+ */
+template <typename Container, std::size_t N>
+class array_of {
+    static_assert(N > 0, "array_of requires at least one container");
+
+public:
+    using value_type = Container;
+    using size_type = std::size_t;
+    using reference = Container&;
+    using const_reference = const Container&;
+
+    array_of() = default;
+
+    // 容器可能正被其它线程使用，数组不可复制不可移动
+    array_of(const array_of&) = delete;
+    array_of& operator=(const array_of&) = delete;
+
+    // ==================== 元素访问 ====================
+
+    Container& operator[](size_type index) noexcept {
+        return slots_[index].value;
+    }
+
+    const Container& operator[](size_type index) const noexcept {
+        return slots_[index].value;
+    }
+
+    Container& at(size_type index) {
+        if (index >= N) {
+            throw std::out_of_range("array_of::at");
+        }
+        return slots_[index].value;
+    }
+
+    const Container& at(size_type index) const {
+        if (index >= N) {
+            throw std::out_of_range("array_of::at");
+        }
+        return slots_[index].value;
+    }
+
+    /**
+     * @brief 当前线程对应的容器
+     */
+    Container& local() noexcept {
+        return slots_[detail::thread_index() % N].value;
+    }
+
+    const Container& local() const noexcept {
+        return slots_[detail::thread_index() % N].value;
+    }
+
+    static constexpr size_type size() noexcept {
+        return N;
+    }
+
+    // ==================== 遍历 ====================
+
+    /**
+     * @brief 依次对每个容器执行 func(container)
+     */
+    template <typename Func>
+    void for_each(Func func) {
+        for (auto& slot : slots_) {
+            func(slot.value);
+        }
+    }
+
+    template <typename Func>
+    void for_each(Func func) const {
+        for (const auto& slot : slots_) {
+            func(slot.value);
+        }
+    }
+
+    /**
+     * @brief 所有容器元素个数之和（逐个容器加锁，不是全局原子快照）
+     */
+    size_type total_size() const {
+        size_type total = 0;
+        for (const auto& slot : slots_) {
+            total += slot.value.size();
+        }
+        return total;
+    }
+
+private:
+    std::array<cache_aligned<Container>, N> slots_;
+};
+
+} // namespace ts_stl
+
+#endif // TS_ARRAY_OF_HPP
@@ -0,0 +1,215 @@
+#pragma once
+
+#ifndef TS_ASYNC_LOCK_HPP
+#define TS_ASYNC_LOCK_HPP
+
+#include <condition_variable>
+#include <coroutine>
+#include <cstddef>
+#include <mutex>
+#include <shared_mutex>
+
+namespace ts_stl {
+
+/**
+ * @brief 可被协程 co_await 的读写锁（C++20，TS_STL_SUPPORT_COROUTINES）
+ *
+ * 同时提供两套获取方式，可以混用：
+ * - 同步：lock() / lock_shared() 阻塞当前线程，满足 Lockable / SharedLockable，
+ *   因此可以直接作为容器的锁（LockPolicy::Async）
+ * - 异步：co_await lock_async() / lock_shared_async() 在锁不可用时挂起协程并排入等待队列，
+ *   不占用执行器线程；得到锁后返回 std::unique_lock / std::shared_lock 守卫
+ *
+ * 调度规则：
+ * - 等待队列 FIFO；队列非空时新来的请求（包括读者）一律排队，写者不会被持续到来的读者饿死
+ * - 释放时锁直接移交给队首：队首是写者时只唤醒它，否则唤醒队首连续的全部读者
+ * - 被唤醒的协程在释放锁的线程上、于 unlock() 返回前恢复执行；需要回到特定执行器的调用方
+ *   应在获得锁后自行调度（例如 co_await executor.schedule()）
+ *
+ * 内部状态由一把 std::mutex 保护，临界区只有几次指针操作。
+ */
+class async_shared_mutex {
+    struct waiter {
+        waiter* next = nullptr;
+        bool exclusive = false;
+        bool granted = false;
+        std::coroutine_handle<> handle;  // 为空表示同步等待者
+    };
+
+    std::mutex state_lock_;
+    std::condition_variable sync_granted_;
+    std::ptrdiff_t state_ = 0;  // -1：写者持有；> 0：读者个数
+    waiter* head_ = nullptr;
+    waiter* tail_ = nullptr;
+
+    // 以下函数调用方持有 state_lock_
+
+    bool try_grant(bool exclusive) noexcept {
+        if (head_ != nullptr) {
+            return false;
+        }
+        if (exclusive) {
+            if (state_ != 0) {
+                return false;
+            }
+            state_ = -1;
+        } else {
+            if (state_ < 0) {
+                return false;
+            }
+            ++state_;
+        }
+        return true;
+    }
+
+    void enqueue(waiter& w) noexcept {
+        if (tail_ != nullptr) {
+            tail_->next = &w;
+        } else {
+            head_ = &w;
+        }
+        tail_ = &w;
+    }
+
+    // 把锁移交给队首可以立即获得锁的等待者；返回需要恢复的协程链表，sync_woken 表示是否授予了同步等待者
+    waiter* grant_waiters(bool& sync_woken) noexcept {
+        waiter* resume_head = nullptr;
+        waiter** resume_tail = &resume_head;
+        while (head_ != nullptr) {
+            waiter* w = head_;
+            if (w->exclusive ? state_ != 0 : state_ < 0) {
+                break;
+            }
+            state_ = w->exclusive ? -1 : state_ + 1;
+            head_ = w->next;
+            if (head_ == nullptr) {
+                tail_ = nullptr;
+            }
+            w->next = nullptr;
+            w->granted = true;
+            if (w->handle) {
+                *resume_tail = w;
+                resume_tail = &w->next;
+            } else {
+                sync_woken = true;
+            }
+            if (w->exclusive) {
+                break;
+            }
+        }
+        return resume_head;
+    }
+
+    void wake(waiter* resume_head, bool sync_woken) {
+        if (sync_woken) {
+            sync_granted_.notify_all();
+        }
+        while (resume_head != nullptr) {
+            // 恢复后等待者（位于协程帧内）可能立即失效，先取出后继
+            waiter* next = resume_head->next;
+            resume_head->handle.resume();
+            resume_head = next;
+        }
+    }
+
+    void release(bool exclusive) {
+        bool sync_woken = false;
+        waiter* resume_head = nullptr;
+        {
+            std::lock_guard<std::mutex> lock(state_lock_);
+            if (exclusive) {
+                state_ = 0;
+            } else {
+                --state_;
+            }
+            if (state_ == 0) {
+                resume_head = grant_waiters(sync_woken);
+            }
+        }
+        wake(resume_head, sync_woken);
+    }
+
+    void acquire_blocking(bool exclusive) {
+        std::unique_lock<std::mutex> lock(state_lock_);
+        if (try_grant(exclusive)) {
+            return;
+        }
+        waiter w;
+        w.exclusive = exclusive;
+        enqueue(w);
+        sync_granted_.wait(lock, [&w] { return w.granted; });
+    }
+
+    bool try_acquire(bool exclusive) {
+        std::lock_guard<std::mutex> lock(state_lock_);
+        return try_grant(exclusive);
+    }
+
+    template <typename Guard, bool Exclusive>
+    class lock_awaiter {
+    public:
+        explicit lock_awaiter(async_shared_mutex& mutex) noexcept : mutex_(mutex) {}
+
+        bool await_ready() {
+            return mutex_.try_acquire(Exclusive);
+        }
+
+        bool await_suspend(std::coroutine_handle<> handle) {
+            std::lock_guard<std::mutex> lock(mutex_.state_lock_);
+            if (mutex_.try_grant(Exclusive)) {
+                return false;
+            }
+            node_.exclusive = Exclusive;
+            node_.handle = handle;
+            mutex_.enqueue(node_);
+            return true;
+        }
+
+        Guard await_resume() noexcept {
+            return Guard(mutex_, std::adopt_lock);
+        }
+
+    private:
+        async_shared_mutex& mutex_;
+        waiter node_;
+    };
+
+public:
+    using write_awaiter = lock_awaiter<std::unique_lock<async_shared_mutex>, true>;
+    using read_awaiter = lock_awaiter<std::shared_lock<async_shared_mutex>, false>;
+
+    async_shared_mutex() = default;
+
+    async_shared_mutex(const async_shared_mutex&) = delete;
+    async_shared_mutex& operator=(const async_shared_mutex&) = delete;
+
+    // ==================== 同步接口 ====================
+
+    void lock() { acquire_blocking(true); }
+    bool try_lock() { return try_acquire(true); }
+    void unlock() { release(true); }
+
+    void lock_shared() { acquire_blocking(false); }
+    bool try_lock_shared() { return try_acquire(false); }
+    void unlock_shared() { release(false); }
+
+    // ==================== 协程接口 ====================
+
+    /**
+     * @brief co_await 得到 std::unique_lock<async_shared_mutex>（独占）
+     */
+    write_awaiter lock_async() noexcept {
+        return write_awaiter(*this);
+    }
+
+    /**
+     * @brief co_await 得到 std::shared_lock<async_shared_mutex>（共享）
+     */
+    read_awaiter lock_shared_async() noexcept {
+        return read_awaiter(*this);
+    }
+};
+
+} // namespace ts_stl
+
+#endif // TS_ASYNC_LOCK_HPP
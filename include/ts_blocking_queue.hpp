@@ -0,0 +1,341 @@
+#pragma once
+
+#ifndef TS_BLOCKING_QUEUE_HPP
+#define TS_BLOCKING_QUEUE_HPP
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <type_traits>
+
+#include "ts_stl_base.hpp"
+
+namespace ts_stl {
+
+/**
+ * @brief 线程安全的阻塞队列（多生产者多消费者）
+ * @tparam T 元素类型
+ * @tparam Policy 锁策略（默认使用互斥锁，不支持 LockFree）
+ *
+ * 基于 std::deque，在同一把锁内完成"检查 + 取出"，并通过条件变量实现：
+ * - try_pop_front：非阻塞取出
+ * - wait_pop_front / wait_pop_front_for：阻塞（可超时）等待元素
+ * - 可选容量上限：队列满时 push_back 阻塞，形成背压
+ * - pop_n：一次加锁批量取出
+ * - close：唤醒所有等待者，之后不再接受新元素
+ */
+template <typename T, LockPolicy Policy = LockPolicy::Mutex>
+class blocking_queue : public container_mixin<blocking_queue<T, Policy>, T, Policy> {
+    static_assert(Policy != LockPolicy::LockFree, "blocking_queue requires a locking policy");
+
+private:
+    friend class container_mixin<blocking_queue<T, Policy>, T, Policy>;
+
+    std::deque<T> data_;
+
+    using Base = container_mixin<blocking_queue<T, Policy>, T, Policy>;
+    using Base::acquire_write_lock;
+    using Base::acquire_read_lock;
+
+    // 守卫是 std::unique_lock<std::mutex> 时（互斥锁策略且未开启锁统计）可直接使用更轻量的 std::condition_variable
+    using condition_type = std::conditional_t<std::is_same_v<typename LockGuard<Policy>::write_guard,
+                                                             std::unique_lock<std::mutex>>,
+                                              std::condition_variable,
+                                              std::condition_variable_any>;
+
+public:
+    using Container = std::deque<T>;
+    using value_type = T;
+    using size_type = typename std::deque<T>::size_type;
+    using reference = T&;
+    using const_reference = const T&;
+
+private:
+    size_type capacity_;
+    bool closed_ = false;
+    condition_type not_empty_;
+    condition_type not_full_;
+
+    bool full() const {
+        return capacity_ != 0 && data_.size() >= capacity_;
+    }
+
+    template <typename Guard>
+    void wait_not_full(Guard& guard) {
+        not_full_.wait(guard, [this] { return closed_ || !full(); });
+    }
+
+    template <typename Guard>
+    void wait_not_empty(Guard& guard) {
+        not_empty_.wait(guard, [this] { return closed_ || !data_.empty(); });
+    }
+
+    template <typename Guard>
+    T take_front(Guard& guard) {
+        T value = std::move(data_.front());
+        data_.pop_front();
+        guard.unlock();
+        if (capacity_ != 0) {
+            not_full_.notify_one();
+        }
+        return value;
+    }
+
+public:
+    // ==================== 构造函数 ====================
+
+    /**
+     * @brief 构造队列
+     * @param capacity 容量上限，0 表示不限容量
+     */
+    explicit blocking_queue(size_type capacity = 0) : Base(), capacity_(capacity) {}
+
+    // 可能有线程正在等待，队列不可复制不可移动
+    blocking_queue(const blocking_queue&) = delete;
+    blocking_queue& operator=(const blocking_queue&) = delete;
+
+    // ==================== 入队操作 ====================
+
+    /**
+     * @brief 添加元素到队尾，队列满时阻塞
+     * @return 队列已关闭时返回 false
+     */
+    bool push_back(const T& value) {
+        auto guard = acquire_write_lock();
+        wait_not_full(guard);
+        if (closed_) {
+            return false;
+        }
+        data_.push_back(value);
+        guard.unlock();
+        not_empty_.notify_one();
+        return true;
+    }
+
+    bool push_back(T&& value) {
+        auto guard = acquire_write_lock();
+        wait_not_full(guard);
+        if (closed_) {
+            return false;
+        }
+        data_.push_back(std::move(value));
+        guard.unlock();
+        not_empty_.notify_one();
+        return true;
+    }
+
+    /**
+     * @brief 原地构造元素到队尾，队列满时阻塞
+     */
+    template <typename... Args>
+    bool emplace_back(Args&&... args) {
+        auto guard = acquire_write_lock();
+        wait_not_full(guard);
+        if (closed_) {
+            return false;
+        }
+        data_.emplace_back(std::forward<Args>(args)...);
+        guard.unlock();
+        not_empty_.notify_one();
+        return true;
+    }
+
+    /**
+     * @brief 非阻塞入队，队列满或已关闭时返回 false
+     */
+    bool try_push_back(const T& value) {
+        auto guard = acquire_write_lock();
+        if (closed_ || full()) {
+            return false;
+        }
+        data_.push_back(value);
+        guard.unlock();
+        not_empty_.notify_one();
+        return true;
+    }
+
+    bool try_push_back(T&& value) {
+        auto guard = acquire_write_lock();
+        if (closed_ || full()) {
+            return false;
+        }
+        data_.push_back(std::move(value));
+        guard.unlock();
+        not_empty_.notify_one();
+        return true;
+    }
+
+    /**
+     * @brief 带超时的入队，超时、队列已关闭时返回 false
+     */
+    template <typename Rep, typename Period>
+    bool push_back_for(const T& value, const std::chrono::duration<Rep, Period>& timeout) {
+        auto guard = acquire_write_lock();
+        if (!not_full_.wait_for(guard, timeout, [this] { return closed_ || !full(); }) || closed_) {
+            return false;
+        }
+        data_.push_back(value);
+        guard.unlock();
+        not_empty_.notify_one();
+        return true;
+    }
+
+    template <typename Rep, typename Period>
+    bool push_back_for(T&& value, const std::chrono::duration<Rep, Period>& timeout) {
+        auto guard = acquire_write_lock();
+        if (!not_full_.wait_for(guard, timeout, [this] { return closed_ || !full(); }) || closed_) {
+            return false;
+        }
+        data_.push_back(std::move(value));
+        guard.unlock();
+        not_empty_.notify_one();
+        return true;
+    }
+
+    // ==================== 出队操作 ====================
+
+    /**
+     * @brief 非阻塞出队
+     * @return 队列为空时返回 false，out 保持不变
+     */
+    bool try_pop_front(T& out) {
+        auto guard = acquire_write_lock();
+        if (data_.empty()) {
+            return false;
+        }
+        out = take_front(guard);
+        return true;
+    }
+
+    /**
+     * @brief 阻塞出队，直到有元素或队列关闭
+     * @return 队列已关闭且为空时返回 false
+     */
+    bool wait_pop_front(T& out) {
+        auto guard = acquire_write_lock();
+        wait_not_empty(guard);
+        if (data_.empty()) {
+            return false;
+        }
+        out = take_front(guard);
+        return true;
+    }
+
+    /**
+     * @brief 带超时的阻塞出队
+     * @return 超时或队列已关闭且为空时返回 false
+     */
+    template <typename Rep, typename Period>
+    bool wait_pop_front_for(T& out, const std::chrono::duration<Rep, Period>& timeout) {
+        auto guard = acquire_write_lock();
+        not_empty_.wait_for(guard, timeout, [this] { return closed_ || !data_.empty(); });
+        if (data_.empty()) {
+            return false;
+        }
+        out = take_front(guard);
+        return true;
+    }
+
+    /**
+     * @brief 一次加锁批量取出最多 max_count 个元素（非阻塞）
+     * @return 实际取出的元素个数
+     */
+    template <typename OutputIt>
+    size_type pop_n(OutputIt out, size_type max_count) {
+        auto guard = acquire_write_lock();
+        size_type n = std::min(max_count, data_.size());
+        auto last = data_.begin() + static_cast<typename std::deque<T>::difference_type>(n);
+        std::move(data_.begin(), last, out);
+        data_.erase(data_.begin(), last);
+        guard.unlock();
+        if (capacity_ != 0 && n > 0) {
+            not_full_.notify_all();
+        }
+        return n;
+    }
+
+    /**
+     * @brief 等待至少一个元素（或超时/关闭）后批量取出最多 max_count 个元素
+     */
+    template <typename OutputIt, typename Rep, typename Period>
+    size_type wait_pop_n_for(OutputIt out, size_type max_count,
+                             const std::chrono::duration<Rep, Period>& timeout) {
+        auto guard = acquire_write_lock();
+        not_empty_.wait_for(guard, timeout, [this] { return closed_ || !data_.empty(); });
+        size_type n = std::min(max_count, data_.size());
+        auto last = data_.begin() + static_cast<typename std::deque<T>::difference_type>(n);
+        std::move(data_.begin(), last, out);
+        data_.erase(data_.begin(), last);
+        guard.unlock();
+        if (capacity_ != 0 && n > 0) {
+            not_full_.notify_all();
+        }
+        return n;
+    }
+
+    /**
+     * @brief 一次加锁取走全部元素（O(1) 交换），并唤醒等待空位的生产者
+     */
+    std::deque<T> drain() {
+        std::deque<T> out;
+        auto guard = acquire_write_lock();
+        data_.swap(out);
+        guard.unlock();
+        if (capacity_ != 0 && !out.empty()) {
+            not_full_.notify_all();
+        }
+        return out;
+    }
+
+    // 换入任意多个元素会绕过容量上限与 not_empty_ 通知，队列不提供 swap_out
+    void swap_out(std::deque<T>& other) = delete;
+
+    // ==================== 关闭 ====================
+
+    /**
+     * @brief 关闭队列：唤醒所有等待者，之后的入队操作均失败，
+     *        已入队的元素仍可被取出
+     */
+    void close() {
+        auto guard = acquire_write_lock();
+        closed_ = true;
+        guard.unlock();
+        not_empty_.notify_all();
+        not_full_.notify_all();
+    }
+
+    bool is_closed() const {
+        auto guard = acquire_read_lock();
+        return closed_;
+    }
+
+    // ==================== 容量管理 ====================
+
+    size_type size() const {
+        auto guard = acquire_read_lock();
+        return data_.size();
+    }
+
+    bool empty() const {
+        auto guard = acquire_read_lock();
+        return data_.empty();
+    }
+
+    /**
+     * @brief 容量上限，0 表示不限容量
+     */
+    size_type capacity() const noexcept {
+        return capacity_;
+    }
+
+    void clear() {
+        auto guard = acquire_write_lock();
+        data_.clear();
+        guard.unlock();
+        not_full_.notify_all();
+    }
+};
+
+} // namespace ts_stl
+
+#endif // TS_BLOCKING_QUEUE_HPP
@@ -0,0 +1,409 @@
+#pragma once
+
+#ifndef TS_CONCURRENT_LIST_HPP
+#define TS_CONCURRENT_LIST_HPP
+
+#include <atomic>
+#include <initializer_list>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+#include "ts_stl_base.hpp"
+
+namespace ts_stl {
+
+/**
+ * @brief 细粒度加锁的双向链表（每个节点一把锁）
+ * @tparam T 元素类型
+ * @tparam Policy 节点锁类型（SpinLock 或 Mutex，默认 SpinLock）
+ *
+ * 与 list 锁住整个 std::list 不同，这里只锁被修改链接两端的节点：
+ * - 队首与队尾操作互不阻塞（元素多于两个时），生产者 push_back 与消费者 pop_front 可并行
+ * - remove_if / for_each 以 hand-over-hand 方式逐节点前进，同一时刻最多持有三个相邻节点的锁，
+ *   扫描过程中其它位置的插入与弹出照常进行
+ *
+ * 加锁规则：
+ * - 修改 a <-> b 之间的链接时必须同时持有 a 和 b 的锁
+ * - 从左到右（head -> tail 方向）阻塞加锁；从右到左只用 try_lock，失败即全部释放后重试，
+ *   因此不会形成死锁环
+ * - 节点只能经由持有锁的相邻节点到达，摘下节点时两侧邻居均被锁住，所以摘下后即可立即释放
+ *
+ * 注意：
+ * - 回调（pred / func）在节点锁内执行，不得再访问同一个链表
+ * - size() 为原子计数，在并发修改下仅是瞬时值
+ * - 队尾操作在队首竞争激烈时可能多次重试
+ */
+template <typename T, LockPolicy Policy = LockPolicy::SpinLock>
+class concurrent_list {
+    static_assert(Policy != LockPolicy::LockFree &&
+                      std::is_same_v<typename lock_traits<Policy>::write_guard,
+                                     typename lock_traits<Policy>::read_guard>,
+                  "concurrent_list requires an exclusive node lock (Mutex, SpinLock, Adaptive or Ticket)");
+
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using reference = T&;
+    using const_reference = const T&;
+
+private:
+    using mutex_type = typename lock_traits<Policy>::mutex_type;
+    using node_guard = std::unique_lock<mutex_type>;
+
+    struct node {
+        mutable mutex_type lock;
+        node* prev = nullptr;
+        node* next = nullptr;
+    };
+
+    struct value_node : node {
+        template <typename... Args>
+        explicit value_node(Args&&... args) : value(std::forward<Args>(args)...) {}
+
+        T value;
+    };
+
+    node head_;
+    node tail_;
+    std::atomic<size_type> size_{0};
+
+    static T& value_of(node* n) noexcept {
+        return static_cast<value_node*>(n)->value;
+    }
+
+    // 调用方持有 left 与 right 的锁
+    static void link_between(node* left, node* n, node* right) noexcept {
+        n->prev = left;
+        n->next = right;
+        left->next = n;
+        right->prev = n;
+    }
+
+    // 调用方持有 n 及其两侧邻居的锁
+    static void unlink(node* n) noexcept {
+        n->prev->next = n->next;
+        n->next->prev = n->prev;
+    }
+
+    // 从右到左的 try_lock 失败后退避
+    static void backoff(unsigned& spins) {
+        if (++spins < 16) {
+            cpu_relax();
+        } else {
+            std::this_thread::yield();
+        }
+    }
+
+    void link_front(value_node* n) {
+        node_guard head_guard(head_.lock);
+        node* first = head_.next;
+        node_guard first_guard(first->lock);
+        link_between(&head_, n, first);
+        size_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void link_back(value_node* n) {
+        unsigned spins = 0;
+        for (;;) {
+            node_guard tail_guard(tail_.lock);
+            node* last = tail_.prev;
+            node_guard last_guard(last->lock, std::try_to_lock);
+            if (last_guard.owns_lock()) {
+                link_between(last, n, &tail_);
+                size_.fetch_add(1, std::memory_order_relaxed);
+                return;
+            }
+            tail_guard.unlock();
+            backoff(spins);
+        }
+    }
+
+    // 摘下第一个元素，链表为空时返回 nullptr
+    value_node* unlink_front() {
+        node_guard head_guard(head_.lock);
+        node* first = head_.next;
+        if (first == &tail_) {
+            return nullptr;
+        }
+        node_guard first_guard(first->lock);
+        node_guard second_guard(first->next->lock);
+        unlink(first);
+        size_.fetch_sub(1, std::memory_order_relaxed);
+        return static_cast<value_node*>(first);
+    }
+
+    // 摘下最后一个元素，链表为空时返回 nullptr
+    value_node* unlink_back() {
+        unsigned spins = 0;
+        for (;;) {
+            node_guard tail_guard(tail_.lock);
+            node* last = tail_.prev;
+            if (last == &head_) {
+                return nullptr;
+            }
+            node_guard last_guard(last->lock, std::try_to_lock);
+            if (last_guard.owns_lock()) {
+                node_guard before_guard(last->prev->lock, std::try_to_lock);
+                if (before_guard.owns_lock()) {
+                    unlink(last);
+                    size_.fetch_sub(1, std::memory_order_relaxed);
+                    return static_cast<value_node*>(last);
+                }
+            }
+            last_guard = node_guard();
+            tail_guard.unlock();
+            backoff(spins);
+        }
+    }
+
+public:
+    // ==================== 构造函数 ====================
+
+    concurrent_list() noexcept {
+        head_.next = &tail_;
+        tail_.prev = &head_;
+    }
+
+    template <typename InputIt>
+    concurrent_list(InputIt first, InputIt last) : concurrent_list() {
+        for (; first != last; ++first) {
+            push_back(*first);
+        }
+    }
+
+    concurrent_list(std::initializer_list<T> init) : concurrent_list(init.begin(), init.end()) {}
+
+    // 节点地址被并发访问者持有，不可复制不可移动
+    concurrent_list(const concurrent_list&) = delete;
+    concurrent_list& operator=(const concurrent_list&) = delete;
+
+    ~concurrent_list() {
+        node* n = head_.next;
+        while (n != &tail_) {
+            node* next = n->next;
+            delete static_cast<value_node*>(n);
+            n = next;
+        }
+    }
+
+    // ==================== 容量管理 ====================
+
+    size_type size() const noexcept {
+        return size_.load(std::memory_order_relaxed);
+    }
+
+    bool empty() const noexcept {
+        return size() == 0;
+    }
+
+    /**
+     * @brief 逐节点删除所有元素（与 remove_if 相同的加锁方式）
+     */
+    void clear() {
+        remove_if([](const T&) { return true; });
+    }
+
+    // ==================== 修改操作 ====================
+
+    /**
+     * @brief 在链表头插入（锁住 head 与原第一个节点）
+     */
+    void push_front(const T& value) {
+        emplace_front(value);
+    }
+
+    void push_front(T&& value) {
+        emplace_front(std::move(value));
+    }
+
+    template <typename... Args>
+    void emplace_front(Args&&... args) {
+        // 节点在锁外构造；加锁失败抛出异常时由 unique_ptr 释放
+        std::unique_ptr<value_node> n(new value_node(std::forward<Args>(args)...));
+        link_front(n.get());
+        n.release();
+    }
+
+    /**
+     * @brief 在链表尾插入（锁住原最后一个节点与 tail）
+     */
+    void push_back(const T& value) {
+        emplace_back(value);
+    }
+
+    void push_back(T&& value) {
+        emplace_back(std::move(value));
+    }
+
+    template <typename... Args>
+    void emplace_back(Args&&... args) {
+        std::unique_ptr<value_node> n(new value_node(std::forward<Args>(args)...));
+        link_back(n.get());
+        n.release();
+    }
+
+    /**
+     * @brief 尝试弹出第一个元素
+     * @return 链表为空时返回 false，value 保持不变
+     */
+    bool try_pop_front(T& value) {
+        std::unique_ptr<value_node> n(unlink_front());
+        if (!n) {
+            return false;
+        }
+        value = std::move(n->value);
+        return true;
+    }
+
+    /**
+     * @brief 尝试弹出最后一个元素
+     * @return 链表为空时返回 false，value 保持不变
+     */
+    bool try_pop_back(T& value) {
+        std::unique_ptr<value_node> n(unlink_back());
+        if (!n) {
+            return false;
+        }
+        value = std::move(n->value);
+        return true;
+    }
+
+    /**
+     * @brief 删除所有满足 pred(const T&) 的元素
+     *
+     * hand-over-hand 扫描：持有前驱与当前节点的锁，命中时再锁住后继、摘下并立即释放当前节点。
+     * 扫描只锁住正在经过的相邻节点，其它位置的插入与弹出不受影响；
+     * 扫描开始后插入到已经过位置的元素不会被检查
+     * @return 删除的元素个数
+     */
+    template <typename Predicate>
+    size_type remove_if(Predicate pred) {
+        size_type removed = 0;
+        node_guard prev_guard(head_.lock);
+        node* cur = head_.next;
+        node_guard cur_guard(cur->lock);
+        while (cur != &tail_) {
+            node* next = cur->next;
+            node_guard next_guard(next->lock);
+            if (pred(static_cast<const T&>(value_of(cur)))) {
+                unlink(cur);
+                size_.fetch_sub(1, std::memory_order_relaxed);
+                cur_guard.unlock();
+                // 前驱与后继仍被锁住，其它线程无法再到达 cur
+                delete static_cast<value_node*>(cur);
+                ++removed;
+            } else {
+                prev_guard = std::move(cur_guard);
+            }
+            cur_guard = std::move(next_guard);
+            cur = next;
+        }
+        return removed;
+    }
+
+    /**
+     * @brief 删除所有等于 value 的元素
+     */
+    size_type remove(const T& value) {
+        return remove_if([&value](const T& item) { return item == value; });
+    }
+
+    // ==================== 迭代和查询 ====================
+
+    /**
+     * @brief 从头到尾对每个元素执行 func(const T&)（hand-over-hand，逐节点加锁）
+     */
+    template <typename Func>
+    void for_each(Func func) const {
+        node_guard head_guard(head_.lock);
+        node* cur = head_.next;
+        node_guard cur_guard(cur->lock);
+        head_guard.unlock();
+        while (cur != &tail_) {
+            func(static_cast<const T&>(value_of(cur)));
+            node* next = cur->next;
+            node_guard next_guard(next->lock);
+            cur_guard = std::move(next_guard);
+            cur = next;
+        }
+    }
+
+    /**
+     * @brief 从头到尾对每个元素执行 func(T&)，可原地修改
+     */
+    template <typename Func>
+    void for_each_mut(Func func) {
+        node_guard head_guard(head_.lock);
+        node* cur = head_.next;
+        node_guard cur_guard(cur->lock);
+        head_guard.unlock();
+        while (cur != &tail_) {
+            func(value_of(cur));
+            node* next = cur->next;
+            node_guard next_guard(next->lock);
+            cur_guard = std::move(next_guard);
+            cur = next;
+        }
+    }
+
+    bool contains(const T& value) const {
+        bool found = false;
+        for_each([&](const T& item) {
+            if (!found && item == value) {
+                found = true;
+            }
+        });
+        return found;
+    }
+
+    /**
+     * @brief 复制第一个元素，链表为空时返回 false
+     */
+    bool try_front(T& value) const {
+        node_guard head_guard(head_.lock);
+        node* first = head_.next;
+        if (first == &tail_) {
+            return false;
+        }
+        node_guard first_guard(first->lock);
+        value = value_of(first);
+        return true;
+    }
+
+    /**
+     * @brief 复制最后一个元素，链表为空时返回 false
+     */
+    bool try_back(T& value) const {
+        unsigned spins = 0;
+        for (;;) {
+            node_guard tail_guard(tail_.lock);
+            node* last = tail_.prev;
+            if (last == &head_) {
+                return false;
+            }
+            node_guard last_guard(last->lock, std::try_to_lock);
+            if (last_guard.owns_lock()) {
+                value = value_of(last);
+                return true;
+            }
+            tail_guard.unlock();
+            backoff(spins);
+        }
+    }
+
+    /**
+     * @brief 按顺序复制到 std::list（逐节点加锁，不是原子快照）
+     */
+    std::list<T> copy() const {
+        std::list<T> out;
+        for_each([&out](const T& item) { out.push_back(item); });
+        return out;
+    }
+};
+
+} // namespace ts_stl
+
+#endif // TS_CONCURRENT_LIST_HPP
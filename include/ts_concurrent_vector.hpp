@@ -0,0 +1,456 @@
+#pragma once
+
+#ifndef TS_CONCURRENT_VECTOR_HPP
+#define TS_CONCURRENT_VECTOR_HPP
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "ts_stl_base.hpp"
+#include "ts_vector.hpp"
+
+namespace ts_stl {
+
+/**
+ * @brief 只追加的分段并发 vector（追加不加锁）
+ * @tparam T 元素类型
+ *
+ * 存储由一组大小依次翻倍的段组成（首段 32 个元素，第 s 段 32 * 2^s 个），段一经分配就不再移动：
+ * - push_back / emplace_back 先确保所需的段已分配，再用 CAS 预留下标，然后在自己的槽位上构造元素，
+ *   追加之间没有全局锁，扩容也不复制已有元素
+ * - grow_by(n) 一次预留连续 n 个槽位
+ * - 段指针通过 CAS 发布，多个线程同时需要新段时只有一个分配结果被采用
+ * - 元素的地址与引用在容器生命周期内保持有效
+ *
+ * 可见性：
+ * - 槽位构造完成后才会计入 size()；size() 是"已完成前缀"的长度，即 [0, size()) 都已构造完毕，
+ *   读者可以在追加进行的同时安全地读取这一前缀（for_each / scan / operator[]）
+ * - 某个慢线程尚未构造完的槽位会挡住它后面已完成的槽位计入 size()，直到它完成
+ * - 元素构造抛出异常时该槽位保持未构造，size() 此后不再越过该下标（其余线程的追加仍会成功），
+ *   因此要求元素构造在正常运行中不抛异常
+ * - 段分配失败（std::bad_alloc）或超出容量（std::length_error）发生在预留之前，
+ *   异常抛出后容器状态不变，不会留下空洞
+ *
+ * 已完成前缀内的元素可被多个线程读取；修改同一元素需要调用方自行同步。
+ * clear() 与析构不是线程安全的，调用时不得有并发访问。
+ */
+template <typename T>
+class concurrent_vector {
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = T&;
+    using const_reference = const T&;
+
+private:
+    static constexpr unsigned first_segment_log = 5;
+    static constexpr size_type first_segment_size = size_type(1) << first_segment_log;
+    static constexpr unsigned max_segments = static_cast<unsigned>(sizeof(size_type) * 8) - first_segment_log;
+
+    using ready_flag = std::atomic<unsigned char>;
+
+    // 段内存：segment_size(s) 个元素之后紧跟同样个数的就绪标志
+    std::array<std::atomic<T*>, max_segments> segments_{};
+    std::atomic<size_type> reserved_{0};
+    std::atomic<size_type> completed_{0};
+
+    static unsigned floor_log2(size_type v) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+        return static_cast<unsigned>(sizeof(unsigned long long) * 8 - 1) -
+               static_cast<unsigned>(__builtin_clzll(static_cast<unsigned long long>(v)));
+#else
+        unsigned n = 0;
+        while (v >>= 1) {
+            ++n;
+        }
+        return n;
+#endif
+    }
+
+    static constexpr size_type segment_size(unsigned s) noexcept {
+        return first_segment_size << s;
+    }
+
+    // 下标 i 映射到段 s = log2(i + 32) - 5，段内偏移为 i + 32 - 32 * 2^s
+    static std::pair<unsigned, size_type> locate(size_type index) noexcept {
+        const size_type j = index + first_segment_size;
+        const unsigned s = floor_log2(j) - first_segment_log;
+        return {s, j - segment_size(s)};
+    }
+
+    static ready_flag* flags_of(T* segment, unsigned s) noexcept {
+        return reinterpret_cast<ready_flag*>(reinterpret_cast<unsigned char*>(segment) + segment_size(s) * sizeof(T));
+    }
+
+    static T* allocate_segment(unsigned s) {
+        const size_type n = segment_size(s);
+        if (n > static_cast<size_type>(-1) / (sizeof(T) + sizeof(ready_flag))) {
+            throw std::length_error("concurrent_vector capacity exceeded");
+        }
+        void* raw = ::operator new(n * (sizeof(T) + sizeof(ready_flag)), std::align_val_t(alignof(T)));
+        T* segment = static_cast<T*>(raw);
+        ready_flag* flags = flags_of(segment, s);
+        for (size_type i = 0; i < n; ++i) {
+            new (flags + i) ready_flag(0);
+        }
+        return segment;
+    }
+
+    static void deallocate_segment(T* segment) noexcept {
+        ::operator delete(static_cast<void*>(segment), std::align_val_t(alignof(T)));
+    }
+
+    // 取得段 s，尚未分配时分配并以 CAS 发布（竞争失败的一方释放自己的分配）
+    T* ensure_segment(unsigned s) {
+        if (s >= max_segments) {
+            throw std::length_error("concurrent_vector capacity exceeded");
+        }
+        T* segment = segments_[s].load(std::memory_order_acquire);
+        if (segment != nullptr) {
+            return segment;
+        }
+        T* fresh = allocate_segment(s);
+        if (segments_[s].compare_exchange_strong(segment, fresh, std::memory_order_acq_rel,
+                                                 std::memory_order_acquire)) {
+            return fresh;
+        }
+        deallocate_segment(fresh);
+        return segment;
+    }
+
+    bool is_ready(size_type index) const noexcept {
+        auto [s, offset] = locate(index);
+        T* segment = segments_[s].load(std::memory_order_acquire);
+        return segment != nullptr && flags_of(segment, s)[offset].load(std::memory_order_seq_cst) == 1;
+    }
+
+    // 把已完成前缀推进到第一个未就绪的槽位；由每个完成构造的线程调用
+    void advance_completed() noexcept {
+        size_type current = completed_.load(std::memory_order_seq_cst);
+        for (;;) {
+            const size_type limit = reserved_.load(std::memory_order_acquire);
+            size_type next = current;
+            while (next < limit && is_ready(next)) {
+                ++next;
+            }
+            if (next == current) {
+                return;
+            }
+            if (completed_.compare_exchange_weak(current, next, std::memory_order_seq_cst)) {
+                current = next;
+            }
+        }
+    }
+
+    // 预留 [first, first + n)：先确保覆盖这些槽位的段都已分配，再以 CAS 发布预留；
+    // 分配失败（bad_alloc / length_error）时 reserved_ 保持不变，不会留下永远挡住 size() 的空洞
+    size_type claim(size_type n) {
+        size_type first = reserved_.load(std::memory_order_acquire);
+        if (n == 0) {
+            return first;
+        }
+        for (;;) {
+            if (n > max_size() - first) {
+                throw std::length_error("concurrent_vector capacity exceeded");
+            }
+            const unsigned last = locate(first + n - 1).first;
+            for (unsigned s = locate(first).first; s <= last; ++s) {
+                ensure_segment(s);
+            }
+            if (reserved_.compare_exchange_weak(first, first + n, std::memory_order_acq_rel,
+                                                std::memory_order_acquire)) {
+                return first;
+            }
+        }
+    }
+
+    // index 必须已由 claim 预留，所在段已分配
+    template <typename... Args>
+    void construct_at(size_type index, Args&&... args) {
+        auto [s, offset] = locate(index);
+        T* segment = segments_[s].load(std::memory_order_acquire);
+        new (segment + offset) T(std::forward<Args>(args)...);
+        flags_of(segment, s)[offset].store(1, std::memory_order_seq_cst);
+    }
+
+    // 预留 [first, first + n) 并逐个构造；make(index, i) 在下标 index 处构造第 i 个元素
+    template <typename Make>
+    size_type grow_with(size_type n, Make make) {
+        const size_type first = claim(n);
+        for (size_type i = 0; i < n; ++i) {
+            make(first + i, i);
+        }
+        advance_completed();
+        return first;
+    }
+
+    template <typename Func>
+    void for_each_slot(size_type first, size_type last, Func func) const {
+        while (first < last) {
+            auto [s, offset] = locate(first);
+            T* segment = segments_[s].load(std::memory_order_acquire);
+            const size_type n = std::min(segment_size(s) - offset, last - first);
+            for (size_type i = 0; i < n; ++i) {
+                func(segment[offset + i]);
+            }
+            first += n;
+        }
+    }
+
+    void destroy_all() noexcept {
+        const size_type reserved = reserved_.load(std::memory_order_relaxed);
+        for (unsigned s = 0; s < max_segments; ++s) {
+            T* segment = segments_[s].load(std::memory_order_relaxed);
+            if (segment == nullptr) {
+                continue;
+            }
+            const size_type base = segment_size(s) - first_segment_size;
+            const size_type used = reserved > base ? std::min(segment_size(s), reserved - base) : 0;
+            ready_flag* flags = flags_of(segment, s);
+            for (size_type i = 0; i < used; ++i) {
+                if (flags[i].load(std::memory_order_relaxed) == 1) {
+                    segment[i].~T();
+                }
+            }
+            deallocate_segment(segment);
+            segments_[s].store(nullptr, std::memory_order_relaxed);
+        }
+    }
+
+public:
+    // ==================== 构造函数 ====================
+
+    concurrent_vector() = default;
+
+    concurrent_vector(size_type count, const T& value) {
+        grow_by(count, value);
+    }
+
+    concurrent_vector(std::initializer_list<T> init) {
+        grow_by(init.begin(), init.end());
+    }
+
+    template <typename InputIt, typename = std::enable_if_t<!std::is_integral_v<InputIt>>>
+    concurrent_vector(InputIt first, InputIt last) {
+        for (; first != last; ++first) {
+            push_back(*first);
+        }
+    }
+
+    /**
+     * @brief 从 ts_stl::vector 构造（在其读锁内复制）
+     */
+    template <LockPolicy Policy>
+    explicit concurrent_vector(const vector<T, Policy>& other) {
+        const auto items = other.copy();
+        grow_by(items.begin(), items.end());
+    }
+
+    // 其它线程可能持有元素引用，容器不可复制、不可移动；需要副本时使用 to_std_vector / to_vector
+    concurrent_vector(const concurrent_vector&) = delete;
+    concurrent_vector& operator=(const concurrent_vector&) = delete;
+
+    ~concurrent_vector() {
+        destroy_all();
+    }
+
+    // ==================== 追加操作（无锁） ====================
+
+    /**
+     * @brief 追加元素
+     * @return 新元素的下标
+     */
+    size_type push_back(const T& value) {
+        return emplace_back(value);
+    }
+
+    size_type push_back(T&& value) {
+        return emplace_back(std::move(value));
+    }
+
+    /**
+     * @brief 原地构造并追加元素
+     * @return 新元素的下标
+     */
+    template <typename... Args>
+    size_type emplace_back(Args&&... args) {
+        const size_type index = claim(1);
+        construct_at(index, std::forward<Args>(args)...);
+        advance_completed();
+        return index;
+    }
+
+    /**
+     * @brief 一次预留 n 个连续槽位，全部以 value 构造
+     * @return 第一个新元素的下标
+     */
+    size_type grow_by(size_type n, const T& value = T()) {
+        return grow_with(n, [this, &value](size_type index, size_type) { construct_at(index, value); });
+    }
+
+    /**
+     * @brief 一次预留 distance(first, last) 个连续槽位并依次复制 [first, last)
+     * @return 第一个新元素的下标
+     */
+    template <typename ForwardIt, typename = std::enable_if_t<!std::is_integral_v<ForwardIt>>>
+    size_type grow_by(ForwardIt first, ForwardIt last) {
+        const auto n = static_cast<size_type>(std::distance(first, last));
+        return grow_with(n, [this, &first](size_type index, size_type) {
+            construct_at(index, *first);
+            ++first;
+        });
+    }
+
+    size_type grow_by(std::initializer_list<T> init) {
+        return grow_by(init.begin(), init.end());
+    }
+
+    /**
+     * @brief 预先分配足以容纳 n 个元素的段（可与追加并发调用）
+     */
+    void reserve(size_type n) {
+        if (n == 0) {
+            return;
+        }
+        const unsigned last = locate(n - 1).first;
+        for (unsigned s = 0; s <= last; ++s) {
+            ensure_segment(s);
+        }
+    }
+
+    // ==================== 容量 ====================
+
+    /**
+     * @brief 已完成前缀的长度：[0, size()) 内的元素均已构造、可安全读取
+     */
+    size_type size() const noexcept {
+        return completed_.load(std::memory_order_acquire);
+    }
+
+    bool empty() const noexcept {
+        return size() == 0;
+    }
+
+    /**
+     * @brief 已预留的槽位数（包括正在构造、尚未计入 size() 的槽位）
+     */
+    size_type reserved_size() const noexcept {
+        return reserved_.load(std::memory_order_acquire);
+    }
+
+    /**
+     * @brief 已分配段的总容量
+     */
+    size_type capacity() const noexcept {
+        size_type total = 0;
+        for (unsigned s = 0; s < max_segments; ++s) {
+            if (segments_[s].load(std::memory_order_acquire) == nullptr) {
+                break;
+            }
+            total += segment_size(s);
+        }
+        return total;
+    }
+
+    static constexpr size_type max_size() noexcept {
+        return static_cast<size_type>(-1) - first_segment_size + 1;
+    }
+
+    // ==================== 元素访问 ====================
+
+    /**
+     * @brief 访问下标 index 的元素（不检查边界；index 须小于 size() 或是本线程追加返回的下标）
+     */
+    reference operator[](size_type index) noexcept {
+        auto [s, offset] = locate(index);
+        return segments_[s].load(std::memory_order_acquire)[offset];
+    }
+
+    const_reference operator[](size_type index) const noexcept {
+        auto [s, offset] = locate(index);
+        return segments_[s].load(std::memory_order_acquire)[offset];
+    }
+
+    reference at(size_type index) {
+        if (index >= size()) {
+            throw std::out_of_range("concurrent_vector::at: index out of range");
+        }
+        return (*this)[index];
+    }
+
+    const_reference at(size_type index) const {
+        if (index >= size()) {
+            throw std::out_of_range("concurrent_vector::at: index out of range");
+        }
+        return (*this)[index];
+    }
+
+    // ==================== 遍历（已完成前缀） ====================
+
+    /**
+     * @brief 对调用时的已完成前缀中的每个元素执行 func(const T&)
+     */
+    template <typename Func>
+    void for_each(Func func) const {
+        for_each_slot(0, size(), [&func](const T& value) { func(value); });
+    }
+
+    /**
+     * @brief 从下标 from 开始遍历到当前已完成前缀末尾，适合增量消费追加日志
+     * @return 本次遍历结束的位置，可作为下一次调用的 from
+     */
+    template <typename Func>
+    size_type scan(size_type from, Func func) const {
+        const size_type last = size();
+        if (from < last) {
+            for_each_slot(from, last, [&func](const T& value) { func(value); });
+        }
+        return std::max(from, last);
+    }
+
+    // ==================== 与其它容器互操作 ====================
+
+    /**
+     * @brief 复制已完成前缀到 std::vector
+     */
+    std::vector<T> to_std_vector() const {
+        std::vector<T> out;
+        out.reserve(size());
+        for_each([&out](const T& value) { out.push_back(value); });
+        return out;
+    }
+
+    /**
+     * @brief 复制已完成前缀到 ts_stl::vector
+     */
+    template <LockPolicy Policy = LockPolicy::Mutex>
+    vector<T, Policy> to_vector() const {
+        auto items = to_std_vector();
+        return vector<T, Policy>(std::make_move_iterator(items.begin()), std::make_move_iterator(items.end()));
+    }
+
+    // ==================== 清空（非线程安全） ====================
+
+    /**
+     * @brief 销毁所有元素并释放所有段；调用时不得有其它线程访问容器
+     */
+    void clear() noexcept {
+        destroy_all();
+        reserved_.store(0, std::memory_order_relaxed);
+        completed_.store(0, std::memory_order_relaxed);
+    }
+};
+
+} // namespace ts_stl
+
+#endif // TS_CONCURRENT_VECTOR_HPP
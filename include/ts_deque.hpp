@@ -202,6 +202,34 @@ public:
         }
     }
 
+    /**
+     * @brief 原子地取出并移除队首元素
+     * @return 为空时返回 false，out 保持不变
+     */
+    bool try_pop_front(T& out) {
+        auto guard = acquire_write_lock();
+        if (data_.empty()) {
+            return false;
+        }
+        out = std::move(data_.front());
+        data_.pop_front();
+        return true;
+    }
+
+    /**
+     * @brief 原子地取出并移除队尾元素
+     * @return 为空时返回 false，out 保持不变
+     */
+    bool try_pop_back(T& out) {
+        auto guard = acquire_write_lock();
+        if (data_.empty()) {
+            return false;
+        }
+        out = std::move(data_.back());
+        data_.pop_back();
+        return true;
+    }
+
     template <typename... Args>
     reference emplace_back(Args&&... args) {
         auto guard = acquire_write_lock();
@@ -216,6 +244,43 @@ public:
         return data_.front();
     }
 
+    // ==================== 批量操作（单次加锁） ====================
+
+    /**
+     * @brief 批量追加区间内的元素到末尾（只加锁一次）
+     */
+    template <typename InputIt>
+    void push_back_range(InputIt first, InputIt last) {
+        auto guard = acquire_write_lock();
+        data_.insert(data_.end(), first, last);
+    }
+
+    template <typename Range>
+    void push_back_range(const Range& range) {
+        push_back_range(std::begin(range), std::end(range));
+    }
+
+    /**
+     * @brief 批量按下标读取，越界的下标输出 default_value（只加锁一次）
+     * @return 有效下标的个数
+     */
+    template <typename IndexRange, typename OutputIt>
+    size_type get_many(const IndexRange& indices, OutputIt out, const T& default_value = T()) const {
+        auto guard = acquire_read_lock();
+        size_type found = 0;
+        for (const auto& index : indices) {
+            auto pos = static_cast<size_type>(index);
+            if (pos < data_.size()) {
+                *out = data_[pos];
+                ++found;
+            } else {
+                *out = default_value;
+            }
+            ++out;
+        }
+        return found;
+    }
+
     // ==================== STL兼容性 ====================
 
     operator const std::deque<T>&() const {
@@ -423,6 +488,16 @@ public:
         data_.clear();
     }
 
+    std::deque<T> drain() noexcept {
+        std::deque<T> out;
+        data_.swap(out);
+        return out;
+    }
+
+    void swap_out(std::deque<T>& other) noexcept {
+        data_.swap(other);
+    }
+
     void shrink_to_fit() noexcept {
         data_.shrink_to_fit();
     }
@@ -455,6 +530,24 @@ public:
         }
     }
 
+    bool try_pop_front(T& out) {
+        if (data_.empty()) {
+            return false;
+        }
+        out = std::move(data_.front());
+        data_.pop_front();
+        return true;
+    }
+
+    bool try_pop_back(T& out) {
+        if (data_.empty()) {
+            return false;
+        }
+        out = std::move(data_.back());
+        data_.pop_back();
+        return true;
+    }
+
     template <typename... Args>
     reference emplace_back(Args&&... args) {
         data_.emplace_back(std::forward<Args>(args)...);
@@ -467,6 +560,39 @@ public:
         return data_.front();
     }
 
+    /**
+     * @brief 批量追加区间内的元素到末尾
+     */
+    template <typename InputIt>
+    void push_back_range(InputIt first, InputIt last) {
+        data_.insert(data_.end(), first, last);
+    }
+
+    template <typename Range>
+    void push_back_range(const Range& range) {
+        push_back_range(std::begin(range), std::end(range));
+    }
+
+    /**
+     * @brief 批量按下标读取，越界的下标输出 default_value
+     * @return 有效下标的个数
+     */
+    template <typename IndexRange, typename OutputIt>
+    size_type get_many(const IndexRange& indices, OutputIt out, const T& default_value = T()) const {
+        size_type found = 0;
+        for (const auto& index : indices) {
+            auto pos = static_cast<size_type>(index);
+            if (pos < data_.size()) {
+                *out = data_[pos];
+                ++found;
+            } else {
+                *out = default_value;
+            }
+            ++out;
+        }
+        return found;
+    }
+
     operator std::deque<T>&() noexcept {
         return data_;
     }
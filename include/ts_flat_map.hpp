@@ -0,0 +1,2294 @@
+#pragma once
+
+#ifndef TS_FLAT_MAP_HPP
+#define TS_FLAT_MAP_HPP
+
+#include <algorithm>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <optional>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "ts_stl_base.hpp"
+
+namespace ts_stl {
+
+namespace detail {
+
+struct flat_map_key_of {
+    template <typename Pair>
+    const typename Pair::first_type& operator()(const Pair& value) const noexcept {
+        return value.first;
+    }
+};
+
+struct flat_set_key_of {
+    template <typename Key>
+    const Key& operator()(const Key& value) const noexcept {
+        return value;
+    }
+};
+
+/**
+ * @brief 有序 vector 容器的公共部分：存储、二分查找、删除与批量合并
+ * @tparam Key 键类型
+ * @tparam Value 元素类型（map 为 std::pair<Key, T>，set 为 Key）
+ * @tparam KeyOf 从元素取键的函数对象
+ * @tparam Compare 比较器
+ */
+template <typename Key, typename Value, typename KeyOf, typename Compare>
+class sorted_vector_base {
+public:
+    using key_type = Key;
+    using value_type = Value;
+    using key_compare = Compare;
+    using container_type = std::vector<Value>;
+    using size_type = typename container_type::size_type;
+    using difference_type = typename container_type::difference_type;
+    using iterator = typename container_type::iterator;
+    using const_iterator = typename container_type::const_iterator;
+    using reverse_iterator = typename container_type::reverse_iterator;
+    using const_reverse_iterator = typename container_type::const_reverse_iterator;
+
+protected:
+    container_type data_;
+    Compare comp_;
+
+    template <typename K>
+    bool value_less_key(const Value& value, const K& key) const {
+        return comp_(KeyOf()(value), key);
+    }
+
+    template <typename K>
+    bool key_less_value(const K& key, const Value& value) const {
+        return comp_(key, KeyOf()(value));
+    }
+
+    bool keys_equal(const Value& a, const Value& b) const {
+        return !comp_(KeyOf()(a), KeyOf()(b)) && !comp_(KeyOf()(b), KeyOf()(a));
+    }
+
+    /**
+     * @brief 无分支二分查找：循环体只有一次比较和条件移动，预取下一轮可能访问的两个位置
+     * @param before 判断元素是否排在查找位置之前
+     */
+    template <typename Before>
+    size_type partition_index(Before before) const {
+        size_type n = data_.size();
+        if (n == 0) {
+            return 0;
+        }
+        const Value* base = data_.data();
+        while (n > 1) {
+            size_type half = n / 2;
+#if defined(__GNUC__) || defined(__clang__)
+            __builtin_prefetch(base + half / 2);
+            __builtin_prefetch(base + half + half / 2);
+#endif
+            base = before(base[half]) ? base + half : base;
+            n -= half;
+        }
+        return static_cast<size_type>(base - data_.data()) + (before(*base) ? 1 : 0);
+    }
+
+    template <typename K>
+    size_type lower_index(const K& key) const {
+        return partition_index([this, &key](const Value& v) { return value_less_key(v, key); });
+    }
+
+    template <typename K>
+    size_type upper_index(const K& key) const {
+        return partition_index([this, &key](const Value& v) { return !key_less_value(key, v); });
+    }
+
+    template <typename K>
+    size_type find_index(const K& key) const {
+        size_type i = lower_index(key);
+        if (i != data_.size() && !key_less_value(key, data_[i])) {
+            return i;
+        }
+        return data_.size();
+    }
+
+    /**
+     * @brief 把 [sorted, size()) 追加段排序后与前面的有序段合并并去重
+     *
+     * 合并是稳定的：键重复时保留已有元素，追加段内保留先出现的元素。
+     */
+    void merge_tail(size_type sorted) {
+        auto less = [this](const Value& a, const Value& b) { return comp_(KeyOf()(a), KeyOf()(b)); };
+        auto middle = data_.begin() + static_cast<difference_type>(sorted);
+        std::stable_sort(middle, data_.end(), less);
+        std::inplace_merge(data_.begin(), middle, data_.end(), less);
+        auto last = std::unique(data_.begin(), data_.end(),
+                                [this](const Value& a, const Value& b) { return keys_equal(a, b); });
+        data_.erase(last, data_.end());
+    }
+
+    sorted_vector_base() = default;
+
+    explicit sorted_vector_base(const Compare& comp) : comp_(comp) {}
+
+public:
+    // ==================== 迭代器 ====================
+
+    iterator begin() noexcept {
+        return data_.begin();
+    }
+
+    const_iterator begin() const noexcept {
+        return data_.begin();
+    }
+
+    const_iterator cbegin() const noexcept {
+        return data_.cbegin();
+    }
+
+    iterator end() noexcept {
+        return data_.end();
+    }
+
+    const_iterator end() const noexcept {
+        return data_.end();
+    }
+
+    const_iterator cend() const noexcept {
+        return data_.cend();
+    }
+
+    reverse_iterator rbegin() noexcept {
+        return data_.rbegin();
+    }
+
+    const_reverse_iterator rbegin() const noexcept {
+        return data_.rbegin();
+    }
+
+    reverse_iterator rend() noexcept {
+        return data_.rend();
+    }
+
+    const_reverse_iterator rend() const noexcept {
+        return data_.rend();
+    }
+
+    // ==================== 容量管理 ====================
+
+    size_type size() const noexcept {
+        return data_.size();
+    }
+
+    bool empty() const noexcept {
+        return data_.empty();
+    }
+
+    size_type capacity() const noexcept {
+        return data_.capacity();
+    }
+
+    void reserve(size_type n) {
+        data_.reserve(n);
+    }
+
+    void shrink_to_fit() {
+        data_.shrink_to_fit();
+    }
+
+    void clear() noexcept {
+        data_.clear();
+    }
+
+    // ==================== 查找操作（O(log n)） ====================
+
+    iterator lower_bound(const Key& key) {
+        return begin() + static_cast<difference_type>(lower_index(key));
+    }
+
+    const_iterator lower_bound(const Key& key) const {
+        return begin() + static_cast<difference_type>(lower_index(key));
+    }
+
+    iterator upper_bound(const Key& key) {
+        return begin() + static_cast<difference_type>(upper_index(key));
+    }
+
+    const_iterator upper_bound(const Key& key) const {
+        return begin() + static_cast<difference_type>(upper_index(key));
+    }
+
+    iterator find(const Key& key) {
+        return begin() + static_cast<difference_type>(find_index(key));
+    }
+
+    const_iterator find(const Key& key) const {
+        return begin() + static_cast<difference_type>(find_index(key));
+    }
+
+    bool contains(const Key& key) const {
+        return find_index(key) != data_.size();
+    }
+
+    size_type count(const Key& key) const {
+        return contains(key) ? 1 : 0;
+    }
+
+    template <typename K, typename C = Compare, enable_if_transparent_t<C> = 0>
+    const_iterator lower_bound(const K& key) const {
+        return begin() + static_cast<difference_type>(lower_index(key));
+    }
+
+    template <typename K, typename C = Compare, enable_if_transparent_t<C> = 0>
+    const_iterator upper_bound(const K& key) const {
+        return begin() + static_cast<difference_type>(upper_index(key));
+    }
+
+    template <typename K, typename C = Compare, enable_if_transparent_t<C> = 0>
+    iterator find(const K& key) {
+        return begin() + static_cast<difference_type>(find_index(key));
+    }
+
+    template <typename K, typename C = Compare, enable_if_transparent_t<C> = 0>
+    const_iterator find(const K& key) const {
+        return begin() + static_cast<difference_type>(find_index(key));
+    }
+
+    template <typename K, typename C = Compare, enable_if_transparent_t<C> = 0>
+    bool contains(const K& key) const {
+        return find_index(key) != data_.size();
+    }
+
+    template <typename K, typename C = Compare, enable_if_transparent_t<C> = 0>
+    size_type count(const K& key) const {
+        return contains(key) ? 1 : 0;
+    }
+
+    // ==================== 删除操作 ====================
+
+    size_type erase(const Key& key) {
+        size_type i = find_index(key);
+        if (i == data_.size()) {
+            return 0;
+        }
+        data_.erase(data_.begin() + static_cast<difference_type>(i));
+        return 1;
+    }
+
+    iterator erase(const_iterator pos) {
+        return data_.erase(pos);
+    }
+
+    iterator erase(const_iterator first, const_iterator last) {
+        return data_.erase(first, last);
+    }
+
+    /**
+     * @brief 一趟删除所有满足 pred 的元素（O(n)）
+     * @return 删除的元素个数
+     */
+    template <typename Predicate>
+    size_type erase_if(Predicate pred) {
+        auto last = std::remove_if(data_.begin(), data_.end(), pred);
+        size_type erased = static_cast<size_type>(data_.end() - last);
+        data_.erase(last, data_.end());
+        return erased;
+    }
+
+    // ==================== 底层存储 ====================
+
+    /**
+     * @brief 连续存储的元素首地址（按键升序）
+     */
+    const value_type* data() const noexcept {
+        return data_.data();
+    }
+
+    const container_type& sequence() const noexcept {
+        return data_;
+    }
+
+    /**
+     * @brief 取出底层 vector，本容器变为空
+     */
+    container_type extract_sequence() noexcept {
+        container_type out = std::move(data_);
+        data_.clear();
+        return out;
+    }
+
+    key_compare key_comp() const {
+        return comp_;
+    }
+
+    friend bool operator==(const sorted_vector_base& a, const sorted_vector_base& b) {
+        return a.data_ == b.data_;
+    }
+
+    friend bool operator!=(const sorted_vector_base& a, const sorted_vector_base& b) {
+        return !(a == b);
+    }
+};
+
+} // namespace detail
+
+/**
+ * @brief 基于有序 vector 的 map（非线程安全）
+ * @tparam Key 键类型
+ * @tparam T 值类型
+ * @tparam Compare 比较器（默认使用std::less）
+ *
+ * 元素按键升序连续存放：查找为无分支二分查找，遍历和区间扫描是顺序内存访问。
+ * 单个插入/删除需要移动后续元素（O(n)），适合一次构建、大量查询的场景；
+ * 批量插入只排序合并一次。
+ *
+ * 注意：元素类型为 std::pair<Key, T>（键可移动），不得通过迭代器修改键；
+ * 插入与删除会使迭代器失效。
+ */
+template <typename Key, typename T, typename Compare = std::less<Key>>
+class sorted_vector_map : public detail::sorted_vector_base<Key, std::pair<Key, T>, detail::flat_map_key_of, Compare> {
+private:
+    using Base = detail::sorted_vector_base<Key, std::pair<Key, T>, detail::flat_map_key_of, Compare>;
+    using Base::data_;
+    using Base::lower_index;
+    using Base::find_index;
+    using Base::key_less_value;
+    using Base::merge_tail;
+
+public:
+    using mapped_type = T;
+    using typename Base::value_type;
+    using typename Base::size_type;
+    using typename Base::difference_type;
+    using typename Base::iterator;
+    using typename Base::const_iterator;
+    using typename Base::container_type;
+
+    // ==================== 构造函数 ====================
+
+    sorted_vector_map() = default;
+
+    explicit sorted_vector_map(const Compare& comp) : Base(comp) {}
+
+    /**
+     * @brief 批量构建：追加全部元素后只排序去重一次（键重复时保留先出现的）
+     */
+    template <typename InputIt>
+    sorted_vector_map(InputIt first, InputIt last, const Compare& comp = Compare()) : Base(comp) {
+        insert(first, last);
+    }
+
+    sorted_vector_map(std::initializer_list<value_type> init, const Compare& comp = Compare()) : Base(comp) {
+        insert(init.begin(), init.end());
+    }
+
+    /**
+     * @brief 接管一个（可以无序的）vector
+     */
+    explicit sorted_vector_map(container_type items, const Compare& comp = Compare()) : Base(comp) {
+        data_ = std::move(items);
+        merge_tail(0);
+    }
+
+    // ==================== 元素访问 ====================
+
+    T& operator[](const Key& key) {
+        return try_emplace(key).first->second;
+    }
+
+    T& at(const Key& key) {
+        size_type i = find_index(key);
+        if (i == data_.size()) {
+            throw std::out_of_range("sorted_vector_map::at key not found");
+        }
+        return data_[i].second;
+    }
+
+    const T& at(const Key& key) const {
+        return const_cast<sorted_vector_map*>(this)->at(key);
+    }
+
+    template <typename K, typename C = Compare, detail::enable_if_transparent_t<C> = 0>
+    T& at(const K& key) {
+        size_type i = find_index(key);
+        if (i == data_.size()) {
+            throw std::out_of_range("sorted_vector_map::at key not found");
+        }
+        return data_[i].second;
+    }
+
+    template <typename K, typename C = Compare, detail::enable_if_transparent_t<C> = 0>
+    const T& at(const K& key) const {
+        return const_cast<sorted_vector_map*>(this)->at(key);
+    }
+
+    // ==================== 修改操作 ====================
+
+    /**
+     * @brief 键不存在时以 args 构造值并插入到有序位置（O(log n) 查找 + O(n) 移动）
+     */
+    template <typename K, typename... Args>
+    std::pair<iterator, bool> try_emplace(K&& key, Args&&... args) {
+        size_type i = lower_index(key);
+        if (i != data_.size() && !key_less_value(key, data_[i])) {
+            return {data_.begin() + static_cast<difference_type>(i), false};
+        }
+        auto it = data_.emplace(data_.begin() + static_cast<difference_type>(i), std::piecewise_construct,
+                                std::forward_as_tuple(std::forward<K>(key)),
+                                std::forward_as_tuple(std::forward<Args>(args)...));
+        return {it, true};
+    }
+
+    template <typename K, typename... Args>
+    std::pair<iterator, bool> emplace(K&& key, Args&&... args) {
+        return try_emplace(std::forward<K>(key), std::forward<Args>(args)...);
+    }
+
+    std::pair<iterator, bool> insert(const value_type& value) {
+        return try_emplace(value.first, value.second);
+    }
+
+    std::pair<iterator, bool> insert(value_type&& value) {
+        return try_emplace(std::move(value.first), std::move(value.second));
+    }
+
+    template <typename M>
+    std::pair<iterator, bool> insert_or_assign(const Key& key, M&& value) {
+        auto result = try_emplace(key, std::forward<M>(value));
+        if (!result.second) {
+            result.first->second = std::forward<M>(value);
+        }
+        return result;
+    }
+
+    /**
+     * @brief 批量插入：追加后排序合并一次（O((n + m) log m)），已存在的键保持不变
+     */
+    template <typename InputIt>
+    void insert(InputIt first, InputIt last) {
+        size_type sorted = data_.size();
+        data_.reserve(sorted + detail::bulk_size_hint(first, last));
+        for (; first != last; ++first) {
+            data_.emplace_back(*first);
+        }
+        merge_tail(sorted);
+    }
+
+    /**
+     * @brief 用新的元素序列整体替换（排序去重一次）
+     */
+    template <typename InputIt>
+    void assign(InputIt first, InputIt last) {
+        data_.clear();
+        insert(first, last);
+    }
+
+    void swap(sorted_vector_map& other) noexcept {
+        data_.swap(other.data_);
+        std::swap(this->comp_, other.comp_);
+    }
+};
+
+/**
+ * @brief 基于有序 vector 的 set（非线程安全）
+ * @tparam Key 键类型
+ * @tparam Compare 比较器（默认使用std::less）
+ *
+ * 与 sorted_vector_map 相同：查找 O(log n)、单个插入删除 O(n)、批量插入只排序合并一次。
+ */
+template <typename Key, typename Compare = std::less<Key>>
+class sorted_vector_set : public detail::sorted_vector_base<Key, Key, detail::flat_set_key_of, Compare> {
+private:
+    using Base = detail::sorted_vector_base<Key, Key, detail::flat_set_key_of, Compare>;
+    using Base::data_;
+    using Base::lower_index;
+    using Base::key_less_value;
+    using Base::merge_tail;
+
+public:
+    using typename Base::value_type;
+    using typename Base::size_type;
+    using typename Base::difference_type;
+    using typename Base::iterator;
+    using typename Base::const_iterator;
+    using typename Base::container_type;
+
+    // ==================== 构造函数 ====================
+
+    sorted_vector_set() = default;
+
+    explicit sorted_vector_set(const Compare& comp) : Base(comp) {}
+
+    template <typename InputIt>
+    sorted_vector_set(InputIt first, InputIt last, const Compare& comp = Compare()) : Base(comp) {
+        insert(first, last);
+    }
+
+    sorted_vector_set(std::initializer_list<value_type> init, const Compare& comp = Compare()) : Base(comp) {
+        insert(init.begin(), init.end());
+    }
+
+    explicit sorted_vector_set(container_type items, const Compare& comp = Compare()) : Base(comp) {
+        data_ = std::move(items);
+        merge_tail(0);
+    }
+
+    // ==================== 修改操作 ====================
+
+    template <typename K>
+    std::pair<iterator, bool> insert(K&& key) {
+        size_type i = lower_index(key);
+        if (i != data_.size() && !key_less_value(key, data_[i])) {
+            return {data_.begin() + static_cast<difference_type>(i), false};
+        }
+        return {data_.insert(data_.begin() + static_cast<difference_type>(i), std::forward<K>(key)), true};
+    }
+
+    template <typename... Args>
+    std::pair<iterator, bool> emplace(Args&&... args) {
+        return insert(Key(std::forward<Args>(args)...));
+    }
+
+    /**
+     * @brief 批量插入：追加后排序合并一次，已存在的键保持不变
+     */
+    template <typename InputIt>
+    void insert(InputIt first, InputIt last) {
+        size_type sorted = data_.size();
+        data_.reserve(sorted + detail::bulk_size_hint(first, last));
+        data_.insert(data_.end(), first, last);
+        merge_tail(sorted);
+    }
+
+    template <typename InputIt>
+    void assign(InputIt first, InputIt last) {
+        data_.clear();
+        insert(first, last);
+    }
+
+    void swap(sorted_vector_set& other) noexcept {
+        data_.swap(other.data_);
+        std::swap(this->comp_, other.comp_);
+    }
+};
+
+/**
+ * @brief 线程安全的有序 vector Map（接口与 map 一致）
+ * @tparam Key 键类型
+ * @tparam T 值类型
+ * @tparam Compare 比较器（默认使用std::less）
+ * @tparam Policy 锁策略（默认使用互斥锁）
+ *
+ * 底层为 sorted_vector_map：查找 O(log n) 且缓存友好，单个插入/删除 O(n)。
+ * 适合“批量构建一次、之后以读为主”的场景，配合 ReadWrite 策略时
+ * 多个读者可并发查找与区间扫描；写入尽量走 insert_bulk / assign。
+ */
+template <typename Key, typename T, typename Compare = std::less<Key>, LockPolicy Policy = LockPolicy::Mutex>
+class flat_map : public container_mixin<flat_map<Key, T, Compare, Policy>, std::pair<Key, T>, Policy> {
+private:
+    friend class container_mixin<flat_map<Key, T, Compare, Policy>, std::pair<Key, T>, Policy>;
+
+    sorted_vector_map<Key, T, Compare> data_;
+
+    using Base = container_mixin<flat_map<Key, T, Compare, Policy>, std::pair<Key, T>, Policy>;
+    using Base::acquire_write_lock;
+    using Base::acquire_read_lock;
+
+public:
+    // 为基类提供必要的类型信息
+    using Container = sorted_vector_map<Key, T, Compare>;
+    
+    using key_type = Key;
+    using mapped_type = T;
+    using value_type = std::pair<Key, T>;
+    using size_type = typename sorted_vector_map<Key, T, Compare>::size_type;
+    using iterator = typename sorted_vector_map<Key, T, Compare>::iterator;
+    using const_iterator = typename sorted_vector_map<Key, T, Compare>::const_iterator;
+    using reverse_iterator = typename sorted_vector_map<Key, T, Compare>::reverse_iterator;
+    using const_reverse_iterator = typename sorted_vector_map<Key, T, Compare>::const_reverse_iterator;
+
+    // ==================== 构造函数 ====================
+
+    flat_map() : Base() {}
+
+    explicit flat_map(const Compare& comp) : Base() {
+        data_ = sorted_vector_map<Key, T, Compare>(comp);
+    }
+
+    /**
+     * @brief 批量构建：只排序去重一次（键重复时保留先出现的）
+     */
+    template <typename InputIt>
+    flat_map(InputIt first, InputIt last) : Base() {
+        data_.insert(first, last);
+    }
+
+    flat_map(const flat_map& other) : Base() {
+        auto guard = acquire_write_lock();
+        data_ = other.data_;
+    }
+
+    flat_map& operator=(const flat_map& other) {
+        if (this != &other) {
+            auto guard = acquire_write_lock();
+            data_ = other.data_;
+        }
+        return *this;
+    }
+
+    flat_map(flat_map&& other) noexcept : Base() {
+        auto guard = acquire_write_lock();
+        data_ = std::move(other.data_);
+    }
+
+    flat_map& operator=(flat_map&& other) noexcept {
+        if (this != &other) {
+            auto guard = acquire_write_lock();
+            data_ = std::move(other.data_);
+        }
+        return *this;
+    }
+
+    // ==================== 元素访问 ====================
+
+    /**
+     * @brief 获取指定键对应的值（如果键不存在则插入默认值）
+     */
+    T& operator[](const Key& key) {
+        auto guard = acquire_write_lock();
+        return data_[key];
+    }
+
+    /**
+     * @brief 获取指定键对应的值（const版本）
+     */
+    T at(const Key& key) const {
+        auto guard = acquire_read_lock();
+        return data_.at(key);
+    }
+
+    /**
+     * @brief 获取指定键对应的值（非const版本）
+     */
+    T& at(const Key& key) {
+        auto guard = acquire_write_lock();
+        return data_.at(key);
+    }
+
+    /**
+     * @brief 设置指定键的值
+     */
+    void set(const Key& key, const T& value) {
+        auto guard = acquire_write_lock();
+        data_[key] = value;
+    }
+
+    /**
+     * @brief 获取指定键的值，如果不存在返回默认值
+     */
+    T get(const Key& key, const T& default_value = T()) const {
+        auto guard = acquire_read_lock();
+        auto it = data_.find(key);
+        if (it != data_.end()) {
+            return it->second;
+        }
+        return default_value;
+    }
+
+    // ==================== 容量管理 ====================
+
+    /**
+     * @brief 获取map的大小
+     */
+    size_type size() const {
+        auto guard = acquire_read_lock();
+        return data_.size();
+    }
+
+    /**
+     * @brief 检查map是否为空
+     */
+    bool empty() const {
+        auto guard = acquire_read_lock();
+        return data_.empty();
+    }
+
+    /**
+     * @brief 清空map
+     */
+    void clear() {
+        auto guard = acquire_write_lock();
+        data_.clear();
+    }
+
+    // ==================== 查找操作 ====================
+
+    /**
+     * @brief 查找指定键
+     */
+    bool contains(const Key& key) const {
+        auto guard = acquire_read_lock();
+        return data_.find(key) != data_.end();
+    }
+
+    /**
+     * @brief 统计指定键的个数
+     */
+    size_type count(const Key& key) const {
+        auto guard = acquire_read_lock();
+        return data_.count(key);
+    }
+
+    /**
+     * @brief 查找第一个不小于指定键的元素
+     */
+    bool lower_bound(const Key& key) const {
+        auto guard = acquire_read_lock();
+        return data_.lower_bound(key) != data_.end();
+    }
+
+    /**
+     * @brief 查找第一个大于指定键的元素
+     */
+    bool upper_bound(const Key& key) const {
+        auto guard = acquire_read_lock();
+        return data_.upper_bound(key) != data_.end();
+    }
+
+    // ==================== 异构查找（透明比较器） ====================
+
+    /**
+     * @brief 以任意可与 Key 比较的类型查找（需要 Compare::is_transparent，如 std::less<>）
+     *
+     * 例如 key 为 std::string 时可直接传入 std::string_view，避免构造临时字符串
+     */
+    template <typename K, typename C = Compare, detail::enable_if_transparent_t<C> = 0>
+    bool contains(const K& key) const {
+        auto guard = acquire_read_lock();
+        return data_.find(key) != data_.end();
+    }
+
+    template <typename K, typename C = Compare, detail::enable_if_transparent_t<C> = 0>
+    size_type count(const K& key) const {
+        auto guard = acquire_read_lock();
+        return data_.count(key);
+    }
+
+    template <typename K, typename C = Compare, detail::enable_if_transparent_t<C> = 0>
+    T get(const K& key, const T& default_value = T()) const {
+        auto guard = acquire_read_lock();
+        auto it = data_.find(key);
+        if (it != data_.end()) {
+            return it->second;
+        }
+        return default_value;
+    }
+
+    template <typename K, typename C = Compare, detail::enable_if_transparent_t<C> = 0>
+    T at(const K& key) const {
+        auto guard = acquire_read_lock();
+        auto it = data_.find(key);
+        if (it == data_.end()) {
+            throw std::out_of_range("flat_map::at");
+        }
+        return it->second;
+    }
+
+    template <typename K, typename C = Compare, detail::enable_if_transparent_t<C> = 0>
+    T& at(const K& key) {
+        auto guard = acquire_write_lock();
+        auto it = data_.find(key);
+        if (it == data_.end()) {
+            throw std::out_of_range("flat_map::at");
+        }
+        return it->second;
+    }
+
+    // ==================== 修改操作 ====================
+
+    /**
+     * @brief 插入键值对（O(log n) 查找 + O(n) 移动后续元素）
+     * @return 是否插入了新元素，键已存在时返回 false 且原值保持不变
+     */
+    bool insert(const Key& key, const T& value) {
+        auto guard = acquire_write_lock();
+        return data_.insert({key, value}).second;
+    }
+
+    /**
+     * @brief 使用移动语义插入键值对
+     */
+    bool insert(const Key& key, T&& value) {
+        auto guard = acquire_write_lock();
+        return data_.insert({key, std::move(value)}).second;
+    }
+
+    /**
+     * @brief 原地构造并插入（键已存在时不构造值）
+     */
+    template <typename... Args>
+    bool emplace(const Key& key, Args&&... args) {
+        auto guard = acquire_write_lock();
+        return data_.try_emplace(key, std::forward<Args>(args)...).second;
+    }
+
+    /**
+     * @brief 插入键值对，并返回该键在有序序列中的下标（下标计算 O(1)）
+     */
+    std::pair<bool, size_type> insert_indexed(const Key& key, const T& value) {
+        auto guard = acquire_write_lock();
+        auto result = data_.insert({key, value});
+        return {result.second, static_cast<size_type>(std::distance(data_.begin(), result.first))};
+    }
+
+    std::pair<bool, size_type> insert_indexed(const Key& key, T&& value) {
+        auto guard = acquire_write_lock();
+        auto result = data_.insert({key, std::move(value)});
+        return {result.second, static_cast<size_type>(std::distance(data_.begin(), result.first))};
+    }
+
+    /**
+     * @brief 键在有序序列中的下标（O(log n)），键不存在时返回 std::nullopt
+     */
+    std::optional<size_type> index_of(const Key& key) const {
+        auto guard = acquire_read_lock();
+        auto it = data_.find(key);
+        if (it == data_.end()) {
+            return std::nullopt;
+        }
+        return static_cast<size_type>(std::distance(data_.begin(), it));
+    }
+
+    /**
+     * @brief 移除指定键
+     */
+    size_type erase(const Key& key) {
+        auto guard = acquire_write_lock();
+        return data_.erase(key);
+    }
+
+    /**
+     * @brief 删除指定位置的元素
+     */
+    void erase(const_iterator pos) {
+        auto guard = acquire_write_lock();
+        data_.erase(pos);
+    }
+
+    /**
+     * @brief 删除指定范围的元素
+     */
+    void erase(const_iterator first, const_iterator last) {
+        auto guard = acquire_write_lock();
+        data_.erase(first, last);
+    }
+
+    // ==================== 原地访问与原子读-改-写 ====================
+
+    /**
+     * @brief 在读锁内对键对应的值执行 func(const T&)，不复制值
+     * @return 键存在时返回 true
+     */
+    template <typename Func>
+    bool visit(const Key& key, Func func) const {
+        auto guard = acquire_read_lock();
+        auto it = data_.find(key);
+        if (it == data_.end()) {
+            return false;
+        }
+        func(static_cast<const T&>(it->second));
+        return true;
+    }
+
+    /**
+     * @brief 在写锁内对键对应的值执行 func(T&)，原地修改
+     * @return 键存在时返回 true
+     */
+    template <typename Func>
+    bool visit_mut(const Key& key, Func func) {
+        auto guard = acquire_write_lock();
+        auto it = data_.find(key);
+        if (it == data_.end()) {
+            return false;
+        }
+        func(it->second);
+        return true;
+    }
+
+    /**
+     * @brief 键存在时在写锁内执行 func(T&)；若 func 返回 bool 且为 false，则删除该元素
+     * @return 调用前键是否存在
+     */
+    template <typename Func>
+    bool compute_if_present(const Key& key, Func func) {
+        auto guard = acquire_write_lock();
+        auto it = data_.find(key);
+        if (it == data_.end()) {
+            return false;
+        }
+        if constexpr (std::is_same_v<std::invoke_result_t<Func&, T&>, void>) {
+            func(it->second);
+        } else {
+            if (!func(it->second)) {
+                data_.erase(it);
+            }
+        }
+        return true;
+    }
+
+    /**
+     * @brief 键不存在时在写锁内以 factory() 的结果插入（键存在时 factory 不会被调用）
+     * @return 是否插入了新元素
+     */
+    template <typename Factory>
+    bool compute_if_absent(const Key& key, Factory factory) {
+        auto guard = acquire_write_lock();
+        if (data_.find(key) != data_.end()) {
+            return false;
+        }
+        data_.emplace(key, factory());
+        return true;
+    }
+
+    /**
+     * @brief 键不存在时插入 value，否则在写锁内执行 func(T& existing, const T& value) 合并
+     * @return 是否插入了新元素
+     */
+    template <typename Func>
+    bool merge(const Key& key, const T& value, Func func) {
+        auto guard = acquire_write_lock();
+        auto result = data_.try_emplace(key, value);
+        if (!result.second) {
+            func(result.first->second, value);
+        }
+        return result.second;
+    }
+
+    // ==================== 批量操作（单次加锁） ====================
+
+    /**
+     * @brief 批量插入键值对（只加锁一次），已存在的键保持不变
+     *
+     * 追加到尾部后排序合并一次，O((n + m) log m)，而不是 m 次 O(n) 的逐个插入
+     * @return 新插入的元素个数
+     */
+    template <typename InputIt>
+    size_type insert_bulk(InputIt first, InputIt last) {
+        auto guard = acquire_write_lock();
+        size_type before = data_.size();
+        data_.insert(first, last);
+        return data_.size() - before;
+    }
+
+    template <typename Range>
+    size_type insert_bulk(const Range& range) {
+        return insert_bulk(std::begin(range), std::end(range));
+    }
+
+    /**
+     * @brief 批量删除键（只加锁一次）
+     *
+     * 待删除的键先在锁外排序，再在锁内一趟压缩，O(n log m)
+     * @return 实际删除的元素个数
+     */
+    template <typename InputIt>
+    size_type erase_bulk(InputIt first, InputIt last) {
+        std::vector<Key> keys(first, last);
+        Compare comp = data_.key_comp();
+        std::sort(keys.begin(), keys.end(), comp);
+        auto guard = acquire_write_lock();
+        return data_.erase_if([&keys, &comp](const value_type& item) {
+            return std::binary_search(keys.begin(), keys.end(), item.first, comp);
+        });
+    }
+
+    template <typename KeyRange>
+    size_type erase_bulk(const KeyRange& keys) {
+        return erase_bulk(std::begin(keys), std::end(keys));
+    }
+
+    /**
+     * @brief 批量查找（只加锁一次），按 keys 的顺序输出值，不存在的键输出 default_value
+     * @return 命中的键个数
+     */
+    template <typename KeyRange, typename OutputIt>
+    size_type get_many(const KeyRange& keys, OutputIt out, const T& default_value = T()) const {
+        auto guard = acquire_read_lock();
+        size_type found = 0;
+        for (const auto& key : keys) {
+            auto it = data_.find(key);
+            if (it != data_.end()) {
+                *out = it->second;
+                ++found;
+            } else {
+                *out = default_value;
+            }
+            ++out;
+        }
+        return found;
+    }
+
+    /**
+     * @brief 用新的元素序列整体替换：在锁外排序去重，锁内只做一次交换
+     */
+    template <typename InputIt>
+    void assign(InputIt first, InputIt last) {
+        sorted_vector_map<Key, T, Compare> fresh(first, last, data_.key_comp());
+        auto guard = acquire_write_lock();
+        data_.swap(fresh);
+    }
+
+    template <typename Range>
+    void assign(const Range& range) {
+        assign(std::begin(range), std::end(range));
+    }
+
+    /**
+     * @brief 预留容量，避免后续插入时重新分配
+     */
+    void reserve(size_type n) {
+        auto guard = acquire_write_lock();
+        data_.reserve(n);
+    }
+
+    void shrink_to_fit() {
+        auto guard = acquire_write_lock();
+        data_.shrink_to_fit();
+    }
+
+    // ==================== 区间查询（读锁内按序扫描） ====================
+
+    /**
+     * @brief 第一个键不小于 key 的元素，不存在时返回 std::nullopt
+     */
+    std::optional<value_type> lower_bound_entry(const Key& key) const {
+        auto guard = acquire_read_lock();
+        auto it = data_.lower_bound(key);
+        if (it == data_.end()) {
+            return std::nullopt;
+        }
+        return value_type(it->first, it->second);
+    }
+
+    /**
+     * @brief 第一个键大于 key 的元素，不存在时返回 std::nullopt
+     */
+    std::optional<value_type> upper_bound_entry(const Key& key) const {
+        auto guard = acquire_read_lock();
+        auto it = data_.upper_bound(key);
+        if (it == data_.end()) {
+            return std::nullopt;
+        }
+        return value_type(it->first, it->second);
+    }
+
+    /**
+     * @brief 在读锁内按键升序对 [lo, hi) 内的元素执行 func(const Key&, const T&)
+     *
+     * 只访问区间内的元素（O(log n + k)），不复制容器；func 返回 bool 时，返回 false 即停止扫描
+     * @return 访问的元素个数
+     */
+    template <typename Func>
+    size_type range(const Key& lo, const Key& hi, Func func) const {
+        auto guard = acquire_read_lock();
+        auto comp = data_.key_comp();
+        return detail::scan_while(
+            data_.lower_bound(lo), data_.end(), [&](const value_type& item) { return comp(item.first, hi); },
+            [&](const value_type& item) { return detail::invoke_continue(func, item.first, item.second); });
+    }
+
+    /**
+     * @brief 把 [lo, hi) 内至多 limit 个元素按键升序写入 out
+     * @return 写入的元素个数
+     */
+    template <typename OutputIt>
+    size_type collect_range(const Key& lo, const Key& hi, OutputIt out,
+                            size_type limit = std::numeric_limits<size_type>::max()) const {
+        if (limit == 0) {
+            return 0;
+        }
+        size_type written = 0;
+        range(lo, hi, [&](const Key& key, const T& value) {
+            *out = value_type(key, value);
+            ++out;
+            return ++written < limit;
+        });
+        return written;
+    }
+
+    /**
+     * @brief 在读锁内按序对键以 prefix 开头的元素执行 func(const Key&, const T&)
+     *
+     * 适用于字符串类键且 Compare 为字典序（std::less / std::less<>）的情形，
+     * 从 lower_bound(prefix) 开始扫描，遇到第一个不匹配的键即停止
+     * @return 访问的元素个数
+     */
+    template <typename Func>
+    size_type prefix_scan(const Key& prefix, Func func) const {
+        auto guard = acquire_read_lock();
+        return detail::scan_while(
+            data_.lower_bound(prefix), data_.end(),
+            [&prefix](const value_type& item) { return detail::key_has_prefix(item.first, prefix); },
+            [&](const value_type& item) { return detail::invoke_continue(func, item.first, item.second); });
+    }
+
+    /**
+     * @brief 把键以 prefix 开头的至多 limit 个元素按序写入 out
+     * @return 写入的元素个数
+     */
+    template <typename OutputIt>
+    size_type collect_prefix(const Key& prefix, OutputIt out,
+                             size_type limit = std::numeric_limits<size_type>::max()) const {
+        if (limit == 0) {
+            return 0;
+        }
+        size_type written = 0;
+        prefix_scan(prefix, [&](const Key& key, const T& value) {
+            *out = value_type(key, value);
+            ++out;
+            return ++written < limit;
+        });
+        return written;
+    }
+
+    // ==================== 区间查询（连续内存） ====================
+
+    /**
+     * @brief 在读锁内对键位于 [lo, hi) 的元素执行 func(const value_type* first, const value_type* last)
+     *
+     * 区间内元素在内存中连续且按键升序排列，可直接按数组处理；指针只在 func 内有效
+     * @return 区间内的元素个数
+     */
+    template <typename Func>
+    size_type visit_range(const Key& lo, const Key& hi, Func func) const {
+        auto guard = acquire_read_lock();
+        const value_type* first = data_.data() + (data_.lower_bound(lo) - data_.begin());
+        const value_type* last = data_.data() + (data_.lower_bound(hi) - data_.begin());
+        if (last < first) {
+            last = first;
+        }
+        func(first, last);
+        return static_cast<size_type>(last - first);
+    }
+
+    /**
+     * @brief 复制键位于 [lo, hi) 的元素（读锁内一次连续拷贝）
+     */
+    std::vector<value_type> copy_range(const Key& lo, const Key& hi) const {
+        std::vector<value_type> out;
+        visit_range(lo, hi, [&out](const value_type* first, const value_type* last) { out.assign(first, last); });
+        return out;
+    }
+
+    // ==================== STL兼容性 ====================
+
+    /**
+     * @brief 隐式转换到底层 sorted_vector_map
+     */
+    operator const sorted_vector_map<Key, T, Compare>&() const {
+        return data_;
+    }
+
+    /**
+     * @brief 获取内部有序 vector 的拷贝
+     */
+    sorted_vector_map<Key, T, Compare> copy() const {
+        auto guard = acquire_read_lock();
+        return data_;
+    }
+
+    /**
+     * @brief 获取内部map的引用
+     */
+    const sorted_vector_map<Key, T, Compare>& ref() const {
+        return data_;
+    }
+
+    // ==================== 迭代和查询 ====================
+
+    /**
+     * @brief 对每个元素执行操作
+     */
+    template <typename Func>
+    void for_each(Func func) const {
+        auto guard = acquire_read_lock();
+        for (const auto& pair : data_) {
+            func(pair.first, pair.second);
+        }
+    }
+
+    /**
+     * @brief 条件查找
+     */
+    template <typename Predicate>
+    const_iterator find_if(Predicate pred) const {
+        auto guard = acquire_read_lock();
+        return std::find_if(data_.begin(), data_.end(), 
+                          [&pred](const auto& p) { return pred(p.first, p.second); });
+    }
+
+    /**
+     * @brief 统计满足条件的元素个数
+     */
+    template <typename Predicate>
+    size_type count_if(Predicate pred) const {
+        auto guard = acquire_read_lock();
+        return std::count_if(data_.begin(), data_.end(),
+                            [&pred](const auto& p) { return pred(p.first, p.second); });
+    }
+
+    // ==================== 比较操作 ====================
+
+    bool operator==(const flat_map& other) const {
+        auto guard = acquire_read_lock();
+        return data_ == other.data_;
+    }
+
+    bool operator!=(const flat_map& other) const {
+        return !(*this == other);
+    }
+
+    // ==================== 线程不安全接口 ====================
+
+    /**
+     * @brief 获取内部map的非const引用（线程不安全）
+     */
+    sorted_vector_map<Key, T, Compare>& unsafe_ref() {
+        return data_;
+    }
+
+    const sorted_vector_map<Key, T, Compare>& unsafe_ref() const {
+        return data_;
+    }
+
+    /**
+     * @brief 线程不安全的size获取
+     */
+    size_type unsafe_size() const {
+        return data_.size();
+    }
+
+    /**
+     * @brief 线程不安全的empty检查
+     */
+    bool unsafe_empty() const {
+        return data_.empty();
+    }
+
+    /**
+     * @brief 线程不安全的clear
+     */
+    void unsafe_clear() {
+        data_.clear();
+    }
+
+    /**
+     * @brief 线程不安全的insert
+     */
+    void unsafe_insert(const Key& key, const T& value) {
+        data_[key] = value;
+    }
+
+    void unsafe_insert(const Key& key, T&& value) {
+        data_[key] = std::move(value);
+    }
+
+    /**
+     * @brief 线程不安全的erase
+     */
+    size_type unsafe_erase(const Key& key) {
+        return data_.erase(key);
+    }
+
+    /**
+     * @brief 线程不安全的at访问
+     */
+    T& unsafe_at(const Key& key) {
+        return data_[key];
+    }
+
+    const T& unsafe_at(const Key& key) const {
+        return data_.at(key);
+    }
+
+    // ==================== 手动锁控制接口 ====================
+
+    /**
+     * @brief 获取写锁guard供外部使用
+     */
+    auto acquire_write_guard() const {
+        return acquire_write_lock();
+    }
+
+#if TS_STL_SUPPORT_RW_LOCK
+    /**
+     * @brief 获取读锁guard供外部使用
+     */
+    auto acquire_read_guard() const {
+        return acquire_read_lock();
+    }
+#endif
+
+    /**
+     * @brief 批量操作助手 - 在锁保护下执行lambda
+     */
+    template <typename Func>
+    void with_write_lock(Func func) const {
+        auto guard = acquire_write_lock();
+        func(*const_cast<flat_map*>(this));
+    }
+
+#if TS_STL_SUPPORT_RW_LOCK
+    /**
+     * @brief 批量读操作助手 - 在读锁保护下执行lambda
+     */
+    template <typename Func>
+    void with_read_lock(Func func) const {
+        auto guard = acquire_read_lock();
+        func(*this);
+    }
+#endif
+};
+
+// ==================== Flat Map 的 LockFree 特化版本（零开销） ====================
+
+/**
+ * @brief Flat Map 的 LockFree 特化版本 - 为极限性能优化
+ */
+template <typename Key, typename T, typename Compare>
+class flat_map<Key, T, Compare, LockPolicy::LockFree> {
+private:
+    sorted_vector_map<Key, T, Compare> data_;
+
+public:
+    // 类型定义
+    using key_type = Key;
+    using mapped_type = T;
+    using value_type = std::pair<Key, T>;
+    using size_type = typename sorted_vector_map<Key, T, Compare>::size_type;
+    using iterator = typename sorted_vector_map<Key, T, Compare>::iterator;
+    using const_iterator = typename sorted_vector_map<Key, T, Compare>::const_iterator;
+
+    // ==================== 构造函数 ====================
+
+    flat_map() = default;
+
+    explicit flat_map(const Compare& comp) : data_(comp) {}
+
+    template <typename InputIt>
+    flat_map(InputIt first, InputIt last) : data_(first, last) {}
+
+    flat_map(const flat_map& other) = default;
+
+    flat_map& operator=(const flat_map& other) = default;
+
+    flat_map(flat_map&& other) noexcept = default;
+
+    flat_map& operator=(flat_map&& other) noexcept = default;
+
+    // ==================== 元素访问（零开销） ====================
+
+    T& operator[](const Key& key) noexcept {
+        return data_[key];
+    }
+
+    T at(const Key& key) const {
+        return data_.at(key);
+    }
+
+    T& at(const Key& key) {
+        return data_.at(key);
+    }
+
+    T get(const Key& key, const T& default_value = T()) const {
+        auto it = data_.find(key);
+        if (it != data_.end()) {
+            return it->second;
+        }
+        return default_value;
+    }
+
+    // ==================== 容量管理（零开销） ====================
+
+    size_type size() const noexcept {
+        return data_.size();
+    }
+
+    bool empty() const noexcept {
+        return data_.empty();
+    }
+
+    void clear() noexcept {
+        data_.clear();
+    }
+
+    // ==================== 查找操作（零开销） ====================
+
+    bool contains(const Key& key) const {
+        return data_.find(key) != data_.end();
+    }
+
+    size_type count(const Key& key) const {
+        return data_.count(key);
+    }
+
+    template <typename K, typename C = Compare, detail::enable_if_transparent_t<C> = 0>
+    bool contains(const K& key) const {
+        return data_.find(key) != data_.end();
+    }
+
+    template <typename K, typename C = Compare, detail::enable_if_transparent_t<C> = 0>
+    size_type count(const K& key) const {
+        return data_.count(key);
+    }
+
+    template <typename K, typename C = Compare, detail::enable_if_transparent_t<C> = 0>
+    T get(const K& key, const T& default_value = T()) const {
+        auto it = data_.find(key);
+        if (it != data_.end()) {
+            return it->second;
+        }
+        return default_value;
+    }
+
+    template <typename K, typename C = Compare, detail::enable_if_transparent_t<C> = 0>
+    T at(const K& key) const {
+        auto it = data_.find(key);
+        if (it == data_.end()) {
+            throw std::out_of_range("flat_map::at");
+        }
+        return it->second;
+    }
+
+    template <typename K, typename C = Compare, detail::enable_if_transparent_t<C> = 0>
+    T& at(const K& key) {
+        auto it = data_.find(key);
+        if (it == data_.end()) {
+            throw std::out_of_range("flat_map::at");
+        }
+        return it->second;
+    }
+
+    // ==================== 修改操作（零开销） ====================
+
+    bool insert(const Key& key, const T& value) {
+        return data_.insert({key, value}).second;
+    }
+
+    bool insert(const Key& key, T&& value) {
+        return data_.insert({key, std::move(value)}).second;
+    }
+
+    template <typename... Args>
+    bool emplace(const Key& key, Args&&... args) {
+        return data_.try_emplace(key, std::forward<Args>(args)...).second;
+    }
+
+    std::pair<bool, size_type> insert_indexed(const Key& key, const T& value) {
+        auto result = data_.insert({key, value});
+        return {result.second, static_cast<size_type>(std::distance(data_.begin(), result.first))};
+    }
+
+    std::optional<size_type> index_of(const Key& key) const {
+        auto it = data_.find(key);
+        if (it == data_.end()) {
+            return std::nullopt;
+        }
+        return static_cast<size_type>(std::distance(data_.begin(), it));
+    }
+
+    size_type erase(const Key& key) {
+        return data_.erase(key);
+    }
+
+    template <typename Func>
+    bool visit(const Key& key, Func func) const {
+        auto it = data_.find(key);
+        if (it == data_.end()) {
+            return false;
+        }
+        func(static_cast<const T&>(it->second));
+        return true;
+    }
+
+    template <typename Func>
+    bool visit_mut(const Key& key, Func func) {
+        auto it = data_.find(key);
+        if (it == data_.end()) {
+            return false;
+        }
+        func(it->second);
+        return true;
+    }
+
+    template <typename Func>
+    bool compute_if_present(const Key& key, Func func) {
+        auto it = data_.find(key);
+        if (it == data_.end()) {
+            return false;
+        }
+        if constexpr (std::is_same_v<std::invoke_result_t<Func&, T&>, void>) {
+            func(it->second);
+        } else {
+            if (!func(it->second)) {
+                data_.erase(it);
+            }
+        }
+        return true;
+    }
+
+    template <typename Factory>
+    bool compute_if_absent(const Key& key, Factory factory) {
+        if (data_.find(key) != data_.end()) {
+            return false;
+        }
+        data_.emplace(key, factory());
+        return true;
+    }
+
+    template <typename Func>
+    bool merge(const Key& key, const T& value, Func func) {
+        auto result = data_.try_emplace(key, value);
+        if (!result.second) {
+            func(result.first->second, value);
+        }
+        return result.second;
+    }
+
+    // ==================== 批量操作与区间查询（零开销） ====================
+
+    template <typename InputIt>
+    size_type insert_bulk(InputIt first, InputIt last) {
+        size_type before = data_.size();
+        data_.insert(first, last);
+        return data_.size() - before;
+    }
+
+    template <typename InputIt>
+    void assign(InputIt first, InputIt last) {
+        data_.assign(first, last);
+    }
+
+    void reserve(size_type n) {
+        data_.reserve(n);
+    }
+
+    std::optional<value_type> lower_bound_entry(const Key& key) const {
+        auto it = data_.lower_bound(key);
+        if (it == data_.end()) {
+            return std::nullopt;
+        }
+        return value_type(it->first, it->second);
+    }
+
+    std::optional<value_type> upper_bound_entry(const Key& key) const {
+        auto it = data_.upper_bound(key);
+        if (it == data_.end()) {
+            return std::nullopt;
+        }
+        return value_type(it->first, it->second);
+    }
+
+    template <typename Func>
+    size_type range(const Key& lo, const Key& hi, Func func) const {
+        auto comp = data_.key_comp();
+        return detail::scan_while(
+            data_.lower_bound(lo), data_.end(), [&](const value_type& item) { return comp(item.first, hi); },
+            [&](const value_type& item) { return detail::invoke_continue(func, item.first, item.second); });
+    }
+
+    template <typename OutputIt>
+    size_type collect_range(const Key& lo, const Key& hi, OutputIt out,
+                            size_type limit = std::numeric_limits<size_type>::max()) const {
+        if (limit == 0) {
+            return 0;
+        }
+        size_type written = 0;
+        range(lo, hi, [&](const Key& key, const T& value) {
+            *out = value_type(key, value);
+            ++out;
+            return ++written < limit;
+        });
+        return written;
+    }
+
+    template <typename Func>
+    size_type prefix_scan(const Key& prefix, Func func) const {
+        return detail::scan_while(
+            data_.lower_bound(prefix), data_.end(),
+            [&prefix](const value_type& item) { return detail::key_has_prefix(item.first, prefix); },
+            [&](const value_type& item) { return detail::invoke_continue(func, item.first, item.second); });
+    }
+
+    template <typename OutputIt>
+    size_type collect_prefix(const Key& prefix, OutputIt out,
+                             size_type limit = std::numeric_limits<size_type>::max()) const {
+        if (limit == 0) {
+            return 0;
+        }
+        size_type written = 0;
+        prefix_scan(prefix, [&](const Key& key, const T& value) {
+            *out = value_type(key, value);
+            ++out;
+            return ++written < limit;
+        });
+        return written;
+    }
+
+    /**
+     * @brief 键位于 [lo, hi) 的元素构成的连续区间 [first, last)，插入或删除后失效
+     */
+    std::pair<const value_type*, const value_type*> range_span(const Key& lo, const Key& hi) const {
+        const value_type* first = data_.data() + (data_.lower_bound(lo) - data_.begin());
+        const value_type* last = data_.data() + (data_.lower_bound(hi) - data_.begin());
+        return {first, last < first ? first : last};
+    }
+
+    // ==================== 迭代器（零开销） ====================
+
+    iterator begin() noexcept {
+        return data_.begin();
+    }
+
+    const_iterator begin() const noexcept {
+        return data_.begin();
+    }
+
+    const_iterator cbegin() const noexcept {
+        return data_.cbegin();
+    }
+
+    iterator end() noexcept {
+        return data_.end();
+    }
+
+    const_iterator end() const noexcept {
+        return data_.end();
+    }
+
+    const_iterator cend() const noexcept {
+        return data_.cend();
+    }
+
+    // ==================== 转换操作 ====================
+
+    operator sorted_vector_map<Key, T, Compare>&() noexcept {
+        return data_;
+    }
+
+    operator const sorted_vector_map<Key, T, Compare>&() const noexcept {
+        return data_;
+    }
+
+    sorted_vector_map<Key, T, Compare>& get_unsafe() noexcept {
+        return data_;
+    }
+
+    const sorted_vector_map<Key, T, Compare>& get_unsafe() const noexcept {
+        return data_;
+    }
+};
+
+/**
+ * @brief 线程安全的有序 vector Set（接口与 set 一致）
+ * @tparam Key 键类型
+ * @tparam Compare 比较器（默认使用std::less）
+ * @tparam Policy 锁策略（默认使用互斥锁）
+ *
+ * 底层为 sorted_vector_set，取舍与 flat_map 相同：读多写少、批量构建。
+ */
+template <typename Key, typename Compare = std::less<Key>, LockPolicy Policy = LockPolicy::Mutex>
+class flat_set : public container_mixin<flat_set<Key, Compare, Policy>, Key, Policy> {
+private:
+    friend class container_mixin<flat_set<Key, Compare, Policy>, Key, Policy>;
+
+    sorted_vector_set<Key, Compare> data_;
+
+    using Base = container_mixin<flat_set<Key, Compare, Policy>, Key, Policy>;
+    using Base::acquire_write_lock;
+    using Base::acquire_read_lock;
+
+public:
+    using Container = sorted_vector_set<Key, Compare>;
+    using value_type = Key;
+    using size_type = typename sorted_vector_set<Key, Compare>::size_type;
+    using iterator = typename sorted_vector_set<Key, Compare>::iterator;
+    using const_iterator = typename sorted_vector_set<Key, Compare>::const_iterator;
+
+    // ==================== 构造函数 ====================
+
+    flat_set() : Base() {}
+
+    explicit flat_set(const Compare& comp) : Base() {
+        data_ = sorted_vector_set<Key, Compare>(comp);
+    }
+
+    template <typename InputIt>
+    flat_set(InputIt first, InputIt last) : Base() {
+        data_.insert(first, last);
+    }
+
+    flat_set(const flat_set& other) : Base() {
+        auto guard = acquire_write_lock();
+        data_ = other.data_;
+    }
+
+    flat_set& operator=(const flat_set& other) {
+        if (this != &other) {
+            auto guard = acquire_write_lock();
+            data_ = other.data_;
+        }
+        return *this;
+    }
+
+    flat_set(flat_set&& other) noexcept : Base() {
+        auto guard = acquire_write_lock();
+        data_ = std::move(other.data_);
+    }
+
+    flat_set& operator=(flat_set&& other) noexcept {
+        if (this != &other) {
+            auto guard = acquire_write_lock();
+            data_ = std::move(other.data_);
+        }
+        return *this;
+    }
+
+    // ==================== 容量管理 ====================
+
+    size_type size() const {
+        auto guard = acquire_read_lock();
+        return data_.size();
+    }
+
+    bool empty() const {
+        auto guard = acquire_read_lock();
+        return data_.empty();
+    }
+
+    void clear() {
+        auto guard = acquire_write_lock();
+        data_.clear();
+    }
+
+    // ==================== 查找操作 ====================
+
+    bool contains(const Key& key) const {
+        auto guard = acquire_read_lock();
+        return data_.find(key) != data_.end();
+    }
+
+    size_type count(const Key& key) const {
+        auto guard = acquire_read_lock();
+        return data_.count(key);
+    }
+
+    // ==================== 异构查找（透明比较器） ====================
+
+    /**
+     * @brief 以任意可与 Key 比较的类型查找（需要 Compare::is_transparent，如 std::less<>）
+     *
+     * 例如 key 为 std::string 时可直接传入 std::string_view，避免构造临时字符串
+     */
+    template <typename K, typename C = Compare, detail::enable_if_transparent_t<C> = 0>
+    bool contains(const K& key) const {
+        auto guard = acquire_read_lock();
+        return data_.find(key) != data_.end();
+    }
+
+    template <typename K, typename C = Compare, detail::enable_if_transparent_t<C> = 0>
+    size_type count(const K& key) const {
+        auto guard = acquire_read_lock();
+        return data_.count(key);
+    }
+
+    // ==================== 修改操作 ====================
+
+    std::pair<iterator, bool> insert(const Key& key) {
+        auto guard = acquire_write_lock();
+        return data_.insert(key);
+    }
+
+    std::pair<iterator, bool> insert(Key&& key) {
+        auto guard = acquire_write_lock();
+        return data_.insert(std::move(key));
+    }
+
+    template <typename... Args>
+    std::pair<iterator, bool> emplace(Args&&... args) {
+        auto guard = acquire_write_lock();
+        return data_.emplace(std::forward<Args>(args)...);
+    }
+
+    size_type erase(const Key& key) {
+        auto guard = acquire_write_lock();
+        return data_.erase(key);
+    }
+
+    void erase(const_iterator pos) {
+        auto guard = acquire_write_lock();
+        data_.erase(pos);
+    }
+
+    void erase(const_iterator first, const_iterator last) {
+        auto guard = acquire_write_lock();
+        data_.erase(first, last);
+    }
+
+    // ==================== 批量操作（单次加锁） ====================
+
+    /**
+     * @brief 批量插入键（只加锁一次），已存在的键保持不变
+     *
+     * 追加到尾部后排序合并一次，O((n + m) log m)
+     * @return 新插入的元素个数
+     */
+    template <typename InputIt>
+    size_type insert_bulk(InputIt first, InputIt last) {
+        auto guard = acquire_write_lock();
+        size_type before = data_.size();
+        data_.insert(first, last);
+        return data_.size() - before;
+    }
+
+    template <typename Range>
+    size_type insert_bulk(const Range& range) {
+        return insert_bulk(std::begin(range), std::end(range));
+    }
+
+    /**
+     * @brief 批量删除键（只加锁一次）
+     *
+     * 待删除的键先在锁外排序，再在锁内一趟压缩，O(n log m)
+     * @return 实际删除的元素个数
+     */
+    template <typename InputIt>
+    size_type erase_bulk(InputIt first, InputIt last) {
+        std::vector<Key> keys(first, last);
+        Compare comp = data_.key_comp();
+        std::sort(keys.begin(), keys.end(), comp);
+        auto guard = acquire_write_lock();
+        return data_.erase_if([&keys, &comp](const Key& item) {
+            return std::binary_search(keys.begin(), keys.end(), item, comp);
+        });
+    }
+
+    template <typename KeyRange>
+    size_type erase_bulk(const KeyRange& keys) {
+        return erase_bulk(std::begin(keys), std::end(keys));
+    }
+
+    /**
+     * @brief 用新的键序列整体替换：在锁外排序去重，锁内只做一次交换
+     */
+    template <typename InputIt>
+    void assign(InputIt first, InputIt last) {
+        sorted_vector_set<Key, Compare> fresh(first, last, data_.key_comp());
+        auto guard = acquire_write_lock();
+        data_.swap(fresh);
+    }
+
+    template <typename Range>
+    void assign(const Range& range) {
+        assign(std::begin(range), std::end(range));
+    }
+
+    void reserve(size_type n) {
+        auto guard = acquire_write_lock();
+        data_.reserve(n);
+    }
+
+    // ==================== 区间查询（读锁内按序扫描） ====================
+
+    /**
+     * @brief 第一个不小于 key 的元素，不存在时返回 std::nullopt
+     */
+    std::optional<Key> lower_bound_key(const Key& key) const {
+        auto guard = acquire_read_lock();
+        auto it = data_.lower_bound(key);
+        if (it == data_.end()) {
+            return std::nullopt;
+        }
+        return *it;
+    }
+
+    /**
+     * @brief 第一个大于 key 的元素，不存在时返回 std::nullopt
+     */
+    std::optional<Key> upper_bound_key(const Key& key) const {
+        auto guard = acquire_read_lock();
+        auto it = data_.upper_bound(key);
+        if (it == data_.end()) {
+            return std::nullopt;
+        }
+        return *it;
+    }
+
+    /**
+     * @brief 在读锁内按升序对 [lo, hi) 内的元素执行 func(const Key&)
+     *
+     * 只访问区间内的元素（O(log n + k)）；func 返回 bool 时，返回 false 即停止扫描
+     * @return 访问的元素个数
+     */
+    template <typename Func>
+    size_type range(const Key& lo, const Key& hi, Func func) const {
+        auto guard = acquire_read_lock();
+        auto comp = data_.key_comp();
+        return detail::scan_while(
+            data_.lower_bound(lo), data_.end(), [&](const Key& item) { return comp(item, hi); },
+            [&](const Key& item) { return detail::invoke_continue(func, item); });
+    }
+
+    /**
+     * @brief 把 [lo, hi) 内至多 limit 个元素按升序写入 out
+     * @return 写入的元素个数
+     */
+    template <typename OutputIt>
+    size_type collect_range(const Key& lo, const Key& hi, OutputIt out,
+                            size_type limit = std::numeric_limits<size_type>::max()) const {
+        if (limit == 0) {
+            return 0;
+        }
+        size_type written = 0;
+        range(lo, hi, [&](const Key& item) {
+            *out = item;
+            ++out;
+            return ++written < limit;
+        });
+        return written;
+    }
+
+    /**
+     * @brief 在读锁内按序对以 prefix 开头的元素执行 func(const Key&)（字符串类键、字典序比较器）
+     * @return 访问的元素个数
+     */
+    template <typename Func>
+    size_type prefix_scan(const Key& prefix, Func func) const {
+        auto guard = acquire_read_lock();
+        return detail::scan_while(
+            data_.lower_bound(prefix), data_.end(),
+            [&prefix](const Key& item) { return detail::key_has_prefix(item, prefix); },
+            [&](const Key& item) { return detail::invoke_continue(func, item); });
+    }
+
+    template <typename OutputIt>
+    size_type collect_prefix(const Key& prefix, OutputIt out,
+                             size_type limit = std::numeric_limits<size_type>::max()) const {
+        if (limit == 0) {
+            return 0;
+        }
+        size_type written = 0;
+        prefix_scan(prefix, [&](const Key& item) {
+            *out = item;
+            ++out;
+            return ++written < limit;
+        });
+        return written;
+    }
+
+    // ==================== 区间查询（连续内存） ====================
+
+    /**
+     * @brief 在读锁内对位于 [lo, hi) 的键执行 func(const Key* first, const Key* last)
+     * @return 区间内的元素个数
+     */
+    template <typename Func>
+    size_type visit_range(const Key& lo, const Key& hi, Func func) const {
+        auto guard = acquire_read_lock();
+        const Key* first = data_.data() + (data_.lower_bound(lo) - data_.begin());
+        const Key* last = data_.data() + (data_.lower_bound(hi) - data_.begin());
+        if (last < first) {
+            last = first;
+        }
+        func(first, last);
+        return static_cast<size_type>(last - first);
+    }
+
+    std::vector<Key> copy_range(const Key& lo, const Key& hi) const {
+        std::vector<Key> out;
+        visit_range(lo, hi, [&out](const Key* first, const Key* last) { out.assign(first, last); });
+        return out;
+    }
+
+    // ==================== STL兼容性 ====================
+
+    operator const sorted_vector_set<Key, Compare>&() const {
+        return data_;
+    }
+
+    sorted_vector_set<Key, Compare> copy() const {
+        auto guard = acquire_read_lock();
+        return data_;
+    }
+
+    const sorted_vector_set<Key, Compare>& ref() const {
+        return data_;
+    }
+
+    // ==================== 迭代和查询 ====================
+
+    template <typename Func>
+    void for_each(Func func) const {
+        auto guard = acquire_read_lock();
+        for (const auto& item : data_) {
+            func(item);
+        }
+    }
+
+    template <typename Predicate>
+    const_iterator find_if(Predicate pred) const {
+        auto guard = acquire_read_lock();
+        return std::find_if(data_.begin(), data_.end(), pred);
+    }
+
+    template <typename Predicate>
+    size_type count_if(Predicate pred) const {
+        auto guard = acquire_read_lock();
+        return std::count_if(data_.begin(), data_.end(), pred);
+    }
+
+    // ==================== 线程不安全接口 ====================
+
+    sorted_vector_set<Key, Compare>& unsafe_ref() {
+        return data_;
+    }
+
+    const sorted_vector_set<Key, Compare>& unsafe_ref() const {
+        return data_;
+    }
+
+    size_type unsafe_size() const {
+        return data_.size();
+    }
+
+    bool unsafe_empty() const {
+        return data_.empty();
+    }
+
+    void unsafe_clear() {
+        data_.clear();
+    }
+
+    std::pair<iterator, bool> unsafe_insert(const Key& key) {
+        return data_.insert(key);
+    }
+
+    size_type unsafe_erase(const Key& key) {
+        return data_.erase(key);
+    }
+
+    // ==================== 手动锁控制接口 ====================
+
+    auto acquire_write_guard() const {
+        return acquire_write_lock();
+    }
+
+#if TS_STL_SUPPORT_RW_LOCK
+    auto acquire_read_guard() const {
+        return acquire_read_lock();
+    }
+#endif
+
+    template <typename Func>
+    void with_write_lock(Func func) const {
+        auto guard = acquire_write_lock();
+        func(*const_cast<flat_set*>(this));
+    }
+
+#if TS_STL_SUPPORT_RW_LOCK
+    template <typename Func>
+    void with_read_lock(Func func) const {
+        auto guard = acquire_read_lock();
+        func(*this);
+    }
+#endif
+};
+
+// ==================== Flat Set 的 LockFree 特化版本 ====================
+
+template <typename Key, typename Compare>
+class flat_set<Key, Compare, LockPolicy::LockFree> {
+private:
+    sorted_vector_set<Key, Compare> data_;
+
+public:
+    using value_type = Key;
+    using size_type = typename sorted_vector_set<Key, Compare>::size_type;
+    using iterator = typename sorted_vector_set<Key, Compare>::iterator;
+    using const_iterator = typename sorted_vector_set<Key, Compare>::const_iterator;
+
+    flat_set() = default;
+
+    explicit flat_set(const Compare& comp) : data_(comp) {}
+
+    template <typename InputIt>
+    flat_set(InputIt first, InputIt last) : data_(first, last) {}
+
+    flat_set(const flat_set& other) = default;
+    flat_set& operator=(const flat_set& other) = default;
+    flat_set(flat_set&& other) noexcept = default;
+    flat_set& operator=(flat_set&& other) noexcept = default;
+
+    size_type size() const noexcept {
+        return data_.size();
+    }
+
+    bool empty() const noexcept {
+        return data_.empty();
+    }
+
+    void clear() noexcept {
+        data_.clear();
+    }
+
+    bool contains(const Key& key) const {
+        return data_.find(key) != data_.end();
+    }
+
+    size_type count(const Key& key) const {
+        return data_.count(key);
+    }
+
+    template <typename K, typename C = Compare, detail::enable_if_transparent_t<C> = 0>
+    bool contains(const K& key) const {
+        return data_.find(key) != data_.end();
+    }
+
+    template <typename K, typename C = Compare, detail::enable_if_transparent_t<C> = 0>
+    size_type count(const K& key) const {
+        return data_.count(key);
+    }
+
+    std::pair<iterator, bool> insert(const Key& key) {
+        return data_.insert(key);
+    }
+
+    std::pair<iterator, bool> insert(Key&& key) {
+        return data_.insert(std::move(key));
+    }
+
+    template <typename... Args>
+    std::pair<iterator, bool> emplace(Args&&... args) {
+        return data_.emplace(std::forward<Args>(args)...);
+    }
+
+    size_type erase(const Key& key) {
+        return data_.erase(key);
+    }
+
+    template <typename InputIt>
+    size_type insert_bulk(InputIt first, InputIt last) {
+        size_type before = data_.size();
+        data_.insert(first, last);
+        return data_.size() - before;
+    }
+
+    template <typename InputIt>
+    void assign(InputIt first, InputIt last) {
+        data_.assign(first, last);
+    }
+
+    void reserve(size_type n) {
+        data_.reserve(n);
+    }
+
+    std::optional<Key> lower_bound_key(const Key& key) const {
+        auto it = data_.lower_bound(key);
+        if (it == data_.end()) {
+            return std::nullopt;
+        }
+        return *it;
+    }
+
+    std::optional<Key> upper_bound_key(const Key& key) const {
+        auto it = data_.upper_bound(key);
+        if (it == data_.end()) {
+            return std::nullopt;
+        }
+        return *it;
+    }
+
+    template <typename Func>
+    size_type range(const Key& lo, const Key& hi, Func func) const {
+        auto comp = data_.key_comp();
+        return detail::scan_while(
+            data_.lower_bound(lo), data_.end(), [&](const Key& item) { return comp(item, hi); },
+            [&](const Key& item) { return detail::invoke_continue(func, item); });
+    }
+
+    template <typename OutputIt>
+    size_type collect_range(const Key& lo, const Key& hi, OutputIt out,
+                            size_type limit = std::numeric_limits<size_type>::max()) const {
+        if (limit == 0) {
+            return 0;
+        }
+        size_type written = 0;
+        range(lo, hi, [&](const Key& item) {
+            *out = item;
+            ++out;
+            return ++written < limit;
+        });
+        return written;
+    }
+
+    template <typename Func>
+    size_type prefix_scan(const Key& prefix, Func func) const {
+        return detail::scan_while(
+            data_.lower_bound(prefix), data_.end(),
+            [&prefix](const Key& item) { return detail::key_has_prefix(item, prefix); },
+            [&](const Key& item) { return detail::invoke_continue(func, item); });
+    }
+
+    template <typename OutputIt>
+    size_type collect_prefix(const Key& prefix, OutputIt out,
+                             size_type limit = std::numeric_limits<size_type>::max()) const {
+        if (limit == 0) {
+            return 0;
+        }
+        size_type written = 0;
+        prefix_scan(prefix, [&](const Key& item) {
+            *out = item;
+            ++out;
+            return ++written < limit;
+        });
+        return written;
+    }
+
+    /**
+     * @brief 位于 [lo, hi) 的键构成的连续区间 [first, last)，插入或删除后失效
+     */
+    std::pair<const Key*, const Key*> range_span(const Key& lo, const Key& hi) const {
+        const Key* first = data_.data() + (data_.lower_bound(lo) - data_.begin());
+        const Key* last = data_.data() + (data_.lower_bound(hi) - data_.begin());
+        return {first, last < first ? first : last};
+    }
+
+    const_iterator begin() const noexcept {
+        return data_.begin();
+    }
+
+    const_iterator end() const noexcept {
+        return data_.end();
+    }
+
+    operator sorted_vector_set<Key, Compare>&() noexcept {
+        return data_;
+    }
+
+    operator const sorted_vector_set<Key, Compare>&() const noexcept {
+        return data_;
+    }
+
+    sorted_vector_set<Key, Compare>& get_unsafe() noexcept {
+        return data_;
+    }
+
+    const sorted_vector_set<Key, Compare>& get_unsafe() const noexcept {
+        return data_;
+    }
+};
+
+} // namespace ts_stl
+
+#endif // TS_FLAT_MAP_HPP
@@ -0,0 +1,1769 @@
+#pragma once
+
+#ifndef TS_FLAT_UNORDERED_MAP_HPP
+#define TS_FLAT_UNORDERED_MAP_HPP
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+
+#include "ts_stl_base.hpp"
+
+// 控制字节组探测使用 SSE2（x86-64 基线指令集）；定义 TS_STL_NO_SIMD 可强制使用标量实现
+#if defined(__SSE2__) && !defined(TS_STL_NO_SIMD)
+    #include <emmintrin.h>
+    #define TS_STL_FLAT_USE_SSE2 1
+#else
+    #define TS_STL_FLAT_USE_SSE2 0
+#endif
+
+namespace ts_stl {
+
+namespace detail {
+
+// 控制字节：最高位为 0 表示槽位已占用，低 7 位保存哈希值的 H2 部分
+using flat_ctrl_t = std::int8_t;
+
+inline constexpr flat_ctrl_t flat_ctrl_empty = -128;   // 0b10000000
+inline constexpr flat_ctrl_t flat_ctrl_deleted = -2;   // 0b11111110
+inline constexpr std::size_t flat_group_width = 16;
+
+/**
+ * @brief 位掩码最低置位的下标（掩码非 0）
+ */
+inline unsigned flat_trailing_zeros(std::uint32_t mask) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+    return static_cast<unsigned>(__builtin_ctz(mask));
+#else
+    unsigned n = 0;
+    while ((mask & 1u) == 0) {
+        mask >>= 1;
+        ++n;
+    }
+    return n;
+#endif
+}
+
+/**
+ * @brief 16 位组掩码中从最高位开始连续的 0 的个数
+ */
+inline unsigned flat_leading_zeros16(std::uint32_t mask) noexcept {
+    if (mask == 0) {
+        return 16;
+    }
+#if defined(__GNUC__) || defined(__clang__)
+    return static_cast<unsigned>(__builtin_clz(mask)) - 16;
+#else
+    unsigned n = 0;
+    for (std::uint32_t bit = 1u << 15; (mask & bit) == 0; bit >>= 1) {
+        ++n;
+    }
+    return n;
+#endif
+}
+
+/**
+ * @brief 一次比较 16 个控制字节，返回匹配位置的位掩码（第 i 位对应第 i 个槽位）
+ */
+class flat_group {
+public:
+    explicit flat_group(const flat_ctrl_t* ctrl) noexcept
+#if TS_STL_FLAT_USE_SSE2
+        : ctrl_(_mm_loadu_si128(reinterpret_cast<const __m128i*>(ctrl))) {}
+#else
+        : ctrl_(ctrl) {}
+#endif
+
+    std::uint32_t match(flat_ctrl_t h2) const noexcept {
+#if TS_STL_FLAT_USE_SSE2
+        return to_mask(_mm_cmpeq_epi8(_mm_set1_epi8(static_cast<char>(h2)), ctrl_));
+#else
+        std::uint32_t mask = 0;
+        for (std::size_t i = 0; i < flat_group_width; ++i) {
+            mask |= static_cast<std::uint32_t>(ctrl_[i] == h2) << i;
+        }
+        return mask;
+#endif
+    }
+
+    std::uint32_t match_empty() const noexcept {
+        return match(flat_ctrl_empty);
+    }
+
+    // 空槽与墓碑都小于 -1，已占用槽位的控制字节非负
+    std::uint32_t match_empty_or_deleted() const noexcept {
+#if TS_STL_FLAT_USE_SSE2
+        return to_mask(_mm_cmpgt_epi8(_mm_set1_epi8(-1), ctrl_));
+#else
+        std::uint32_t mask = 0;
+        for (std::size_t i = 0; i < flat_group_width; ++i) {
+            mask |= static_cast<std::uint32_t>(ctrl_[i] < -1) << i;
+        }
+        return mask;
+#endif
+    }
+
+private:
+#if TS_STL_FLAT_USE_SSE2
+    static std::uint32_t to_mask(__m128i cmp) noexcept {
+        return static_cast<std::uint32_t>(_mm_movemask_epi8(cmp));
+    }
+
+    __m128i ctrl_;
+#else
+    const flat_ctrl_t* ctrl_;
+#endif
+};
+
+} // namespace detail
+
+/**
+ * @brief 开放寻址的扁平哈希表（SwissTable 风格，非线程安全）
+ * @tparam Key 键类型
+ * @tparam T 值类型
+ * @tparam Hash 哈希函数（默认使用std::hash）
+ * @tparam KeyEqual 键相等比较器（默认使用std::equal_to）
+ *
+ * 元素直接存放在连续的槽位数组中，另有一个每槽 1 字节的控制字节数组：
+ * - 哈希值的高位（H1）决定探测起点，低 7 位（H2）存入控制字节
+ * - 查找时一次比较 16 个控制字节，只有 H2 匹配的槽位才比较键，通常一次缓存未命中即可完成
+ * - 删除留下墓碑；墓碑过多时在原容量下重建，最大装载因子 7/8
+ *
+ * 与 std::unordered_map 的差异：
+ * - 插入触发扩容时所有迭代器、引用失效（元素被移动到新数组）
+ * - 扩容时键通过 const_cast 移动（与标准库 node_handle 的做法相同），元素的移动构造不应抛出异常
+ * - 最大装载因子固定，不提供 max_load_factor(float)
+ * - Hash 与 KeyEqual 都透明时，查找接口直接接受异构键
+ */
+template <typename Key, typename T, typename Hash = std::hash<Key>, typename KeyEqual = std::equal_to<Key>>
+class flat_hash_table {
+public:
+    using key_type = Key;
+    using mapped_type = T;
+    using value_type = std::pair<const Key, T>;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using hasher = Hash;
+    using key_equal = KeyEqual;
+    using reference = value_type&;
+    using const_reference = const value_type&;
+
+private:
+    using ctrl_t = detail::flat_ctrl_t;
+    static constexpr size_type group_width = detail::flat_group_width;
+    static constexpr size_type npos = static_cast<size_type>(-1);
+
+    struct slot {
+        alignas(value_type) unsigned char bytes[sizeof(value_type)];
+
+        value_type* ptr() noexcept {
+            return std::launder(reinterpret_cast<value_type*>(bytes));
+        }
+
+        const value_type* ptr() const noexcept {
+            return std::launder(reinterpret_cast<const value_type*>(bytes));
+        }
+    };
+
+    template <typename... Fs>
+    using if_transparent = detail::enable_if_transparent_t<Fs...>;
+
+public:
+    /**
+     * @brief 前向迭代器，跳过空槽与墓碑
+     */
+    template <bool Const>
+    class basic_iterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = typename flat_hash_table::value_type;
+        using difference_type = std::ptrdiff_t;
+        using pointer = std::conditional_t<Const, const value_type*, value_type*>;
+        using reference = std::conditional_t<Const, const value_type&, value_type&>;
+
+        basic_iterator() = default;
+
+        // 允许 iterator 隐式转换为 const_iterator
+        template <bool C = Const, std::enable_if_t<C, int> = 0>
+        basic_iterator(const basic_iterator<false>& other) noexcept
+            : ctrl_(other.ctrl_), end_(other.end_), slot_(other.slot_) {}
+
+        reference operator*() const noexcept {
+            return *slot_->ptr();
+        }
+
+        pointer operator->() const noexcept {
+            return slot_->ptr();
+        }
+
+        basic_iterator& operator++() noexcept {
+            ++ctrl_;
+            ++slot_;
+            skip_free();
+            return *this;
+        }
+
+        basic_iterator operator++(int) noexcept {
+            basic_iterator tmp = *this;
+            ++*this;
+            return tmp;
+        }
+
+        friend bool operator==(const basic_iterator& a, const basic_iterator& b) noexcept {
+            return a.slot_ == b.slot_;
+        }
+
+        friend bool operator!=(const basic_iterator& a, const basic_iterator& b) noexcept {
+            return a.slot_ != b.slot_;
+        }
+
+    private:
+        friend class flat_hash_table;
+        template <bool> friend class basic_iterator;
+
+        using slot_pointer = std::conditional_t<Const, const slot*, slot*>;
+
+        basic_iterator(const ctrl_t* ctrl, const ctrl_t* end, slot_pointer s) noexcept
+            : ctrl_(ctrl), end_(end), slot_(s) {
+            skip_free();
+        }
+
+        void skip_free() noexcept {
+            while (ctrl_ != end_ && *ctrl_ < 0) {
+                ++ctrl_;
+                ++slot_;
+            }
+        }
+
+        const ctrl_t* ctrl_ = nullptr;
+        const ctrl_t* end_ = nullptr;
+        slot_pointer slot_ = nullptr;
+    };
+
+    using iterator = basic_iterator<false>;
+    using const_iterator = basic_iterator<true>;
+
+private:
+    std::unique_ptr<ctrl_t[]> ctrl_;   // capacity_ + group_width 字节，尾部镜像前 group_width 个
+    std::unique_ptr<slot[]> slots_;
+    size_type capacity_ = 0;           // 0 或不小于 group_width 的2的幂
+    size_type size_ = 0;
+    size_type growth_left_ = 0;        // 达到最大装载因子前还能占用的空槽数（墓碑计为已占用）
+    Hash hash_;
+    KeyEqual equal_;
+
+    // ==================== 内部辅助 ====================
+
+    static size_type max_load(size_type capacity) noexcept {
+        return capacity - capacity / 8;
+    }
+
+    // 容纳 n 个元素所需的最小容量
+    static size_type capacity_for(size_type n) {
+        if (n == 0) {
+            return 0;
+        }
+        size_type capacity = group_width;
+        while (max_load(capacity) < n) {
+            if (capacity > (npos >> 2)) {
+                throw std::length_error("flat_hash_table capacity too large");
+            }
+            capacity <<= 1;
+        }
+        return capacity;
+    }
+
+    template <typename K>
+    std::size_t hash_of(const K& key) const {
+        return detail::mix_hash(hash_(key));
+    }
+
+    static ctrl_t h2_of(std::size_t hash) noexcept {
+        return static_cast<ctrl_t>(hash & 0x7f);
+    }
+
+    static size_type h1_of(std::size_t hash) noexcept {
+        return hash >> 7;
+    }
+
+    // 写控制字节，前 group_width 个同时写入尾部镜像，使任意起点的组加载都不越界
+    void set_ctrl(size_type i, ctrl_t value) noexcept {
+        ctrl_[i] = value;
+        if (i < group_width) {
+            ctrl_[capacity_ + i] = value;
+        }
+    }
+
+    // 按组探测：组起点依次偏移 16、32、48...（三角数步长遍历所有组）
+    template <typename K>
+    size_type find_index(const K& key, std::size_t hash) const {
+        if (capacity_ == 0) {
+            return npos;
+        }
+        const size_type mask = capacity_ - 1;
+        const ctrl_t h2 = h2_of(hash);
+        size_type pos = h1_of(hash) & mask;
+        for (size_type step = group_width;; step += group_width) {
+            detail::flat_group group(ctrl_.get() + pos);
+            for (std::uint32_t m = group.match(h2); m != 0; m &= m - 1) {
+                size_type i = (pos + detail::flat_trailing_zeros(m)) & mask;
+                if (equal_(slots_[i].ptr()->first, key)) {
+                    return i;
+                }
+            }
+            if (group.match_empty() != 0) {
+                return npos;
+            }
+            pos = (pos + step) & mask;
+        }
+    }
+
+    // 探测序列上第一个空槽或墓碑（装载因子保证一定存在）
+    size_type find_free_slot(std::size_t hash) const noexcept {
+        const size_type mask = capacity_ - 1;
+        size_type pos = h1_of(hash) & mask;
+        for (size_type step = group_width;; step += group_width) {
+            std::uint32_t m = detail::flat_group(ctrl_.get() + pos).match_empty_or_deleted();
+            if (m != 0) {
+                return (pos + detail::flat_trailing_zeros(m)) & mask;
+            }
+            pos = (pos + step) & mask;
+        }
+    }
+
+    // 为新元素选定槽位，必要时扩容或清理墓碑
+    size_type prepare_insert(std::size_t hash) {
+        if (capacity_ != 0) {
+            size_type i = find_free_slot(hash);
+            if (growth_left_ != 0 || ctrl_[i] == detail::flat_ctrl_deleted) {
+                return i;
+            }
+        }
+        if (capacity_ == 0) {
+            resize(group_width);
+        } else if (size_ <= max_load(capacity_) / 2) {
+            resize(capacity_);  // 主要是墓碑：原容量重建
+        } else {
+            resize(capacity_ * 2);
+        }
+        return find_free_slot(hash);
+    }
+
+    template <typename K, typename... Args>
+    std::pair<iterator, bool> emplace_unique(std::size_t hash, K&& key, Args&&... args) {
+        size_type i = find_index(key, hash);
+        if (i != npos) {
+            return {iterator_at(i), false};
+        }
+        i = prepare_insert(hash);
+        ::new (static_cast<void*>(slots_[i].bytes)) value_type(std::piecewise_construct,
+                                                               std::forward_as_tuple(std::forward<K>(key)),
+                                                               std::forward_as_tuple(std::forward<Args>(args)...));
+        if (ctrl_[i] == detail::flat_ctrl_empty) {
+            --growth_left_;
+        }
+        set_ctrl(i, h2_of(hash));
+        ++size_;
+        return {iterator_at(i), true};
+    }
+
+    void erase_at(size_type i) noexcept {
+        slots_[i].ptr()->~value_type();
+        --size_;
+        // 若没有任何完整的探测组跨过该槽位，可以直接标记为空，不留墓碑
+        const size_type mask = capacity_ - 1;
+        std::uint32_t empty_after = detail::flat_group(ctrl_.get() + i).match_empty();
+        std::uint32_t empty_before = detail::flat_group(ctrl_.get() + ((i - group_width) & mask)).match_empty();
+        unsigned full_after = empty_after != 0 ? detail::flat_trailing_zeros(empty_after) : 16;
+        unsigned full_before = detail::flat_leading_zeros16(empty_before);
+        if (full_before + full_after < group_width) {
+            set_ctrl(i, detail::flat_ctrl_empty);
+            ++growth_left_;
+        } else {
+            set_ctrl(i, detail::flat_ctrl_deleted);
+        }
+    }
+
+    void allocate(size_type capacity) {
+        ctrl_.reset(new ctrl_t[capacity + group_width]);
+        std::memset(ctrl_.get(), static_cast<unsigned char>(detail::flat_ctrl_empty), capacity + group_width);
+        slots_.reset(new slot[capacity]);
+        capacity_ = capacity;
+        growth_left_ = max_load(capacity);
+    }
+
+    void resize(size_type capacity) {
+        std::unique_ptr<ctrl_t[]> old_ctrl = std::move(ctrl_);
+        std::unique_ptr<slot[]> old_slots = std::move(slots_);
+        size_type old_capacity = capacity_;
+        try {
+            allocate(capacity);
+        } catch (...) {
+            ctrl_ = std::move(old_ctrl);
+            slots_ = std::move(old_slots);
+            capacity_ = old_capacity;
+            throw;
+        }
+        for (size_type i = 0; i < old_capacity; ++i) {
+            if (old_ctrl[i] >= 0) {
+                value_type* old_value = old_slots[i].ptr();
+                std::size_t hash = hash_of(old_value->first);
+                size_type j = find_free_slot(hash);
+                ::new (static_cast<void*>(slots_[j].bytes))
+                    value_type(std::move(const_cast<Key&>(old_value->first)), std::move(old_value->second));
+                old_value->~value_type();
+                set_ctrl(j, h2_of(hash));
+            }
+        }
+        growth_left_ -= size_;
+    }
+
+    void destroy_all() noexcept {
+        if (!std::is_trivially_destructible<value_type>::value) {
+            for (size_type i = 0; i < capacity_; ++i) {
+                if (ctrl_[i] >= 0) {
+                    slots_[i].ptr()->~value_type();
+                }
+            }
+        }
+    }
+
+    void release() noexcept {
+        destroy_all();
+        ctrl_.reset();
+        slots_.reset();
+        capacity_ = 0;
+        size_ = 0;
+        growth_left_ = 0;
+    }
+
+    iterator iterator_at(size_type i) noexcept {
+        return iterator(ctrl_.get() + i, ctrl_.get() + capacity_, slots_.get() + i);
+    }
+
+    const_iterator iterator_at(size_type i) const noexcept {
+        return const_iterator(ctrl_.get() + i, ctrl_.get() + capacity_, slots_.get() + i);
+    }
+
+    template <typename K>
+    iterator find_impl(const K& key) {
+        size_type i = find_index(key, hash_of(key));
+        return i == npos ? end() : iterator_at(i);
+    }
+
+    template <typename K>
+    const_iterator find_impl(const K& key) const {
+        size_type i = find_index(key, hash_of(key));
+        return i == npos ? end() : iterator_at(i);
+    }
+
+public:
+    // ==================== 构造函数 ====================
+
+    flat_hash_table() = default;
+
+    explicit flat_hash_table(size_type bucket_count, const Hash& hash = Hash(), const KeyEqual& equal = KeyEqual())
+        : hash_(hash), equal_(equal) {
+        rehash(bucket_count);
+    }
+
+    template <typename InputIt>
+    flat_hash_table(InputIt first, InputIt last) {
+        insert(first, last);
+    }
+
+    flat_hash_table(std::initializer_list<value_type> init) {
+        insert(init.begin(), init.end());
+    }
+
+    flat_hash_table(const flat_hash_table& other) : hash_(other.hash_), equal_(other.equal_) {
+        reserve(other.size_);
+        for (const auto& item : other) {
+            emplace_unique(hash_of(item.first), item.first, item.second);
+        }
+    }
+
+    flat_hash_table(flat_hash_table&& other) noexcept
+        : ctrl_(std::move(other.ctrl_)),
+          slots_(std::move(other.slots_)),
+          capacity_(other.capacity_),
+          size_(other.size_),
+          growth_left_(other.growth_left_),
+          hash_(std::move(other.hash_)),
+          equal_(std::move(other.equal_)) {
+        other.capacity_ = 0;
+        other.size_ = 0;
+        other.growth_left_ = 0;
+    }
+
+    flat_hash_table& operator=(const flat_hash_table& other) {
+        if (this != &other) {
+            flat_hash_table tmp(other);
+            swap(tmp);
+        }
+        return *this;
+    }
+
+    flat_hash_table& operator=(flat_hash_table&& other) noexcept {
+        if (this != &other) {
+            release();
+            swap(other);
+        }
+        return *this;
+    }
+
+    ~flat_hash_table() {
+        destroy_all();
+    }
+
+    void swap(flat_hash_table& other) noexcept {
+        using std::swap;
+        swap(ctrl_, other.ctrl_);
+        swap(slots_, other.slots_);
+        swap(capacity_, other.capacity_);
+        swap(size_, other.size_);
+        swap(growth_left_, other.growth_left_);
+        swap(hash_, other.hash_);
+        swap(equal_, other.equal_);
+    }
+
+    // ==================== 迭代器 ====================
+
+    iterator begin() noexcept {
+        return iterator_at(0);
+    }
+
+    const_iterator begin() const noexcept {
+        return iterator_at(0);
+    }
+
+    const_iterator cbegin() const noexcept {
+        return begin();
+    }
+
+    iterator end() noexcept {
+        return iterator_at(capacity_);
+    }
+
+    const_iterator end() const noexcept {
+        return iterator_at(capacity_);
+    }
+
+    const_iterator cend() const noexcept {
+        return end();
+    }
+
+    // ==================== 容量管理 ====================
+
+    size_type size() const noexcept {
+        return size_;
+    }
+
+    bool empty() const noexcept {
+        return size_ == 0;
+    }
+
+    /**
+     * @brief 槽位总数（对应 std::unordered_map 的桶数）
+     */
+    size_type bucket_count() const noexcept {
+        return capacity_;
+    }
+
+    float load_factor() const noexcept {
+        return capacity_ == 0 ? 0.0f : static_cast<float>(size_) / static_cast<float>(capacity_);
+    }
+
+    float max_load_factor() const noexcept {
+        return 0.875f;
+    }
+
+    /**
+     * @brief 清空元素，保留已分配的槽位
+     */
+    void clear() noexcept {
+        if (capacity_ == 0) {
+            return;
+        }
+        destroy_all();
+        std::memset(ctrl_.get(), static_cast<unsigned char>(detail::flat_ctrl_empty), capacity_ + group_width);
+        size_ = 0;
+        growth_left_ = max_load(capacity_);
+    }
+
+    /**
+     * @brief 预留至少容纳 n 个元素的空间（不会缩小）
+     */
+    void reserve(size_type n) {
+        size_type capacity = capacity_for(n);
+        if (capacity > capacity_) {
+            resize(capacity);
+        }
+    }
+
+    /**
+     * @brief 调整槽位数为不小于 n 且足以容纳当前元素的2的幂（可缩小，n 为 0 且表为空时释放内存）
+     */
+    void rehash(size_type n) {
+        size_type capacity = capacity_for(size_);
+        if (n > capacity) {
+            capacity = group_width;
+            while (capacity < n) {
+                capacity <<= 1;
+            }
+        }
+        if (capacity == 0) {
+            release();
+        } else if (capacity != capacity_) {
+            resize(capacity);
+        }
+    }
+
+    // ==================== 查找操作 ====================
+
+    iterator find(const Key& key) {
+        return find_impl(key);
+    }
+
+    const_iterator find(const Key& key) const {
+        return find_impl(key);
+    }
+
+    template <typename K, typename H = Hash, typename E = KeyEqual, if_transparent<H, E> = 0>
+    iterator find(const K& key) {
+        return find_impl(key);
+    }
+
+    template <typename K, typename H = Hash, typename E = KeyEqual, if_transparent<H, E> = 0>
+    const_iterator find(const K& key) const {
+        return find_impl(key);
+    }
+
+    bool contains(const Key& key) const {
+        return find_index(key, hash_of(key)) != npos;
+    }
+
+    template <typename K, typename H = Hash, typename E = KeyEqual, if_transparent<H, E> = 0>
+    bool contains(const K& key) const {
+        return find_index(key, hash_of(key)) != npos;
+    }
+
+    size_type count(const Key& key) const {
+        return contains(key) ? 1 : 0;
+    }
+
+    template <typename K, typename H = Hash, typename E = KeyEqual, if_transparent<H, E> = 0>
+    size_type count(const K& key) const {
+        return contains(key) ? 1 : 0;
+    }
+
+    // ==================== 元素访问 ====================
+
+    T& operator[](const Key& key) {
+        return try_emplace(key).first->second;
+    }
+
+    T& operator[](Key&& key) {
+        return try_emplace(std::move(key)).first->second;
+    }
+
+    T& at(const Key& key) {
+        size_type i = find_index(key, hash_of(key));
+        if (i == npos) {
+            throw std::out_of_range("flat_hash_table::at key not found");
+        }
+        return slots_[i].ptr()->second;
+    }
+
+    const T& at(const Key& key) const {
+        return const_cast<flat_hash_table*>(this)->at(key);
+    }
+
+    template <typename K, typename H = Hash, typename E = KeyEqual, if_transparent<H, E> = 0>
+    T& at(const K& key) {
+        size_type i = find_index(key, hash_of(key));
+        if (i == npos) {
+            throw std::out_of_range("flat_hash_table::at key not found");
+        }
+        return slots_[i].ptr()->second;
+    }
+
+    template <typename K, typename H = Hash, typename E = KeyEqual, if_transparent<H, E> = 0>
+    const T& at(const K& key) const {
+        return const_cast<flat_hash_table*>(this)->at(key);
+    }
+
+    // ==================== 修改操作 ====================
+
+    /**
+     * @brief 键不存在时以 args 构造值并插入，键存在时不构造值
+     */
+    template <typename... Args>
+    std::pair<iterator, bool> try_emplace(const Key& key, Args&&... args) {
+        return emplace_unique(hash_of(key), key, std::forward<Args>(args)...);
+    }
+
+    template <typename... Args>
+    std::pair<iterator, bool> try_emplace(Key&& key, Args&&... args) {
+        std::size_t hash = hash_of(key);
+        return emplace_unique(hash, std::move(key), std::forward<Args>(args)...);
+    }
+
+    /**
+     * @brief 以键和值的构造参数插入（等价于 try_emplace）
+     */
+    template <typename K, typename... Args>
+    std::pair<iterator, bool> emplace(K&& key, Args&&... args) {
+        return try_emplace(Key(std::forward<K>(key)), std::forward<Args>(args)...);
+    }
+
+    std::pair<iterator, bool> insert(const value_type& value) {
+        return try_emplace(value.first, value.second);
+    }
+
+    std::pair<iterator, bool> insert(value_type&& value) {
+        return try_emplace(value.first, std::move(value.second));
+    }
+
+    template <typename InputIt>
+    void insert(InputIt first, InputIt last) {
+        reserve(size_ + detail::bulk_size_hint(first, last));
+        for (; first != last; ++first) {
+            const auto& item = *first;
+            try_emplace(item.first, item.second);
+        }
+    }
+
+    template <typename M>
+    std::pair<iterator, bool> insert_or_assign(const Key& key, M&& value) {
+        auto result = try_emplace(key, std::forward<M>(value));
+        if (!result.second) {
+            result.first->second = std::forward<M>(value);
+        }
+        return result;
+    }
+
+    size_type erase(const Key& key) {
+        size_type i = find_index(key, hash_of(key));
+        if (i == npos) {
+            return 0;
+        }
+        erase_at(i);
+        return 1;
+    }
+
+    /**
+     * @brief 删除指定位置的元素（不会移动其他元素），返回下一个元素
+     */
+    iterator erase(const_iterator pos) noexcept {
+        size_type i = static_cast<size_type>(pos.slot_ - slots_.get());
+        erase_at(i);
+        return iterator_at(i + 1);
+    }
+
+    iterator erase(iterator pos) noexcept {
+        return erase(const_iterator(pos));
+    }
+
+    iterator erase(const_iterator first, const_iterator last) noexcept {
+        size_type i = static_cast<size_type>(first.slot_ - slots_.get());
+        size_type end_index = static_cast<size_type>(last.slot_ - slots_.get());
+        for (; i < end_index; ++i) {
+            if (ctrl_[i] >= 0) {
+                erase_at(i);
+            }
+        }
+        return iterator_at(end_index);
+    }
+
+    // ==================== 观察者与比较 ====================
+
+    hasher hash_function() const {
+        return hash_;
+    }
+
+    key_equal key_eq() const {
+        return equal_;
+    }
+
+    bool operator==(const flat_hash_table& other) const {
+        if (size_ != other.size_) {
+            return false;
+        }
+        for (const auto& item : *this) {
+            auto it = other.find(item.first);
+            if (it == other.end() || !(it->second == item.second)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool operator!=(const flat_hash_table& other) const {
+        return !(*this == other);
+    }
+};
+
+/**
+ * @brief 以扁平哈希表为后端的线程安全Unordered Map代理类
+ * @tparam Key 键类型
+ * @tparam T 值类型
+ * @tparam Hash 哈希函数（默认使用std::hash）
+ * @tparam KeyEqual 键相等比较器（默认使用std::equal_to）
+ * @tparam Policy 锁策略（默认使用互斥锁）
+ *
+ * 接口与 unordered_map 一致，底层换成 flat_hash_table：元素连续存放、没有逐元素节点分配，
+ * 小键值对的内存占用约为 std::unordered_map 的一半，查找通常只访问一条控制字节缓存行和一个槽位。
+ * 注意 unsafe_ref() 取得的迭代器在扩容后失效。
+ */
+template <typename Key, typename T, typename Hash = std::hash<Key>, typename KeyEqual = std::equal_to<Key>, LockPolicy Policy = LockPolicy::Mutex>
+class flat_unordered_map : public container_mixin<flat_unordered_map<Key, T, Hash, KeyEqual, Policy>, std::pair<const Key, T>, Policy> {
+private:
+    friend class container_mixin<flat_unordered_map<Key, T, Hash, KeyEqual, Policy>, std::pair<const Key, T>, Policy>;
+
+    flat_hash_table<Key, T, Hash, KeyEqual> data_;
+
+    using Base = container_mixin<flat_unordered_map<Key, T, Hash, KeyEqual, Policy>, std::pair<const Key, T>, Policy>;
+    using Base::acquire_write_lock;
+    using Base::acquire_read_lock;
+
+public:
+    // 为基类提供必要的类型信息
+    using Container = flat_hash_table<Key, T, Hash, KeyEqual>;
+    
+    using key_type = Key;
+    using mapped_type = T;
+    using value_type = std::pair<const Key, T>;
+    using size_type = typename flat_hash_table<Key, T, Hash, KeyEqual>::size_type;
+    using iterator = typename flat_hash_table<Key, T, Hash, KeyEqual>::iterator;
+    using const_iterator = typename flat_hash_table<Key, T, Hash, KeyEqual>::const_iterator;
+
+    // ==================== 构造函数 ====================
+
+    flat_unordered_map() : Base() {}
+
+    explicit flat_unordered_map(size_type bucket_count) : Base() {
+        data_ = flat_hash_table<Key, T, Hash, KeyEqual>(bucket_count);
+    }
+
+    flat_unordered_map(size_type bucket_count, const Hash& hash) : Base() {
+        data_ = flat_hash_table<Key, T, Hash, KeyEqual>(bucket_count, hash);
+    }
+
+    flat_unordered_map(size_type bucket_count, const Hash& hash, const KeyEqual& equal) : Base() {
+        data_ = flat_hash_table<Key, T, Hash, KeyEqual>(bucket_count, hash, equal);
+    }
+
+    template <typename InputIt>
+    flat_unordered_map(InputIt first, InputIt last) : Base() {
+        data_.insert(first, last);
+    }
+
+    flat_unordered_map(const flat_unordered_map& other) : Base() {
+        auto guard = acquire_write_lock();
+        data_ = other.data_;
+    }
+
+    flat_unordered_map& operator=(const flat_unordered_map& other) {
+        if (this != &other) {
+            auto guard = acquire_write_lock();
+            data_ = other.data_;
+        }
+        return *this;
+    }
+
+    flat_unordered_map(flat_unordered_map&& other) noexcept : Base() {
+        auto guard = acquire_write_lock();
+        data_ = std::move(other.data_);
+    }
+
+    flat_unordered_map& operator=(flat_unordered_map&& other) noexcept {
+        if (this != &other) {
+            auto guard = acquire_write_lock();
+            data_ = std::move(other.data_);
+        }
+        return *this;
+    }
+
+    // ==================== 元素访问 ====================
+
+    /**
+     * @brief 获取指定键对应的值（如果键不存在则插入默认值）
+     */
+    T& operator[](const Key& key) {
+        auto guard = acquire_write_lock();
+        return data_[key];
+    }
+
+    /**
+     * @brief 获取指定键对应的值（const版本）
+     */
+    T at(const Key& key) const {
+        auto guard = acquire_read_lock();
+        return data_.at(key);
+    }
+
+    /**
+     * @brief 获取指定键对应的值（非const版本）
+     */
+    T& at(const Key& key) {
+        auto guard = acquire_write_lock();
+        return data_.at(key);
+    }
+
+    /**
+     * @brief 设置指定键的值
+     */
+    void set(const Key& key, const T& value) {
+        auto guard = acquire_write_lock();
+        data_[key] = value;
+    }
+
+    /**
+     * @brief 获取指定键的值，如果不存在返回默认值
+     */
+    T get(const Key& key, const T& default_value = T()) const {
+        auto guard = acquire_read_lock();
+        auto it = data_.find(key);
+        if (it != data_.end()) {
+            return it->second;
+        }
+        return default_value;
+    }
+
+    // ==================== 容量管理 ====================
+
+    /**
+     * @brief 获取flat_unordered_map的大小
+     */
+    size_type size() const {
+        auto guard = acquire_read_lock();
+        return data_.size();
+    }
+
+    /**
+     * @brief 检查flat_unordered_map是否为空
+     */
+    bool empty() const {
+        auto guard = acquire_read_lock();
+        return data_.empty();
+    }
+
+    /**
+     * @brief 清空flat_unordered_map
+     */
+    void clear() {
+        auto guard = acquire_write_lock();
+        data_.clear();
+    }
+
+    /**
+     * @brief 获取桶数量
+     */
+    size_type bucket_count() const {
+        auto guard = acquire_read_lock();
+        return data_.bucket_count();
+    }
+
+    /**
+     * @brief 获取装载因子（元素个数/桶数量）
+     */
+    float load_factor() const {
+        auto guard = acquire_read_lock();
+        return data_.load_factor();
+    }
+
+    /**
+     * @brief 获取最大装载因子
+     */
+    float max_load_factor() const {
+        auto guard = acquire_read_lock();
+        return data_.max_load_factor();
+    }
+
+    /**
+     * @brief 重新哈希以至少容纳n个元素
+     */
+    void reserve(size_type n) {
+        auto guard = acquire_write_lock();
+        data_.reserve(n);
+    }
+
+    /**
+     * @brief 重新哈希使桶数至少为n
+     */
+    void rehash(size_type n) {
+        auto guard = acquire_write_lock();
+        data_.rehash(n);
+    }
+
+    // ==================== 查找操作 ====================
+
+    /**
+     * @brief 查找指定键
+     */
+    bool contains(const Key& key) const {
+        auto guard = acquire_read_lock();
+        return data_.find(key) != data_.end();
+    }
+
+    /**
+     * @brief 统计指定键的个数
+     */
+    size_type count(const Key& key) const {
+        auto guard = acquire_read_lock();
+        return data_.count(key);
+    }
+
+    // ==================== 异构查找（透明比较器） ====================
+
+    /**
+     * @brief 以任意可与 Key 比较的类型查找（需要 Hash 与 KeyEqual 都声明 is_transparent，
+     *        如 string_hash + std::equal_to<>；flat_hash_table 自身支持，C++17 即可使用）
+     */
+    template <typename K, typename H = Hash, typename E = KeyEqual, detail::enable_if_transparent_t<H, E> = 0>
+    bool contains(const K& key) const {
+        auto guard = acquire_read_lock();
+        return data_.find(key) != data_.end();
+    }
+
+    template <typename K, typename H = Hash, typename E = KeyEqual, detail::enable_if_transparent_t<H, E> = 0>
+    size_type count(const K& key) const {
+        auto guard = acquire_read_lock();
+        return data_.count(key);
+    }
+
+    template <typename K, typename H = Hash, typename E = KeyEqual, detail::enable_if_transparent_t<H, E> = 0>
+    T get(const K& key, const T& default_value = T()) const {
+        auto guard = acquire_read_lock();
+        auto it = data_.find(key);
+        if (it != data_.end()) {
+            return it->second;
+        }
+        return default_value;
+    }
+
+    template <typename K, typename H = Hash, typename E = KeyEqual, detail::enable_if_transparent_t<H, E> = 0>
+    T at(const K& key) const {
+        auto guard = acquire_read_lock();
+        auto it = data_.find(key);
+        if (it == data_.end()) {
+            throw std::out_of_range("flat_unordered_map::at");
+        }
+        return it->second;
+    }
+
+    template <typename K, typename H = Hash, typename E = KeyEqual, detail::enable_if_transparent_t<H, E> = 0>
+    T& at(const K& key) {
+        auto guard = acquire_write_lock();
+        auto it = data_.find(key);
+        if (it == data_.end()) {
+            throw std::out_of_range("flat_unordered_map::at");
+        }
+        return it->second;
+    }
+
+    // ==================== 修改操作 ====================
+
+    /**
+     * @brief 插入键值对
+     */
+    std::pair<bool, size_type> insert(const Key& key, const T& value) {
+        auto guard = acquire_write_lock();
+        auto result = data_.insert({key, value});
+        return {result.second, 0};  // 哈希表没有有序下标
+    }
+
+    /**
+     * @brief 使用移动语义插入键值对
+     */
+    std::pair<bool, size_type> insert(const Key& key, T&& value) {
+        auto guard = acquire_write_lock();
+        auto result = data_.insert({key, std::move(value)});
+        return {result.second, 0};  // 哈希表没有有序下标
+    }
+
+    /**
+     * @brief 原地构造并插入
+     */
+    template <typename... Args>
+    std::pair<bool, size_type> emplace(const Key& key, Args&&... args) {
+        auto guard = acquire_write_lock();
+        auto result = data_.emplace(key, T(std::forward<Args>(args)...));
+        return {result.second, 0};  // 哈希表没有有序下标
+    }
+
+    /**
+     * @brief 移除指定键
+     */
+    size_type erase(const Key& key) {
+        auto guard = acquire_write_lock();
+        return data_.erase(key);
+    }
+
+    /**
+     * @brief 删除指定位置的元素
+     */
+    void erase(const_iterator pos) {
+        auto guard = acquire_write_lock();
+        data_.erase(pos);
+    }
+
+    /**
+     * @brief 删除指定范围的元素
+     */
+    void erase(const_iterator first, const_iterator last) {
+        auto guard = acquire_write_lock();
+        data_.erase(first, last);
+    }
+
+    // ==================== 原地访问与原子读-改-写 ====================
+
+    /**
+     * @brief 在读锁内对键对应的值执行 func(const T&)，不复制值
+     * @return 键存在时返回 true
+     */
+    template <typename Func>
+    bool visit(const Key& key, Func func) const {
+        auto guard = acquire_read_lock();
+        auto it = data_.find(key);
+        if (it == data_.end()) {
+            return false;
+        }
+        func(static_cast<const T&>(it->second));
+        return true;
+    }
+
+    /**
+     * @brief 在写锁内对键对应的值执行 func(T&)，原地修改
+     * @return 键存在时返回 true
+     */
+    template <typename Func>
+    bool visit_mut(const Key& key, Func func) {
+        auto guard = acquire_write_lock();
+        auto it = data_.find(key);
+        if (it == data_.end()) {
+            return false;
+        }
+        func(it->second);
+        return true;
+    }
+
+    /**
+     * @brief 键存在时在写锁内执行 func(T&)；若 func 返回 bool 且为 false，则删除该元素
+     * @return 调用前键是否存在
+     */
+    template <typename Func>
+    bool compute_if_present(const Key& key, Func func) {
+        auto guard = acquire_write_lock();
+        auto it = data_.find(key);
+        if (it == data_.end()) {
+            return false;
+        }
+        if constexpr (std::is_same_v<std::invoke_result_t<Func&, T&>, void>) {
+            func(it->second);
+        } else {
+            if (!func(it->second)) {
+                data_.erase(it);
+            }
+        }
+        return true;
+    }
+
+    /**
+     * @brief 键不存在时在写锁内以 factory() 的结果插入（键存在时 factory 不会被调用）
+     * @return 是否插入了新元素
+     */
+    template <typename Factory>
+    bool compute_if_absent(const Key& key, Factory factory) {
+        auto guard = acquire_write_lock();
+        if (data_.find(key) != data_.end()) {
+            return false;
+        }
+        data_.emplace(key, factory());
+        return true;
+    }
+
+    /**
+     * @brief 键不存在时插入 value，否则在写锁内执行 func(T& existing, const T& value) 合并
+     * @return 是否插入了新元素
+     */
+    template <typename Func>
+    bool merge(const Key& key, const T& value, Func func) {
+        auto guard = acquire_write_lock();
+        auto result = data_.try_emplace(key, value);
+        if (!result.second) {
+            func(result.first->second, value);
+        }
+        return result.second;
+    }
+
+    // ==================== 批量操作（单次加锁） ====================
+
+    /**
+     * @brief 批量插入键值对（只加锁一次，并按批量大小预先 reserve），已存在的键保持不变
+     * @return 新插入的元素个数
+     */
+    template <typename InputIt>
+    size_type insert_bulk(InputIt first, InputIt last) {
+        auto guard = acquire_write_lock();
+        data_.reserve(data_.size() + detail::bulk_size_hint(first, last));
+        size_type inserted = 0;
+        for (; first != last; ++first) {
+            if (data_.insert(*first).second) {
+                ++inserted;
+            }
+        }
+        return inserted;
+    }
+
+    template <typename Range>
+    size_type insert_bulk(const Range& range) {
+        return insert_bulk(std::begin(range), std::end(range));
+    }
+
+    /**
+     * @brief 批量删除键（只加锁一次）
+     * @return 实际删除的元素个数
+     */
+    template <typename InputIt>
+    size_type erase_bulk(InputIt first, InputIt last) {
+        auto guard = acquire_write_lock();
+        size_type erased = 0;
+        for (; first != last; ++first) {
+            erased += data_.erase(*first);
+        }
+        return erased;
+    }
+
+    template <typename KeyRange>
+    size_type erase_bulk(const KeyRange& keys) {
+        return erase_bulk(std::begin(keys), std::end(keys));
+    }
+
+    /**
+     * @brief 批量查找（只加锁一次），按 keys 的顺序输出值，不存在的键输出 default_value
+     * @return 命中的键个数
+     */
+    template <typename KeyRange, typename OutputIt>
+    size_type get_many(const KeyRange& keys, OutputIt out, const T& default_value = T()) const {
+        auto guard = acquire_read_lock();
+        size_type found = 0;
+        for (const auto& key : keys) {
+            auto it = data_.find(key);
+            if (it != data_.end()) {
+                *out = it->second;
+                ++found;
+            } else {
+                *out = default_value;
+            }
+            ++out;
+        }
+        return found;
+    }
+
+    // ==================== STL兼容性 ====================
+
+    /**
+     * @brief 隐式转换到flat_hash_table
+     */
+    operator const flat_hash_table<Key, T, Hash, KeyEqual>&() const {
+        return data_;
+    }
+
+    /**
+     * @brief 获取内部flat_hash_table的拷贝
+     */
+    flat_hash_table<Key, T, Hash, KeyEqual> copy() const {
+        auto guard = acquire_read_lock();
+        return data_;
+    }
+
+    /**
+     * @brief 获取内部flat_hash_table的引用
+     */
+    const flat_hash_table<Key, T, Hash, KeyEqual>& ref() const {
+        return data_;
+    }
+
+    // ==================== 迭代和查询 ====================
+
+    /**
+     * @brief 对每个元素执行操作
+     */
+    template <typename Func>
+    void for_each(Func func) const {
+        auto guard = acquire_read_lock();
+        for (const auto& pair : data_) {
+            func(pair.first, pair.second);
+        }
+    }
+
+    /**
+     * @brief 条件查找
+     */
+    template <typename Predicate>
+    const_iterator find_if(Predicate pred) const {
+        auto guard = acquire_read_lock();
+        return std::find_if(data_.begin(), data_.end(), 
+                          [&pred](const auto& p) { return pred(p.first, p.second); });
+    }
+
+    /**
+     * @brief 统计满足条件的元素个数
+     */
+    template <typename Predicate>
+    size_type count_if(Predicate pred) const {
+        auto guard = acquire_read_lock();
+        return std::count_if(data_.begin(), data_.end(),
+                            [&pred](const auto& p) { return pred(p.first, p.second); });
+    }
+
+    // ==================== 比较操作 ====================
+
+    bool operator==(const flat_unordered_map& other) const {
+        auto guard = acquire_read_lock();
+        return data_ == other.data_;
+    }
+
+    bool operator!=(const flat_unordered_map& other) const {
+        return !(*this == other);
+    }
+
+    // ==================== 线程不安全接口 ====================
+
+    /**
+     * @brief 获取内部flat_hash_table的非const引用（线程不安全）
+     */
+    flat_hash_table<Key, T, Hash, KeyEqual>& unsafe_ref() {
+        return data_;
+    }
+
+    const flat_hash_table<Key, T, Hash, KeyEqual>& unsafe_ref() const {
+        return data_;
+    }
+
+    /**
+     * @brief 线程不安全的size获取
+     */
+    size_type unsafe_size() const {
+        return data_.size();
+    }
+
+    /**
+     * @brief 线程不安全的empty检查
+     */
+    bool unsafe_empty() const {
+        return data_.empty();
+    }
+
+    /**
+     * @brief 线程不安全的clear
+     */
+    void unsafe_clear() {
+        data_.clear();
+    }
+
+    /**
+     * @brief 线程不安全的insert
+     */
+    void unsafe_insert(const Key& key, const T& value) {
+        data_[key] = value;
+    }
+
+    void unsafe_insert(const Key& key, T&& value) {
+        data_[key] = std::move(value);
+    }
+
+    /**
+     * @brief 线程不安全的erase
+     */
+    size_type unsafe_erase(const Key& key) {
+        return data_.erase(key);
+    }
+
+    /**
+     * @brief 线程不安全的at访问
+     */
+    T& unsafe_at(const Key& key) {
+        return data_[key];
+    }
+
+    const T& unsafe_at(const Key& key) const {
+        return data_.at(key);
+    }
+
+    // ==================== 手动锁控制接口 ====================
+
+    /**
+     * @brief 获取写锁guard供外部使用
+     */
+    auto acquire_write_guard() const {
+        return acquire_write_lock();
+    }
+
+#if TS_STL_SUPPORT_RW_LOCK
+    /**
+     * @brief 获取读锁guard供外部使用
+     */
+    auto acquire_read_guard() const {
+        return acquire_read_lock();
+    }
+#endif
+
+    /**
+     * @brief 批量操作助手 - 在锁保护下执行lambda
+     */
+    template <typename Func>
+    void with_write_lock(Func func) const {
+        auto guard = acquire_write_lock();
+        func(*const_cast<flat_unordered_map*>(this));
+    }
+
+#if TS_STL_SUPPORT_RW_LOCK
+    /**
+     * @brief 批量读操作助手 - 在读锁保护下执行lambda
+     */
+    template <typename Func>
+    void with_read_lock(Func func) const {
+        auto guard = acquire_read_lock();
+        func(*this);
+    }
+#endif
+};
+
+// ==================== Flat Unordered Map 的 LockFree 特化版本（零开销） ====================
+
+/**
+ * @brief Flat Unordered Map 的 LockFree 特化版本 - 为极限性能优化
+ */
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+class flat_unordered_map<Key, T, Hash, KeyEqual, LockPolicy::LockFree> {
+private:
+    flat_hash_table<Key, T, Hash, KeyEqual> data_;
+
+public:
+    // 类型定义
+    using key_type = Key;
+    using mapped_type = T;
+    using value_type = std::pair<const Key, T>;
+    using size_type = typename flat_hash_table<Key, T, Hash, KeyEqual>::size_type;
+    using iterator = typename flat_hash_table<Key, T, Hash, KeyEqual>::iterator;
+    using const_iterator = typename flat_hash_table<Key, T, Hash, KeyEqual>::const_iterator;
+
+    // ==================== 构造函数 ====================
+
+    flat_unordered_map() = default;
+
+    explicit flat_unordered_map(size_type bucket_count) : data_(bucket_count) {}
+
+    flat_unordered_map(size_type bucket_count, const Hash& hash) : data_(bucket_count, hash) {}
+
+    flat_unordered_map(size_type bucket_count, const Hash& hash, const KeyEqual& equal) 
+        : data_(bucket_count, hash, equal) {}
+
+    template <typename InputIt>
+    flat_unordered_map(InputIt first, InputIt last) : data_(first, last) {}
+
+    flat_unordered_map(const flat_unordered_map& other) = default;
+
+    flat_unordered_map& operator=(const flat_unordered_map& other) = default;
+
+    flat_unordered_map(flat_unordered_map&& other) noexcept = default;
+
+    flat_unordered_map& operator=(flat_unordered_map&& other) noexcept = default;
+
+    // ==================== 元素访问（零开销） ====================
+
+    T& operator[](const Key& key) noexcept {
+        return data_[key];
+    }
+
+    T at(const Key& key) const {
+        return data_.at(key);
+    }
+
+    T& at(const Key& key) {
+        return data_.at(key);
+    }
+
+    T get(const Key& key, const T& default_value = T()) const {
+        auto it = data_.find(key);
+        if (it != data_.end()) {
+            return it->second;
+        }
+        return default_value;
+    }
+
+    // ==================== 容量管理（零开销） ====================
+
+    size_type size() const noexcept {
+        return data_.size();
+    }
+
+    bool empty() const noexcept {
+        return data_.empty();
+    }
+
+    void clear() noexcept {
+        data_.clear();
+    }
+
+    size_type bucket_count() const noexcept {
+        return data_.bucket_count();
+    }
+
+    float load_factor() const noexcept {
+        return data_.load_factor();
+    }
+
+    float max_load_factor() const noexcept {
+        return data_.max_load_factor();
+    }
+
+    void reserve(size_type n) noexcept {
+        data_.reserve(n);
+    }
+
+    void rehash(size_type n) noexcept {
+        data_.rehash(n);
+    }
+
+    // ==================== 查找操作（零开销） ====================
+
+    bool contains(const Key& key) const {
+        return data_.find(key) != data_.end();
+    }
+
+    size_type count(const Key& key) const {
+        return data_.count(key);
+    }
+
+    template <typename K, typename H = Hash, typename E = KeyEqual, detail::enable_if_transparent_t<H, E> = 0>
+    bool contains(const K& key) const {
+        return data_.find(key) != data_.end();
+    }
+
+    template <typename K, typename H = Hash, typename E = KeyEqual, detail::enable_if_transparent_t<H, E> = 0>
+    size_type count(const K& key) const {
+        return data_.count(key);
+    }
+
+    template <typename K, typename H = Hash, typename E = KeyEqual, detail::enable_if_transparent_t<H, E> = 0>
+    T get(const K& key, const T& default_value = T()) const {
+        auto it = data_.find(key);
+        if (it != data_.end()) {
+            return it->second;
+        }
+        return default_value;
+    }
+
+    template <typename K, typename H = Hash, typename E = KeyEqual, detail::enable_if_transparent_t<H, E> = 0>
+    T at(const K& key) const {
+        auto it = data_.find(key);
+        if (it == data_.end()) {
+            throw std::out_of_range("flat_unordered_map::at");
+        }
+        return it->second;
+    }
+
+    template <typename K, typename H = Hash, typename E = KeyEqual, detail::enable_if_transparent_t<H, E> = 0>
+    T& at(const K& key) {
+        auto it = data_.find(key);
+        if (it == data_.end()) {
+            throw std::out_of_range("flat_unordered_map::at");
+        }
+        return it->second;
+    }
+
+    // ==================== 修改操作（零开销） ====================
+
+    std::pair<bool, size_type> insert(const Key& key, const T& value) {
+        auto result = data_.insert({key, value});
+        return {result.second, 0};
+    }
+
+    std::pair<bool, size_type> insert(const Key& key, T&& value) {
+        auto result = data_.insert({key, std::move(value)});
+        return {result.second, 0};
+    }
+
+    template <typename... Args>
+    std::pair<bool, size_type> emplace(const Key& key, Args&&... args) {
+        auto result = data_.emplace(key, T(std::forward<Args>(args)...));
+        return {result.second, 0};
+    }
+
+    size_type erase(const Key& key) {
+        return data_.erase(key);
+    }
+
+    template <typename Func>
+    bool visit(const Key& key, Func func) const {
+        auto it = data_.find(key);
+        if (it == data_.end()) {
+            return false;
+        }
+        func(static_cast<const T&>(it->second));
+        return true;
+    }
+
+    template <typename Func>
+    bool visit_mut(const Key& key, Func func) {
+        auto it = data_.find(key);
+        if (it == data_.end()) {
+            return false;
+        }
+        func(it->second);
+        return true;
+    }
+
+    template <typename Func>
+    bool compute_if_present(const Key& key, Func func) {
+        auto it = data_.find(key);
+        if (it == data_.end()) {
+            return false;
+        }
+        if constexpr (std::is_same_v<std::invoke_result_t<Func&, T&>, void>) {
+            func(it->second);
+        } else {
+            if (!func(it->second)) {
+                data_.erase(it);
+            }
+        }
+        return true;
+    }
+
+    template <typename Factory>
+    bool compute_if_absent(const Key& key, Factory factory) {
+        if (data_.find(key) != data_.end()) {
+            return false;
+        }
+        data_.emplace(key, factory());
+        return true;
+    }
+
+    template <typename Func>
+    bool merge(const Key& key, const T& value, Func func) {
+        auto result = data_.try_emplace(key, value);
+        if (!result.second) {
+            func(result.first->second, value);
+        }
+        return result.second;
+    }
+
+    // ==================== 批量操作（零开销） ====================
+
+    /**
+     * @brief 批量插入键值对（按批量大小预先 reserve），已存在的键保持不变
+     * @return 新插入的元素个数
+     */
+    template <typename InputIt>
+    size_type insert_bulk(InputIt first, InputIt last) {
+        data_.reserve(data_.size() + detail::bulk_size_hint(first, last));
+        size_type inserted = 0;
+        for (; first != last; ++first) {
+            if (data_.insert(*first).second) {
+                ++inserted;
+            }
+        }
+        return inserted;
+    }
+
+    template <typename Range>
+    size_type insert_bulk(const Range& range) {
+        return insert_bulk(std::begin(range), std::end(range));
+    }
+
+    /**
+     * @brief 批量删除键
+     * @return 实际删除的元素个数
+     */
+    template <typename InputIt>
+    size_type erase_bulk(InputIt first, InputIt last) {
+        size_type erased = 0;
+        for (; first != last; ++first) {
+            erased += data_.erase(*first);
+        }
+        return erased;
+    }
+
+    template <typename KeyRange>
+    size_type erase_bulk(const KeyRange& keys) {
+        return erase_bulk(std::begin(keys), std::end(keys));
+    }
+
+    /**
+     * @brief 批量查找，按 keys 的顺序输出值，不存在的键输出 default_value
+     * @return 命中的键个数
+     */
+    template <typename KeyRange, typename OutputIt>
+    size_type get_many(const KeyRange& keys, OutputIt out, const T& default_value = T()) const {
+        size_type found = 0;
+        for (const auto& key : keys) {
+            auto it = data_.find(key);
+            if (it != data_.end()) {
+                *out = it->second;
+                ++found;
+            } else {
+                *out = default_value;
+            }
+            ++out;
+        }
+        return found;
+    }
+
+    // ==================== 迭代器（零开销） ====================
+
+    iterator begin() noexcept {
+        return data_.begin();
+    }
+
+    const_iterator begin() const noexcept {
+        return data_.begin();
+    }
+
+    const_iterator cbegin() const noexcept {
+        return data_.cbegin();
+    }
+
+    iterator end() noexcept {
+        return data_.end();
+    }
+
+    const_iterator end() const noexcept {
+        return data_.end();
+    }
+
+    const_iterator cend() const noexcept {
+        return data_.cend();
+    }
+
+    // ==================== 转换操作 ====================
+
+    operator flat_hash_table<Key, T, Hash, KeyEqual>&() noexcept {
+        return data_;
+    }
+
+    operator const flat_hash_table<Key, T, Hash, KeyEqual>&() const noexcept {
+        return data_;
+    }
+
+    flat_hash_table<Key, T, Hash, KeyEqual>& get_unsafe() noexcept {
+        return data_;
+    }
+
+    const flat_hash_table<Key, T, Hash, KeyEqual>& get_unsafe() const noexcept {
+        return data_;
+    }
+};
+
+} // namespace ts_stl
+
+#endif // TS_FLAT_UNORDERED_MAP_HPP
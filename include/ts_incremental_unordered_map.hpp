@@ -0,0 +1,1508 @@
+#pragma once
+
+#ifndef TS_INCREMENTAL_UNORDERED_MAP_HPP
+#define TS_INCREMENTAL_UNORDERED_MAP_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "ts_stl_base.hpp"
+
+// 渐进式扩容时每次修改操作迁移的旧桶个数
+#ifndef TS_STL_INCREMENTAL_REHASH_STEP
+    #define TS_STL_INCREMENTAL_REHASH_STEP 8
+#endif
+
+namespace ts_stl {
+
+/**
+ * @brief 渐进式扩容的进度与累计指标
+ */
+struct incremental_resize_stats {
+    bool in_progress = false;             // 是否有扩容正在进行（新旧两张桶表并存）
+    std::size_t old_bucket_count = 0;     // 正在迁出的旧表桶数（未扩容时为 0）
+    std::size_t bucket_count = 0;         // 当前（新）表桶数
+    std::size_t migrated_buckets = 0;     // 旧表中已迁移的桶数
+    std::uint64_t resizes_started = 0;    // 累计开始的扩容次数
+    std::uint64_t resizes_completed = 0;  // 累计完成的扩容次数
+    std::uint64_t nodes_migrated = 0;     // 累计迁移的节点数
+    std::uint64_t forced_completions = 0; // 迁移未完成时再次触发扩容、只能一次迁完剩余桶的次数
+
+    /**
+     * @brief 当前扩容完成的比例（未扩容时为 1）
+     */
+    double progress() const noexcept {
+        return in_progress && old_bucket_count != 0
+                   ? static_cast<double>(migrated_buckets) / static_cast<double>(old_bucket_count)
+                   : 1.0;
+    }
+};
+
+/**
+ * @brief 渐进式扩容的链式哈希表（单线程，由外层容器加锁）
+ * @tparam Key 键类型
+ * @tparam Mapped 值类型；为 void 时表示集合
+ *
+ * 元素个数超过 bucket_count * max_load_factor 时不一次性重哈希：
+ * 分配两倍大小的新桶表后，新旧两张表并存，之后每次插入/删除顺带把旧表中
+ * migrate_step 个桶的节点重新链接到新表，直到旧表迁空后释放。
+ * - 单次操作的额外工作有上界，消除一次性重哈希造成的长尾延迟；代价是扩容期间每次修改多一点工作
+ * - 节点只重新链接，不重新分配、不重新计算哈希（节点缓存哈希值），元素引用在迁移中保持有效
+ * - 查找根据键的旧桶是否已迁移决定查哪张表，任何时刻只查一处
+ * - 桶数组用 calloc 分配，大数组由操作系统按需提供零页，不需要逐字节清零
+ *
+ * 迭代器在任何修改操作后失效（迁移会移动节点所在的桶）。
+ */
+template <typename Key, typename Mapped, typename Hash = std::hash<Key>, typename KeyEqual = std::equal_to<Key>>
+class incremental_hash_table {
+public:
+    static constexpr bool is_set = std::is_void_v<Mapped>;
+
+    using key_type = Key;
+    using mapped_type = Mapped;
+    using value_type = std::conditional_t<is_set, Key, std::pair<const Key, std::conditional_t<is_set, int, Mapped>>>;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using hasher = Hash;
+    using key_equal = KeyEqual;
+    using reference = value_type&;
+    using const_reference = const value_type&;
+
+private:
+    struct node {
+        node* next;
+        std::size_t hash;
+        value_type value;
+
+        template <typename... Args>
+        explicit node(std::size_t h, Args&&... args) : next(nullptr), hash(h), value(std::forward<Args>(args)...) {}
+    };
+
+    struct free_deleter {
+        void operator()(node** p) const noexcept { std::free(p); }
+    };
+
+    using bucket_ptr = std::unique_ptr<node*[], free_deleter>;
+
+    static constexpr size_type min_buckets = 16;
+
+    bucket_ptr buckets_;
+    size_type bucket_count_ = 0;
+    bucket_ptr old_buckets_;
+    size_type old_bucket_count_ = 0;
+    size_type migrate_pos_ = 0;
+    size_type size_ = 0;
+    float max_load_factor_ = 1.0f;
+    size_type migrate_step_ = TS_STL_INCREMENTAL_REHASH_STEP;
+    incremental_resize_stats stats_;
+    Hash hash_;
+    KeyEqual equal_;
+
+    static bucket_ptr allocate_buckets(size_type count) {
+        auto* p = static_cast<node**>(std::calloc(count, sizeof(node*)));
+        if (p == nullptr) {
+            throw std::bad_alloc();
+        }
+        return bucket_ptr(p);
+    }
+
+    static size_type round_up_pow2(size_type n) noexcept {
+        size_type count = min_buckets;
+        while (count < n) {
+            count <<= 1;
+        }
+        return count;
+    }
+
+    size_type buckets_for(size_type n) const noexcept {
+        return round_up_pow2(static_cast<size_type>(std::ceil(static_cast<double>(n) / max_load_factor_)));
+    }
+
+    static const Key& key_of(const value_type& value) noexcept {
+        if constexpr (is_set) {
+            return value;
+        } else {
+            return value.first;
+        }
+    }
+
+    std::size_t hash_of(const Key& key) const {
+        return detail::mix_hash(hash_(key));
+    }
+
+    bool resizing() const noexcept {
+        return old_bucket_count_ != 0;
+    }
+
+    // 键所在的桶：旧表中尚未迁移的桶仍在旧表，其余在新表
+    node** bucket_for(std::size_t h) const noexcept {
+        if (resizing()) {
+            const size_type old_index = h & (old_bucket_count_ - 1);
+            if (old_index >= migrate_pos_) {
+                return &old_buckets_[old_index];
+            }
+        }
+        return &buckets_[h & (bucket_count_ - 1)];
+    }
+
+    node* find_node(const Key& key, std::size_t h) const {
+        if (bucket_count_ == 0) {
+            return nullptr;
+        }
+        for (node* n = *bucket_for(h); n != nullptr; n = n->next) {
+            if (n->hash == h && equal_(key_of(n->value), key)) {
+                return n;
+            }
+        }
+        return nullptr;
+    }
+
+    void relink(node* n, node** table, size_type count) noexcept {
+        while (n != nullptr) {
+            node* next = n->next;
+            node*& head = table[n->hash & (count - 1)];
+            n->next = head;
+            head = n;
+            n = next;
+        }
+    }
+
+    // 迁移最多 max_buckets 个旧桶；返回是否仍在扩容
+    bool migrate(size_type max_buckets) noexcept {
+        if (!resizing()) {
+            return false;
+        }
+        const size_type end = std::min(old_bucket_count_, migrate_pos_ + max_buckets);
+        for (; migrate_pos_ < end; ++migrate_pos_) {
+            node* n = old_buckets_[migrate_pos_];
+            if (n == nullptr) {
+                continue;
+            }
+            old_buckets_[migrate_pos_] = nullptr;
+            for (node* m = n; m != nullptr; m = m->next) {
+                ++stats_.nodes_migrated;
+            }
+            relink(n, buckets_.get(), bucket_count_);
+        }
+        if (migrate_pos_ == old_bucket_count_) {
+            old_buckets_.reset();
+            old_bucket_count_ = 0;
+            migrate_pos_ = 0;
+            ++stats_.resizes_completed;
+            return false;
+        }
+        return true;
+    }
+
+    // 插入前检查装载因子：超过阈值时开始一次渐进式扩容
+    void grow_if_needed(size_type new_size) {
+        if (bucket_count_ == 0) {
+            buckets_ = allocate_buckets(min_buckets);
+            bucket_count_ = min_buckets;
+        }
+        if (static_cast<double>(new_size) <= static_cast<double>(bucket_count_) * max_load_factor_) {
+            return;
+        }
+        if (resizing()) {
+            // 迁移速度跟不上增长（migrate_step 过小或 max_load_factor 过低）：先迁完剩余桶
+            ++stats_.forced_completions;
+            migrate(old_bucket_count_);
+        }
+        bucket_ptr next = allocate_buckets(bucket_count_ * 2);
+        old_buckets_ = std::move(buckets_);
+        old_bucket_count_ = bucket_count_;
+        buckets_ = std::move(next);
+        bucket_count_ *= 2;
+        migrate_pos_ = 0;
+        ++stats_.resizes_started;
+    }
+
+    // 同步重建为 count 个桶（仅用于显式 reserve/rehash）
+    void rebuild(size_type count) {
+        bucket_ptr next = allocate_buckets(count);
+        if (resizing()) {
+            for (size_type i = migrate_pos_; i < old_bucket_count_; ++i) {
+                relink(old_buckets_[i], next.get(), count);
+            }
+            old_buckets_.reset();
+            old_bucket_count_ = 0;
+            migrate_pos_ = 0;
+            ++stats_.resizes_completed;
+        }
+        for (size_type i = 0; i < bucket_count_; ++i) {
+            relink(buckets_[i], next.get(), count);
+        }
+        buckets_ = std::move(next);
+        bucket_count_ = count;
+    }
+
+    template <typename... Args>
+    std::pair<node*, bool> emplace_key(const Key& key, Args&&... args) {
+        migrate(migrate_step_);
+        const std::size_t h = hash_of(key);
+        if (node* existing = find_node(key, h)) {
+            return {existing, false};
+        }
+        grow_if_needed(size_ + 1);
+        auto* n = new node(h, std::forward<Args>(args)...);
+        node** head = bucket_for(h);
+        n->next = *head;
+        *head = n;
+        ++size_;
+        return {n, true};
+    }
+
+    void destroy_chain(node* n) noexcept {
+        while (n != nullptr) {
+            node* next = n->next;
+            delete n;
+            n = next;
+        }
+    }
+
+    void destroy_all() noexcept {
+        for (size_type i = migrate_pos_; i < old_bucket_count_; ++i) {
+            destroy_chain(old_buckets_[i]);
+        }
+        for (size_type i = 0; i < bucket_count_; ++i) {
+            destroy_chain(buckets_[i]);
+        }
+    }
+
+    template <bool Const>
+    class basic_iterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = typename incremental_hash_table::value_type;
+        using difference_type = std::ptrdiff_t;
+        using pointer = std::conditional_t<Const, const value_type*, value_type*>;
+        using reference = std::conditional_t<Const, const value_type&, value_type&>;
+
+        basic_iterator() = default;
+
+        template <bool C = Const, std::enable_if_t<C, int> = 0>
+        basic_iterator(const basic_iterator<false>& other) noexcept
+            : table_(other.table_), in_old_(other.in_old_), index_(other.index_), node_(other.node_) {}
+
+        reference operator*() const noexcept { return node_->value; }
+        pointer operator->() const noexcept { return &node_->value; }
+
+        basic_iterator& operator++() noexcept {
+            node_ = node_->next;
+            if (node_ == nullptr) {
+                ++index_;
+                settle();
+            }
+            return *this;
+        }
+
+        basic_iterator operator++(int) noexcept {
+            basic_iterator tmp = *this;
+            ++*this;
+            return tmp;
+        }
+
+        friend bool operator==(const basic_iterator& a, const basic_iterator& b) noexcept {
+            return a.node_ == b.node_;
+        }
+
+        friend bool operator!=(const basic_iterator& a, const basic_iterator& b) noexcept {
+            return a.node_ != b.node_;
+        }
+
+    private:
+        friend class incremental_hash_table;
+        template <bool> friend class basic_iterator;
+
+        const incremental_hash_table* table_ = nullptr;
+        bool in_old_ = false;
+        size_type index_ = 0;
+        node* node_ = nullptr;
+
+        // 指向 n 的迭代器：按 bucket_for 的规则记下 n 所在的表与桶，使 ++ 从该桶之后继续
+        basic_iterator(const incremental_hash_table* table, node* n) noexcept : table_(table), node_(n) {
+            if (n == nullptr) {
+                return;
+            }
+            if (table->resizing()) {
+                const size_type old_index = n->hash & (table->old_bucket_count_ - 1);
+                if (old_index >= table->migrate_pos_) {
+                    in_old_ = true;
+                    index_ = old_index;
+                    return;
+                }
+            }
+            index_ = n->hash & (table->bucket_count_ - 1);
+        }
+
+        // 先遍历旧表中尚未迁移的桶，再遍历新表
+        explicit basic_iterator(const incremental_hash_table* table) noexcept
+            : table_(table), in_old_(table->resizing()), index_(table->migrate_pos_) {
+            if (!in_old_) {
+                index_ = 0;
+            }
+            settle();
+        }
+
+        void settle() noexcept {
+            if (in_old_) {
+                for (; index_ < table_->old_bucket_count_; ++index_) {
+                    if ((node_ = table_->old_buckets_[index_]) != nullptr) {
+                        return;
+                    }
+                }
+                in_old_ = false;
+                index_ = 0;
+            }
+            for (; index_ < table_->bucket_count_; ++index_) {
+                if ((node_ = table_->buckets_[index_]) != nullptr) {
+                    return;
+                }
+            }
+            node_ = nullptr;
+        }
+    };
+
+public:
+    using iterator = basic_iterator<false>;
+    using const_iterator = basic_iterator<true>;
+
+    // ==================== 构造与析构 ====================
+
+    incremental_hash_table() = default;
+
+    explicit incremental_hash_table(size_type bucket_count, const Hash& hash = Hash(),
+                                    const KeyEqual& equal = KeyEqual())
+        : hash_(hash), equal_(equal) {
+        if (bucket_count != 0) {
+            bucket_count_ = round_up_pow2(bucket_count);
+            buckets_ = allocate_buckets(bucket_count_);
+        }
+    }
+
+    incremental_hash_table(const incremental_hash_table& other)
+        : max_load_factor_(other.max_load_factor_), migrate_step_(other.migrate_step_),
+          hash_(other.hash_), equal_(other.equal_) {
+        if (other.size_ != 0) {
+            bucket_count_ = other.bucket_count_;
+            buckets_ = allocate_buckets(bucket_count_);
+            try {
+                for (const auto& value : other) {
+                    auto* n = new node(hash_of(key_of(value)), value);
+                    node*& head = buckets_[n->hash & (bucket_count_ - 1)];
+                    n->next = head;
+                    head = n;
+                    ++size_;
+                }
+            } catch (...) {
+                destroy_all();
+                throw;
+            }
+        }
+    }
+
+    incremental_hash_table(incremental_hash_table&& other) noexcept
+        : max_load_factor_(other.max_load_factor_), migrate_step_(other.migrate_step_),
+          hash_(other.hash_), equal_(other.equal_) {
+        steal(other);
+    }
+
+    incremental_hash_table& operator=(const incremental_hash_table& other) {
+        if (this != &other) {
+            incremental_hash_table(other).swap(*this);
+        }
+        return *this;
+    }
+
+    incremental_hash_table& operator=(incremental_hash_table&& other) noexcept {
+        if (this != &other) {
+            incremental_hash_table(std::move(other)).swap(*this);
+        }
+        return *this;
+    }
+
+    ~incremental_hash_table() {
+        destroy_all();
+    }
+
+    void swap(incremental_hash_table& other) noexcept {
+        using std::swap;
+        swap(buckets_, other.buckets_);
+        swap(bucket_count_, other.bucket_count_);
+        swap(old_buckets_, other.old_buckets_);
+        swap(old_bucket_count_, other.old_bucket_count_);
+        swap(migrate_pos_, other.migrate_pos_);
+        swap(size_, other.size_);
+        swap(max_load_factor_, other.max_load_factor_);
+        swap(migrate_step_, other.migrate_step_);
+        swap(stats_, other.stats_);
+        swap(hash_, other.hash_);
+        swap(equal_, other.equal_);
+    }
+
+    // ==================== 迭代器 ====================
+
+    iterator begin() noexcept { return iterator(this); }
+    const_iterator begin() const noexcept { return const_iterator(this); }
+    const_iterator cbegin() const noexcept { return const_iterator(this); }
+    iterator end() noexcept { return iterator(this, nullptr); }
+    const_iterator end() const noexcept { return const_iterator(this, nullptr); }
+    const_iterator cend() const noexcept { return const_iterator(this, nullptr); }
+
+    // ==================== 容量 ====================
+
+    size_type size() const noexcept { return size_; }
+    bool empty() const noexcept { return size_ == 0; }
+    size_type bucket_count() const noexcept { return bucket_count_; }
+
+    float load_factor() const noexcept {
+        return bucket_count_ == 0 ? 0.0f : static_cast<float>(size_) / static_cast<float>(bucket_count_);
+    }
+
+    float max_load_factor() const noexcept { return max_load_factor_; }
+
+    void max_load_factor(float ml) {
+        if (!(ml > 0.0f)) {
+            throw std::invalid_argument("incremental_hash_table::max_load_factor must be positive");
+        }
+        max_load_factor_ = ml;
+    }
+
+    /**
+     * @brief 每次修改操作迁移的旧桶个数（至少为 1）
+     */
+    size_type migrate_step() const noexcept { return migrate_step_; }
+
+    void migrate_step(size_type step) noexcept { migrate_step_ = std::max<size_type>(step, 1); }
+
+    /**
+     * @brief 一次性重建到足以容纳 n 个元素的桶数（同步完成，适合在启动/低峰时调用）
+     */
+    void reserve(size_type n) {
+        const size_type count = buckets_for(n);
+        if (count > bucket_count_ || resizing()) {
+            rebuild(std::max(count, bucket_count_));
+        }
+    }
+
+    void rehash(size_type count) {
+        count = std::max(round_up_pow2(count), buckets_for(size_));
+        if (count != bucket_count_ || resizing()) {
+            rebuild(count);
+        }
+    }
+
+    // ==================== 渐进式扩容控制 ====================
+
+    bool resize_in_progress() const noexcept { return resizing(); }
+
+    /**
+     * @brief 主动迁移最多 max_buckets 个旧桶（如在空闲时由维护线程分批调用）
+     * @return 迁移后是否仍在扩容
+     */
+    bool rehash_step(size_type max_buckets) noexcept { return migrate(max_buckets); }
+
+    /**
+     * @brief 立即迁完剩余的旧桶
+     */
+    void finish_resize() noexcept { migrate(old_bucket_count_); }
+
+    incremental_resize_stats resize_stats() const noexcept {
+        incremental_resize_stats s = stats_;
+        s.in_progress = resizing();
+        s.old_bucket_count = old_bucket_count_;
+        s.bucket_count = bucket_count_;
+        s.migrated_buckets = resizing() ? migrate_pos_ : 0;
+        return s;
+    }
+
+    // ==================== 查找 ====================
+
+    iterator find(const Key& key) {
+        return iterator(this, find_node(key, hash_of(key)));
+    }
+
+    const_iterator find(const Key& key) const {
+        return const_iterator(this, find_node(key, hash_of(key)));
+    }
+
+    bool contains(const Key& key) const {
+        return find_node(key, hash_of(key)) != nullptr;
+    }
+
+    size_type count(const Key& key) const {
+        return contains(key) ? 1 : 0;
+    }
+
+    template <bool S = is_set, std::enable_if_t<!S, int> = 0>
+    auto& at(const Key& key) {
+        if (node* n = find_node(key, hash_of(key))) {
+            return n->value.second;
+        }
+        throw std::out_of_range("incremental_hash_table::at");
+    }
+
+    template <bool S = is_set, std::enable_if_t<!S, int> = 0>
+    const auto& at(const Key& key) const {
+        if (node* n = find_node(key, hash_of(key))) {
+            return n->value.second;
+        }
+        throw std::out_of_range("incremental_hash_table::at");
+    }
+
+    // ==================== 修改 ====================
+
+    std::pair<iterator, bool> insert(const value_type& value) {
+        auto result = emplace_key(key_of(value), value);
+        return {iterator(this, result.first), result.second};
+    }
+
+    std::pair<iterator, bool> insert(value_type&& value) {
+        const Key& key = key_of(value);
+        auto result = emplace_key(key, std::move(value));
+        return {iterator(this, result.first), result.second};
+    }
+
+    template <typename InputIt>
+    void insert(InputIt first, InputIt last) {
+        for (; first != last; ++first) {
+            insert(*first);
+        }
+    }
+
+    template <typename... Args, bool S = is_set, std::enable_if_t<!S, int> = 0>
+    std::pair<iterator, bool> try_emplace(const Key& key, Args&&... args) {
+        auto result = emplace_key(key, std::piecewise_construct, std::forward_as_tuple(key),
+                                  std::forward_as_tuple(std::forward<Args>(args)...));
+        return {iterator(this, result.first), result.second};
+    }
+
+    template <typename... Args, bool S = is_set, std::enable_if_t<!S, int> = 0>
+    std::pair<iterator, bool> emplace(const Key& key, Args&&... args) {
+        return try_emplace(key, std::forward<Args>(args)...);
+    }
+
+    template <typename M, bool S = is_set, std::enable_if_t<!S, int> = 0>
+    std::pair<iterator, bool> insert_or_assign(const Key& key, M&& value) {
+        auto result = try_emplace(key, std::forward<M>(value));
+        if (!result.second) {
+            result.first->second = std::forward<M>(value);
+        }
+        return result;
+    }
+
+    template <bool S = is_set, std::enable_if_t<!S, int> = 0>
+    auto& operator[](const Key& key) {
+        return try_emplace(key).first->second;
+    }
+
+    size_type erase(const Key& key) {
+        migrate(migrate_step_);
+        if (bucket_count_ == 0) {
+            return 0;
+        }
+        const std::size_t h = hash_of(key);
+        for (node** link = bucket_for(h); *link != nullptr; link = &(*link)->next) {
+            node* n = *link;
+            if (n->hash == h && equal_(key_of(n->value), key)) {
+                *link = n->next;
+                delete n;
+                --size_;
+                return 1;
+            }
+        }
+        return 0;
+    }
+
+    /**
+     * @brief 清空所有元素（保留当前桶数，放弃进行中的扩容）
+     */
+    void clear() noexcept {
+        destroy_all();
+        old_buckets_.reset();
+        old_bucket_count_ = 0;
+        migrate_pos_ = 0;
+        std::fill_n(buckets_.get(), bucket_count_, nullptr);
+        size_ = 0;
+    }
+
+    Hash hash_function() const { return hash_; }
+    KeyEqual key_eq() const { return equal_; }
+
+private:
+    void steal(incremental_hash_table& other) noexcept {
+        buckets_ = std::move(other.buckets_);
+        bucket_count_ = std::exchange(other.bucket_count_, 0);
+        old_buckets_ = std::move(other.old_buckets_);
+        old_bucket_count_ = std::exchange(other.old_bucket_count_, 0);
+        migrate_pos_ = std::exchange(other.migrate_pos_, 0);
+        size_ = std::exchange(other.size_, 0);
+        stats_ = std::exchange(other.stats_, incremental_resize_stats{});
+    }
+};
+
+// ==================== 线程安全容器 ====================
+
+/**
+ * @brief 渐进式扩容的线程安全 Unordered Map
+ * @tparam Key 键类型
+ * @tparam T 值类型
+ * @tparam Hash 哈希函数（默认使用std::hash）
+ * @tparam KeyEqual 键相等比较器（默认使用std::equal_to）
+ * @tparam Policy 锁策略（默认使用互斥锁）
+ *
+ * 接口与 unordered_map 的常用部分一致。跨过 max_load_factor 时不在写锁内一次性重哈希全部元素，
+ * 而是由后续每次插入/删除各迁移 migrate_step 个旧桶，写锁的最长持有时间因此与表大小无关。
+ * 查找只读，不参与迁移；只读负载下可用 rehash_step() 由维护线程分批推进。
+ */
+template <typename Key, typename T, typename Hash = std::hash<Key>, typename KeyEqual = std::equal_to<Key>,
+          LockPolicy Policy = LockPolicy::Mutex>
+class incremental_unordered_map
+    : public container_mixin<incremental_unordered_map<Key, T, Hash, KeyEqual, Policy>, std::pair<const Key, T>, Policy> {
+private:
+    friend class container_mixin<incremental_unordered_map<Key, T, Hash, KeyEqual, Policy>, std::pair<const Key, T>, Policy>;
+
+    incremental_hash_table<Key, T, Hash, KeyEqual> data_;
+
+    using Base = container_mixin<incremental_unordered_map<Key, T, Hash, KeyEqual, Policy>, std::pair<const Key, T>, Policy>;
+    using Base::acquire_write_lock;
+    using Base::acquire_read_lock;
+
+public:
+    // 为基类提供必要的类型信息
+    using Container = incremental_hash_table<Key, T, Hash, KeyEqual>;
+
+    using key_type = Key;
+    using mapped_type = T;
+    using value_type = std::pair<const Key, T>;
+    using size_type = typename Container::size_type;
+    using iterator = typename Container::iterator;
+    using const_iterator = typename Container::const_iterator;
+
+    // ==================== 构造函数 ====================
+
+    incremental_unordered_map() : Base() {}
+
+    explicit incremental_unordered_map(size_type bucket_count, const Hash& hash = Hash(),
+                                       const KeyEqual& equal = KeyEqual())
+        : Base(), data_(bucket_count, hash, equal) {}
+
+    template <typename InputIt>
+    incremental_unordered_map(InputIt first, InputIt last) : Base() {
+        data_.insert(first, last);
+    }
+
+    incremental_unordered_map(const incremental_unordered_map& other) : Base() {
+        auto guard = other.acquire_read_lock();
+        data_ = other.data_;
+    }
+
+    incremental_unordered_map& operator=(const incremental_unordered_map& other) {
+        if (this != &other) {
+            Container copy = other.copy();
+            auto guard = acquire_write_lock();
+            data_.swap(copy);
+        }
+        return *this;
+    }
+
+    // ==================== 元素访问 ====================
+
+    T at(const Key& key) const {
+        auto guard = acquire_read_lock();
+        return data_.at(key);
+    }
+
+    /**
+     * @brief 获取指定键的值，如果不存在返回默认值
+     */
+    T get(const Key& key, const T& default_value = T()) const {
+        auto guard = acquire_read_lock();
+        auto it = data_.find(key);
+        return it != data_.end() ? it->second : default_value;
+    }
+
+    /**
+     * @brief 设置指定键的值（不存在时插入）
+     */
+    void set(const Key& key, const T& value) {
+        auto guard = acquire_write_lock();
+        data_.insert_or_assign(key, value);
+    }
+
+    // ==================== 容量管理 ====================
+
+    size_type size() const {
+        auto guard = acquire_read_lock();
+        return data_.size();
+    }
+
+    bool empty() const {
+        auto guard = acquire_read_lock();
+        return data_.empty();
+    }
+
+    void clear() {
+        auto guard = acquire_write_lock();
+        data_.clear();
+    }
+
+    size_type bucket_count() const {
+        auto guard = acquire_read_lock();
+        return data_.bucket_count();
+    }
+
+    float load_factor() const {
+        auto guard = acquire_read_lock();
+        return data_.load_factor();
+    }
+
+    float max_load_factor() const {
+        auto guard = acquire_read_lock();
+        return data_.max_load_factor();
+    }
+
+    void max_load_factor(float ml) {
+        auto guard = acquire_write_lock();
+        data_.max_load_factor(ml);
+    }
+
+    /**
+     * @brief 一次性扩容到足以容纳 n 个元素（同步完成，适合启动阶段预分配）
+     */
+    void reserve(size_type n) {
+        auto guard = acquire_write_lock();
+        data_.reserve(n);
+    }
+
+    // ==================== 渐进式扩容 ====================
+
+    /**
+     * @brief 是否有扩容正在进行
+     */
+    bool resize_in_progress() const {
+        auto guard = acquire_read_lock();
+        return data_.resize_in_progress();
+    }
+
+    /**
+     * @brief 扩容进度与累计指标
+     */
+    incremental_resize_stats resize_stats() const {
+        auto guard = acquire_read_lock();
+        return data_.resize_stats();
+    }
+
+    /**
+     * @brief 设置每次修改操作迁移的旧桶个数：越大扩容越快结束，单次操作的最坏延迟越高
+     */
+    void set_migrate_step(size_type step) {
+        auto guard = acquire_write_lock();
+        data_.migrate_step(step);
+    }
+
+    /**
+     * @brief 在一次写锁内迁移最多 max_buckets 个旧桶
+     * @return 是否仍在扩容
+     */
+    bool rehash_step(size_type max_buckets) {
+        auto guard = acquire_write_lock();
+        return data_.rehash_step(max_buckets);
+    }
+
+    // ==================== 查找操作 ====================
+
+    bool contains(const Key& key) const {
+        auto guard = acquire_read_lock();
+        return data_.contains(key);
+    }
+
+    size_type count(const Key& key) const {
+        auto guard = acquire_read_lock();
+        return data_.count(key);
+    }
+
+    // ==================== 修改操作 ====================
+
+    /**
+     * @brief 插入键值对，键已存在时不修改
+     * @return 是否插入
+     */
+    bool insert(const Key& key, const T& value) {
+        auto guard = acquire_write_lock();
+        return data_.try_emplace(key, value).second;
+    }
+
+    bool insert(const Key& key, T&& value) {
+        auto guard = acquire_write_lock();
+        return data_.try_emplace(key, std::move(value)).second;
+    }
+
+    template <typename... Args>
+    bool emplace(const Key& key, Args&&... args) {
+        auto guard = acquire_write_lock();
+        return data_.try_emplace(key, std::forward<Args>(args)...).second;
+    }
+
+    size_type erase(const Key& key) {
+        auto guard = acquire_write_lock();
+        return data_.erase(key);
+    }
+
+    // ==================== 原地访问与原子读-改-写 ====================
+
+    /**
+     * @brief 在读锁内对键对应的值执行 func(const T&)，不复制值
+     * @return 键存在时返回 true
+     */
+    template <typename Func>
+    bool visit(const Key& key, Func func) const {
+        auto guard = acquire_read_lock();
+        auto it = data_.find(key);
+        if (it == data_.end()) {
+            return false;
+        }
+        func(static_cast<const T&>(it->second));
+        return true;
+    }
+
+    /**
+     * @brief 在写锁内对键对应的值执行 func(T&)
+     * @return 键存在时返回 true
+     */
+    template <typename Func>
+    bool visit_mut(const Key& key, Func func) {
+        auto guard = acquire_write_lock();
+        auto it = data_.find(key);
+        if (it == data_.end()) {
+            return false;
+        }
+        func(it->second);
+        return true;
+    }
+
+    /**
+     * @brief 键不存在时在写锁内用 factory() 构造值并插入
+     * @return 是否插入
+     */
+    template <typename Factory>
+    bool compute_if_absent(const Key& key, Factory factory) {
+        auto guard = acquire_write_lock();
+        if (data_.contains(key)) {
+            return false;
+        }
+        data_.try_emplace(key, factory());
+        return true;
+    }
+
+    // ==================== 批量操作（单次加锁） ====================
+
+    template <typename InputIt>
+    size_type insert_bulk(InputIt first, InputIt last) {
+        auto guard = acquire_write_lock();
+        size_type inserted = 0;
+        for (; first != last; ++first) {
+            inserted += data_.try_emplace(first->first, first->second).second ? 1 : 0;
+        }
+        return inserted;
+    }
+
+    template <typename Range>
+    size_type insert_bulk(const Range& range) {
+        return insert_bulk(std::begin(range), std::end(range));
+    }
+
+    // ==================== 迭代和查询 ====================
+
+    template <typename Func>
+    void for_each(Func func) const {
+        auto guard = acquire_read_lock();
+        for (const auto& kv : data_) {
+            func(kv.first, kv.second);
+        }
+    }
+
+    template <typename Predicate>
+    size_type count_if(Predicate pred) const {
+        auto guard = acquire_read_lock();
+        return static_cast<size_type>(std::count_if(data_.begin(), data_.end(),
+                                                    [&pred](const auto& kv) { return pred(kv.first, kv.second); }));
+    }
+
+    // ==================== 线程不安全接口 ====================
+
+    Container& unsafe_ref() {
+        return data_;
+    }
+
+    const Container& unsafe_ref() const {
+        return data_;
+    }
+
+    // ==================== 手动锁控制接口 ====================
+
+    template <typename Func>
+    void with_write_lock(Func func) const {
+        auto guard = acquire_write_lock();
+        func(*const_cast<incremental_unordered_map*>(this));
+    }
+};
+
+// ==================== Incremental Unordered Map 的 LockFree 特化版本（零开销） ====================
+
+/**
+ * @brief Incremental Unordered Map 的 LockFree 特化版本 - 无锁开销，迁移规则不变
+ */
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+class incremental_unordered_map<Key, T, Hash, KeyEqual, LockPolicy::LockFree> {
+private:
+    incremental_hash_table<Key, T, Hash, KeyEqual> data_;
+
+public:
+    // 类型定义
+    using key_type = Key;
+    using mapped_type = T;
+    using value_type = std::pair<const Key, T>;
+    using size_type = typename incremental_hash_table<Key, T, Hash, KeyEqual>::size_type;
+    using iterator = typename incremental_hash_table<Key, T, Hash, KeyEqual>::iterator;
+    using const_iterator = typename incremental_hash_table<Key, T, Hash, KeyEqual>::const_iterator;
+
+    // ==================== 构造函数 ====================
+
+    incremental_unordered_map() = default;
+
+    explicit incremental_unordered_map(size_type bucket_count, const Hash& hash = Hash(),
+                                       const KeyEqual& equal = KeyEqual())
+        : data_(bucket_count, hash, equal) {}
+
+    template <typename InputIt>
+    incremental_unordered_map(InputIt first, InputIt last) {
+        data_.insert(first, last);
+    }
+
+    // ==================== 元素访问（零开销） ====================
+
+    T& operator[](const Key& key) {
+        return data_[key];
+    }
+
+    T& at(const Key& key) {
+        return data_.at(key);
+    }
+
+    const T& at(const Key& key) const {
+        return data_.at(key);
+    }
+
+    T get(const Key& key, const T& default_value = T()) const {
+        auto it = data_.find(key);
+        return it != data_.end() ? it->second : default_value;
+    }
+
+    void set(const Key& key, const T& value) {
+        data_.insert_or_assign(key, value);
+    }
+
+    // ==================== 容量管理（零开销） ====================
+
+    size_type size() const noexcept {
+        return data_.size();
+    }
+
+    bool empty() const noexcept {
+        return data_.empty();
+    }
+
+    void clear() noexcept {
+        data_.clear();
+    }
+
+    size_type bucket_count() const noexcept {
+        return data_.bucket_count();
+    }
+
+    float load_factor() const noexcept {
+        return data_.load_factor();
+    }
+
+    float max_load_factor() const noexcept {
+        return data_.max_load_factor();
+    }
+
+    void max_load_factor(float ml) {
+        data_.max_load_factor(ml);
+    }
+
+    void reserve(size_type n) {
+        data_.reserve(n);
+    }
+
+    // ==================== 渐进式扩容（零开销） ====================
+
+    bool resize_in_progress() const noexcept {
+        return data_.resize_in_progress();
+    }
+
+    incremental_resize_stats resize_stats() const noexcept {
+        return data_.resize_stats();
+    }
+
+    void set_migrate_step(size_type step) noexcept {
+        data_.migrate_step(step);
+    }
+
+    bool rehash_step(size_type max_buckets) noexcept {
+        return data_.rehash_step(max_buckets);
+    }
+
+    // ==================== 查找与修改（零开销） ====================
+
+    bool contains(const Key& key) const {
+        return data_.contains(key);
+    }
+
+    size_type count(const Key& key) const {
+        return data_.count(key);
+    }
+
+    iterator find(const Key& key) {
+        return data_.find(key);
+    }
+
+    const_iterator find(const Key& key) const {
+        return data_.find(key);
+    }
+
+    bool insert(const Key& key, const T& value) {
+        return data_.try_emplace(key, value).second;
+    }
+
+    bool insert(const Key& key, T&& value) {
+        return data_.try_emplace(key, std::move(value)).second;
+    }
+
+    template <typename... Args>
+    bool emplace(const Key& key, Args&&... args) {
+        return data_.try_emplace(key, std::forward<Args>(args)...).second;
+    }
+
+    size_type erase(const Key& key) {
+        return data_.erase(key);
+    }
+
+    // ==================== 迭代器（零开销） ====================
+
+    iterator begin() noexcept { return data_.begin(); }
+    const_iterator begin() const noexcept { return data_.begin(); }
+    iterator end() noexcept { return data_.end(); }
+    const_iterator end() const noexcept { return data_.end(); }
+
+    template <typename Func>
+    void for_each(Func func) const {
+        for (const auto& kv : data_) {
+            func(kv.first, kv.second);
+        }
+    }
+
+    template <typename Predicate>
+    size_type count_if(Predicate pred) const {
+        return static_cast<size_type>(std::count_if(data_.begin(), data_.end(),
+                                                    [&pred](const auto& kv) { return pred(kv.first, kv.second); }));
+    }
+
+    // ==================== 批量操作（零开销） ====================
+
+    template <typename InputIt>
+    size_type insert_bulk(InputIt first, InputIt last) {
+        size_type inserted = 0;
+        for (; first != last; ++first) {
+            inserted += data_.try_emplace(first->first, first->second).second ? 1 : 0;
+        }
+        return inserted;
+    }
+
+    template <typename Range>
+    size_type insert_bulk(const Range& range) {
+        return insert_bulk(std::begin(range), std::end(range));
+    }
+
+    // ==================== 直接访问底层容器 ====================
+
+    incremental_hash_table<Key, T, Hash, KeyEqual>& get_unsafe() noexcept {
+        return data_;
+    }
+
+    const incremental_hash_table<Key, T, Hash, KeyEqual>& get_unsafe() const noexcept {
+        return data_;
+    }
+};
+
+/**
+ * @brief 渐进式扩容的线程安全 Unordered Set（扩容规则同 incremental_unordered_map）
+ */
+template <typename Key, typename Hash = std::hash<Key>, typename KeyEqual = std::equal_to<Key>,
+          LockPolicy Policy = LockPolicy::Mutex>
+class incremental_unordered_set
+    : public container_mixin<incremental_unordered_set<Key, Hash, KeyEqual, Policy>, Key, Policy> {
+private:
+    friend class container_mixin<incremental_unordered_set<Key, Hash, KeyEqual, Policy>, Key, Policy>;
+
+    incremental_hash_table<Key, void, Hash, KeyEqual> data_;
+
+    using Base = container_mixin<incremental_unordered_set<Key, Hash, KeyEqual, Policy>, Key, Policy>;
+    using Base::acquire_write_lock;
+    using Base::acquire_read_lock;
+
+public:
+    // 为基类提供必要的类型信息
+    using Container = incremental_hash_table<Key, void, Hash, KeyEqual>;
+
+    using key_type = Key;
+    using value_type = Key;
+    using size_type = typename Container::size_type;
+    using iterator = typename Container::iterator;
+    using const_iterator = typename Container::const_iterator;
+
+    // ==================== 构造函数 ====================
+
+    incremental_unordered_set() : Base() {}
+
+    explicit incremental_unordered_set(size_type bucket_count, const Hash& hash = Hash(),
+                                       const KeyEqual& equal = KeyEqual())
+        : Base(), data_(bucket_count, hash, equal) {}
+
+    template <typename InputIt>
+    incremental_unordered_set(InputIt first, InputIt last) : Base() {
+        data_.insert(first, last);
+    }
+
+    incremental_unordered_set(const incremental_unordered_set& other) : Base() {
+        auto guard = other.acquire_read_lock();
+        data_ = other.data_;
+    }
+
+    incremental_unordered_set& operator=(const incremental_unordered_set& other) {
+        if (this != &other) {
+            Container copy = other.copy();
+            auto guard = acquire_write_lock();
+            data_.swap(copy);
+        }
+        return *this;
+    }
+
+    // ==================== 容量管理 ====================
+
+    size_type size() const {
+        auto guard = acquire_read_lock();
+        return data_.size();
+    }
+
+    bool empty() const {
+        auto guard = acquire_read_lock();
+        return data_.empty();
+    }
+
+    void clear() {
+        auto guard = acquire_write_lock();
+        data_.clear();
+    }
+
+    size_type bucket_count() const {
+        auto guard = acquire_read_lock();
+        return data_.bucket_count();
+    }
+
+    float load_factor() const {
+        auto guard = acquire_read_lock();
+        return data_.load_factor();
+    }
+
+    float max_load_factor() const {
+        auto guard = acquire_read_lock();
+        return data_.max_load_factor();
+    }
+
+    void max_load_factor(float ml) {
+        auto guard = acquire_write_lock();
+        data_.max_load_factor(ml);
+    }
+
+    void reserve(size_type n) {
+        auto guard = acquire_write_lock();
+        data_.reserve(n);
+    }
+
+    // ==================== 渐进式扩容 ====================
+
+    bool resize_in_progress() const {
+        auto guard = acquire_read_lock();
+        return data_.resize_in_progress();
+    }
+
+    incremental_resize_stats resize_stats() const {
+        auto guard = acquire_read_lock();
+        return data_.resize_stats();
+    }
+
+    void set_migrate_step(size_type step) {
+        auto guard = acquire_write_lock();
+        data_.migrate_step(step);
+    }
+
+    bool rehash_step(size_type max_buckets) {
+        auto guard = acquire_write_lock();
+        return data_.rehash_step(max_buckets);
+    }
+
+    // ==================== 查找与修改 ====================
+
+    bool contains(const Key& key) const {
+        auto guard = acquire_read_lock();
+        return data_.contains(key);
+    }
+
+    size_type count(const Key& key) const {
+        auto guard = acquire_read_lock();
+        return data_.count(key);
+    }
+
+    /**
+     * @brief 插入元素
+     * @return 是否插入（元素已存在时返回 false）
+     */
+    bool insert(const Key& key) {
+        auto guard = acquire_write_lock();
+        return data_.insert(key).second;
+    }
+
+    bool insert(Key&& key) {
+        auto guard = acquire_write_lock();
+        return data_.insert(std::move(key)).second;
+    }
+
+    size_type erase(const Key& key) {
+        auto guard = acquire_write_lock();
+        return data_.erase(key);
+    }
+
+    template <typename InputIt>
+    size_type insert_bulk(InputIt first, InputIt last) {
+        auto guard = acquire_write_lock();
+        size_type inserted = 0;
+        for (; first != last; ++first) {
+            inserted += data_.insert(*first).second ? 1 : 0;
+        }
+        return inserted;
+    }
+
+    template <typename Range>
+    size_type insert_bulk(const Range& range) {
+        return insert_bulk(std::begin(range), std::end(range));
+    }
+
+    // ==================== 迭代和查询 ====================
+
+    template <typename Func>
+    void for_each(Func func) const {
+        auto guard = acquire_read_lock();
+        for (const auto& item : data_) {
+            func(item);
+        }
+    }
+
+    template <typename Predicate>
+    size_type count_if(Predicate pred) const {
+        auto guard = acquire_read_lock();
+        return static_cast<size_type>(std::count_if(data_.begin(), data_.end(), pred));
+    }
+
+    // ==================== 线程不安全接口 ====================
+
+    Container& unsafe_ref() {
+        return data_;
+    }
+
+    const Container& unsafe_ref() const {
+        return data_;
+    }
+
+    // ==================== 手动锁控制接口 ====================
+
+    template <typename Func>
+    void with_write_lock(Func func) const {
+        auto guard = acquire_write_lock();
+        func(*const_cast<incremental_unordered_set*>(this));
+    }
+};
+
+// ==================== Incremental Unordered Set 的 LockFree 特化版本（零开销） ====================
+
+/**
+ * @brief Incremental Unordered Set 的 LockFree 特化版本 - 无锁开销，迁移规则不变
+ */
+template <typename Key, typename Hash, typename KeyEqual>
+class incremental_unordered_set<Key, Hash, KeyEqual, LockPolicy::LockFree> {
+private:
+    incremental_hash_table<Key, void, Hash, KeyEqual> data_;
+
+public:
+    // 类型定义
+    using key_type = Key;
+    using value_type = Key;
+    using size_type = typename incremental_hash_table<Key, void, Hash, KeyEqual>::size_type;
+    using iterator = typename incremental_hash_table<Key, void, Hash, KeyEqual>::iterator;
+    using const_iterator = typename incremental_hash_table<Key, void, Hash, KeyEqual>::const_iterator;
+
+    // ==================== 构造函数 ====================
+
+    incremental_unordered_set() = default;
+
+    explicit incremental_unordered_set(size_type bucket_count, const Hash& hash = Hash(),
+                                       const KeyEqual& equal = KeyEqual())
+        : data_(bucket_count, hash, equal) {}
+
+    template <typename InputIt>
+    incremental_unordered_set(InputIt first, InputIt last) {
+        data_.insert(first, last);
+    }
+
+    // ==================== 容量管理（零开销） ====================
+
+    size_type size() const noexcept {
+        return data_.size();
+    }
+
+    bool empty() const noexcept {
+        return data_.empty();
+    }
+
+    void clear() noexcept {
+        data_.clear();
+    }
+
+    size_type bucket_count() const noexcept {
+        return data_.bucket_count();
+    }
+
+    float load_factor() const noexcept {
+        return data_.load_factor();
+    }
+
+    float max_load_factor() const noexcept {
+        return data_.max_load_factor();
+    }
+
+    void max_load_factor(float ml) {
+        data_.max_load_factor(ml);
+    }
+
+    void reserve(size_type n) {
+        data_.reserve(n);
+    }
+
+    // ==================== 渐进式扩容（零开销） ====================
+
+    bool resize_in_progress() const noexcept {
+        return data_.resize_in_progress();
+    }
+
+    incremental_resize_stats resize_stats() const noexcept {
+        return data_.resize_stats();
+    }
+
+    void set_migrate_step(size_type step) noexcept {
+        data_.migrate_step(step);
+    }
+
+    bool rehash_step(size_type max_buckets) noexcept {
+        return data_.rehash_step(max_buckets);
+    }
+
+    // ==================== 查找与修改（零开销） ====================
+
+    bool contains(const Key& key) const {
+        return data_.contains(key);
+    }
+
+    size_type count(const Key& key) const {
+        return data_.count(key);
+    }
+
+    iterator find(const Key& key) {
+        return data_.find(key);
+    }
+
+    const_iterator find(const Key& key) const {
+        return data_.find(key);
+    }
+
+    bool insert(const Key& key) {
+        return data_.insert(key).second;
+    }
+
+    bool insert(Key&& key) {
+        return data_.insert(std::move(key)).second;
+    }
+
+    size_type erase(const Key& key) {
+        return data_.erase(key);
+    }
+
+    template <typename InputIt>
+    size_type insert_bulk(InputIt first, InputIt last) {
+        size_type inserted = 0;
+        for (; first != last; ++first) {
+            inserted += data_.insert(*first).second ? 1 : 0;
+        }
+        return inserted;
+    }
+
+    template <typename Range>
+    size_type insert_bulk(const Range& range) {
+        return insert_bulk(std::begin(range), std::end(range));
+    }
+
+    // ==================== 迭代器（零开销） ====================
+
+    iterator begin() noexcept { return data_.begin(); }
+    const_iterator begin() const noexcept { return data_.begin(); }
+    iterator end() noexcept { return data_.end(); }
+    const_iterator end() const noexcept { return data_.end(); }
+
+    template <typename Func>
+    void for_each(Func func) const {
+        for (const auto& item : data_) {
+            func(item);
+        }
+    }
+
+    template <typename Predicate>
+    size_type count_if(Predicate pred) const {
+        return static_cast<size_type>(std::count_if(data_.begin(), data_.end(), pred));
+    }
+
+    // ==================== 直接访问底层容器 ====================
+
+    incremental_hash_table<Key, void, Hash, KeyEqual>& get_unsafe() noexcept {
+        return data_;
+    }
+
+    const incremental_hash_table<Key, void, Hash, KeyEqual>& get_unsafe() const noexcept {
+        return data_;
+    }
+};
+
+} // namespace ts_stl
+
+#endif // TS_INCREMENTAL_UNORDERED_MAP_HPP
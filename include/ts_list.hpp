@@ -14,32 +14,39 @@ namespace ts_stl {
  * @brief 线程安全的List代理类
  * @tparam T 元素类型
  * @tparam Policy 锁策略（默认使用互斥锁）
+ * @tparam Allocator 底层标准容器使用的分配器（默认使用std::allocator）
  */
-template <typename T, LockPolicy Policy = LockPolicy::Mutex>
-class list : public container_mixin<list<T, Policy>, T, Policy> {
+template <typename T, LockPolicy Policy = LockPolicy::Mutex, typename Allocator = std::allocator<T>>
+class list : public container_mixin<list<T, Policy, Allocator>, T, Policy> {
 private:
-    friend class container_mixin<list<T, Policy>, T, Policy>;
+    friend class container_mixin<list<T, Policy, Allocator>, T, Policy>;
 
-    std::list<T> data_;
+    std::list<T, Allocator> data_;
 
-    using Base = container_mixin<list<T, Policy>, T, Policy>;
+    using Base = container_mixin<list<T, Policy, Allocator>, T, Policy>;
     using Base::acquire_write_lock;
     using Base::acquire_read_lock;
 
 public:
     // 为基类提供必要的类型信息
-    using Container = std::list<T>;
+    using Container = std::list<T, Allocator>;
     
     using value_type = T;
+    using allocator_type = Allocator;
     using reference = T&;
     using const_reference = const T&;
-    using iterator = typename std::list<T>::iterator;
-    using const_iterator = typename std::list<T>::const_iterator;
-    using size_type = typename std::list<T>::size_type;
-    using difference_type = typename std::list<T>::difference_type;
+    using iterator = typename std::list<T, Allocator>::iterator;
+    using const_iterator = typename std::list<T, Allocator>::const_iterator;
+    using size_type = typename std::list<T, Allocator>::size_type;
+    using difference_type = typename std::list<T, Allocator>::difference_type;
 
     list() : Base() {}
 
+    /**
+     * @brief 使用指定分配器构造（如 std::pmr::polymorphic_allocator）
+     */
+    explicit list(const Allocator& alloc) : Base(), data_(alloc) {}
+
     explicit list(size_type count) 
         : Base() {
         data_.resize(count);
@@ -250,21 +257,44 @@ public:
         data_.sort(comp);
     }
 
+    // ==================== 批量操作（单次加锁） ====================
+
+    /**
+     * @brief 批量追加区间内的元素到末尾（只加锁一次）
+     */
+    template <typename InputIt>
+    void push_back_range(InputIt first, InputIt last) {
+        auto guard = acquire_write_lock();
+        data_.insert(data_.end(), first, last);
+    }
+
+    template <typename Range>
+    void push_back_range(const Range& range) {
+        push_back_range(std::begin(range), std::end(range));
+    }
+
     // ==================== STL兼容性 ====================
 
-    operator const std::list<T>&() const {
+    operator const std::list<T, Allocator>&() const {
         return data_;
     }
 
-    std::list<T> copy() const {
+    std::list<T, Allocator> copy() const {
         auto guard = acquire_read_lock();
         return data_;
     }
 
-    const std::list<T>& ref() const {
+    const std::list<T, Allocator>& ref() const {
         return data_;
     }
 
+    /**
+     * @brief 获取底层容器的分配器
+     */
+    allocator_type get_allocator() const noexcept {
+        return data_.get_allocator();
+    }
+
     // ==================== 迭代和查询 ====================
 
     template <typename Func>
@@ -291,11 +321,11 @@ public:
 
     // ==================== 线程不安全接口 ====================
 
-    std::list<T>& unsafe_ref() {
+    std::list<T, Allocator>& unsafe_ref() {
         return data_;
     }
 
-    const std::list<T>& unsafe_ref() const {
+    const std::list<T, Allocator>& unsafe_ref() const {
         return data_;
     }
 
@@ -387,25 +417,28 @@ public:
 /**
  * @brief List 的 LockFree 特化版本 - 为极限性能优化
  */
-template <typename T>
-class list<T, LockPolicy::LockFree> {
+template <typename T, typename Allocator>
+class list<T, LockPolicy::LockFree, Allocator> {
 private:
-    std::list<T> data_;
+    std::list<T, Allocator> data_;
 
 public:
     // 类型定义
     using value_type = T;
+    using allocator_type = Allocator;
     using reference = T&;
     using const_reference = const T&;
-    using iterator = typename std::list<T>::iterator;
-    using const_iterator = typename std::list<T>::const_iterator;
-    using size_type = typename std::list<T>::size_type;
-    using difference_type = typename std::list<T>::difference_type;
+    using iterator = typename std::list<T, Allocator>::iterator;
+    using const_iterator = typename std::list<T, Allocator>::const_iterator;
+    using size_type = typename std::list<T, Allocator>::size_type;
+    using difference_type = typename std::list<T, Allocator>::difference_type;
 
     // ==================== 构造函数 ====================
 
     list() = default;
 
+    explicit list(const Allocator& alloc) : data_(alloc) {}
+
     explicit list(size_type count) : data_(count) {}
 
     list(size_type count, const_reference value)
@@ -497,6 +530,21 @@ public:
         return data_.erase(first, last);
     }
 
+    // ==================== 批量操作（零开销） ====================
+
+    /**
+     * @brief 批量追加区间内的元素到末尾
+     */
+    template <typename InputIt>
+    void push_back_range(InputIt first, InputIt last) {
+        data_.insert(data_.end(), first, last);
+    }
+
+    template <typename Range>
+    void push_back_range(const Range& range) {
+        push_back_range(std::begin(range), std::end(range));
+    }
+
     // ==================== 查询操作（零开销） ====================
 
     iterator find(const_reference value) {
@@ -539,21 +587,25 @@ public:
 
     // ==================== 转换操作 ====================
 
-    operator std::list<T>&() noexcept {
+    operator std::list<T, Allocator>&() noexcept {
         return data_;
     }
 
-    operator const std::list<T>&() const noexcept {
+    operator const std::list<T, Allocator>&() const noexcept {
         return data_;
     }
 
-    std::list<T>& get_unsafe() noexcept {
+    std::list<T, Allocator>& get_unsafe() noexcept {
         return data_;
     }
 
-    const std::list<T>& get_unsafe() const noexcept {
+    const std::list<T, Allocator>& get_unsafe() const noexcept {
         return data_;
     }
+
+    allocator_type get_allocator() const noexcept {
+        return data_.get_allocator();
+    }
 };
 
 } // namespace ts_stl
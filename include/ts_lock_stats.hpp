@@ -0,0 +1,421 @@
+#pragma once
+
+#ifndef TS_LOCK_STATS_HPP
+#define TS_LOCK_STATS_HPP
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iomanip>
+#include <initializer_list>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+// 锁竞争统计：开启后每个加锁容器记录加锁次数、竞争次数、等待/持有时间直方图；
+// 关闭时（默认）不增加任何存储和指令
+#ifndef TS_STL_ENABLE_LOCK_STATS
+    #define TS_STL_ENABLE_LOCK_STATS 0
+#endif
+
+namespace ts_stl {
+
+/**
+ * @brief 某个锁在某一时刻的统计快照
+ *
+ * 直方图第 0 桶为 0ns，第 i 桶（i >= 1）为 [2^(i-1), 2^i) ns，最后一桶包含更长的时间
+ */
+struct lock_stats_snapshot {
+    static constexpr std::size_t buckets = 32;
+
+    std::string name;
+    std::uint64_t acquisitions = 0;         // 独占（写）加锁次数
+    std::uint64_t shared_acquisitions = 0;  // 共享（读）加锁次数，仅读写锁策略
+    std::uint64_t contended = 0;            // 首次尝试失败、需要等待的加锁次数
+    std::uint64_t total_wait_ns = 0;
+    std::uint64_t max_wait_ns = 0;
+    std::uint64_t total_hold_ns = 0;
+    std::uint64_t max_hold_ns = 0;
+    std::array<std::uint64_t, buckets> wait_histogram{};
+    std::array<std::uint64_t, buckets> hold_histogram{};
+
+    std::uint64_t total_acquisitions() const noexcept {
+        return acquisitions + shared_acquisitions;
+    }
+
+    // 需要等待的加锁占比
+    double contention_ratio() const noexcept {
+        std::uint64_t total = total_acquisitions();
+        return total == 0 ? 0.0 : static_cast<double>(contended) / static_cast<double>(total);
+    }
+
+    // 读加锁占比：接近 1 且竞争高时考虑 ReadWrite 或分片容器
+    double read_ratio() const noexcept {
+        std::uint64_t total = total_acquisitions();
+        return total == 0 ? 0.0 : static_cast<double>(shared_acquisitions) / static_cast<double>(total);
+    }
+
+    double mean_wait_ns() const noexcept {
+        std::uint64_t total = total_acquisitions();
+        return total == 0 ? 0.0 : static_cast<double>(total_wait_ns) / static_cast<double>(total);
+    }
+
+    double mean_hold_ns() const noexcept {
+        std::uint64_t total = total_acquisitions();
+        return total == 0 ? 0.0 : static_cast<double>(total_hold_ns) / static_cast<double>(total);
+    }
+
+    // 直方图估计的百分位（返回所在桶的上界，p 取 0~1）
+    std::uint64_t wait_percentile_ns(double p) const noexcept {
+        return percentile(wait_histogram, p);
+    }
+
+    std::uint64_t hold_percentile_ns(double p) const noexcept {
+        return percentile(hold_histogram, p);
+    }
+
+    // 桶 index 的上界（ns）
+    static std::uint64_t bucket_upper_ns(std::size_t index) noexcept {
+        return index == 0 ? 0 : (std::uint64_t{1} << index) - 1;
+    }
+
+private:
+    static std::uint64_t percentile(const std::array<std::uint64_t, buckets>& histogram, double p) noexcept {
+        std::uint64_t total = 0;
+        for (std::uint64_t count : histogram) {
+            total += count;
+        }
+        if (total == 0) {
+            return 0;
+        }
+        double target = p * static_cast<double>(total);
+        std::uint64_t seen = 0;
+        for (std::size_t i = 0; i < buckets; ++i) {
+            seen += histogram[i];
+            if (static_cast<double>(seen) >= target && seen != 0) {
+                return bucket_upper_ns(i);
+            }
+        }
+        return bucket_upper_ns(buckets - 1);
+    }
+};
+
+/**
+ * @brief 单个锁的统计计数器（所有计数均为 relaxed 原子操作，可在任意线程并发更新和读取）
+ */
+class lock_stats {
+public:
+    static constexpr std::size_t buckets = lock_stats_snapshot::buckets;
+
+    lock_stats() = default;
+    ~lock_stats();
+
+    lock_stats(const lock_stats&) = delete;
+    lock_stats& operator=(const lock_stats&) = delete;
+
+    void record_acquire(bool shared, bool was_contended, std::uint64_t wait_ns) noexcept {
+        (shared ? shared_acquisitions_ : acquisitions_).fetch_add(1, std::memory_order_relaxed);
+        if (was_contended) {
+            contended_.fetch_add(1, std::memory_order_relaxed);
+            total_wait_ns_.fetch_add(wait_ns, std::memory_order_relaxed);
+            update_max(max_wait_ns_, wait_ns);
+        }
+        wait_histogram_[bucket_of(wait_ns)].fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void record_hold(std::uint64_t hold_ns) noexcept {
+        total_hold_ns_.fetch_add(hold_ns, std::memory_order_relaxed);
+        update_max(max_hold_ns_, hold_ns);
+        hold_histogram_[bucket_of(hold_ns)].fetch_add(1, std::memory_order_relaxed);
+    }
+
+    lock_stats_snapshot snapshot() const {
+        lock_stats_snapshot out;
+        out.acquisitions = acquisitions_.load(std::memory_order_relaxed);
+        out.shared_acquisitions = shared_acquisitions_.load(std::memory_order_relaxed);
+        out.contended = contended_.load(std::memory_order_relaxed);
+        out.total_wait_ns = total_wait_ns_.load(std::memory_order_relaxed);
+        out.max_wait_ns = max_wait_ns_.load(std::memory_order_relaxed);
+        out.total_hold_ns = total_hold_ns_.load(std::memory_order_relaxed);
+        out.max_hold_ns = max_hold_ns_.load(std::memory_order_relaxed);
+        for (std::size_t i = 0; i < buckets; ++i) {
+            out.wait_histogram[i] = wait_histogram_[i].load(std::memory_order_relaxed);
+            out.hold_histogram[i] = hold_histogram_[i].load(std::memory_order_relaxed);
+        }
+        return out;
+    }
+
+    void reset() noexcept {
+        for (auto* counter : {&acquisitions_, &shared_acquisitions_, &contended_, &total_wait_ns_,
+                              &max_wait_ns_, &total_hold_ns_, &max_hold_ns_}) {
+            counter->store(0, std::memory_order_relaxed);
+        }
+        for (std::size_t i = 0; i < buckets; ++i) {
+            wait_histogram_[i].store(0, std::memory_order_relaxed);
+            hold_histogram_[i].store(0, std::memory_order_relaxed);
+        }
+    }
+
+private:
+    friend class lock_stats_registry;
+
+    static std::size_t bucket_of(std::uint64_t ns) noexcept {
+        std::size_t index = 0;
+        while (ns != 0 && index + 1 < buckets) {
+            ns >>= 1;
+            ++index;
+        }
+        return index;
+    }
+
+    static void update_max(std::atomic<std::uint64_t>& target, std::uint64_t value) noexcept {
+        std::uint64_t current = target.load(std::memory_order_relaxed);
+        while (value > current &&
+               !target.compare_exchange_weak(current, value, std::memory_order_relaxed)) {
+        }
+    }
+
+    std::atomic<std::uint64_t> acquisitions_{0};
+    std::atomic<std::uint64_t> shared_acquisitions_{0};
+    std::atomic<std::uint64_t> contended_{0};
+    std::atomic<std::uint64_t> total_wait_ns_{0};
+    std::atomic<std::uint64_t> max_wait_ns_{0};
+    std::atomic<std::uint64_t> total_hold_ns_{0};
+    std::atomic<std::uint64_t> max_hold_ns_{0};
+    std::array<std::atomic<std::uint64_t>, buckets> wait_histogram_{};
+    std::array<std::atomic<std::uint64_t>, buckets> hold_histogram_{};
+    bool registered_ = false;  // 由 lock_stats_registry 的互斥锁保护
+};
+
+/**
+ * @brief 具名锁统计注册表（进程级单例）
+ *
+ * 容器通过 register_lock_stats(name) 登记自己的锁统计，容器析构时自动注销。
+ * 同名登记多个容器是允许的（例如每线程分箱），快照中各自单独列出。
+ */
+class lock_stats_registry {
+public:
+    static lock_stats_registry& instance() {
+        // 有意不析构：静态存储期的容器可能晚于注册表析构，仍需要注销
+        static lock_stats_registry* registry = new lock_stats_registry();
+        return *registry;
+    }
+
+    void add(std::string name, lock_stats& stats) {
+        std::lock_guard<std::mutex> guard(mutex_);
+        for (auto& entry : entries_) {
+            if (entry.second == &stats) {
+                entry.first = std::move(name);
+                return;
+            }
+        }
+        entries_.emplace_back(std::move(name), &stats);
+        stats.registered_ = true;
+    }
+
+    void remove(lock_stats& stats) {
+        std::lock_guard<std::mutex> guard(mutex_);
+        entries_.erase(std::remove_if(entries_.begin(), entries_.end(),
+                                      [&stats](const auto& entry) { return entry.second == &stats; }),
+                       entries_.end());
+        stats.registered_ = false;
+    }
+
+    /**
+     * @brief 所有已登记锁的快照，按名称排序
+     */
+    std::vector<lock_stats_snapshot> snapshot() const {
+        std::vector<lock_stats_snapshot> out;
+        {
+            std::lock_guard<std::mutex> guard(mutex_);
+            out.reserve(entries_.size());
+            for (const auto& entry : entries_) {
+                out.push_back(entry.second->snapshot());
+                out.back().name = entry.first;
+            }
+        }
+        std::stable_sort(out.begin(), out.end(),
+                         [](const lock_stats_snapshot& a, const lock_stats_snapshot& b) { return a.name < b.name; });
+        return out;
+    }
+
+    /**
+     * @brief 清零所有已登记锁的计数
+     */
+    void reset() {
+        std::lock_guard<std::mutex> guard(mutex_);
+        for (auto& entry : entries_) {
+            entry.second->reset();
+        }
+    }
+
+    /**
+     * @brief 以表格形式输出所有已登记锁的统计（时间单位 ns）
+     */
+    void dump(std::ostream& os) const {
+        auto stats = snapshot();
+        os << std::left << std::setw(24) << "lock" << std::right
+           << std::setw(12) << "acquire" << std::setw(8) << "read%" << std::setw(10) << "contend%"
+           << std::setw(12) << "wait avg" << std::setw(12) << "wait p99" << std::setw(12) << "wait max"
+           << std::setw(12) << "hold avg" << std::setw(12) << "hold p99" << "\n";
+        for (const auto& s : stats) {
+            os << std::left << std::setw(24) << s.name << std::right
+               << std::setw(12) << s.total_acquisitions()
+               << std::fixed << std::setprecision(1)
+               << std::setw(8) << s.read_ratio() * 100.0
+               << std::setw(10) << s.contention_ratio() * 100.0
+               << std::setw(12) << s.mean_wait_ns()
+               << std::setw(12) << s.wait_percentile_ns(0.99)
+               << std::setw(12) << s.max_wait_ns
+               << std::setw(12) << s.mean_hold_ns()
+               << std::setw(12) << s.hold_percentile_ns(0.99) << "\n";
+        }
+    }
+
+private:
+    lock_stats_registry() = default;
+
+    mutable std::mutex mutex_;
+    std::vector<std::pair<std::string, lock_stats*>> entries_;
+};
+
+inline lock_stats::~lock_stats() {
+    // registered_ 只会在注册表锁内改变；未登记的锁不访问注册表
+    if (registered_) {
+        lock_stats_registry::instance().remove(*this);
+    }
+}
+
+namespace detail {
+
+/**
+ * @brief 带统计的锁守卫：先 try_lock，失败时计时等待；解锁时记录持有时间
+ * @tparam Shared 是否以共享方式（lock_shared）加锁
+ *
+ * 提供 lock()/unlock()/owns_lock()，可配合 std::condition_variable_any 使用
+ */
+template <typename Mutex, bool Shared>
+class instrumented_guard {
+    using clock = std::chrono::steady_clock;
+
+public:
+    instrumented_guard(Mutex& mutex, lock_stats& stats) : mutex_(&mutex), stats_(&stats) {
+        lock();
+    }
+
+    ~instrumented_guard() {
+        if (owns_lock_) {
+            unlock();
+        }
+    }
+
+    instrumented_guard(instrumented_guard&& other) noexcept
+        : mutex_(other.mutex_), stats_(other.stats_), acquired_at_(other.acquired_at_),
+          owns_lock_(other.owns_lock_) {
+        other.mutex_ = nullptr;
+        other.stats_ = nullptr;
+        other.owns_lock_ = false;
+    }
+
+    instrumented_guard& operator=(instrumented_guard&& other) noexcept {
+        if (this != &other) {
+            if (owns_lock_) {
+                unlock();
+            }
+            mutex_ = other.mutex_;
+            stats_ = other.stats_;
+            acquired_at_ = other.acquired_at_;
+            owns_lock_ = other.owns_lock_;
+            other.mutex_ = nullptr;
+            other.stats_ = nullptr;
+            other.owns_lock_ = false;
+        }
+        return *this;
+    }
+
+    instrumented_guard(const instrumented_guard&) = delete;
+    instrumented_guard& operator=(const instrumented_guard&) = delete;
+
+    // 与 std::unique_lock 一致：被移走的守卫上加锁、重复加锁或未持有时解锁都抛出 std::system_error
+    void lock() {
+        if (mutex_ == nullptr) {
+            throw std::system_error(std::make_error_code(std::errc::operation_not_permitted),
+                                    "instrumented_guard::lock: no associated mutex");
+        }
+        if (owns_lock_) {
+            throw std::system_error(std::make_error_code(std::errc::resource_deadlock_would_occur),
+                                    "instrumented_guard::lock: already owned");
+        }
+        std::uint64_t wait_ns = 0;
+        bool was_contended = !try_acquire();
+        if (was_contended) {
+            auto start = clock::now();
+            acquire();
+            wait_ns = elapsed_ns(start, clock::now());
+        }
+        acquired_at_ = clock::now();
+        owns_lock_ = true;
+        stats_->record_acquire(Shared, was_contended, wait_ns);
+    }
+
+    void unlock() {
+        if (!owns_lock_) {
+            throw std::system_error(std::make_error_code(std::errc::operation_not_permitted),
+                                    "instrumented_guard::unlock: not owned");
+        }
+        std::uint64_t hold_ns = elapsed_ns(acquired_at_, clock::now());
+        release();
+        owns_lock_ = false;
+        stats_->record_hold(hold_ns);
+    }
+
+    bool owns_lock() const noexcept {
+        return owns_lock_;
+    }
+
+private:
+    static std::uint64_t elapsed_ns(clock::time_point from, clock::time_point to) noexcept {
+        return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(to - from).count());
+    }
+
+    bool try_acquire() {
+        if constexpr (Shared) {
+            return mutex_->try_lock_shared();
+        } else {
+            return mutex_->try_lock();
+        }
+    }
+
+    void acquire() {
+        if constexpr (Shared) {
+            mutex_->lock_shared();
+        } else {
+            mutex_->lock();
+        }
+    }
+
+    void release() {
+        if constexpr (Shared) {
+            mutex_->unlock_shared();
+        } else {
+            mutex_->unlock();
+        }
+    }
+
+    Mutex* mutex_;
+    lock_stats* stats_;
+    clock::time_point acquired_at_{};
+    bool owns_lock_ = false;
+};
+
+} // namespace detail
+
+} // namespace ts_stl
+
+#endif // TS_LOCK_STATS_HPP
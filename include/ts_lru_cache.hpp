@@ -0,0 +1,449 @@
+#pragma once
+
+#ifndef TS_LRU_CACHE_HPP
+#define TS_LRU_CACHE_HPP
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <optional>
+#include <stdexcept>
+#include <unordered_map>
+#include <utility>
+
+#include "ts_stl_base.hpp"
+
+namespace ts_stl {
+
+/**
+ * @brief 缓存命中/未命中/淘汰计数
+ */
+struct cache_stats {
+    std::uint64_t hits = 0;         // 命中次数
+    std::uint64_t misses = 0;       // 未命中次数（包括命中已过期条目）
+    std::uint64_t insertions = 0;   // 新键插入次数
+    std::uint64_t evictions = 0;    // 因容量不足淘汰的条目数
+    std::uint64_t expirations = 0;  // 因过期被移除的条目数
+
+    double hit_ratio() const noexcept {
+        const std::uint64_t total = hits + misses;
+        return total == 0 ? 0.0 : static_cast<double>(hits) / static_cast<double>(total);
+    }
+};
+
+namespace detail {
+
+#if TS_STL_SUPPORT_RW_LOCK
+inline constexpr LockPolicy lru_cache_default_policy = LockPolicy::ReadWrite;
+#else
+inline constexpr LockPolicy lru_cache_default_policy = LockPolicy::Mutex;
+#endif
+
+} // namespace detail
+
+/**
+ * @brief 分片的线程安全 LRU/TTL 缓存（CLOCK 近似 LRU）
+ * @tparam Key 键类型
+ * @tparam V 值类型
+ * @tparam Shards 分片数量（必须是2的幂）
+ * @tparam Hash 哈希函数（默认使用std::hash）
+ * @tparam KeyEqual 键相等比较器（默认使用std::equal_to）
+ * @tparam Policy 每个分片使用的锁策略（默认使用读写锁）
+ *
+ * 按键的哈希值划分到 Shards 个独立加锁的分片，容量平均分配到各分片。
+ * 每个分片用 CLOCK（second chance）近似 LRU，代替"哈希表 + 链表 + 外层锁"的组合：
+ * - 命中只在读锁内把条目的访问位置 1（已置位时不再写），不移动任何链表节点，
+ *   因此读写锁策略下命中可以并行
+ * - 分片满时，写锁内由时钟指针扫描条目：访问位为 1 的清零放过（第二次机会），
+ *   遇到访问位为 0 或已过期的条目即淘汰
+ * - 可选 TTL：构造时给出默认存活时间，put 时可逐条覆盖；过期条目在读锁内视为未命中，
+ *   由之后的写操作、时钟扫描或 purge_expired() 移除
+ *
+ * 注意：
+ * - 淘汰顺序是分片内的近似 LRU，不是全局严格 LRU；容量很小时应减少分片数
+ * - size()/stats() 逐个分片汇总，不是全局原子快照
+ * - get_or_compute 的 factory 在分片写锁内执行，不得再访问同一个缓存
+ */
+template <typename Key, typename V, std::size_t Shards = 8, typename Hash = std::hash<Key>,
+          typename KeyEqual = std::equal_to<Key>, LockPolicy Policy = detail::lru_cache_default_policy>
+class lru_cache {
+    static_assert(Shards > 0 && (Shards & (Shards - 1)) == 0, "Shards must be a power of two");
+    static_assert(Policy != LockPolicy::LockFree, "lru_cache requires a locking policy");
+
+public:
+    using key_type = Key;
+    using mapped_type = V;
+    using size_type = std::size_t;
+    using clock = std::chrono::steady_clock;
+    using duration = clock::duration;
+    using time_point = clock::time_point;
+
+private:
+    struct entry {
+        V value;
+        time_point expires;
+        mutable std::atomic<bool> referenced{false};
+
+        template <typename Arg>
+        entry(Arg&& v, time_point e) : value(std::forward<Arg>(v)), expires(e) {}
+
+        bool expired(time_point now) const noexcept {
+            return expires <= now;
+        }
+    };
+
+    using index_type = std::unordered_map<Key, entry, Hash, KeyEqual>;
+
+    struct alignas(cache_line_size) shard {
+        LockGuard<Policy> lock;
+        index_type index;
+        typename index_type::iterator hand;
+        size_type capacity = 0;
+
+        // 命中/未命中在读锁内累加
+        mutable std::atomic<std::uint64_t> hits{0};
+        mutable std::atomic<std::uint64_t> misses{0};
+        std::uint64_t insertions = 0;
+        std::uint64_t evictions = 0;
+        std::uint64_t expirations = 0;
+    };
+
+    std::array<shard, Shards> shards_;
+    duration default_ttl_;
+    Hash hash_;
+
+    static constexpr time_point never() noexcept {
+        return time_point::max();
+    }
+
+    time_point deadline(duration ttl) const noexcept {
+        return ttl > duration::zero() ? clock::now() + ttl : never();
+    }
+
+    // 只有设置了 TTL 的条目才需要读时钟
+    static bool is_live(const entry& e) noexcept {
+        return e.expires == never() || !e.expired(clock::now());
+    }
+
+    shard& shard_for(const Key& key) {
+        return shards_[shard_index(key)];
+    }
+
+    const shard& shard_for(const Key& key) const {
+        return shards_[shard_index(key)];
+    }
+
+    static void erase_at(shard& s, typename index_type::iterator it) {
+        if (s.hand == it) {
+            s.hand = s.index.erase(it);
+        } else {
+            s.index.erase(it);
+        }
+    }
+
+    // 调用方持有写锁；时钟指针扫描直到淘汰一个条目
+    static void evict_one(shard& s) {
+        const time_point now = clock::now();
+        for (;;) {
+            if (s.hand == s.index.end()) {
+                s.hand = s.index.begin();
+            }
+            entry& e = s.hand->second;
+            if (e.expires != never() && e.expired(now)) {
+                s.hand = s.index.erase(s.hand);
+                ++s.expirations;
+                return;
+            }
+            if (!e.referenced.load(std::memory_order_relaxed)) {
+                s.hand = s.index.erase(s.hand);
+                ++s.evictions;
+                return;
+            }
+            e.referenced.store(false, std::memory_order_relaxed);
+            ++s.hand;
+        }
+    }
+
+    // 调用方持有写锁；返回是否插入了新键
+    template <typename Arg>
+    bool put_locked(shard& s, const Key& key, Arg&& value, time_point expires) {
+        auto it = s.index.find(key);
+        if (it != s.index.end()) {
+            it->second.value = std::forward<Arg>(value);
+            it->second.expires = expires;
+            it->second.referenced.store(true, std::memory_order_relaxed);
+            return false;
+        }
+        if (s.index.size() >= s.capacity) {
+            evict_one(s);
+        }
+        // 已预留 capacity 个桶，插入不会重哈希，时钟指针保持有效
+        s.index.try_emplace(key, std::forward<Arg>(value), expires);
+        ++s.insertions;
+        return true;
+    }
+
+    template <typename Func>
+    bool visit_live(const Key& key, Func& func) const {
+        const shard& s = shard_for(key);
+        auto guard = s.lock.read_lock();
+        auto it = s.index.find(key);
+        if (it == s.index.end() || !is_live(it->second)) {
+            s.misses.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        const entry& e = it->second;
+        if (!e.referenced.load(std::memory_order_relaxed)) {
+            e.referenced.store(true, std::memory_order_relaxed);
+        }
+        s.hits.fetch_add(1, std::memory_order_relaxed);
+        func(static_cast<const V&>(e.value));
+        return true;
+    }
+
+public:
+    // ==================== 构造函数 ====================
+
+    /**
+     * @brief 构造缓存
+     * @param capacity 总容量（平均分配到各分片，每个分片至少 1 个条目）
+     * @param default_ttl 默认存活时间，零表示永不过期
+     */
+    explicit lru_cache(size_type capacity, duration default_ttl = duration::zero())
+        : default_ttl_(default_ttl) {
+        if (capacity == 0) {
+            throw std::invalid_argument("lru_cache capacity must be positive");
+        }
+        const size_type per_shard = (capacity + Shards - 1) / Shards;
+        for (auto& s : shards_) {
+            s.capacity = per_shard;
+            s.index.reserve(per_shard);
+            s.hand = s.index.end();
+        }
+    }
+
+    // 其它线程可能正在访问，缓存不可复制不可移动
+    lru_cache(const lru_cache&) = delete;
+    lru_cache& operator=(const lru_cache&) = delete;
+
+    // ==================== 查找（读锁） ====================
+
+    /**
+     * @brief 查找键，命中时返回值的副本并标记为最近使用
+     */
+    std::optional<V> get(const Key& key) const {
+        std::optional<V> out;
+        auto copy = [&out](const V& value) { out.emplace(value); };
+        visit_live(key, copy);
+        return out;
+    }
+
+    /**
+     * @brief 命中时在读锁内对值执行 func(const V&)，不复制值
+     * @return 是否命中
+     */
+    template <typename Func>
+    bool visit(const Key& key, Func func) const {
+        return visit_live(key, func);
+    }
+
+    /**
+     * @brief 是否存在未过期的条目（不计入命中统计，不影响淘汰顺序）
+     */
+    bool contains(const Key& key) const {
+        const shard& s = shard_for(key);
+        auto guard = s.lock.read_lock();
+        auto it = s.index.find(key);
+        return it != s.index.end() && is_live(it->second);
+    }
+
+    // ==================== 修改（写锁） ====================
+
+    /**
+     * @brief 插入或更新条目，使用默认存活时间
+     * @return 是否插入了新键
+     */
+    bool put(const Key& key, const V& value) {
+        return put(key, value, default_ttl_);
+    }
+
+    bool put(const Key& key, V&& value) {
+        return put(key, std::move(value), default_ttl_);
+    }
+
+    /**
+     * @brief 插入或更新条目并指定存活时间（零表示永不过期）
+     */
+    bool put(const Key& key, const V& value, duration ttl) {
+        shard& s = shard_for(key);
+        const time_point expires = deadline(ttl);
+        auto guard = s.lock.write_lock();
+        return put_locked(s, key, value, expires);
+    }
+
+    bool put(const Key& key, V&& value, duration ttl) {
+        shard& s = shard_for(key);
+        const time_point expires = deadline(ttl);
+        auto guard = s.lock.write_lock();
+        return put_locked(s, key, std::move(value), expires);
+    }
+
+    /**
+     * @brief 命中时返回缓存值；未命中时在写锁内用 factory() 计算、插入并返回
+     *
+     * 同一键的并发未命中只会调用一次 factory（后到者在写锁内重新检查）。
+     */
+    template <typename Factory>
+    V get_or_compute(const Key& key, Factory factory) {
+        if (auto cached = get(key)) {
+            return std::move(*cached);
+        }
+        shard& s = shard_for(key);
+        const time_point expires = deadline(default_ttl_);
+        auto guard = s.lock.write_lock();
+        auto it = s.index.find(key);
+        if (it != s.index.end()) {
+            if (is_live(it->second)) {
+                it->second.referenced.store(true, std::memory_order_relaxed);
+                return it->second.value;
+            }
+            erase_at(s, it);
+            ++s.expirations;
+        }
+        V value = factory();
+        put_locked(s, key, value, expires);
+        return value;
+    }
+
+    size_type erase(const Key& key) {
+        shard& s = shard_for(key);
+        auto guard = s.lock.write_lock();
+        auto it = s.index.find(key);
+        if (it == s.index.end()) {
+            return 0;
+        }
+        erase_at(s, it);
+        return 1;
+    }
+
+    /**
+     * @brief 移除所有已过期的条目
+     * @return 移除的条目数
+     */
+    size_type purge_expired() {
+        size_type removed = 0;
+        for (auto& s : shards_) {
+            auto guard = s.lock.write_lock();
+            const time_point now = clock::now();
+            for (auto it = s.index.begin(); it != s.index.end();) {
+                if (it->second.expires != never() && it->second.expired(now)) {
+                    auto next = std::next(it);
+                    erase_at(s, it);
+                    it = next;
+                    ++removed;
+                    ++s.expirations;
+                } else {
+                    ++it;
+                }
+            }
+        }
+        return removed;
+    }
+
+    void clear() {
+        for (auto& s : shards_) {
+            auto guard = s.lock.write_lock();
+            s.index.clear();
+            s.hand = s.index.end();
+        }
+    }
+
+    // ==================== 容量与统计 ====================
+
+    /**
+     * @brief 条目数（包括已过期但尚未移除的条目）
+     */
+    size_type size() const {
+        size_type total = 0;
+        for (const auto& s : shards_) {
+            auto guard = s.lock.read_lock();
+            total += s.index.size();
+        }
+        return total;
+    }
+
+    bool empty() const {
+        return size() == 0;
+    }
+
+    /**
+     * @brief 实际总容量（每分片容量 * 分片数）
+     */
+    size_type capacity() const noexcept {
+        return shards_[0].capacity * Shards;
+    }
+
+    duration default_ttl() const noexcept {
+        return default_ttl_;
+    }
+
+    static constexpr size_type shard_count() noexcept {
+        return Shards;
+    }
+
+    size_type shard_index(const Key& key) const {
+        return detail::mix_hash(hash_(key)) & (Shards - 1);
+    }
+
+    /**
+     * @brief 汇总各分片的命中/未命中/淘汰计数
+     */
+    cache_stats stats() const {
+        cache_stats total;
+        for (const auto& s : shards_) {
+            auto guard = s.lock.read_lock();
+            total.hits += s.hits.load(std::memory_order_relaxed);
+            total.misses += s.misses.load(std::memory_order_relaxed);
+            total.insertions += s.insertions;
+            total.evictions += s.evictions;
+            total.expirations += s.expirations;
+        }
+        return total;
+    }
+
+    void reset_stats() {
+        for (auto& s : shards_) {
+            auto guard = s.lock.write_lock();
+            s.hits.store(0, std::memory_order_relaxed);
+            s.misses.store(0, std::memory_order_relaxed);
+            s.insertions = 0;
+            s.evictions = 0;
+            s.expirations = 0;
+        }
+    }
+
+    // ==================== 迭代 ====================
+
+    /**
+     * @brief 逐分片在读锁内对每个未过期条目执行 func(key, value)（不影响淘汰顺序）
+     */
+    template <typename Func>
+    void for_each(Func func) const {
+        for (const auto& s : shards_) {
+            auto guard = s.lock.read_lock();
+            for (const auto& kv : s.index) {
+                if (is_live(kv.second)) {
+                    func(kv.first, static_cast<const V&>(kv.second.value));
+                }
+            }
+        }
+    }
+};
+
+} // namespace ts_stl
+
+#endif // TS_LRU_CACHE_HPP
@@ -3,7 +3,9 @@
 #ifndef TS_MAP_HPP
 #define TS_MAP_HPP
 
+#include <limits>
 #include <map>
+#include <optional>
 
 #include "ts_stl_base.hpp"
 
@@ -15,37 +17,48 @@ namespace ts_stl {
  * @tparam T 值类型
  * @tparam Compare 比较器（默认使用std::less）
  * @tparam Policy 锁策略（默认使用互斥锁）
+ * @tparam Allocator 底层标准容器使用的分配器（默认使用std::allocator）
  */
-template <typename Key, typename T, typename Compare = std::less<Key>, LockPolicy Policy = LockPolicy::Mutex>
-class map : public container_mixin<map<Key, T, Compare, Policy>, std::pair<const Key, T>, Policy> {
+template <typename Key, typename T, typename Compare = std::less<Key>, LockPolicy Policy = LockPolicy::Mutex,
+          typename Allocator = std::allocator<std::pair<const Key, T>>>
+class map : public container_mixin<map<Key, T, Compare, Policy, Allocator>, std::pair<const Key, T>, Policy> {
 private:
-    friend class container_mixin<map<Key, T, Compare, Policy>, std::pair<const Key, T>, Policy>;
+    friend class container_mixin<map<Key, T, Compare, Policy, Allocator>, std::pair<const Key, T>, Policy>;
 
-    std::map<Key, T, Compare> data_;
+    std::map<Key, T, Compare, Allocator> data_;
 
-    using Base = container_mixin<map<Key, T, Compare, Policy>, std::pair<const Key, T>, Policy>;
+    using Base = container_mixin<map<Key, T, Compare, Policy, Allocator>, std::pair<const Key, T>, Policy>;
     using Base::acquire_write_lock;
     using Base::acquire_read_lock;
 
 public:
     // 为基类提供必要的类型信息
-    using Container = std::map<Key, T, Compare>;
+    using Container = std::map<Key, T, Compare, Allocator>;
     
     using key_type = Key;
     using mapped_type = T;
     using value_type = std::pair<const Key, T>;
-    using size_type = typename std::map<Key, T, Compare>::size_type;
-    using iterator = typename std::map<Key, T, Compare>::iterator;
-    using const_iterator = typename std::map<Key, T, Compare>::const_iterator;
-    using reverse_iterator = typename std::map<Key, T, Compare>::reverse_iterator;
-    using const_reverse_iterator = typename std::map<Key, T, Compare>::const_reverse_iterator;
+    using allocator_type = Allocator;
+    using size_type = typename std::map<Key, T, Compare, Allocator>::size_type;
+    using iterator = typename std::map<Key, T, Compare, Allocator>::iterator;
+    using const_iterator = typename std::map<Key, T, Compare, Allocator>::const_iterator;
+    using node_type = typename std::map<Key, T, Compare, Allocator>::node_type;
+    using reverse_iterator = typename std::map<Key, T, Compare, Allocator>::reverse_iterator;
+    using const_reverse_iterator = typename std::map<Key, T, Compare, Allocator>::const_reverse_iterator;
 
     // ==================== 构造函数 ====================
 
     map() : Base() {}
 
+    /**
+     * @brief 使用指定分配器构造（如 std::pmr::polymorphic_allocator）
+     */
+    explicit map(const Allocator& alloc) : Base(), data_(alloc) {}
+
+    map(const Compare& comp, const Allocator& alloc) : Base(), data_(comp, alloc) {}
+
     explicit map(const Compare& comp) : Base() {
-        data_ = std::map<Key, T, Compare>(comp);
+        data_ = std::map<Key, T, Compare, Allocator>(comp);
     }
 
     template <typename InputIt>
@@ -185,34 +198,205 @@ public:
         return data_.upper_bound(key) != data_.end();
     }
 
+    // ==================== 异构查找（透明比较器） ====================
+
+    /**
+     * @brief 以任意可与 Key 比较的类型查找（需要 Compare::is_transparent，如 std::less<>）
+     *
+     * 例如 key 为 std::string 时可直接传入 std::string_view，避免构造临时字符串
+     */
+    template <typename K, typename C = Compare, detail::enable_if_transparent_t<C> = 0>
+    bool contains(const K& key) const {
+        auto guard = acquire_read_lock();
+        return data_.find(key) != data_.end();
+    }
+
+    template <typename K, typename C = Compare, detail::enable_if_transparent_t<C> = 0>
+    size_type count(const K& key) const {
+        auto guard = acquire_read_lock();
+        return data_.count(key);
+    }
+
+    template <typename K, typename C = Compare, detail::enable_if_transparent_t<C> = 0>
+    T get(const K& key, const T& default_value = T()) const {
+        auto guard = acquire_read_lock();
+        auto it = data_.find(key);
+        if (it != data_.end()) {
+            return it->second;
+        }
+        return default_value;
+    }
+
+    template <typename K, typename C = Compare, detail::enable_if_transparent_t<C> = 0>
+    T at(const K& key) const {
+        auto guard = acquire_read_lock();
+        auto it = data_.find(key);
+        if (it == data_.end()) {
+            throw std::out_of_range("map::at");
+        }
+        return it->second;
+    }
+
+    template <typename K, typename C = Compare, detail::enable_if_transparent_t<C> = 0>
+    T& at(const K& key) {
+        auto guard = acquire_write_lock();
+        auto it = data_.find(key);
+        if (it == data_.end()) {
+            throw std::out_of_range("map::at");
+        }
+        return it->second;
+    }
+
+    // ==================== 区间查询（读锁内按序扫描） ====================
+
+    /**
+     * @brief 第一个键不小于 key 的元素，不存在时返回 std::nullopt
+     */
+    std::optional<std::pair<Key, T>> lower_bound_entry(const Key& key) const {
+        auto guard = acquire_read_lock();
+        auto it = data_.lower_bound(key);
+        if (it == data_.end()) {
+            return std::nullopt;
+        }
+        return std::pair<Key, T>(it->first, it->second);
+    }
+
+    /**
+     * @brief 第一个键大于 key 的元素，不存在时返回 std::nullopt
+     */
+    std::optional<std::pair<Key, T>> upper_bound_entry(const Key& key) const {
+        auto guard = acquire_read_lock();
+        auto it = data_.upper_bound(key);
+        if (it == data_.end()) {
+            return std::nullopt;
+        }
+        return std::pair<Key, T>(it->first, it->second);
+    }
+
+    /**
+     * @brief 在读锁内按键升序对 [lo, hi) 内的元素执行 func(const Key&, const T&)
+     *
+     * 只访问区间内的元素（O(log n + k)），不复制容器；func 返回 bool 时，返回 false 即停止扫描
+     * @return 访问的元素个数
+     */
+    template <typename Func>
+    size_type range(const Key& lo, const Key& hi, Func func) const {
+        auto guard = acquire_read_lock();
+        auto comp = data_.key_comp();
+        return detail::scan_while(
+            data_.lower_bound(lo), data_.end(), [&](const value_type& item) { return comp(item.first, hi); },
+            [&](const value_type& item) { return detail::invoke_continue(func, item.first, item.second); });
+    }
+
+    /**
+     * @brief 把 [lo, hi) 内至多 limit 个元素按键升序写入 out
+     * @return 写入的元素个数
+     */
+    template <typename OutputIt>
+    size_type collect_range(const Key& lo, const Key& hi, OutputIt out,
+                            size_type limit = std::numeric_limits<size_type>::max()) const {
+        if (limit == 0) {
+            return 0;
+        }
+        size_type written = 0;
+        range(lo, hi, [&](const Key& key, const T& value) {
+            *out = std::pair<Key, T>(key, value);
+            ++out;
+            return ++written < limit;
+        });
+        return written;
+    }
+
+    /**
+     * @brief 在读锁内按序对键以 prefix 开头的元素执行 func(const Key&, const T&)
+     *
+     * 适用于字符串类键且 Compare 为字典序（std::less / std::less<>）的情形，
+     * 从 lower_bound(prefix) 开始扫描，遇到第一个不匹配的键即停止
+     * @return 访问的元素个数
+     */
+    template <typename Func>
+    size_type prefix_scan(const Key& prefix, Func func) const {
+        auto guard = acquire_read_lock();
+        return detail::scan_while(
+            data_.lower_bound(prefix), data_.end(),
+            [&prefix](const value_type& item) { return detail::key_has_prefix(item.first, prefix); },
+            [&](const value_type& item) { return detail::invoke_continue(func, item.first, item.second); });
+    }
+
+    /**
+     * @brief 把键以 prefix 开头的至多 limit 个元素按序写入 out
+     * @return 写入的元素个数
+     */
+    template <typename OutputIt>
+    size_type collect_prefix(const Key& prefix, OutputIt out,
+                             size_type limit = std::numeric_limits<size_type>::max()) const {
+        if (limit == 0) {
+            return 0;
+        }
+        size_type written = 0;
+        prefix_scan(prefix, [&](const Key& key, const T& value) {
+            *out = std::pair<Key, T>(key, value);
+            ++out;
+            return ++written < limit;
+        });
+        return written;
+    }
+
     // ==================== 修改操作 ====================
 
     /**
-     * @brief 插入键值对
+     * @brief 插入键值对（O(log n)）
+     * @return 是否插入了新元素，键已存在时返回 false 且原值保持不变
      */
-    std::pair<bool, size_type> insert(const Key& key, const T& value) {
+    bool insert(const Key& key, const T& value) {
         auto guard = acquire_write_lock();
-        auto result = data_.insert({key, value});
-        return {result.second, std::distance(data_.begin(), result.first)};
+        return data_.insert({key, value}).second;
     }
 
     /**
      * @brief 使用移动语义插入键值对
      */
-    std::pair<bool, size_type> insert(const Key& key, T&& value) {
+    bool insert(const Key& key, T&& value) {
         auto guard = acquire_write_lock();
-        auto result = data_.insert({key, std::move(value)});
-        return {result.second, std::distance(data_.begin(), result.first)};
+        return data_.insert({key, std::move(value)}).second;
     }
 
     /**
-     * @brief 原地构造并插入
+     * @brief 原地构造并插入（键已存在时不构造值）
      */
     template <typename... Args>
-    std::pair<bool, size_type> emplace(const Key& key, Args&&... args) {
+    bool emplace(const Key& key, Args&&... args) {
         auto guard = acquire_write_lock();
-        auto result = data_.emplace(key, T(std::forward<Args>(args)...));
-        return {result.second, std::distance(data_.begin(), result.first)};
+        return data_.try_emplace(key, std::forward<Args>(args)...).second;
+    }
+
+    /**
+     * @brief 插入键值对，并返回该键在有序序列中的下标
+     * @note std::map 不维护子树大小，计算下标需要 O(n) 遍历且全程持有写锁，
+     *       仅在确实需要下标时使用
+     */
+    std::pair<bool, size_type> insert_indexed(const Key& key, const T& value) {
+        auto guard = acquire_write_lock();
+        auto result = data_.insert({key, value});
+        return {result.second, static_cast<size_type>(std::distance(data_.begin(), result.first))};
+    }
+
+    std::pair<bool, size_type> insert_indexed(const Key& key, T&& value) {
+        auto guard = acquire_write_lock();
+        auto result = data_.insert({key, std::move(value)});
+        return {result.second, static_cast<size_type>(std::distance(data_.begin(), result.first))};
+    }
+
+    /**
+     * @brief 键在有序序列中的下标（O(n)），键不存在时返回 std::nullopt
+     */
+    std::optional<size_type> index_of(const Key& key) const {
+        auto guard = acquire_read_lock();
+        auto it = data_.find(key);
+        if (it == data_.end()) {
+            return std::nullopt;
+        }
+        return static_cast<size_type>(std::distance(data_.begin(), it));
     }
 
     /**
@@ -239,19 +423,206 @@ public:
         data_.erase(first, last);
     }
 
+    // ==================== 节点迁移（C++17 extract / merge） ====================
+
+    /**
+     * @brief 在写锁内摘下键对应的节点，键不存在时返回空节点
+     *
+     * 节点句柄持有元素本身，插入另一个分配器相同的容器时不复制、不重新分配
+     */
+    node_type extract(const Key& key) {
+        auto guard = acquire_write_lock();
+        return data_.extract(key);
+    }
+
+    /**
+     * @brief 在写锁内插入 extract() 得到的节点
+     * @return 插入成功返回 true，节点被容器接管；键已存在时返回 false，节点仍归调用方所有
+     * @note 分配器不相等（不同 pmr 内存资源）时退化为按值移动插入
+     */
+    bool insert_node(node_type& node) {
+        auto guard = acquire_write_lock();
+        return detail::insert_node_handle(data_, node);
+    }
+
+    bool insert_node(node_type&& node) {
+        return insert_node(node);
+    }
+
+    /**
+     * @brief 把 source 中本容器没有的键迁移过来（如热数据层迁往冷数据层），source 可以使用任意锁策略
+     * @return 迁移的元素个数；键已存在的元素留在 source 中
+     *
+     * 两个容器按地址顺序同时加写锁，反方向并发迁移不会死锁。
+     * 分配器相等时只重新链接节点，不分配内存；否则逐个移动元素。
+     */
+    template <typename Compare2, LockPolicy SourcePolicy>
+    size_type merge_from(map<Key, T, Compare2, SourcePolicy, Allocator>& source) {
+        if (static_cast<const void*>(&source) == static_cast<const void*>(this)) {
+            return 0;
+        }
+        return detail::with_both_locked(*this, source, [&] {
+            return static_cast<size_type>(detail::merge_nodes(data_, detail::raw_container(source)));
+        });
+    }
+
+    // ==================== 原地访问与原子读-改-写 ====================
+
+    /**
+     * @brief 在读锁内对键对应的值执行 func(const T&)，不复制值
+     * @return 键存在时返回 true
+     */
+    template <typename Func>
+    bool visit(const Key& key, Func func) const {
+        auto guard = acquire_read_lock();
+        auto it = data_.find(key);
+        if (it == data_.end()) {
+            return false;
+        }
+        func(static_cast<const T&>(it->second));
+        return true;
+    }
+
+    /**
+     * @brief 在写锁内对键对应的值执行 func(T&)，原地修改
+     * @return 键存在时返回 true
+     */
+    template <typename Func>
+    bool visit_mut(const Key& key, Func func) {
+        auto guard = acquire_write_lock();
+        auto it = data_.find(key);
+        if (it == data_.end()) {
+            return false;
+        }
+        func(it->second);
+        return true;
+    }
+
+    /**
+     * @brief 键存在时在写锁内执行 func(T&)；若 func 返回 bool 且为 false，则删除该元素
+     * @return 调用前键是否存在
+     */
+    template <typename Func>
+    bool compute_if_present(const Key& key, Func func) {
+        auto guard = acquire_write_lock();
+        auto it = data_.find(key);
+        if (it == data_.end()) {
+            return false;
+        }
+        if constexpr (std::is_same_v<std::invoke_result_t<Func&, T&>, void>) {
+            func(it->second);
+        } else {
+            if (!func(it->second)) {
+                data_.erase(it);
+            }
+        }
+        return true;
+    }
+
+    /**
+     * @brief 键不存在时在写锁内以 factory() 的结果插入（键存在时 factory 不会被调用）
+     * @return 是否插入了新元素
+     */
+    template <typename Factory>
+    bool compute_if_absent(const Key& key, Factory factory) {
+        auto guard = acquire_write_lock();
+        if (data_.find(key) != data_.end()) {
+            return false;
+        }
+        data_.emplace(key, factory());
+        return true;
+    }
+
+    /**
+     * @brief 键不存在时插入 value，否则在写锁内执行 func(T& existing, const T& value) 合并
+     * @return 是否插入了新元素
+     */
+    template <typename Func>
+    bool merge(const Key& key, const T& value, Func func) {
+        auto guard = acquire_write_lock();
+        auto result = data_.try_emplace(key, value);
+        if (!result.second) {
+            func(result.first->second, value);
+        }
+        return result.second;
+    }
+
+    // ==================== 批量操作（单次加锁） ====================
+
+    /**
+     * @brief 批量插入键值对（只加锁一次），已存在的键保持不变
+     *
+     * 以 end() 作为插入提示，已按键升序排列的输入每个元素摊还 O(1)
+     * @return 新插入的元素个数
+     */
+    template <typename InputIt>
+    size_type insert_bulk(InputIt first, InputIt last) {
+        auto guard = acquire_write_lock();
+        size_type before = data_.size();
+        for (; first != last; ++first) {
+            data_.emplace_hint(data_.end(), *first);
+        }
+        return data_.size() - before;
+    }
+
+    template <typename Range>
+    size_type insert_bulk(const Range& range) {
+        return insert_bulk(std::begin(range), std::end(range));
+    }
+
+    /**
+     * @brief 批量删除键（只加锁一次）
+     * @return 实际删除的元素个数
+     */
+    template <typename InputIt>
+    size_type erase_bulk(InputIt first, InputIt last) {
+        auto guard = acquire_write_lock();
+        size_type erased = 0;
+        for (; first != last; ++first) {
+            erased += data_.erase(*first);
+        }
+        return erased;
+    }
+
+    template <typename KeyRange>
+    size_type erase_bulk(const KeyRange& keys) {
+        return erase_bulk(std::begin(keys), std::end(keys));
+    }
+
+    /**
+     * @brief 批量查找（只加锁一次），按 keys 的顺序输出值，不存在的键输出 default_value
+     * @return 命中的键个数
+     */
+    template <typename KeyRange, typename OutputIt>
+    size_type get_many(const KeyRange& keys, OutputIt out, const T& default_value = T()) const {
+        auto guard = acquire_read_lock();
+        size_type found = 0;
+        for (const auto& key : keys) {
+            auto it = data_.find(key);
+            if (it != data_.end()) {
+                *out = it->second;
+                ++found;
+            } else {
+                *out = default_value;
+            }
+            ++out;
+        }
+        return found;
+    }
+
     // ==================== STL兼容性 ====================
 
     /**
      * @brief 隐式转换到std::map
      */
-    operator const std::map<Key, T, Compare>&() const {
+    operator const std::map<Key, T, Compare, Allocator>&() const {
         return data_;
     }
 
     /**
      * @brief 获取内部map的拷贝
      */
-    std::map<Key, T, Compare> copy() const {
+    std::map<Key, T, Compare, Allocator> copy() const {
         auto guard = acquire_read_lock();
         return data_;
     }
@@ -259,10 +630,17 @@ public:
     /**
      * @brief 获取内部map的引用
      */
-    const std::map<Key, T, Compare>& ref() const {
+    const std::map<Key, T, Compare, Allocator>& ref() const {
         return data_;
     }
 
+    /**
+     * @brief 获取底层容器的分配器
+     */
+    allocator_type get_allocator() const noexcept {
+        return data_.get_allocator();
+    }
+
     // ==================== 迭代和查询 ====================
 
     /**
@@ -312,11 +690,11 @@ public:
     /**
      * @brief 获取内部map的非const引用（线程不安全）
      */
-    std::map<Key, T, Compare>& unsafe_ref() {
+    std::map<Key, T, Compare, Allocator>& unsafe_ref() {
         return data_;
     }
 
-    const std::map<Key, T, Compare>& unsafe_ref() const {
+    const std::map<Key, T, Compare, Allocator>& unsafe_ref() const {
         return data_;
     }
 
@@ -414,24 +792,30 @@ public:
 /**
  * @brief Map 的 LockFree 特化版本 - 为极限性能优化
  */
-template <typename Key, typename T, typename Compare>
-class map<Key, T, Compare, LockPolicy::LockFree> {
+template <typename Key, typename T, typename Compare, typename Allocator>
+class map<Key, T, Compare, LockPolicy::LockFree, Allocator> {
 private:
-    std::map<Key, T, Compare> data_;
+    std::map<Key, T, Compare, Allocator> data_;
 
 public:
     // 类型定义
     using key_type = Key;
     using mapped_type = T;
     using value_type = std::pair<const Key, T>;
-    using size_type = typename std::map<Key, T, Compare>::size_type;
-    using iterator = typename std::map<Key, T, Compare>::iterator;
-    using const_iterator = typename std::map<Key, T, Compare>::const_iterator;
+    using allocator_type = Allocator;
+    using size_type = typename std::map<Key, T, Compare, Allocator>::size_type;
+    using iterator = typename std::map<Key, T, Compare, Allocator>::iterator;
+    using const_iterator = typename std::map<Key, T, Compare, Allocator>::const_iterator;
+    using node_type = typename std::map<Key, T, Compare, Allocator>::node_type;
 
     // ==================== 构造函数 ====================
 
     map() = default;
 
+    explicit map(const Allocator& alloc) : data_(alloc) {}
+
+    map(const Compare& comp, const Allocator& alloc) : data_(comp, alloc) {}
+
     explicit map(const Compare& comp) : data_(comp) {}
 
     template <typename InputIt>
@@ -491,28 +875,290 @@ public:
         return data_.count(key);
     }
 
+    template <typename K, typename C = Compare, detail::enable_if_transparent_t<C> = 0>
+    bool contains(const K& key) const {
+        return data_.find(key) != data_.end();
+    }
+
+    template <typename K, typename C = Compare, detail::enable_if_transparent_t<C> = 0>
+    size_type count(const K& key) const {
+        return data_.count(key);
+    }
+
+    template <typename K, typename C = Compare, detail::enable_if_transparent_t<C> = 0>
+    T get(const K& key, const T& default_value = T()) const {
+        auto it = data_.find(key);
+        if (it != data_.end()) {
+            return it->second;
+        }
+        return default_value;
+    }
+
+    template <typename K, typename C = Compare, detail::enable_if_transparent_t<C> = 0>
+    T at(const K& key) const {
+        auto it = data_.find(key);
+        if (it == data_.end()) {
+            throw std::out_of_range("map::at");
+        }
+        return it->second;
+    }
+
+    template <typename K, typename C = Compare, detail::enable_if_transparent_t<C> = 0>
+    T& at(const K& key) {
+        auto it = data_.find(key);
+        if (it == data_.end()) {
+            throw std::out_of_range("map::at");
+        }
+        return it->second;
+    }
+
+    // ==================== 区间查询（零开销） ====================
+
+    std::optional<std::pair<Key, T>> lower_bound_entry(const Key& key) const {
+        auto it = data_.lower_bound(key);
+        if (it == data_.end()) {
+            return std::nullopt;
+        }
+        return std::pair<Key, T>(it->first, it->second);
+    }
+
+    std::optional<std::pair<Key, T>> upper_bound_entry(const Key& key) const {
+        auto it = data_.upper_bound(key);
+        if (it == data_.end()) {
+            return std::nullopt;
+        }
+        return std::pair<Key, T>(it->first, it->second);
+    }
+
+    template <typename Func>
+    size_type range(const Key& lo, const Key& hi, Func func) const {
+        auto comp = data_.key_comp();
+        return detail::scan_while(
+            data_.lower_bound(lo), data_.end(), [&](const value_type& item) { return comp(item.first, hi); },
+            [&](const value_type& item) { return detail::invoke_continue(func, item.first, item.second); });
+    }
+
+    template <typename OutputIt>
+    size_type collect_range(const Key& lo, const Key& hi, OutputIt out,
+                            size_type limit = std::numeric_limits<size_type>::max()) const {
+        if (limit == 0) {
+            return 0;
+        }
+        size_type written = 0;
+        range(lo, hi, [&](const Key& key, const T& value) {
+            *out = std::pair<Key, T>(key, value);
+            ++out;
+            return ++written < limit;
+        });
+        return written;
+    }
+
+    template <typename Func>
+    size_type prefix_scan(const Key& prefix, Func func) const {
+        return detail::scan_while(
+            data_.lower_bound(prefix), data_.end(),
+            [&prefix](const value_type& item) { return detail::key_has_prefix(item.first, prefix); },
+            [&](const value_type& item) { return detail::invoke_continue(func, item.first, item.second); });
+    }
+
+    template <typename OutputIt>
+    size_type collect_prefix(const Key& prefix, OutputIt out,
+                             size_type limit = std::numeric_limits<size_type>::max()) const {
+        if (limit == 0) {
+            return 0;
+        }
+        size_type written = 0;
+        prefix_scan(prefix, [&](const Key& key, const T& value) {
+            *out = std::pair<Key, T>(key, value);
+            ++out;
+            return ++written < limit;
+        });
+        return written;
+    }
+
     // ==================== 修改操作（零开销） ====================
 
-    std::pair<bool, size_type> insert(const Key& key, const T& value) {
+    bool insert(const Key& key, const T& value) {
+        return data_.insert({key, value}).second;
+    }
+
+    bool insert(const Key& key, T&& value) {
+        return data_.insert({key, std::move(value)}).second;
+    }
+
+    template <typename... Args>
+    bool emplace(const Key& key, Args&&... args) {
+        return data_.try_emplace(key, std::forward<Args>(args)...).second;
+    }
+
+    std::pair<bool, size_type> insert_indexed(const Key& key, const T& value) {
         auto result = data_.insert({key, value});
-        return {result.second, std::distance(data_.begin(), result.first)};
+        return {result.second, static_cast<size_type>(std::distance(data_.begin(), result.first))};
     }
 
-    std::pair<bool, size_type> insert(const Key& key, T&& value) {
+    std::pair<bool, size_type> insert_indexed(const Key& key, T&& value) {
         auto result = data_.insert({key, std::move(value)});
-        return {result.second, std::distance(data_.begin(), result.first)};
+        return {result.second, static_cast<size_type>(std::distance(data_.begin(), result.first))};
     }
 
-    template <typename... Args>
-    std::pair<bool, size_type> emplace(const Key& key, Args&&... args) {
-        auto result = data_.emplace(key, T(std::forward<Args>(args)...));
-        return {result.second, std::distance(data_.begin(), result.first)};
+    std::optional<size_type> index_of(const Key& key) const {
+        auto it = data_.find(key);
+        if (it == data_.end()) {
+            return std::nullopt;
+        }
+        return static_cast<size_type>(std::distance(data_.begin(), it));
     }
 
     size_type erase(const Key& key) {
         return data_.erase(key);
     }
 
+    node_type extract(const Key& key) {
+        return data_.extract(key);
+    }
+
+    bool insert_node(node_type& node) {
+        return detail::insert_node_handle(data_, node);
+    }
+
+    bool insert_node(node_type&& node) {
+        return insert_node(node);
+    }
+
+    template <typename Compare2, LockPolicy SourcePolicy>
+    size_type merge_from(map<Key, T, Compare2, SourcePolicy, Allocator>& source) {
+        if (static_cast<const void*>(&source) == static_cast<const void*>(this)) {
+            return 0;
+        }
+        return detail::with_both_locked(*this, source, [&] {
+            return static_cast<size_type>(detail::merge_nodes(data_, detail::raw_container(source)));
+        });
+    }
+
+    std::map<Key, T, Compare, Allocator> drain() {
+        std::map<Key, T, Compare, Allocator> out;
+        detail::swap_contents(data_, out);
+        return out;
+    }
+
+    void swap_out(std::map<Key, T, Compare, Allocator>& other) {
+        detail::swap_contents(data_, other);
+    }
+
+    template <typename Func>
+    bool visit(const Key& key, Func func) const {
+        auto it = data_.find(key);
+        if (it == data_.end()) {
+            return false;
+        }
+        func(static_cast<const T&>(it->second));
+        return true;
+    }
+
+    template <typename Func>
+    bool visit_mut(const Key& key, Func func) {
+        auto it = data_.find(key);
+        if (it == data_.end()) {
+            return false;
+        }
+        func(it->second);
+        return true;
+    }
+
+    template <typename Func>
+    bool compute_if_present(const Key& key, Func func) {
+        auto it = data_.find(key);
+        if (it == data_.end()) {
+            return false;
+        }
+        if constexpr (std::is_same_v<std::invoke_result_t<Func&, T&>, void>) {
+            func(it->second);
+        } else {
+            if (!func(it->second)) {
+                data_.erase(it);
+            }
+        }
+        return true;
+    }
+
+    template <typename Factory>
+    bool compute_if_absent(const Key& key, Factory factory) {
+        if (data_.find(key) != data_.end()) {
+            return false;
+        }
+        data_.emplace(key, factory());
+        return true;
+    }
+
+    template <typename Func>
+    bool merge(const Key& key, const T& value, Func func) {
+        auto result = data_.try_emplace(key, value);
+        if (!result.second) {
+            func(result.first->second, value);
+        }
+        return result.second;
+    }
+
+    // ==================== 批量操作（零开销） ====================
+
+    /**
+     * @brief 批量插入键值对，已存在的键保持不变
+     *
+     * 以 end() 作为插入提示，已按键升序排列的输入每个元素摊还 O(1)
+     * @return 新插入的元素个数
+     */
+    template <typename InputIt>
+    size_type insert_bulk(InputIt first, InputIt last) {
+        size_type before = data_.size();
+        for (; first != last; ++first) {
+            data_.emplace_hint(data_.end(), *first);
+        }
+        return data_.size() - before;
+    }
+
+    template <typename Range>
+    size_type insert_bulk(const Range& range) {
+        return insert_bulk(std::begin(range), std::end(range));
+    }
+
+    /**
+     * @brief 批量删除键
+     * @return 实际删除的元素个数
+     */
+    template <typename InputIt>
+    size_type erase_bulk(InputIt first, InputIt last) {
+        size_type erased = 0;
+        for (; first != last; ++first) {
+            erased += data_.erase(*first);
+        }
+        return erased;
+    }
+
+    template <typename KeyRange>
+    size_type erase_bulk(const KeyRange& keys) {
+        return erase_bulk(std::begin(keys), std::end(keys));
+    }
+
+    /**
+     * @brief 批量查找，按 keys 的顺序输出值，不存在的键输出 default_value
+     * @return 命中的键个数
+     */
+    template <typename KeyRange, typename OutputIt>
+    size_type get_many(const KeyRange& keys, OutputIt out, const T& default_value = T()) const {
+        size_type found = 0;
+        for (const auto& key : keys) {
+            auto it = data_.find(key);
+            if (it != data_.end()) {
+                *out = it->second;
+                ++found;
+            } else {
+                *out = default_value;
+            }
+            ++out;
+        }
+        return found;
+    }
+
     // ==================== 迭代器（零开销） ====================
 
     iterator begin() noexcept {
@@ -541,21 +1187,25 @@ public:
 
     // ==================== 转换操作 ====================
 
-    operator std::map<Key, T, Compare>&() noexcept {
+    operator std::map<Key, T, Compare, Allocator>&() noexcept {
         return data_;
     }
 
-    operator const std::map<Key, T, Compare>&() const noexcept {
+    operator const std::map<Key, T, Compare, Allocator>&() const noexcept {
         return data_;
     }
 
-    std::map<Key, T, Compare>& get_unsafe() noexcept {
+    std::map<Key, T, Compare, Allocator>& get_unsafe() noexcept {
         return data_;
     }
 
-    const std::map<Key, T, Compare>& get_unsafe() const noexcept {
+    const std::map<Key, T, Compare, Allocator>& get_unsafe() const noexcept {
         return data_;
     }
+
+    allocator_type get_allocator() const noexcept {
+        return data_.get_allocator();
+    }
 };
 
 } // namespace ts_stl
@@ -0,0 +1,255 @@
+#pragma once
+
+#ifndef TS_PARALLEL_HPP
+#define TS_PARALLEL_HPP
+
+#include <cstddef>
+#include <exception>
+#include <iterator>
+#include <system_error>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// 并行算法每个任务至少处理的元素个数：元素更少时不值得多开线程，直接在调用线程执行
+#ifndef TS_STL_PARALLEL_MIN_CHUNK
+    #define TS_STL_PARALLEL_MIN_CHUNK 16384
+#endif
+
+namespace ts_stl {
+
+inline constexpr std::size_t parallel_min_chunk = TS_STL_PARALLEL_MIN_CHUNK;
+
+namespace detail {
+
+/**
+ * @brief Elem 是 std::pair 且 Func 可以用 (Args..., first, second) 调用
+ */
+template <typename Elem, typename Func, typename... Args>
+struct invocable_with_pair : std::false_type {};
+
+template <typename A, typename B, typename Func, typename... Args>
+struct invocable_with_pair<std::pair<A, B>, Func, Args...>
+    : std::is_invocable<Func, Args..., const A&, const B&> {};
+
+/**
+ * @brief 以容器的回调约定调用 func：键值对元素调用 func(key, value)，其它元素调用 func(elem)
+ */
+template <typename Func, typename Elem>
+decltype(auto) apply_element(Func& func, const Elem& elem) {
+    if constexpr (invocable_with_pair<Elem, Func&>::value) {
+        return func(elem.first, elem.second);
+    } else {
+        return func(elem);
+    }
+}
+
+/**
+ * @brief 归约时的回调约定：键值对元素调用 reduce(acc, key, value)，其它元素调用 reduce(acc, elem)
+ */
+template <typename Reduce, typename Acc, typename Elem>
+decltype(auto) apply_accumulate(Reduce& reduce, Acc&& acc, const Elem& elem) {
+    if constexpr (invocable_with_pair<Elem, Reduce&, Acc&&>::value) {
+        return reduce(std::forward<Acc>(acc), elem.first, elem.second);
+    } else {
+        return reduce(std::forward<Acc>(acc), elem);
+    }
+}
+
+/**
+ * @brief 实际使用的任务数：不超过 max_threads（0 表示硬件线程数），且每个任务至少 parallel_min_chunk 个元素
+ */
+inline std::size_t parallel_task_count(std::size_t max_threads, std::size_t items) noexcept {
+    std::size_t threads = max_threads;
+    if (threads == 0) {
+        threads = std::thread::hardware_concurrency();
+    }
+    std::size_t by_size = items / parallel_min_chunk;
+    if (by_size < threads) {
+        threads = by_size;
+    }
+    return threads == 0 ? 1 : threads;
+}
+
+/**
+ * @brief 执行 task(0) ... task(n - 1)：task(0) 在调用线程执行，其余各开一个线程
+ *
+ * 线程创建失败时剩余任务退回调用线程执行；所有任务结束后重新抛出第一个异常
+ */
+template <typename Task>
+void parallel_invoke_n(std::size_t n, Task& task) {
+    if (n <= 1) {
+        if (n == 1) {
+            task(std::size_t{0});
+        }
+        return;
+    }
+    std::vector<std::exception_ptr> errors(n);
+    auto run = [&task, &errors](std::size_t i) {
+        try {
+            task(i);
+        } catch (...) {
+            errors[i] = std::current_exception();
+        }
+    };
+    std::vector<std::thread> workers;
+    workers.reserve(n - 1);
+    std::size_t next = 1;
+    try {
+        for (; next < n; ++next) {
+            workers.emplace_back(run, next);
+        }
+    } catch (const std::system_error&) {
+        // 线程资源不足，剩余任务在本线程完成
+    }
+    run(0);
+    for (; next < n; ++next) {
+        run(next);
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    for (auto& error : errors) {
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+}
+
+/**
+ * @brief 把 [first, last) 切成长度相差不超过 1 的若干段，返回 段数 + 1 个边界
+ *
+ * 随机访问迭代器直接计算边界，其它迭代器需要顺序走一遍
+ */
+template <typename Iter>
+std::vector<Iter> split_range(Iter first, Iter last, std::size_t max_threads) {
+    std::size_t total = static_cast<std::size_t>(std::distance(first, last));
+    std::size_t parts = parallel_task_count(max_threads, total);
+    std::vector<Iter> bounds;
+    bounds.reserve(parts + 1);
+    bounds.push_back(first);
+    std::size_t base = total / parts;
+    std::size_t extra = total % parts;
+    for (std::size_t i = 0; i + 1 < parts; ++i) {
+        Iter it = bounds.back();
+        std::advance(it, static_cast<typename std::iterator_traits<Iter>::difference_type>(base + (i < extra ? 1 : 0)));
+        bounds.push_back(it);
+    }
+    bounds.push_back(last);
+    return bounds;
+}
+
+} // namespace detail
+
+// ==================== 区间并行算法 ====================
+//
+// 回调会被多个线程同时调用，必须是线程安全的（只读共享状态或自行同步）。
+// 容器成员版本（parallel_for_each 等）在读锁内调用这些算法；LockFree 容器可以直接对
+// begin()/end() 或 unsafe_ref() 使用。
+
+/**
+ * @brief 并行地对 [first, last) 中每个元素执行 func(elem)
+ */
+template <typename Iter, typename Func>
+void parallel_for_each(Iter first, Iter last, Func func, std::size_t max_threads = 0) {
+    auto bounds = detail::split_range(first, last, max_threads);
+    auto task = [&bounds, &func](std::size_t i) {
+        for (Iter it = bounds[i]; it != bounds[i + 1]; ++it) {
+            func(*it);
+        }
+    };
+    detail::parallel_invoke_n(bounds.size() - 1, task);
+}
+
+/**
+ * @brief 并行统计满足 pred(elem) 的元素个数
+ */
+template <typename Iter, typename Predicate>
+std::size_t parallel_count_if(Iter first, Iter last, Predicate pred, std::size_t max_threads = 0) {
+    auto bounds = detail::split_range(first, last, max_threads);
+    std::vector<std::size_t> partials(bounds.size() - 1, 0);
+    auto task = [&bounds, &pred, &partials](std::size_t i) {
+        std::size_t local = 0;
+        for (Iter it = bounds[i]; it != bounds[i + 1]; ++it) {
+            if (pred(*it)) {
+                ++local;
+            }
+        }
+        partials[i] = local;
+    };
+    detail::parallel_invoke_n(partials.size(), task);
+    std::size_t total = 0;
+    for (std::size_t partial : partials) {
+        total += partial;
+    }
+    return total;
+}
+
+/**
+ * @brief 并行归约：每段从 identity 开始做 acc = reduce(acc, elem)，各段结果按顺序用 combine 合并
+ * @param identity 单位元（每段都会从它开始，例如求和用 0）
+ * @note combine 需满足结合律；段内与段间均保持元素原有顺序
+ */
+template <typename Iter, typename U, typename Reduce, typename Combine,
+          std::enable_if_t<!std::is_integral_v<Combine>, int> = 0>
+U parallel_reduce(Iter first, Iter last, U identity, Reduce reduce, Combine combine, std::size_t max_threads = 0) {
+    auto bounds = detail::split_range(first, last, max_threads);
+    std::vector<U> partials(bounds.size() - 1, identity);
+    auto task = [&bounds, &reduce, &partials](std::size_t i) {
+        U acc = std::move(partials[i]);
+        for (Iter it = bounds[i]; it != bounds[i + 1]; ++it) {
+            acc = detail::apply_accumulate(reduce, std::move(acc), *it);
+        }
+        partials[i] = std::move(acc);
+    };
+    detail::parallel_invoke_n(partials.size(), task);
+    U result = std::move(partials[0]);
+    for (std::size_t i = 1; i < partials.size(); ++i) {
+        result = combine(std::move(result), std::move(partials[i]));
+    }
+    return result;
+}
+
+/**
+ * @brief 并行归约（元素与累加值同类型时的简写，例如 parallel_reduce(first, last, 0.0f, std::plus<>())）
+ */
+template <typename Iter, typename U, typename BinaryOp>
+U parallel_reduce(Iter first, Iter last, U identity, BinaryOp op, std::size_t max_threads = 0) {
+    return parallel_reduce(first, last, std::move(identity), op, op, max_threads);
+}
+
+/**
+ * @brief 并行地对每个元素执行 func(elem)，按原顺序收集结果
+ */
+template <typename Iter, typename Func>
+auto parallel_transform(Iter first, Iter last, Func func, std::size_t max_threads = 0) {
+    using result_type = std::decay_t<std::invoke_result_t<Func&, decltype(*first)>>;
+    auto bounds = detail::split_range(first, last, max_threads);
+    std::vector<std::vector<result_type>> pieces(bounds.size() - 1);
+    auto task = [&bounds, &func, &pieces](std::size_t i) {
+        auto& piece = pieces[i];
+        piece.reserve(static_cast<std::size_t>(std::distance(bounds[i], bounds[i + 1])));
+        for (Iter it = bounds[i]; it != bounds[i + 1]; ++it) {
+            piece.push_back(func(*it));
+        }
+    };
+    detail::parallel_invoke_n(pieces.size(), task);
+    if (pieces.size() == 1) {
+        return std::move(pieces[0]);
+    }
+    std::size_t total = 0;
+    for (const auto& piece : pieces) {
+        total += piece.size();
+    }
+    std::vector<result_type> out;
+    out.reserve(total);
+    for (auto& piece : pieces) {
+        out.insert(out.end(), std::make_move_iterator(piece.begin()), std::make_move_iterator(piece.end()));
+    }
+    return out;
+}
+
+} // namespace ts_stl
+
+#endif // TS_PARALLEL_HPP
@@ -0,0 +1,638 @@
+#pragma once
+
+#ifndef TS_PERSIST_HPP
+#define TS_PERSIST_HPP
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// POSIX 平台使用 mmap 映射快照文件，其它平台退化为一次性读入对齐缓冲区
+#if (defined(__unix__) || defined(__APPLE__)) && !defined(TS_STL_NO_MMAP)
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+    #define TS_STL_HAS_MMAP 1
+#else
+    #define TS_STL_HAS_MMAP 0
+#endif
+
+#include "ts_stl_base.hpp"
+#include "ts_snapshot.hpp"
+
+namespace ts_stl {
+
+/**
+ * @brief 快照文件读写失败（无法打开、格式不符、元素布局不一致等）
+ */
+class snapshot_error : public std::runtime_error {
+public:
+    using std::runtime_error::runtime_error;
+};
+
+/**
+ * @brief 键值快照中的一条记录；文件中按 key 升序排列，映射视图直接以此类型访问
+ */
+template <typename Key, typename T>
+struct snapshot_entry {
+    Key key;
+    T value;
+};
+
+namespace detail {
+
+// ==================== 文件格式 ====================
+//
+// [0, 64)   snapshot_header
+// [64, ...) 记录数组：顺序容器为 T[count]，键值容器为按 key 升序的 snapshot_entry<Key, T>[count]
+//
+// 记录按内存布局原样写入，只能在字长、字节序、对齐规则相同的平台之间交换；
+// 头部记录各尺寸与字节序标记，加载时逐项校验。
+
+enum class snapshot_kind : std::uint32_t {
+    sequence = 1,
+    key_value = 2
+};
+
+struct snapshot_header {
+    char magic[8];
+    std::uint32_t format_version;
+    std::uint32_t byte_order;
+    std::uint32_t kind;
+    std::uint32_t key_size;
+    std::uint32_t value_size;
+    std::uint32_t record_size;
+    std::uint32_t record_align;
+    std::uint32_t reserved;
+    std::uint64_t count;
+};
+
+inline constexpr char snapshot_magic[8] = {'T', 'S', 'S', 'T', 'L', 'S', 'N', 'P'};
+inline constexpr std::uint32_t snapshot_format_version = 1;
+inline constexpr std::uint32_t snapshot_byte_order = 0x01020304u;
+inline constexpr std::size_t snapshot_payload_offset = 64;
+
+static_assert(sizeof(snapshot_header) <= snapshot_payload_offset, "snapshot header must fit before the payload");
+
+[[noreturn]] inline void throw_snapshot_error(const std::string& path, const std::string& what) {
+    throw snapshot_error("ts_stl snapshot '" + path + "': " + what);
+}
+
+[[noreturn]] inline void throw_snapshot_errno(const std::string& path, const char* what) {
+    throw_snapshot_error(path, std::string(what) + ": " + std::strerror(errno));
+}
+
+/**
+ * @brief 记录的布局描述：顺序容器 key_size 为 0
+ */
+template <typename Record>
+snapshot_header make_snapshot_header(snapshot_kind kind, std::uint32_t key_size, std::uint32_t value_size,
+                                     std::uint64_t count) {
+    snapshot_header header{};
+    std::memcpy(header.magic, snapshot_magic, sizeof(snapshot_magic));
+    header.format_version = snapshot_format_version;
+    header.byte_order = snapshot_byte_order;
+    header.kind = static_cast<std::uint32_t>(kind);
+    header.key_size = key_size;
+    header.value_size = value_size;
+    header.record_size = static_cast<std::uint32_t>(sizeof(Record));
+    header.record_align = static_cast<std::uint32_t>(alignof(Record));
+    header.count = count;
+    return header;
+}
+
+// ==================== 写入 ====================
+
+/**
+ * @brief 先写入 path.tmp，成功后再 rename 覆盖 path：进程中途崩溃不会留下半个快照
+ *
+ * POSIX 平台在 rename 之后还会 fsync 所在目录，使替换本身在掉电后也能保留
+ */
+class snapshot_writer {
+public:
+    explicit snapshot_writer(const std::string& path) : path_(path), temp_path_(path + ".tmp") {
+        file_ = std::fopen(temp_path_.c_str(), "wb");
+        if (file_ == nullptr) {
+            throw_snapshot_errno(temp_path_, "cannot open for writing");
+        }
+        std::setvbuf(file_, nullptr, _IOFBF, buffer_size);
+    }
+
+    snapshot_writer(const snapshot_writer&) = delete;
+    snapshot_writer& operator=(const snapshot_writer&) = delete;
+
+    ~snapshot_writer() {
+        if (file_ != nullptr) {
+            std::fclose(file_);
+            std::remove(temp_path_.c_str());
+        }
+    }
+
+    void write(const void* data, std::size_t bytes) {
+        if (bytes != 0 && std::fwrite(data, 1, bytes, file_) != bytes) {
+            throw_snapshot_errno(temp_path_, "write failed");
+        }
+    }
+
+    void write_header(const snapshot_header& header) {
+        unsigned char block[snapshot_payload_offset] = {};
+        std::memcpy(block, &header, sizeof(header));
+        write(block, sizeof(block));
+    }
+
+    /**
+     * @brief 刷盘并原子替换目标文件
+     */
+    void commit() {
+        bool ok = std::fflush(file_) == 0;
+#if TS_STL_HAS_MMAP
+        ok = ok && ::fsync(::fileno(file_)) == 0;
+#endif
+        ok = std::fclose(file_) == 0 && ok;
+        file_ = nullptr;
+        if (!ok) {
+            const int saved = errno;
+            std::remove(temp_path_.c_str());
+            errno = saved;
+            throw_snapshot_errno(temp_path_, "flush failed");
+        }
+        if (std::rename(temp_path_.c_str(), path_.c_str()) != 0) {
+            const int saved = errno;
+            std::remove(temp_path_.c_str());
+            errno = saved;
+            throw_snapshot_errno(path_, "rename failed");
+        }
+#if TS_STL_HAS_MMAP
+        sync_parent_directory();
+#endif
+    }
+
+private:
+    static constexpr std::size_t buffer_size = 1 << 20;
+
+#if TS_STL_HAS_MMAP
+    void sync_parent_directory() const {
+        const auto slash = path_.find_last_of('/');
+        const std::string dir = slash == std::string::npos ? "." : slash == 0 ? "/" : path_.substr(0, slash);
+        const int fd = ::open(dir.c_str(), O_RDONLY | O_DIRECTORY);
+        if (fd < 0) {
+            throw_snapshot_errno(dir, "cannot open directory for sync");
+        }
+        const bool ok = ::fsync(fd) == 0;
+        const int saved = errno;
+        ::close(fd);
+        if (!ok) {
+            errno = saved;
+            throw_snapshot_errno(dir, "directory sync failed");
+        }
+    }
+#endif
+
+    std::string path_;
+    std::string temp_path_;
+    std::FILE* file_ = nullptr;
+};
+
+template <typename C, typename = void>
+struct has_read_guard : std::false_type {};
+
+template <typename C>
+struct has_read_guard<C, std::void_t<decltype(std::declval<const C&>().acquire_read_guard())>> : std::true_type {};
+
+/**
+ * @brief 保存快照时持有的锁：读写锁取读锁，其它策略取写锁，LockFree 不加锁
+ */
+template <typename C>
+auto snapshot_read_lock(const C& c) {
+    if constexpr (has_read_guard<C>::value) {
+        return c.acquire_read_guard();
+    } else {
+        return transfer_lock(c);
+    }
+}
+
+template <typename C, typename = void>
+struct has_contiguous_data : std::false_type {};
+
+template <typename C>
+struct has_contiguous_data<C, std::void_t<decltype(std::declval<const C&>().data())>>
+    : std::is_pointer<decltype(std::declval<const C&>().data())> {};
+
+/**
+ * @brief 把标准容器写成快照，guard 为调用方持有的锁，在不再读取 data 时提前释放
+ *
+ * 键值容器在持锁期间复制为记录数组，排序与写盘都在锁外完成；顺序容器写完元素后才释放锁
+ */
+template <typename Data, typename Guard>
+void write_snapshot(const Data& data, Guard& guard, const std::string& path) {
+    using value_type = typename Data::value_type;
+    if constexpr (is_pair<value_type>::value) {
+        using key_type = std::remove_const_t<typename value_type::first_type>;
+        using mapped_type = typename value_type::second_type;
+        using record = snapshot_entry<key_type, mapped_type>;
+        static_assert(std::is_trivially_copyable_v<key_type> && std::is_trivially_copyable_v<mapped_type>,
+                      "snapshot keys and values must be trivially copyable");
+        static_assert(alignof(record) <= snapshot_payload_offset, "snapshot record alignment is too large");
+
+        // 先把记录（包括填充字节）清零再逐成员赋值：输出可复现，也不会把内存残留写进文件；
+        // 值初始化不保证编译器为填充字节生成写入，因此直接 memset（record 是平凡可复制类型）
+        std::vector<record> records(data.size());
+        if (!records.empty()) {
+            std::memset(static_cast<void*>(records.data()), 0, records.size() * sizeof(record));
+        }
+        std::size_t i = 0;
+        for (const auto& kv : data) {
+            records[i].key = kv.first;
+            records[i].value = kv.second;
+            ++i;
+        }
+        guard.unlock();
+
+        auto by_key = [](const record& a, const record& b) { return a.key < b.key; };
+        if (!std::is_sorted(records.begin(), records.end(), by_key)) {
+            std::sort(records.begin(), records.end(), by_key);
+        }
+        snapshot_writer writer(path);
+        writer.write_header(make_snapshot_header<record>(snapshot_kind::key_value,
+                                                         static_cast<std::uint32_t>(sizeof(key_type)),
+                                                         static_cast<std::uint32_t>(sizeof(mapped_type)),
+                                                         records.size()));
+        writer.write(records.data(), records.size() * sizeof(record));
+        writer.commit();
+    } else {
+        static_assert(std::is_trivially_copyable_v<value_type>, "snapshot elements must be trivially copyable");
+        static_assert(alignof(value_type) <= snapshot_payload_offset, "snapshot element alignment is too large");
+
+        snapshot_writer writer(path);
+        writer.write_header(make_snapshot_header<value_type>(snapshot_kind::sequence, 0,
+                                                             static_cast<std::uint32_t>(sizeof(value_type)),
+                                                             data.size()));
+        if constexpr (has_contiguous_data<Data>::value) {
+            writer.write(data.data(), data.size() * sizeof(value_type));
+        } else {
+            for (const auto& elem : data) {
+                writer.write(&elem, sizeof(value_type));
+            }
+        }
+        guard.unlock();
+        writer.commit();
+    }
+}
+
+// ==================== 读取 ====================
+
+/**
+ * @brief 只读打开的快照文件：POSIX 上为 mmap 映射，其它平台为对齐的内存副本
+ */
+class mapped_file {
+public:
+    mapped_file() = default;
+
+    mapped_file(const std::string& path, bool sequential) {
+#if TS_STL_HAS_MMAP
+        const int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) {
+            throw_snapshot_errno(path, "cannot open");
+        }
+        struct ::stat st {};
+        if (::fstat(fd, &st) != 0) {
+            const int saved = errno;
+            ::close(fd);
+            errno = saved;
+            throw_snapshot_errno(path, "cannot stat");
+        }
+        size_ = static_cast<std::size_t>(st.st_size);
+        if (size_ != 0) {
+            void* p = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (p == MAP_FAILED) {
+                const int saved = errno;
+                ::close(fd);
+                errno = saved;
+                throw_snapshot_errno(path, "mmap failed");
+            }
+            // 整体加载时提示内核顺序预读；映射视图为随机访问，只预取不丢弃
+            ::madvise(p, size_, sequential ? MADV_SEQUENTIAL : MADV_WILLNEED);
+            data_ = static_cast<const unsigned char*>(p);
+        }
+        ::close(fd);
+#else
+        (void)sequential;
+        std::FILE* file = std::fopen(path.c_str(), "rb");
+        if (file == nullptr) {
+            throw_snapshot_errno(path, "cannot open");
+        }
+        std::fseek(file, 0, SEEK_END);
+        const long length = std::ftell(file);
+        std::fseek(file, 0, SEEK_SET);
+        if (length < 0) {
+            std::fclose(file);
+            throw_snapshot_errno(path, "cannot determine size");
+        }
+        size_ = static_cast<std::size_t>(length);
+        buffer_.reset(static_cast<unsigned char*>(::operator new(size_ + 1, std::align_val_t{snapshot_payload_offset})));
+        const bool ok = std::fread(buffer_.get(), 1, size_, file) == size_;
+        std::fclose(file);
+        if (!ok) {
+            throw_snapshot_errno(path, "read failed");
+        }
+        data_ = buffer_.get();
+#endif
+    }
+
+    mapped_file(mapped_file&& other) noexcept { swap(other); }
+
+    mapped_file& operator=(mapped_file&& other) noexcept {
+        mapped_file(std::move(other)).swap(*this);
+        return *this;
+    }
+
+    mapped_file(const mapped_file&) = delete;
+    mapped_file& operator=(const mapped_file&) = delete;
+
+    ~mapped_file() {
+#if TS_STL_HAS_MMAP
+        if (data_ != nullptr) {
+            ::munmap(const_cast<unsigned char*>(data_), size_);
+        }
+#endif
+    }
+
+    const unsigned char* data() const noexcept { return data_; }
+    std::size_t size() const noexcept { return size_; }
+
+    void swap(mapped_file& other) noexcept {
+        std::swap(data_, other.data_);
+        std::swap(size_, other.size_);
+#if !TS_STL_HAS_MMAP
+        std::swap(buffer_, other.buffer_);
+#endif
+    }
+
+private:
+#if !TS_STL_HAS_MMAP
+    struct aligned_delete {
+        void operator()(unsigned char* p) const noexcept {
+            ::operator delete(p, std::align_val_t{snapshot_payload_offset});
+        }
+    };
+    std::unique_ptr<unsigned char, aligned_delete> buffer_;
+#endif
+    const unsigned char* data_ = nullptr;
+    std::size_t size_ = 0;
+};
+
+/**
+ * @brief 校验快照头部与期望的记录布局一致，返回记录个数
+ */
+template <typename Record>
+std::size_t validate_snapshot(const mapped_file& file, const std::string& path, snapshot_kind kind,
+                              std::uint32_t key_size, std::uint32_t value_size) {
+    if (file.size() < snapshot_payload_offset) {
+        throw_snapshot_error(path, "file too small");
+    }
+    snapshot_header header;
+    std::memcpy(&header, file.data(), sizeof(header));
+    if (std::memcmp(header.magic, snapshot_magic, sizeof(snapshot_magic)) != 0) {
+        throw_snapshot_error(path, "not a ts_stl snapshot");
+    }
+    if (header.format_version != snapshot_format_version) {
+        throw_snapshot_error(path, "unsupported format version " + std::to_string(header.format_version));
+    }
+    if (header.byte_order != snapshot_byte_order) {
+        throw_snapshot_error(path, "byte order mismatch");
+    }
+    if (header.kind != static_cast<std::uint32_t>(kind)) {
+        throw_snapshot_error(path, kind == snapshot_kind::sequence ? "expected a sequence snapshot"
+                                                                   : "expected a key-value snapshot");
+    }
+    if (header.key_size != key_size || header.value_size != value_size ||
+        header.record_size != sizeof(Record) || header.record_align != alignof(Record)) {
+        throw_snapshot_error(path, "element layout mismatch");
+    }
+    const std::size_t available = (file.size() - snapshot_payload_offset) / sizeof(Record);
+    if (header.count > available) {
+        throw_snapshot_error(path, "truncated payload");
+    }
+    return static_cast<std::size_t>(header.count);
+}
+
+template <typename Record>
+const Record* snapshot_records(const mapped_file& file) noexcept {
+    return reinterpret_cast<const Record*>(file.data() + snapshot_payload_offset);
+}
+
+template <typename C, typename = void>
+struct has_reserve : std::false_type {};
+
+template <typename C>
+struct has_reserve<C, std::void_t<decltype(std::declval<C&>().reserve(std::size_t{}))>> : std::true_type {};
+
+template <typename C, typename = void>
+struct has_assign : std::false_type {};
+
+template <typename C>
+struct has_assign<C, std::void_t<decltype(std::declval<C&>().assign(
+                         std::declval<const typename C::value_type*>(),
+                         std::declval<const typename C::value_type*>()))>> : std::true_type {};
+
+} // namespace detail
+
+// ==================== 映射视图 ====================
+
+/**
+ * @brief 直接在映射内存上访问的顺序快照（只读）
+ *
+ * 打开时只校验头部，不复制数据；页面在首次访问时按需读入。
+ * 视图不可修改，任意多个线程可同时读取，无需加锁。
+ */
+template <typename T>
+class mapped_vector {
+    static_assert(std::is_trivially_copyable_v<T>, "snapshot elements must be trivially copyable");
+
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using const_iterator = const T*;
+
+    explicit mapped_vector(const std::string& path) : file_(path, false) {
+        size_ = detail::validate_snapshot<T>(file_, path, detail::snapshot_kind::sequence, 0,
+                                             static_cast<std::uint32_t>(sizeof(T)));
+        data_ = detail::snapshot_records<T>(file_);
+    }
+
+    const T* data() const noexcept { return data_; }
+    size_type size() const noexcept { return size_; }
+    bool empty() const noexcept { return size_ == 0; }
+
+    const T& operator[](size_type index) const noexcept { return data_[index]; }
+
+    const T& at(size_type index) const {
+        if (index >= size_) {
+            throw std::out_of_range("mapped_vector::at");
+        }
+        return data_[index];
+    }
+
+    const_iterator begin() const noexcept { return data_; }
+    const_iterator end() const noexcept { return data_ + size_; }
+
+private:
+    detail::mapped_file file_;
+    const T* data_ = nullptr;
+    size_type size_ = 0;
+};
+
+/**
+ * @brief 直接在映射内存上查找的键值快照（只读，扁平有序数组）
+ *
+ * 记录在保存时已按 key 升序排列，find() 在映射内存上二分查找，
+ * 启动时不需要重建哈希表；需要修改时再用 load_snapshot() 载入容器。
+ */
+template <typename Key, typename T>
+class mapped_map {
+public:
+    using key_type = Key;
+    using mapped_type = T;
+    using value_type = snapshot_entry<Key, T>;
+    using size_type = std::size_t;
+    using const_iterator = const value_type*;
+
+    explicit mapped_map(const std::string& path) : file_(path, false) {
+        size_ = detail::validate_snapshot<value_type>(file_, path, detail::snapshot_kind::key_value,
+                                                      static_cast<std::uint32_t>(sizeof(Key)),
+                                                      static_cast<std::uint32_t>(sizeof(T)));
+        data_ = detail::snapshot_records<value_type>(file_);
+    }
+
+    size_type size() const noexcept { return size_; }
+    bool empty() const noexcept { return size_ == 0; }
+
+    /**
+     * @brief 查找键，返回映射内存中值的指针，键不存在时返回 nullptr
+     */
+    const T* find(const Key& key) const noexcept {
+        const value_type* it = lower_bound(key);
+        return it != end() && !(key < it->key) ? &it->value : nullptr;
+    }
+
+    bool contains(const Key& key) const noexcept {
+        return find(key) != nullptr;
+    }
+
+    const T& at(const Key& key) const {
+        if (const T* value = find(key)) {
+            return *value;
+        }
+        throw std::out_of_range("mapped_map::at");
+    }
+
+    /**
+     * @brief 第一个不小于 key 的记录（区间扫描的起点）
+     */
+    const_iterator lower_bound(const Key& key) const noexcept {
+        return std::lower_bound(begin(), end(), key,
+                                [](const value_type& entry, const Key& k) { return entry.key < k; });
+    }
+
+    const_iterator begin() const noexcept { return data_; }
+    const_iterator end() const noexcept { return data_ + size_; }
+
+private:
+    detail::mapped_file file_;
+    const value_type* data_ = nullptr;
+    size_type size_ = 0;
+};
+
+// ==================== 保存与加载 ====================
+
+/**
+ * @brief 把容器写成二进制快照（元素须可平凡复制）
+ *
+ * 顺序容器在读锁内直接写出元素内存；键值容器在读锁内复制为记录数组，
+ * 释放锁后再排序、写盘。写入先落到 path.tmp，完成后原子替换 path。
+ */
+template <typename Container>
+void save_snapshot(const Container& container, const std::string& path) {
+    auto guard = detail::snapshot_read_lock(container);
+    detail::write_snapshot(detail::raw_container(container), guard, path);
+}
+
+/**
+ * @brief 从 RCU 快照的当前版本保存：全程不加锁，写者可并发发布新版本
+ */
+template <typename Container>
+void save_snapshot(const snapshot<Container>& source, const std::string& path) {
+    typename snapshot<Container>::pointer current = source.load();
+    NullLockGuard guard;
+    detail::write_snapshot(*current, guard, path);
+}
+
+/**
+ * @brief 映射快照文件并批量构造容器内容，替换 target 原有的元素
+ *
+ * 新内容在锁外构造完成后通过 swap_out() 一次换入，加载期间 target 仍可正常读写。
+ */
+template <typename Container>
+void load_snapshot(Container& target, const std::string& path) {
+    using data_type = std::remove_reference_t<decltype(detail::raw_container(target))>;
+    using value_type = typename data_type::value_type;
+    detail::mapped_file file(path, true);
+    data_type data;
+    if constexpr (detail::is_pair<value_type>::value) {
+        using key_type = std::remove_const_t<typename value_type::first_type>;
+        using mapped_type = typename value_type::second_type;
+        using record = snapshot_entry<key_type, mapped_type>;
+        const std::size_t count = detail::validate_snapshot<record>(
+            file, path, detail::snapshot_kind::key_value, static_cast<std::uint32_t>(sizeof(key_type)),
+            static_cast<std::uint32_t>(sizeof(mapped_type)));
+        const record* records = detail::snapshot_records<record>(file);
+        if constexpr (detail::has_reserve<data_type>::value) {
+            data.reserve(count);
+        }
+        for (std::size_t i = 0; i < count; ++i) {
+            data.try_emplace(records[i].key, records[i].value);
+        }
+    } else {
+        const std::size_t count = detail::validate_snapshot<value_type>(
+            file, path, detail::snapshot_kind::sequence, 0, static_cast<std::uint32_t>(sizeof(value_type)));
+        const value_type* first = detail::snapshot_records<value_type>(file);
+        if constexpr (detail::has_assign<data_type>::value) {
+            data.assign(first, first + count);
+        } else {
+            data.insert(first, first + count);
+        }
+    }
+    if constexpr (detail::has_write_guard<Container>::value) {
+        target.swap_out(data);
+    } else {
+        detail::raw_container(target).swap(data);
+    }
+}
+
+/**
+ * @brief 只读映射快照，不构造容器：顺序快照得到 mapped_vector，键值快照得到 mapped_map
+ * @tparam Container 保存快照时使用的容器类型（如 unordered_mapRW<std::uint64_t, Record>）
+ */
+template <typename Container>
+auto map_snapshot(const std::string& path) {
+    using value_type = typename Container::value_type;
+    if constexpr (detail::is_pair<value_type>::value) {
+        return mapped_map<std::remove_const_t<typename value_type::first_type>, typename value_type::second_type>(path);
+    } else {
+        return mapped_vector<value_type>(path);
+    }
+}
+
+} // namespace ts_stl
+
+#endif // TS_PERSIST_HPP
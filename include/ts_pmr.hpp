@@ -0,0 +1,116 @@
+#pragma once
+
+#ifndef TS_PMR_HPP
+#define TS_PMR_HPP
+
+// 条件编译：标准库提供 <memory_resource> 时启用 pmr 支持
+#if defined(__has_include)
+    #if __has_include(<memory_resource>)
+        #include <memory_resource>
+        #define TS_STL_SUPPORT_PMR 1
+    #endif
+#endif
+#ifndef TS_STL_SUPPORT_PMR
+    #define TS_STL_SUPPORT_PMR 0
+#endif
+
+#if TS_STL_SUPPORT_PMR
+
+#include <functional>
+#include <utility>
+
+#include "ts_list.hpp"
+#include "ts_map.hpp"
+#include "ts_set.hpp"
+#include "ts_unordered_map.hpp"
+#include "ts_unordered_set.hpp"
+
+namespace ts_stl {
+namespace pmr {
+
+// ==================== 多态分配器容器别名 ====================
+
+template <typename T, LockPolicy Policy = LockPolicy::Mutex>
+using list = ts_stl::list<T, Policy, std::pmr::polymorphic_allocator<T>>;
+
+template <typename Key, typename T, typename Compare = std::less<Key>, LockPolicy Policy = LockPolicy::Mutex>
+using map = ts_stl::map<Key, T, Compare, Policy, std::pmr::polymorphic_allocator<std::pair<const Key, T>>>;
+
+template <typename Key, typename Compare = std::less<Key>, LockPolicy Policy = LockPolicy::Mutex>
+using set = ts_stl::set<Key, Compare, Policy, std::pmr::polymorphic_allocator<Key>>;
+
+template <typename Key, typename T, typename Hash = std::hash<Key>, typename KeyEqual = std::equal_to<Key>,
+          LockPolicy Policy = LockPolicy::Mutex>
+using unordered_map = ts_stl::unordered_map<Key, T, Hash, KeyEqual, Policy,
+                                            std::pmr::polymorphic_allocator<std::pair<const Key, T>>>;
+
+template <typename Key, typename Hash = std::hash<Key>, typename KeyEqual = std::equal_to<Key>,
+          LockPolicy Policy = LockPolicy::Mutex>
+using unordered_set = ts_stl::unordered_set<Key, Hash, KeyEqual, Policy, std::pmr::polymorphic_allocator<Key>>;
+
+} // namespace pmr
+
+namespace detail {
+
+/**
+ * @brief 持有节点池的基类，保证内存池先于容器构造、晚于容器析构
+ */
+struct pool_holder {
+    std::pmr::unsynchronized_pool_resource pool_;
+
+    pool_holder() = default;
+    explicit pool_holder(const std::pmr::pool_options& options) : pool_(options) {}
+};
+
+} // namespace detail
+
+/**
+ * @brief 自带节点内存池的线程安全容器
+ * @tparam Container 使用 polymorphic_allocator 的容器（如 ts_stl::pmr::map<int, int>）
+ *
+ * 每个容器独占一个 std::pmr::unsynchronized_pool_resource：
+ * - 节点分配/释放都发生在容器锁内，已由容器锁串行化，内存池本身无需再加锁
+ * - 释放的节点回到本容器的空闲链表，插入不再争用全局 malloc
+ * - 内存在容器析构时整体归还上游资源
+ *
+ * 注意：
+ * - copy() / drain() / 拷贝构造得到的标准容器使用默认内存资源，可在 pooled 销毁后继续使用
+ * - 不提供 extract()：节点句柄不能离开容器锁；merge_from() / insert_node() 可用，跨内存资源时按值移动
+ * - LockFree 策略下由调用方负责同步，内存池同样只能在该同步下访问
+ * - 不可复制、不可移动（容器内节点引用本对象持有的内存池）
+ */
+template <typename Container>
+class pooled : private detail::pool_holder, public Container {
+public:
+    using container_type = Container;
+    using allocator_type = typename Container::allocator_type;
+
+    pooled() : detail::pool_holder(), Container(allocator_type(&this->pool_)) {}
+
+    /**
+     * @brief 指定内存池参数（每块最多节点数、最大池化块大小）
+     */
+    explicit pooled(const std::pmr::pool_options& options)
+        : detail::pool_holder(options), Container(allocator_type(&this->pool_)) {}
+
+    pooled(const pooled&) = delete;
+    pooled& operator=(const pooled&) = delete;
+
+    // 节点句柄会把池内存带出容器锁，在锁外析构时并发访问非线程安全的内存池；
+    // 需要在容器间迁移时使用 merge_from()（在两个容器锁内逐个移动元素）
+    template <typename... Args>
+    void extract(Args&&...) = delete;
+
+    /**
+     * @brief 本容器使用的内存池
+     */
+    std::pmr::memory_resource* resource() noexcept {
+        return &this->pool_;
+    }
+};
+
+} // namespace ts_stl
+
+#endif // TS_STL_SUPPORT_PMR
+
+#endif // TS_PMR_HPP
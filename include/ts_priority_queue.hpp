@@ -0,0 +1,780 @@
+#pragma once
+
+#ifndef TS_PRIORITY_QUEUE_HPP
+#define TS_PRIORITY_QUEUE_HPP
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "ts_stl_base.hpp"
+
+namespace ts_stl {
+
+namespace detail {
+
+/**
+ * @brief 线程私有的快速伪随机数（xorshift64*），用于在多个堆之间随机选择
+ */
+inline std::uint64_t thread_random() noexcept {
+    thread_local std::uint64_t state =
+        mix_hash(std::hash<std::thread::id>{}(std::this_thread::get_id())) | 1u;
+    state ^= state >> 12;
+    state ^= state << 25;
+    state ^= state >> 27;
+    return state * 2685821657736338717ULL;
+}
+
+/**
+ * @brief 把 [first, last) 并入堆 heap：新元素较多时整体 make_heap（O(n)），否则逐个 push_heap
+ */
+template <typename T, typename Compare, typename InputIt>
+std::size_t heap_append(std::vector<T>& heap, const Compare& comp, InputIt first, InputIt last) {
+    const std::size_t old_size = heap.size();
+    heap.insert(heap.end(), first, last);
+    const std::size_t added = heap.size() - old_size;
+    if (added > old_size) {
+        std::make_heap(heap.begin(), heap.end(), comp);
+    } else {
+        for (std::size_t i = old_size + 1; i <= heap.size(); ++i) {
+            std::push_heap(heap.begin(), heap.begin() + static_cast<std::ptrdiff_t>(i), comp);
+        }
+    }
+    return added;
+}
+
+/**
+ * @brief 弹出堆顶并以右值交给 sink；sink 抛出异常时把该元素放回堆中，堆性质保持不变
+ */
+template <typename T, typename Compare, typename Sink>
+void heap_pop_to(std::vector<T>& heap, const Compare& comp, Sink&& sink) {
+    std::pop_heap(heap.begin(), heap.end(), comp);
+    try {
+        sink(std::move(heap.back()));
+    } catch (...) {
+        std::push_heap(heap.begin(), heap.end(), comp);
+        throw;
+    }
+    heap.pop_back();
+}
+
+/**
+ * @brief 弹出堆顶到 out
+ */
+template <typename T, typename Compare>
+void heap_pop(std::vector<T>& heap, const Compare& comp, T& out) {
+    heap_pop_to(heap, comp, [&out](T&& value) { out = std::move(value); });
+}
+
+/**
+ * @brief 弹出堆顶写入输出迭代器 out（不要求 T 可默认构造）
+ */
+template <typename T, typename Compare, typename OutputIt>
+void heap_pop_out(std::vector<T>& heap, const Compare& comp, OutputIt& out) {
+    heap_pop_to(heap, comp, [&out](T&& value) { *out = std::move(value); });
+    ++out;
+}
+
+} // namespace detail
+
+/**
+ * @brief 线程安全的优先队列
+ * @tparam T 元素类型
+ * @tparam Compare 比较器，语义与 std::priority_queue 相同（默认 std::less，堆顶为最大元素；
+ *                 std::greater 得到最小堆，适合定时器）
+ * @tparam Policy 锁策略（默认使用互斥锁）
+ *
+ * 以 std::vector 维护二叉堆，"检查 + 取出"在同一把锁内完成：
+ * - try_pop / try_pop_if：原子地取出堆顶（可附加条件，例如"到期才取"）
+ * - push_bulk / pop_n：一次加锁批量入队 / 按优先级批量出队
+ * - unsafe_ref() 暴露的是堆序的 std::vector，修改后需自行维护堆性质
+ */
+template <typename T, typename Compare = std::less<T>, LockPolicy Policy = LockPolicy::Mutex>
+class priority_queue : public container_mixin<priority_queue<T, Compare, Policy>, T, Policy> {
+private:
+    friend class container_mixin<priority_queue<T, Compare, Policy>, T, Policy>;
+
+    std::vector<T> data_;
+    Compare comp_;
+
+    using Base = container_mixin<priority_queue<T, Compare, Policy>, T, Policy>;
+    using Base::acquire_write_lock;
+    using Base::acquire_read_lock;
+
+public:
+    using Container = std::vector<T>;
+    using value_type = T;
+    using value_compare = Compare;
+    using size_type = typename std::vector<T>::size_type;
+    using reference = T&;
+    using const_reference = const T&;
+
+    // ==================== 构造函数 ====================
+
+    priority_queue() = default;
+
+    explicit priority_queue(const Compare& comp) : comp_(comp) {}
+
+    template <typename InputIt>
+    priority_queue(InputIt first, InputIt last, const Compare& comp = Compare())
+        : data_(first, last), comp_(comp) {
+        std::make_heap(data_.begin(), data_.end(), comp_);
+    }
+
+    priority_queue(std::initializer_list<T> init, const Compare& comp = Compare())
+        : priority_queue(init.begin(), init.end(), comp) {}
+
+    priority_queue(const priority_queue& other) : Base() {
+        auto guard = other.acquire_read_lock();
+        data_ = other.data_;
+        comp_ = other.comp_;
+    }
+
+    priority_queue& operator=(const priority_queue& other) {
+        if (this != &other) {
+            // 按地址顺序加锁：并发的 a = b 与 b = a 不会死锁
+            detail::with_both_locked(*this, other, [&] {
+                data_ = other.data_;
+                comp_ = other.comp_;
+            });
+        }
+        return *this;
+    }
+
+    priority_queue(priority_queue&& other) noexcept : Base() {
+        auto guard = other.acquire_write_lock();
+        data_ = std::move(other.data_);
+        comp_ = std::move(other.comp_);
+    }
+
+    priority_queue& operator=(priority_queue&& other) noexcept {
+        if (this != &other) {
+            detail::with_both_locked(*this, other, [&] {
+                data_ = std::move(other.data_);
+                comp_ = std::move(other.comp_);
+            });
+        }
+        return *this;
+    }
+
+    // ==================== 入队操作 ====================
+
+    void push(const T& value) {
+        auto guard = acquire_write_lock();
+        data_.push_back(value);
+        std::push_heap(data_.begin(), data_.end(), comp_);
+    }
+
+    void push(T&& value) {
+        auto guard = acquire_write_lock();
+        data_.push_back(std::move(value));
+        std::push_heap(data_.begin(), data_.end(), comp_);
+    }
+
+    template <typename... Args>
+    void emplace(Args&&... args) {
+        auto guard = acquire_write_lock();
+        data_.emplace_back(std::forward<Args>(args)...);
+        std::push_heap(data_.begin(), data_.end(), comp_);
+    }
+
+    /**
+     * @brief 一次加锁批量入队；新元素多于已有元素时整体重建堆（O(n)），否则逐个上浮
+     * @return 入队的元素个数
+     */
+    template <typename InputIt>
+    size_type push_bulk(InputIt first, InputIt last) {
+        auto guard = acquire_write_lock();
+        return detail::heap_append(data_, comp_, first, last);
+    }
+
+    size_type push_bulk(std::initializer_list<T> values) {
+        return push_bulk(values.begin(), values.end());
+    }
+
+    // ==================== 出队操作 ====================
+
+    /**
+     * @brief 非阻塞地取出堆顶
+     * @return 队列为空时返回 false，out 保持不变
+     */
+    bool try_pop(T& out) {
+        auto guard = acquire_write_lock();
+        if (data_.empty()) {
+            return false;
+        }
+        detail::heap_pop(data_, comp_, out);
+        return true;
+    }
+
+    /**
+     * @brief 仅当 pred(堆顶) 为 true 时取出堆顶（例如定时器"已到期才取出"），检查与取出在同一把锁内
+     * @return 是否取出了元素
+     */
+    template <typename Predicate>
+    bool try_pop_if(T& out, Predicate pred) {
+        auto guard = acquire_write_lock();
+        if (data_.empty() || !pred(static_cast<const T&>(data_.front()))) {
+            return false;
+        }
+        detail::heap_pop(data_, comp_, out);
+        return true;
+    }
+
+    /**
+     * @brief 一次加锁按优先级顺序取出最多 max_count 个元素
+     * @return 实际取出的元素个数
+     */
+    template <typename OutputIt>
+    size_type pop_n(OutputIt out, size_type max_count) {
+        auto guard = acquire_write_lock();
+        size_type n = 0;
+        for (; n < max_count && !data_.empty(); ++n) {
+            detail::heap_pop_out(data_, comp_, out);
+        }
+        return n;
+    }
+
+    /**
+     * @brief 一次加锁取出全部满足 pred(堆顶) 的元素（按优先级顺序），遇到第一个不满足的即停止
+     */
+    template <typename OutputIt, typename Predicate>
+    size_type pop_while(OutputIt out, Predicate pred) {
+        auto guard = acquire_write_lock();
+        size_type n = 0;
+        while (!data_.empty() && pred(static_cast<const T&>(data_.front()))) {
+            detail::heap_pop_out(data_, comp_, out);
+            ++n;
+        }
+        return n;
+    }
+
+    /**
+     * @brief 在锁内拷贝堆顶
+     * @return 队列为空时返回 false
+     */
+    bool try_top(T& out) const {
+        auto guard = acquire_read_lock();
+        if (data_.empty()) {
+            return false;
+        }
+        out = data_.front();
+        return true;
+    }
+
+    // ==================== 容量管理 ====================
+
+    size_type size() const {
+        auto guard = acquire_read_lock();
+        return data_.size();
+    }
+
+    bool empty() const {
+        auto guard = acquire_read_lock();
+        return data_.empty();
+    }
+
+    void reserve(size_type new_cap) {
+        auto guard = acquire_write_lock();
+        data_.reserve(new_cap);
+    }
+
+    void clear() {
+        auto guard = acquire_write_lock();
+        data_.clear();
+    }
+
+    /**
+     * @brief 在一次写锁内与 other 交换内容，换入的元素会重新建堆
+     */
+    void swap_out(std::vector<T>& other) {
+        auto guard = acquire_write_lock();
+        data_.swap(other);
+        std::make_heap(data_.begin(), data_.end(), comp_);
+    }
+
+    /**
+     * @brief 按优先级顺序返回全部元素的拷贝（堆顶在前）
+     */
+    std::vector<T> sorted_copy() const {
+        std::vector<T> out = this->copy();
+        std::sort_heap(out.begin(), out.end(), comp_);
+        std::reverse(out.begin(), out.end());
+        return out;
+    }
+
+    // ==================== 线程不安全接口 ====================
+
+    const T& unsafe_top() const {
+        return data_.front();
+    }
+
+    void unsafe_push(const T& value) {
+        data_.push_back(value);
+        std::push_heap(data_.begin(), data_.end(), comp_);
+    }
+
+    void unsafe_pop() {
+        std::pop_heap(data_.begin(), data_.end(), comp_);
+        data_.pop_back();
+    }
+};
+
+// ==================== Priority Queue 的 LockFree 特化版本 ====================
+
+template <typename T, typename Compare>
+class priority_queue<T, Compare, LockPolicy::LockFree> {
+private:
+    std::vector<T> data_;
+    Compare comp_;
+
+public:
+    using Container = std::vector<T>;
+    using value_type = T;
+    using value_compare = Compare;
+    using size_type = typename std::vector<T>::size_type;
+    using reference = T&;
+    using const_reference = const T&;
+
+    priority_queue() = default;
+
+    explicit priority_queue(const Compare& comp) : comp_(comp) {}
+
+    template <typename InputIt>
+    priority_queue(InputIt first, InputIt last, const Compare& comp = Compare())
+        : data_(first, last), comp_(comp) {
+        std::make_heap(data_.begin(), data_.end(), comp_);
+    }
+
+    priority_queue(std::initializer_list<T> init, const Compare& comp = Compare())
+        : priority_queue(init.begin(), init.end(), comp) {}
+
+    priority_queue(const priority_queue& other) = default;
+    priority_queue& operator=(const priority_queue& other) = default;
+    priority_queue(priority_queue&& other) noexcept = default;
+    priority_queue& operator=(priority_queue&& other) noexcept = default;
+
+    void push(const T& value) {
+        data_.push_back(value);
+        std::push_heap(data_.begin(), data_.end(), comp_);
+    }
+
+    void push(T&& value) {
+        data_.push_back(std::move(value));
+        std::push_heap(data_.begin(), data_.end(), comp_);
+    }
+
+    template <typename... Args>
+    void emplace(Args&&... args) {
+        data_.emplace_back(std::forward<Args>(args)...);
+        std::push_heap(data_.begin(), data_.end(), comp_);
+    }
+
+    template <typename InputIt>
+    size_type push_bulk(InputIt first, InputIt last) {
+        return detail::heap_append(data_, comp_, first, last);
+    }
+
+    size_type push_bulk(std::initializer_list<T> values) {
+        return push_bulk(values.begin(), values.end());
+    }
+
+    bool try_pop(T& out) {
+        if (data_.empty()) {
+            return false;
+        }
+        detail::heap_pop(data_, comp_, out);
+        return true;
+    }
+
+    template <typename Predicate>
+    bool try_pop_if(T& out, Predicate pred) {
+        if (data_.empty() || !pred(static_cast<const T&>(data_.front()))) {
+            return false;
+        }
+        detail::heap_pop(data_, comp_, out);
+        return true;
+    }
+
+    template <typename OutputIt>
+    size_type pop_n(OutputIt out, size_type max_count) {
+        size_type n = 0;
+        for (; n < max_count && !data_.empty(); ++n) {
+            detail::heap_pop_out(data_, comp_, out);
+        }
+        return n;
+    }
+
+    template <typename OutputIt, typename Predicate>
+    size_type pop_while(OutputIt out, Predicate pred) {
+        size_type n = 0;
+        while (!data_.empty() && pred(static_cast<const T&>(data_.front()))) {
+            detail::heap_pop_out(data_, comp_, out);
+            ++n;
+        }
+        return n;
+    }
+
+    bool try_top(T& out) const {
+        if (data_.empty()) {
+            return false;
+        }
+        out = data_.front();
+        return true;
+    }
+
+    const T& top() const {
+        return data_.front();
+    }
+
+    void pop() {
+        std::pop_heap(data_.begin(), data_.end(), comp_);
+        data_.pop_back();
+    }
+
+    size_type size() const noexcept {
+        return data_.size();
+    }
+
+    bool empty() const noexcept {
+        return data_.empty();
+    }
+
+    void reserve(size_type new_cap) {
+        data_.reserve(new_cap);
+    }
+
+    void clear() noexcept {
+        data_.clear();
+    }
+
+    void swap_out(std::vector<T>& other) {
+        data_.swap(other);
+        std::make_heap(data_.begin(), data_.end(), comp_);
+    }
+
+    std::vector<T> drain() {
+        std::vector<T> out;
+        data_.swap(out);
+        return out;
+    }
+
+    std::vector<T> sorted_copy() const {
+        std::vector<T> out = data_;
+        std::sort_heap(out.begin(), out.end(), comp_);
+        std::reverse(out.begin(), out.end());
+        return out;
+    }
+
+    std::vector<T>& get_unsafe() noexcept {
+        return data_;
+    }
+
+    const std::vector<T>& get_unsafe() const noexcept {
+        return data_;
+    }
+};
+
+/**
+ * @brief 松弛优先队列（MultiQueue）：N 个独立加锁的堆，出队时从随机两个堆中取较优的堆顶
+ * @tparam T 元素类型
+ * @tparam Compare 比较器，语义同 priority_queue
+ * @tparam Policy 每个堆使用的锁策略（默认使用互斥锁，不支持 LockFree）
+ *
+ * - push：随机选一个堆 try_lock，被占用就换一个，几轮都失败后才阻塞等待
+ * - try_pop：随机选两个非空的堆同时 try_lock，比较堆顶后从较优的堆取出；
+ *   随机尝试都落空时逐个扫描所有堆，因此只有在扫描时所有堆都为空才返回 false
+ * - 堆的数量默认取硬件线程数的两倍，各堆独占缓存行
+ *
+ * 不保证严格的优先级顺序：取出的元素"大概率接近"全局最优（堆数越多越松弛），
+ * 单个生产者按顺序入队的元素之间也可能乱序。适合调度器、定时器溢出桶等只需近似顺序、
+ * 但需要高并发吞吐的场景；需要严格顺序时请使用 priority_queue。
+ * size()/empty() 基于各堆的原子计数，并发修改时只是近似值。
+ */
+template <typename T, typename Compare = std::less<T>, LockPolicy Policy = LockPolicy::Mutex>
+class multi_priority_queue {
+    static_assert(Policy != LockPolicy::LockFree, "multi_priority_queue requires a locking policy");
+
+public:
+    using value_type = T;
+    using value_compare = Compare;
+    using size_type = std::size_t;
+
+private:
+    using mutex_type = typename LockGuard<Policy>::mutex_type;
+
+    struct alignas(cache_line_size) shard {
+        mutable mutex_type mutex;
+        std::vector<T> heap;
+        std::atomic<size_type> count{0};  // 堆中元素个数，供无锁地跳过空堆
+    };
+
+    // push 时 try_lock 失败后换堆重试的次数，之后阻塞等待
+    static constexpr int push_attempts = 4;
+    // try_pop 随机挑选两个堆的轮数，之后逐个扫描
+    static constexpr int pop_attempts = 8;
+
+    size_type shard_count_;
+    std::unique_ptr<shard[]> shards_;
+    Compare comp_;
+
+    static size_type default_queue_count() noexcept {
+        return std::max<size_type>(2, 2 * static_cast<size_type>(std::thread::hardware_concurrency()));
+    }
+
+    size_type random_index() const noexcept {
+        return static_cast<size_type>(detail::thread_random() % shard_count_);
+    }
+
+    // 调用方持有 s.mutex
+    void push_locked(shard& s, T&& value) {
+        s.heap.push_back(std::move(value));
+        std::push_heap(s.heap.begin(), s.heap.end(), comp_);
+        s.count.store(s.heap.size(), std::memory_order_relaxed);
+    }
+
+    // 弹出 s 的堆顶交给 sink；调用方持有 s.mutex
+    template <typename Sink>
+    void pop_locked(shard& s, Sink& sink) {
+        detail::heap_pop_to(s.heap, comp_, sink);
+        s.count.store(s.heap.size(), std::memory_order_relaxed);
+    }
+
+    // a 的堆顶是否比 b 的更优（空堆视为最差）；调用方持有两个堆的锁
+    bool better(const shard& a, const shard& b) const {
+        if (a.heap.empty()) {
+            return false;
+        }
+        return b.heap.empty() || comp_(b.heap.front(), a.heap.front());
+    }
+
+    void push_value(T&& value) {
+        for (int attempt = 0; attempt < push_attempts; ++attempt) {
+            shard& s = shards_[random_index()];
+            if (s.mutex.try_lock()) {
+                std::lock_guard<mutex_type> guard(s.mutex, std::adopt_lock);
+                push_locked(s, std::move(value));
+                return;
+            }
+        }
+        shard& s = shards_[random_index()];
+        std::lock_guard<mutex_type> guard(s.mutex);
+        push_locked(s, std::move(value));
+    }
+
+    // 同时 try_lock 两个不同的堆，取较优的堆顶；任一被占用或都为空时返回 false
+    template <typename Sink>
+    bool try_pop_pair(shard& a, shard& b, Sink& sink) {
+        if (!a.mutex.try_lock()) {
+            return false;
+        }
+        std::lock_guard<mutex_type> guard_a(a.mutex, std::adopt_lock);
+        if (!b.mutex.try_lock()) {
+            return false;
+        }
+        std::lock_guard<mutex_type> guard_b(b.mutex, std::adopt_lock);
+        if (a.heap.empty() && b.heap.empty()) {
+            return false;
+        }
+        pop_locked(better(a, b) ? a : b, sink);
+        return true;
+    }
+
+    template <typename Sink>
+    bool try_pop_single(shard& s, Sink& sink) {
+        if (!s.mutex.try_lock()) {
+            return false;
+        }
+        std::lock_guard<mutex_type> guard(s.mutex, std::adopt_lock);
+        if (s.heap.empty()) {
+            return false;
+        }
+        pop_locked(s, sink);
+        return true;
+    }
+
+    // 取出一个近似最优的元素交给 sink(T&&)；所有堆在扫描时都为空则返回 false
+    template <typename Sink>
+    bool pop_to(Sink&& sink) {
+        if (shard_count_ > 1) {
+            for (int attempt = 0; attempt < pop_attempts; ++attempt) {
+                const size_type i = random_index();
+                size_type j = random_index();
+                if (j == i) {
+                    j = (i + 1) % shard_count_;
+                }
+                shard& a = shards_[i];
+                shard& b = shards_[j];
+                const bool a_empty = a.count.load(std::memory_order_relaxed) == 0;
+                const bool b_empty = b.count.load(std::memory_order_relaxed) == 0;
+                if (a_empty && b_empty) {
+                    continue;
+                }
+                if (a_empty || b_empty) {
+                    if (try_pop_single(a_empty ? b : a, sink)) {
+                        return true;
+                    }
+                    continue;
+                }
+                if (try_pop_pair(a, b, sink)) {
+                    return true;
+                }
+            }
+        }
+        // 随机尝试都落空（多数堆为空或竞争激烈）：从随机位置起逐个阻塞加锁扫描
+        const size_type start = random_index();
+        for (size_type k = 0; k < shard_count_; ++k) {
+            shard& s = shards_[(start + k) % shard_count_];
+            if (s.count.load(std::memory_order_relaxed) == 0) {
+                continue;
+            }
+            std::lock_guard<mutex_type> guard(s.mutex);
+            if (!s.heap.empty()) {
+                pop_locked(s, sink);
+                return true;
+            }
+        }
+        return false;
+    }
+
+public:
+    // ==================== 构造函数 ====================
+
+    /**
+     * @brief 构造松弛优先队列
+     * @param queue_count 内部堆的数量，0 表示取硬件线程数的两倍（至少为 2）
+     */
+    explicit multi_priority_queue(size_type queue_count = 0, const Compare& comp = Compare())
+        : shard_count_(queue_count == 0 ? default_queue_count() : queue_count),
+          shards_(new shard[shard_count_]),
+          comp_(comp) {}
+
+    // 各堆的锁内嵌在对象中，不可复制不可移动
+    multi_priority_queue(const multi_priority_queue&) = delete;
+    multi_priority_queue& operator=(const multi_priority_queue&) = delete;
+
+    /**
+     * @brief 内部堆的数量
+     */
+    size_type queue_count() const noexcept {
+        return shard_count_;
+    }
+
+    // ==================== 入队操作 ====================
+
+    void push(const T& value) {
+        push_value(T(value));
+    }
+
+    void push(T&& value) {
+        push_value(std::move(value));
+    }
+
+    template <typename... Args>
+    void emplace(Args&&... args) {
+        push_value(T(std::forward<Args>(args)...));
+    }
+
+    /**
+     * @brief 批量入队：元素按顺序切成最多 queue_count() 段，从随机的堆开始每段一次加锁
+     * @return 入队的元素个数
+     */
+    template <typename InputIt>
+    size_type push_bulk(InputIt first, InputIt last) {
+        std::vector<T> batch(first, last);
+        const size_type total = batch.size();
+        const size_type parts = std::min(total, shard_count_);
+        const size_type start = random_index();
+        for (size_type k = 0; k < parts; ++k) {
+            auto begin = batch.begin() + static_cast<std::ptrdiff_t>(k * total / parts);
+            auto end = batch.begin() + static_cast<std::ptrdiff_t>((k + 1) * total / parts);
+            shard& s = shards_[(start + k) % shard_count_];
+            std::lock_guard<mutex_type> guard(s.mutex);
+            detail::heap_append(s.heap, comp_, std::make_move_iterator(begin), std::make_move_iterator(end));
+            s.count.store(s.heap.size(), std::memory_order_relaxed);
+        }
+        return total;
+    }
+
+    size_type push_bulk(std::initializer_list<T> values) {
+        return push_bulk(values.begin(), values.end());
+    }
+
+    // ==================== 出队操作 ====================
+
+    /**
+     * @brief 取出一个近似最优的元素
+     * @return 所有堆在扫描时都为空则返回 false，out 保持不变
+     */
+    bool try_pop(T& out) {
+        return pop_to([&out](T&& value) { out = std::move(value); });
+    }
+
+    /**
+     * @brief 连续取出最多 max_count 个近似最优的元素
+     * @return 实际取出的元素个数
+     */
+    template <typename OutputIt>
+    size_type pop_n(OutputIt out, size_type max_count) {
+        size_type n = 0;
+        while (n < max_count && pop_to([&out](T&& value) { *out = std::move(value); })) {
+            ++out;
+            ++n;
+        }
+        return n;
+    }
+
+    // ==================== 容量管理 ====================
+
+    /**
+     * @brief 各堆元素个数之和（并发修改时为近似值）
+     */
+    size_type size() const noexcept {
+        size_type total = 0;
+        for (size_type i = 0; i < shard_count_; ++i) {
+            total += shards_[i].count.load(std::memory_order_relaxed);
+        }
+        return total;
+    }
+
+    bool empty() const noexcept {
+        for (size_type i = 0; i < shard_count_; ++i) {
+            if (shards_[i].count.load(std::memory_order_relaxed) != 0) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    void clear() {
+        for (size_type i = 0; i < shard_count_; ++i) {
+            std::lock_guard<mutex_type> guard(shards_[i].mutex);
+            shards_[i].heap.clear();
+            shards_[i].count.store(0, std::memory_order_relaxed);
+        }
+    }
+
+    /**
+     * @brief 逐个堆加锁取走全部元素，返回按优先级排序的结果（堆顶在前）；不是全局原子快照
+     */
+    std::vector<T> drain() {
+        std::vector<T> out;
+        for (size_type i = 0; i < shard_count_; ++i) {
+            std::lock_guard<mutex_type> guard(shards_[i].mutex);
+            std::move(shards_[i].heap.begin(), shards_[i].heap.end(), std::back_inserter(out));
+            shards_[i].heap.clear();
+            shards_[i].count.store(0, std::memory_order_relaxed);
+        }
+        std::sort(out.begin(), out.end(), [this](const T& a, const T& b) { return comp_(b, a); });
+        return out;
+    }
+};
+
+} // namespace ts_stl
+
+#endif // TS_PRIORITY_QUEUE_HPP
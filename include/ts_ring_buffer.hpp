@@ -0,0 +1,444 @@
+#pragma once
+
+#ifndef TS_RING_BUFFER_HPP
+#define TS_RING_BUFFER_HPP
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "ts_stl_base.hpp"
+
+namespace ts_stl {
+
+namespace detail {
+
+/**
+ * @brief 把容量向上取整到2的幂（至少为 min_capacity）
+ */
+inline std::size_t ring_round_up_pow2(std::size_t n, std::size_t min_capacity) {
+    if (n < min_capacity) {
+        n = min_capacity;
+    }
+    std::size_t cap = 1;
+    while (cap < n) {
+        if (cap > (static_cast<std::size_t>(-1) >> 1)) {
+            throw std::length_error("ring buffer capacity too large");
+        }
+        cap <<= 1;
+    }
+    return cap;
+}
+
+/**
+ * @brief 未初始化的元素存储槽
+ */
+template <typename T>
+struct ring_slot {
+    alignas(T) unsigned char bytes[sizeof(T)];
+
+    T* ptr() noexcept {
+        return std::launder(reinterpret_cast<T*>(bytes));
+    }
+
+    template <typename... Args>
+    void construct(Args&&... args) {
+        ::new (static_cast<void*>(bytes)) T(std::forward<Args>(args)...);
+    }
+
+    void destroy() noexcept {
+        ptr()->~T();
+    }
+};
+
+} // namespace detail
+
+/**
+ * @brief 单生产者单消费者无锁环形缓冲区
+ * @tparam T 元素类型
+ *
+ * 固定容量（向上取整到2的幂），生产者只写 tail、消费者只写 head，
+ * 两者各自位于独立的缓存行，并缓存对方的位置以减少跨核读取。
+ *
+ * 注意：同一时刻只能有一个线程调用 push 系列接口、一个线程调用 pop 系列接口。
+ */
+template <typename T>
+class spsc_ring_buffer {
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+
+private:
+    using slot_type = detail::ring_slot<T>;
+
+    // 消费者侧：head 由消费者写，cached_tail 为消费者看到的最近 tail
+    struct alignas(cache_line_size) consumer_state {
+        std::atomic<size_type> head{0};
+        size_type cached_tail = 0;
+    };
+
+    // 生产者侧：tail 由生产者写，cached_head 为生产者看到的最近 head
+    struct alignas(cache_line_size) producer_state {
+        std::atomic<size_type> tail{0};
+        size_type cached_head = 0;
+    };
+
+    consumer_state consumer_;
+    producer_state producer_;
+    size_type capacity_;
+    size_type mask_;
+    std::unique_ptr<slot_type[]> slots_;
+
+    // 生产者侧可用空间，空间不足 needed 时重新读取 head
+    size_type free_slots(size_type tail, size_type needed) {
+        size_type free = capacity_ - (tail - producer_.cached_head);
+        if (free < needed) {
+            producer_.cached_head = consumer_.head.load(std::memory_order_acquire);
+            free = capacity_ - (tail - producer_.cached_head);
+        }
+        return free;
+    }
+
+    // 消费者侧可读元素数，不足 needed 时重新读取 tail
+    size_type ready_slots(size_type head, size_type needed) {
+        size_type ready = consumer_.cached_tail - head;
+        if (ready < needed) {
+            consumer_.cached_tail = producer_.tail.load(std::memory_order_acquire);
+            ready = consumer_.cached_tail - head;
+        }
+        return ready;
+    }
+
+public:
+    // ==================== 构造函数 ====================
+
+    /**
+     * @brief 构造环形缓冲区
+     * @param capacity 期望容量，实际容量向上取整到2的幂
+     */
+    explicit spsc_ring_buffer(size_type capacity)
+        : capacity_(detail::ring_round_up_pow2(capacity, 1)),
+          mask_(capacity_ - 1),
+          slots_(new slot_type[capacity_]) {}
+
+    spsc_ring_buffer(const spsc_ring_buffer&) = delete;
+    spsc_ring_buffer& operator=(const spsc_ring_buffer&) = delete;
+
+    ~spsc_ring_buffer() {
+        size_type head = consumer_.head.load(std::memory_order_relaxed);
+        size_type tail = producer_.tail.load(std::memory_order_relaxed);
+        for (; head != tail; ++head) {
+            slots_[head & mask_].destroy();
+        }
+    }
+
+    // ==================== 生产者接口 ====================
+
+    /**
+     * @brief 原地构造元素，缓冲区满时返回 false
+     */
+    template <typename... Args>
+    bool try_emplace(Args&&... args) {
+        size_type tail = producer_.tail.load(std::memory_order_relaxed);
+        if (free_slots(tail, 1) == 0) {
+            return false;
+        }
+        slots_[tail & mask_].construct(std::forward<Args>(args)...);
+        producer_.tail.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool try_push(const T& value) {
+        return try_emplace(value);
+    }
+
+    bool try_push(T&& value) {
+        return try_emplace(std::move(value));
+    }
+
+    /**
+     * @brief 批量写入最多 count 个元素，只发布一次 tail
+     * @return 实际写入的元素个数
+     */
+    template <typename InputIt>
+    size_type try_push_n(InputIt first, size_type count) {
+        size_type tail = producer_.tail.load(std::memory_order_relaxed);
+        size_type n = std::min(count, free_slots(tail, count));
+        size_type i = 0;
+        try {
+            for (; i < n; ++i, ++first) {
+                slots_[(tail + i) & mask_].construct(*first);
+            }
+        } catch (...) {
+            producer_.tail.store(tail + i, std::memory_order_release);
+            throw;
+        }
+        producer_.tail.store(tail + n, std::memory_order_release);
+        return n;
+    }
+
+    // ==================== 消费者接口 ====================
+
+    /**
+     * @brief 取出一个元素，缓冲区空时返回 false
+     */
+    bool try_pop(T& out) {
+        size_type head = consumer_.head.load(std::memory_order_relaxed);
+        if (ready_slots(head, 1) == 0) {
+            return false;
+        }
+        slot_type& slot = slots_[head & mask_];
+        out = std::move(*slot.ptr());
+        slot.destroy();
+        consumer_.head.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief 批量取出最多 max_count 个元素，只发布一次 head
+     * @return 实际取出的元素个数
+     */
+    template <typename OutputIt>
+    size_type try_pop_n(OutputIt out, size_type max_count) {
+        size_type head = consumer_.head.load(std::memory_order_relaxed);
+        size_type n = std::min(max_count, ready_slots(head, max_count));
+        size_type i = 0;
+        try {
+            for (; i < n; ++i, ++out) {
+                slot_type& slot = slots_[(head + i) & mask_];
+                *out = std::move(*slot.ptr());
+                slot.destroy();
+            }
+        } catch (...) {
+            // 已取出的元素已销毁，发布到 i 为止；抛出异常的元素仍留在缓冲区中
+            consumer_.head.store(head + i, std::memory_order_release);
+            throw;
+        }
+        consumer_.head.store(head + n, std::memory_order_release);
+        return n;
+    }
+
+    // ==================== 容量查询 ====================
+
+    /**
+     * @brief 当前元素个数（并发修改时为近似值）
+     */
+    size_type size() const noexcept {
+        size_type tail = producer_.tail.load(std::memory_order_acquire);
+        size_type head = consumer_.head.load(std::memory_order_acquire);
+        return tail - head;
+    }
+
+    bool empty() const noexcept {
+        return size() == 0;
+    }
+
+    size_type capacity() const noexcept {
+        return capacity_;
+    }
+};
+
+/**
+ * @brief 多生产者多消费者无锁环形缓冲区（Vyukov 有界队列）
+ * @tparam T 元素类型
+ *
+ * 每个槽位带一个序号：生产者通过 CAS 推进 enqueue 位置后写入并发布序号，
+ * 消费者同理推进 dequeue 位置。入队/出队位置各占一条缓存行。
+ *
+ * 异常安全：槽位一旦被 CAS 占用就必须发布，否则后续的消费者会永远停在该槽位上。
+ * 因此要求 T 的移动构造不抛异常；构造可能抛异常时先在占用槽位前构造临时对象再移入。
+ * 出队时向 out 赋值抛出异常的话，该元素被丢弃（已销毁），槽位照常释放，异常继续传播。
+ */
+template <typename T>
+class mpmc_ring_buffer {
+    static_assert(std::is_nothrow_move_constructible_v<T>,
+                  "mpmc_ring_buffer requires a nothrow move constructible element type");
+
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+
+private:
+    struct cell {
+        std::atomic<size_type> sequence;
+        detail::ring_slot<T> slot;
+    };
+
+    using difference_type = std::intptr_t;
+
+    // 出队时无论 sink 是否抛出异常，都销毁元素并把槽位交还给生产者
+    struct cell_releaser {
+        cell* c;
+        size_type next_sequence;
+
+        ~cell_releaser() {
+            c->slot.destroy();
+            c->sequence.store(next_sequence, std::memory_order_release);
+        }
+    };
+
+    alignas(cache_line_size) std::atomic<size_type> enqueue_pos_{0};
+    alignas(cache_line_size) std::atomic<size_type> dequeue_pos_{0};
+    alignas(cache_line_size) size_type capacity_;
+    size_type mask_;
+    std::unique_ptr<cell[]> cells_;
+
+    // 调用方保证以 args 构造 T 不抛异常：槽位一经 CAS 占用就一定会被发布
+    template <typename... Args>
+    bool emplace_nothrow(Args&&... args) noexcept {
+        size_type pos = enqueue_pos_.load(std::memory_order_relaxed);
+        cell* c;
+        for (;;) {
+            c = &cells_[pos & mask_];
+            size_type seq = c->sequence.load(std::memory_order_acquire);
+            difference_type diff = static_cast<difference_type>(seq) - static_cast<difference_type>(pos);
+            if (diff == 0) {
+                if (enqueue_pos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = enqueue_pos_.load(std::memory_order_relaxed);
+            }
+        }
+        c->slot.construct(std::forward<Args>(args)...);
+        c->sequence.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    // 占用一个可读槽位并把元素以右值交给 sink；缓冲区空时返回 false
+    template <typename Sink>
+    bool consume(Sink&& sink) {
+        size_type pos = dequeue_pos_.load(std::memory_order_relaxed);
+        cell* c;
+        for (;;) {
+            c = &cells_[pos & mask_];
+            size_type seq = c->sequence.load(std::memory_order_acquire);
+            difference_type diff = static_cast<difference_type>(seq) - static_cast<difference_type>(pos + 1);
+            if (diff == 0) {
+                if (dequeue_pos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = dequeue_pos_.load(std::memory_order_relaxed);
+            }
+        }
+        cell_releaser release{c, pos + mask_ + 1};
+        sink(std::move(*c->slot.ptr()));
+        return true;
+    }
+
+public:
+    // ==================== 构造函数 ====================
+
+    /**
+     * @brief 构造环形缓冲区
+     * @param capacity 期望容量，实际容量向上取整到2的幂（至少为2）
+     */
+    explicit mpmc_ring_buffer(size_type capacity)
+        : capacity_(detail::ring_round_up_pow2(capacity, 2)),
+          mask_(capacity_ - 1),
+          cells_(new cell[capacity_]) {
+        for (size_type i = 0; i < capacity_; ++i) {
+            cells_[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    mpmc_ring_buffer(const mpmc_ring_buffer&) = delete;
+    mpmc_ring_buffer& operator=(const mpmc_ring_buffer&) = delete;
+
+    ~mpmc_ring_buffer() {
+        size_type head = dequeue_pos_.load(std::memory_order_relaxed);
+        size_type tail = enqueue_pos_.load(std::memory_order_relaxed);
+        for (; head != tail; ++head) {
+            cells_[head & mask_].slot.destroy();
+        }
+    }
+
+    // ==================== 生产者接口 ====================
+
+    /**
+     * @brief 原地构造元素，缓冲区满时返回 false
+     */
+    template <typename... Args>
+    bool try_emplace(Args&&... args) {
+        if constexpr (!std::is_nothrow_constructible_v<T, Args&&...>) {
+            // 构造可能抛异常：先构造临时对象，占用槽位后只做不抛异常的移动构造
+            T value(std::forward<Args>(args)...);
+            return try_emplace(std::move(value));
+        } else {
+            return emplace_nothrow(std::forward<Args>(args)...);
+        }
+    }
+
+    bool try_push(const T& value) {
+        return try_emplace(value);
+    }
+
+    bool try_push(T&& value) {
+        return try_emplace(std::move(value));
+    }
+
+    /**
+     * @brief 连续写入最多 count 个元素，遇到缓冲区满即停止
+     * @return 实际写入的元素个数
+     */
+    template <typename InputIt>
+    size_type try_push_n(InputIt first, size_type count) {
+        size_type n = 0;
+        for (; n < count && try_emplace(*first); ++n, ++first) {
+        }
+        return n;
+    }
+
+    // ==================== 消费者接口 ====================
+
+    /**
+     * @brief 取出一个元素，缓冲区空时返回 false
+     */
+    bool try_pop(T& out) {
+        return consume([&out](T&& value) { out = std::move(value); });
+    }
+
+    /**
+     * @brief 连续取出最多 max_count 个元素，遇到缓冲区空即停止
+     * @return 实际取出的元素个数
+     */
+    template <typename OutputIt>
+    size_type try_pop_n(OutputIt out, size_type max_count) {
+        size_type n = 0;
+        for (; n < max_count && consume([&out](T&& value) { *out = std::move(value); }); ++n, ++out) {
+        }
+        return n;
+    }
+
+    // ==================== 容量查询 ====================
+
+    /**
+     * @brief 当前元素个数（并发修改时为近似值）
+     */
+    size_type size() const noexcept {
+        size_type tail = enqueue_pos_.load(std::memory_order_acquire);
+        size_type head = dequeue_pos_.load(std::memory_order_acquire);
+        return tail > head ? tail - head : 0;
+    }
+
+    bool empty() const noexcept {
+        return size() == 0;
+    }
+
+    size_type capacity() const noexcept {
+        return capacity_;
+    }
+};
+
+} // namespace ts_stl
+
+#endif // TS_RING_BUFFER_HPP
@@ -0,0 +1,290 @@
+#pragma once
+
+#ifndef TS_SEQLOCK_HPP
+#define TS_SEQLOCK_HPP
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <type_traits>
+
+#include "ts_stl_base.hpp"
+
+namespace ts_stl {
+
+/**
+ * @brief 顺序锁（SeqLock）原语
+ *
+ * 写者把序号从偶数推进到奇数、修改数据、再推进到下一个偶数；
+ * 读者不写任何共享状态，只在读取前后比较序号，序号为奇数或前后不一致时重试。
+ * 写者之间通过对序号的 CAS 互斥。
+ */
+class SeqLock {
+public:
+    using sequence_type = std::uint64_t;
+
+    SeqLock() = default;
+
+    SeqLock(const SeqLock&) = delete;
+    SeqLock& operator=(const SeqLock&) = delete;
+
+    // ==================== 写者接口 ====================
+
+    void lock() noexcept {
+        sequence_type seq = seq_.load(std::memory_order_relaxed);
+        for (;;) {
+            if ((seq & 1) == 0 &&
+                seq_.compare_exchange_weak(seq, seq + 1, std::memory_order_acquire,
+                                           std::memory_order_relaxed)) {
+                break;
+            }
+            cpu_relax();
+            seq = seq_.load(std::memory_order_relaxed);
+        }
+        // 保证读者看到新数据时一定能看到奇数序号
+        std::atomic_thread_fence(std::memory_order_release);
+    }
+
+    void unlock() noexcept {
+        seq_.fetch_add(1, std::memory_order_release);
+    }
+
+    // ==================== 读者接口 ====================
+
+    /**
+     * @brief 开始一次乐观读，等待正在进行的写入结束
+     * @return 读取前的序号，传给 read_retry()
+     */
+    sequence_type read_begin() const noexcept {
+        sequence_type seq = seq_.load(std::memory_order_acquire);
+        while (seq & 1) {
+            cpu_relax();
+            seq = seq_.load(std::memory_order_acquire);
+        }
+        return seq;
+    }
+
+    /**
+     * @brief 检查乐观读期间是否发生了写入
+     * @return 需要重试时返回 true
+     */
+    bool read_retry(sequence_type seq) const noexcept {
+        std::atomic_thread_fence(std::memory_order_acquire);
+        return seq_.load(std::memory_order_relaxed) != seq;
+    }
+
+    /**
+     * @brief 当前序号（每次写入加2）
+     */
+    sequence_type sequence() const noexcept {
+        return seq_.load(std::memory_order_acquire);
+    }
+
+private:
+    std::atomic<sequence_type> seq_{0};
+};
+
+/**
+ * @brief 基于顺序锁的单值容器
+ * @tparam T 值类型（必须可平凡复制）
+ *
+ * 读操作不修改任何共享缓存行，读者数量增加时不会产生读者计数的缓存行争用，
+ * 适合频繁读取、偶尔更新的小型配置或统计快照。
+ *
+ * 数据按 64 位字存放在原子变量中（relaxed 访问），乐观读与写入并发时
+ * 不构成数据竞争；读到的撕裂值会因序号不匹配而被丢弃。
+ */
+template <typename T>
+class seqlock {
+    static_assert(std::is_trivially_copyable<T>::value, "seqlock requires a trivially copyable type");
+    static_assert(std::is_default_constructible<T>::value, "seqlock requires a default constructible type");
+
+public:
+    using value_type = T;
+
+private:
+    using word_type = std::uint64_t;
+    static constexpr std::size_t word_count = (sizeof(T) + sizeof(word_type) - 1) / sizeof(word_type);
+
+    SeqLock lock_;
+    std::array<std::atomic<word_type>, word_count> words_;
+
+    void store_words(const T& value) noexcept {
+        word_type buffer[word_count] = {};
+        std::memcpy(buffer, &value, sizeof(T));
+        for (std::size_t i = 0; i < word_count; ++i) {
+            words_[i].store(buffer[i], std::memory_order_relaxed);
+        }
+    }
+
+    T load_words() const noexcept {
+        word_type buffer[word_count];
+        for (std::size_t i = 0; i < word_count; ++i) {
+            buffer[i] = words_[i].load(std::memory_order_relaxed);
+        }
+        T value;
+        std::memcpy(&value, buffer, sizeof(T));
+        return value;
+    }
+
+public:
+    // ==================== 构造函数 ====================
+
+    seqlock() noexcept : seqlock(T()) {}
+
+    explicit seqlock(const T& value) noexcept {
+        store_words(value);
+    }
+
+    seqlock(const seqlock& other) noexcept : seqlock(other.load()) {}
+
+    seqlock& operator=(const seqlock& other) noexcept {
+        if (this != &other) {
+            store(other.load());
+        }
+        return *this;
+    }
+
+    // ==================== 读写接口 ====================
+
+    /**
+     * @brief 乐观读取当前值，与写入冲突时自动重试
+     */
+    T load() const noexcept {
+        for (;;) {
+            auto seq = lock_.read_begin();
+            T value = load_words();
+            if (!lock_.read_retry(seq)) {
+                return value;
+            }
+        }
+    }
+
+    T get() const noexcept {
+        return load();
+    }
+
+    operator T() const noexcept {
+        return load();
+    }
+
+    void store(const T& value) noexcept {
+        lock_.lock();
+        store_words(value);
+        lock_.unlock();
+    }
+
+    void set(const T& value) noexcept {
+        store(value);
+    }
+
+    /**
+     * @brief 在写锁内读-改-写：func(T&) 修改当前值的副本后写回
+     */
+    template <typename Func>
+    void update(Func func) {
+        lock_.lock();
+        T value = load_words();
+        try {
+            func(value);
+        } catch (...) {
+            lock_.unlock();
+            throw;
+        }
+        store_words(value);
+        lock_.unlock();
+    }
+
+    /**
+     * @brief 写入次数对应的版本号
+     */
+    SeqLock::sequence_type version() const noexcept {
+        return lock_.sequence() / 2;
+    }
+};
+
+/**
+ * @brief 固定大小的顺序锁数组（每个元素独立的序号）
+ * @tparam T 元素类型（必须可平凡复制）
+ * @tparam N 元素个数
+ *
+ * 提供与其他容器一致的 get/at/operator[]（按值返回）与 set 接口。
+ * 容量固定、不会重新分配，因此乐观读永远不会访问已释放的内存。
+ */
+template <typename T, std::size_t N>
+class seqlock_array {
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+
+private:
+    std::array<seqlock<T>, N> data_;
+
+public:
+    seqlock_array() = default;
+
+    // ==================== 元素访问 ====================
+
+    T operator[](size_type index) const noexcept {
+        return data_[index].load();
+    }
+
+    T at(size_type index) const {
+        if (index >= N) {
+            throw std::out_of_range("seqlock_array::at index out of range");
+        }
+        return data_[index].load();
+    }
+
+    T get(size_type index, const T& default_value = T()) const noexcept {
+        if (index < N) {
+            return data_[index].load();
+        }
+        return default_value;
+    }
+
+    void set(size_type index, const T& value) noexcept {
+        if (index < N) {
+            data_[index].store(value);
+        }
+    }
+
+    template <typename Func>
+    void update(size_type index, Func func) {
+        data_.at(index).update(func);
+    }
+
+    // ==================== 容量与遍历 ====================
+
+    static constexpr size_type size() noexcept {
+        return N;
+    }
+
+    static constexpr bool empty() noexcept {
+        return N == 0;
+    }
+
+    /**
+     * @brief 逐个元素乐观读取并回调（各元素分别一致，整体不是原子快照）
+     */
+    template <typename Func>
+    void for_each(Func func) const {
+        for (const auto& item : data_) {
+            func(item.load());
+        }
+    }
+
+    std::array<T, N> copy() const noexcept {
+        std::array<T, N> result;
+        for (size_type i = 0; i < N; ++i) {
+            result[i] = data_[i].load();
+        }
+        return result;
+    }
+};
+
+} // namespace ts_stl
+
+#endif // TS_SEQLOCK_HPP
@@ -3,6 +3,8 @@
 #ifndef TS_SET_HPP
 #define TS_SET_HPP
 
+#include <limits>
+#include <optional>
 #include <set>
 
 #include "ts_stl_base.hpp"
@@ -15,30 +17,37 @@ namespace ts_stl {
  * @tparam Compare 比较器（默认使用std::less）
  * @tparam Policy 锁策略（默认使用互斥锁）
  */
-template <typename Key, typename Compare = std::less<Key>, LockPolicy Policy = LockPolicy::Mutex>
-class set : public container_mixin<set<Key, Compare, Policy>, Key, Policy> {
+template <typename Key, typename Compare = std::less<Key>, LockPolicy Policy = LockPolicy::Mutex,
+          typename Allocator = std::allocator<Key>>
+class set : public container_mixin<set<Key, Compare, Policy, Allocator>, Key, Policy> {
 private:
-    friend class container_mixin<set<Key, Compare, Policy>, Key, Policy>;
+    friend class container_mixin<set<Key, Compare, Policy, Allocator>, Key, Policy>;
 
-    std::set<Key, Compare> data_;
+    std::set<Key, Compare, Allocator> data_;
 
-    using Base = container_mixin<set<Key, Compare, Policy>, Key, Policy>;
+    using Base = container_mixin<set<Key, Compare, Policy, Allocator>, Key, Policy>;
     using Base::acquire_write_lock;
     using Base::acquire_read_lock;
 
 public:
-    using Container = std::set<Key, Compare>;
+    using Container = std::set<Key, Compare, Allocator>;
     using value_type = Key;
-    using size_type = typename std::set<Key, Compare>::size_type;
-    using iterator = typename std::set<Key, Compare>::iterator;
-    using const_iterator = typename std::set<Key, Compare>::const_iterator;
+    using allocator_type = Allocator;
+    using size_type = typename std::set<Key, Compare, Allocator>::size_type;
+    using iterator = typename std::set<Key, Compare, Allocator>::iterator;
+    using const_iterator = typename std::set<Key, Compare, Allocator>::const_iterator;
+    using node_type = typename std::set<Key, Compare, Allocator>::node_type;
 
     // ==================== 构造函数 ====================
 
     set() : Base() {}
 
+    explicit set(const Allocator& alloc) : Base(), data_(alloc) {}
+
+    set(const Compare& comp, const Allocator& alloc) : Base(), data_(comp, alloc) {}
+
     explicit set(const Compare& comp) : Base() {
-        data_ = std::set<Key, Compare>(comp);
+        data_ = std::set<Key, Compare, Allocator>(comp);
     }
 
     template <typename InputIt>
@@ -101,6 +110,113 @@ public:
         return data_.count(key);
     }
 
+    // ==================== 异构查找（透明比较器） ====================
+
+    /**
+     * @brief 以任意可与 Key 比较的类型查找（需要 Compare::is_transparent，如 std::less<>）
+     *
+     * 例如 key 为 std::string 时可直接传入 std::string_view，避免构造临时字符串
+     */
+    template <typename K, typename C = Compare, detail::enable_if_transparent_t<C> = 0>
+    bool contains(const K& key) const {
+        auto guard = acquire_read_lock();
+        return data_.find(key) != data_.end();
+    }
+
+    template <typename K, typename C = Compare, detail::enable_if_transparent_t<C> = 0>
+    size_type count(const K& key) const {
+        auto guard = acquire_read_lock();
+        return data_.count(key);
+    }
+
+    // ==================== 区间查询（读锁内按序扫描） ====================
+
+    /**
+     * @brief 第一个不小于 key 的元素，不存在时返回 std::nullopt
+     */
+    std::optional<Key> lower_bound_key(const Key& key) const {
+        auto guard = acquire_read_lock();
+        auto it = data_.lower_bound(key);
+        if (it == data_.end()) {
+            return std::nullopt;
+        }
+        return *it;
+    }
+
+    /**
+     * @brief 第一个大于 key 的元素，不存在时返回 std::nullopt
+     */
+    std::optional<Key> upper_bound_key(const Key& key) const {
+        auto guard = acquire_read_lock();
+        auto it = data_.upper_bound(key);
+        if (it == data_.end()) {
+            return std::nullopt;
+        }
+        return *it;
+    }
+
+    /**
+     * @brief 在读锁内按升序对 [lo, hi) 内的元素执行 func(const Key&)
+     *
+     * 只访问区间内的元素（O(log n + k)）；func 返回 bool 时，返回 false 即停止扫描
+     * @return 访问的元素个数
+     */
+    template <typename Func>
+    size_type range(const Key& lo, const Key& hi, Func func) const {
+        auto guard = acquire_read_lock();
+        auto comp = data_.key_comp();
+        return detail::scan_while(
+            data_.lower_bound(lo), data_.end(), [&](const Key& item) { return comp(item, hi); },
+            [&](const Key& item) { return detail::invoke_continue(func, item); });
+    }
+
+    /**
+     * @brief 把 [lo, hi) 内至多 limit 个元素按升序写入 out
+     * @return 写入的元素个数
+     */
+    template <typename OutputIt>
+    size_type collect_range(const Key& lo, const Key& hi, OutputIt out,
+                            size_type limit = std::numeric_limits<size_type>::max()) const {
+        if (limit == 0) {
+            return 0;
+        }
+        size_type written = 0;
+        range(lo, hi, [&](const Key& item) {
+            *out = item;
+            ++out;
+            return ++written < limit;
+        });
+        return written;
+    }
+
+    /**
+     * @brief 在读锁内按序对以 prefix 开头的元素执行 func(const Key&)（字符串类键、字典序比较器）
+     * @return 访问的元素个数
+     */
+    template <typename Func>
+    size_type prefix_scan(const Key& prefix, Func func) const {
+        auto guard = acquire_read_lock();
+        return detail::scan_while(
+            data_.lower_bound(prefix), data_.end(),
+            [&prefix](const Key& item) { return detail::key_has_prefix(item, prefix); },
+            [&](const Key& item) { return detail::invoke_continue(func, item); });
+    }
+
+    template <typename OutputIt>
+    size_type collect_prefix(const Key& prefix, OutputIt out,
+                             size_type limit = std::numeric_limits<size_type>::max()) const {
+        if (limit == 0) {
+            return 0;
+        }
+        size_type written = 0;
+        prefix_scan(prefix, [&](const Key& item) {
+            *out = item;
+            ++out;
+            return ++written < limit;
+        });
+        return written;
+    }
+
     // ==================== 修改操作 ====================
 
     std::pair<iterator, bool> insert(const Key& key) {
@@ -134,21 +250,113 @@ public:
         data_.erase(first, last);
     }
 
+    // ==================== 节点迁移（C++17 extract / merge） ====================
+
+    /**
+     * @brief 在写锁内摘下键对应的节点，键不存在时返回空节点
+     *
+     * 节点句柄持有元素本身，插入另一个分配器相同的容器时不复制、不重新分配
+     */
+    node_type extract(const Key& key) {
+        auto guard = acquire_write_lock();
+        return data_.extract(key);
+    }
+
+    /**
+     * @brief 在写锁内插入 extract() 得到的节点
+     * @return 插入成功返回 true，节点被容器接管；键已存在时返回 false，节点仍归调用方所有
+     * @note 分配器不相等（不同 pmr 内存资源）时退化为按值移动插入
+     */
+    bool insert_node(node_type& node) {
+        auto guard = acquire_write_lock();
+        return detail::insert_node_handle(data_, node);
+    }
+
+    bool insert_node(node_type&& node) {
+        return insert_node(node);
+    }
+
+    /**
+     * @brief 把 source 中本容器没有的键迁移过来（如热数据层迁往冷数据层），source 可以使用任意锁策略
+     * @return 迁移的元素个数；键已存在的元素留在 source 中
+     *
+     * 两个容器按地址顺序同时加写锁，反方向并发迁移不会死锁。
+     * 分配器相等时只重新链接节点，不分配内存；否则逐个移动元素。
+     */
+    template <typename Compare2, LockPolicy SourcePolicy>
+    size_type merge_from(set<Key, Compare2, SourcePolicy, Allocator>& source) {
+        if (static_cast<const void*>(&source) == static_cast<const void*>(this)) {
+            return 0;
+        }
+        return detail::with_both_locked(*this, source, [&] {
+            return static_cast<size_type>(detail::merge_nodes(data_, detail::raw_container(source)));
+        });
+    }
+
+    // ==================== 批量操作（单次加锁） ====================
+
+    /**
+     * @brief 批量插入键（只加锁一次），已存在的键保持不变
+     *
+     * 以 end() 作为插入提示，已升序排列的输入每个元素摊还 O(1)
+     * @return 新插入的元素个数
+     */
+    template <typename InputIt>
+    size_type insert_bulk(InputIt first, InputIt last) {
+        auto guard = acquire_write_lock();
+        size_type before = data_.size();
+        for (; first != last; ++first) {
+            data_.emplace_hint(data_.end(), *first);
+        }
+        return data_.size() - before;
+    }
+
+    template <typename Range>
+    size_type insert_bulk(const Range& range) {
+        return insert_bulk(std::begin(range), std::end(range));
+    }
+
+    /**
+     * @brief 批量删除键（只加锁一次）
+     * @return 实际删除的元素个数
+     */
+    template <typename InputIt>
+    size_type erase_bulk(InputIt first, InputIt last) {
+        auto guard = acquire_write_lock();
+        size_type erased = 0;
+        for (; first != last; ++first) {
+            erased += data_.erase(*first);
+        }
+        return erased;
+    }
+
+    template <typename KeyRange>
+    size_type erase_bulk(const KeyRange& keys) {
+        return erase_bulk(std::begin(keys), std::end(keys));
+    }
+
     // ==================== STL兼容性 ====================
 
-    operator const std::set<Key, Compare>&() const {
+    operator const std::set<Key, Compare, Allocator>&() const {
         return data_;
     }
 
-    std::set<Key, Compare> copy() const {
+    std::set<Key, Compare, Allocator> copy() const {
         auto guard = acquire_read_lock();
         return data_;
     }
 
-    const std::set<Key, Compare>& ref() const {
+    const std::set<Key, Compare, Allocator>& ref() const {
         return data_;
     }
 
+    /**
+     * @brief 获取底层容器的分配器
+     */
+    allocator_type get_allocator() const noexcept {
+        return data_.get_allocator();
+    }
+
     // ==================== 迭代和查询 ====================
 
     template <typename Func>
@@ -173,11 +381,11 @@ public:
 
     // ==================== 线程不安全接口 ====================
 
-    std::set<Key, Compare>& unsafe_ref() {
+    std::set<Key, Compare, Allocator>& unsafe_ref() {
         return data_;
     }
 
-    const std::set<Key, Compare>& unsafe_ref() const {
+    const std::set<Key, Compare, Allocator>& unsafe_ref() const {
         return data_;
     }
 
@@ -230,19 +438,25 @@ public:
 
 // ==================== Set 的 LockFree 特化版本 ====================
 
-template <typename Key, typename Compare>
-class set<Key, Compare, LockPolicy::LockFree> {
+template <typename Key, typename Compare, typename Allocator>
+class set<Key, Compare, LockPolicy::LockFree, Allocator> {
 private:
-    std::set<Key, Compare> data_;
+    std::set<Key, Compare, Allocator> data_;
 
 public:
     using value_type = Key;
-    using size_type = typename std::set<Key, Compare>::size_type;
-    using iterator = typename std::set<Key, Compare>::iterator;
-    using const_iterator = typename std::set<Key, Compare>::const_iterator;
+    using allocator_type = Allocator;
+    using size_type = typename std::set<Key, Compare, Allocator>::size_type;
+    using iterator = typename std::set<Key, Compare, Allocator>::iterator;
+    using const_iterator = typename std::set<Key, Compare, Allocator>::const_iterator;
+    using node_type = typename std::set<Key, Compare, Allocator>::node_type;
 
     set() = default;
 
+    explicit set(const Allocator& alloc) : data_(alloc) {}
+
+    set(const Compare& comp, const Allocator& alloc) : data_(comp, alloc) {}
+
     explicit set(const Compare& comp) : data_(comp) {}
 
     template <typename InputIt>
@@ -273,6 +487,80 @@ public:
         return data_.count(key);
     }
 
+    template <typename K, typename C = Compare, detail::enable_if_transparent_t<C> = 0>
+    bool contains(const K& key) const {
+        return data_.find(key) != data_.end();
+    }
+
+    template <typename K, typename C = Compare, detail::enable_if_transparent_t<C> = 0>
+    size_type count(const K& key) const {
+        return data_.count(key);
+    }
+
+    // ==================== 区间查询（零开销） ====================
+
+    std::optional<Key> lower_bound_key(const Key& key) const {
+        auto it = data_.lower_bound(key);
+        if (it == data_.end()) {
+            return std::nullopt;
+        }
+        return *it;
+    }
+
+    std::optional<Key> upper_bound_key(const Key& key) const {
+        auto it = data_.upper_bound(key);
+        if (it == data_.end()) {
+            return std::nullopt;
+        }
+        return *it;
+    }
+
+    template <typename Func>
+    size_type range(const Key& lo, const Key& hi, Func func) const {
+        auto comp = data_.key_comp();
+        return detail::scan_while(
+            data_.lower_bound(lo), data_.end(), [&](const Key& item) { return comp(item, hi); },
+            [&](const Key& item) { return detail::invoke_continue(func, item); });
+    }
+
+    template <typename OutputIt>
+    size_type collect_range(const Key& lo, const Key& hi, OutputIt out,
+                            size_type limit = std::numeric_limits<size_type>::max()) const {
+        if (limit == 0) {
+            return 0;
+        }
+        size_type written = 0;
+        range(lo, hi, [&](const Key& item) {
+            *out = item;
+            ++out;
+            return ++written < limit;
+        });
+        return written;
+    }
+
+    template <typename Func>
+    size_type prefix_scan(const Key& prefix, Func func) const {
+        return detail::scan_while(
+            data_.lower_bound(prefix), data_.end(),
+            [&prefix](const Key& item) { return detail::key_has_prefix(item, prefix); },
+            [&](const Key& item) { return detail::invoke_continue(func, item); });
+    }
+
+    template <typename OutputIt>
+    size_type collect_prefix(const Key& prefix, OutputIt out,
+                             size_type limit = std::numeric_limits<size_type>::max()) const {
+        if (limit == 0) {
+            return 0;
+        }
+        size_type written = 0;
+        prefix_scan(prefix, [&](const Key& item) {
+            *out = item;
+            ++out;
+            return ++written < limit;
+        });
+        return written;
+    }
+
     std::pair<iterator, bool> insert(const Key& key) {
         return data_.insert(key);
     }
@@ -290,21 +578,95 @@ public:
         return data_.erase(key);
     }
 
-    operator std::set<Key, Compare>&() noexcept {
+    node_type extract(const Key& key) {
+        return data_.extract(key);
+    }
+
+    bool insert_node(node_type& node) {
+        return detail::insert_node_handle(data_, node);
+    }
+
+    bool insert_node(node_type&& node) {
+        return insert_node(node);
+    }
+
+    /**
+     * @brief 批量插入键，已存在的键保持不变
+     *
+     * 以 end() 作为插入提示，已升序排列的输入每个元素摊还 O(1)
+     * @return 新插入的元素个数
+     */
+    template <typename InputIt>
+    size_type insert_bulk(InputIt first, InputIt last) {
+        size_type before = data_.size();
+        for (; first != last; ++first) {
+            data_.emplace_hint(data_.end(), *first);
+        }
+        return data_.size() - before;
+    }
+
+    template <typename Range>
+    size_type insert_bulk(const Range& range) {
+        return insert_bulk(std::begin(range), std::end(range));
+    }
+
+    /**
+     * @brief 批量删除键
+     * @return 实际删除的元素个数
+     */
+    template <typename InputIt>
+    size_type erase_bulk(InputIt first, InputIt last) {
+        size_type erased = 0;
+        for (; first != last; ++first) {
+            erased += data_.erase(*first);
+        }
+        return erased;
+    }
+
+    template <typename KeyRange>
+    size_type erase_bulk(const KeyRange& keys) {
+        return erase_bulk(std::begin(keys), std::end(keys));
+    }
+
+    template <typename Compare2, LockPolicy SourcePolicy>
+    size_type merge_from(set<Key, Compare2, SourcePolicy, Allocator>& source) {
+        if (static_cast<const void*>(&source) == static_cast<const void*>(this)) {
+            return 0;
+        }
+        return detail::with_both_locked(*this, source, [&] {
+            return static_cast<size_type>(detail::merge_nodes(data_, detail::raw_container(source)));
+        });
+    }
+
+    std::set<Key, Compare, Allocator> drain() {
+        std::set<Key, Compare, Allocator> out;
+        detail::swap_contents(data_, out);
+        return out;
+    }
+
+    void swap_out(std::set<Key, Compare, Allocator>& other) {
+        detail::swap_contents(data_, other);
+    }
+
+    operator std::set<Key, Compare, Allocator>&() noexcept {
         return data_;
     }
 
-    operator const std::set<Key, Compare>&() const noexcept {
+    operator const std::set<Key, Compare, Allocator>&() const noexcept {
         return data_;
     }
 
-    std::set<Key, Compare>& get_unsafe() noexcept {
+    std::set<Key, Compare, Allocator>& get_unsafe() noexcept {
         return data_;
     }
 
-    const std::set<Key, Compare>& get_unsafe() const noexcept {
+    const std::set<Key, Compare, Allocator>& get_unsafe() const noexcept {
         return data_;
     }
+
+    allocator_type get_allocator() const noexcept {
+        return data_.get_allocator();
+    }
 };
 
 } // namespace ts_stl
@@ -0,0 +1,465 @@
+#pragma once
+
+#ifndef TS_SHARDED_UNORDERED_MAP_HPP
+#define TS_SHARDED_UNORDERED_MAP_HPP
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "ts_stl_base.hpp"
+#include "ts_unordered_map.hpp"
+
+namespace ts_stl {
+
+/**
+ * @brief 分片（锁条带化）的线程安全Unordered Map
+ * @tparam Key 键类型
+ * @tparam T 值类型
+ * @tparam Shards 分片数量（必须是2的幂）
+ * @tparam Hash 哈希函数（默认使用std::hash）
+ * @tparam KeyEqual 键相等比较器（默认使用std::equal_to）
+ * @tparam Policy 每个分片使用的锁策略（默认使用互斥锁）
+ *
+ * 按键的哈希值把数据划分到 Shards 个独立加锁的 unordered_map 中，
+ * 不同分片上的写操作互不阻塞，适合写密集的高并发场景。
+ *
+ * 注意：
+ * - size()/empty()/copy()/for_each() 逐个分片加锁聚合，结果不是全局原子快照
+ * - 每个分片按缓存行对齐，避免相邻分片的锁产生伪共享
+ */
+template <typename Key, typename T, std::size_t Shards = 16, typename Hash = std::hash<Key>,
+          typename KeyEqual = std::equal_to<Key>, LockPolicy Policy = LockPolicy::Mutex>
+class sharded_unordered_map {
+    static_assert(Shards > 0 && (Shards & (Shards - 1)) == 0, "Shards must be a power of two");
+    static_assert(Policy != LockPolicy::LockFree, "sharded_unordered_map requires a locking policy");
+
+public:
+    using shard_type = unordered_map<Key, T, Hash, KeyEqual, Policy>;
+    using Container = std::unordered_map<Key, T, Hash, KeyEqual>;
+
+    using key_type = Key;
+    using mapped_type = T;
+    using value_type = std::pair<const Key, T>;
+    using size_type = typename Container::size_type;
+
+private:
+    struct alignas(cache_line_size) padded_shard {
+        shard_type map;
+    };
+
+    std::array<padded_shard, Shards> shards_;
+    Hash hash_;
+
+    // 把分片轮流分配给至多 max_threads 个任务，shard_task(index, shard) 在各任务内顺序执行
+    template <typename ShardTask>
+    void fan_out_shards(size_type max_threads, ShardTask shard_task) const {
+        size_type tasks = detail::parallel_task_count(max_threads, size());
+        if (tasks > Shards) {
+            tasks = Shards;
+        }
+        auto task = [&](size_type first) {
+            for (size_type i = first; i < Shards; i += tasks) {
+                shard_task(i, shards_[i].map);
+            }
+        };
+        detail::parallel_invoke_n(tasks, task);
+    }
+
+public:
+    // ==================== 构造函数 ====================
+
+    sharded_unordered_map() = default;
+
+    /**
+     * @brief 按总桶数构造，桶数平均分配到各分片
+     */
+    explicit sharded_unordered_map(size_type bucket_count) {
+        for (auto& s : shards_) {
+            s.map.rehash(bucket_count / Shards);
+        }
+    }
+
+    template <typename InputIt>
+    sharded_unordered_map(InputIt first, InputIt last) {
+        for (; first != last; ++first) {
+            shard_for(first->first).insert(first->first, first->second);
+        }
+    }
+
+    sharded_unordered_map(const sharded_unordered_map& other) = default;
+    sharded_unordered_map& operator=(const sharded_unordered_map& other) = default;
+    sharded_unordered_map(sharded_unordered_map&& other) = default;
+    sharded_unordered_map& operator=(sharded_unordered_map&& other) = default;
+
+    // ==================== 分片访问 ====================
+
+    /**
+     * @brief 分片数量
+     */
+    static constexpr size_type shard_count() noexcept {
+        return Shards;
+    }
+
+    /**
+     * @brief 计算键所属的分片下标
+     */
+    size_type shard_index(const Key& key) const {
+        // 二次混合避免低质量哈希导致分片不均
+        return detail::mix_hash(hash_(key)) & (Shards - 1);
+    }
+
+    /**
+     * @brief 获取键所属的分片
+     */
+    shard_type& shard_for(const Key& key) {
+        return shards_[shard_index(key)].map;
+    }
+
+    const shard_type& shard_for(const Key& key) const {
+        return shards_[shard_index(key)].map;
+    }
+
+    /**
+     * @brief 按下标获取分片（用于需要对单个分片手动加锁的场景）
+     */
+    shard_type& shard(size_type index) {
+        return shards_[index].map;
+    }
+
+    const shard_type& shard(size_type index) const {
+        return shards_[index].map;
+    }
+
+    // ==================== 元素访问 ====================
+
+    /**
+     * @brief 获取指定键对应的值（如果键不存在则插入默认值）
+     */
+    T& operator[](const Key& key) {
+        return shard_for(key)[key];
+    }
+
+    T at(const Key& key) const {
+        return shard_for(key).at(key);
+    }
+
+    T& at(const Key& key) {
+        return shard_for(key).at(key);
+    }
+
+    void set(const Key& key, const T& value) {
+        shard_for(key).set(key, value);
+    }
+
+    T get(const Key& key, const T& default_value = T()) const {
+        return shard_for(key).get(key, default_value);
+    }
+
+    // ==================== 容量管理 ====================
+
+    /**
+     * @brief 所有分片的元素总数
+     */
+    size_type size() const {
+        size_type total = 0;
+        for (const auto& s : shards_) {
+            total += s.map.size();
+        }
+        return total;
+    }
+
+    bool empty() const {
+        for (const auto& s : shards_) {
+            if (!s.map.empty()) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    void clear() {
+        for (auto& s : shards_) {
+            s.map.clear();
+        }
+    }
+
+    /**
+     * @brief 为总共 n 个元素预留空间（平均分配到各分片）
+     */
+    void reserve(size_type n) {
+        for (auto& s : shards_) {
+            s.map.reserve((n + Shards - 1) / Shards);
+        }
+    }
+
+    // ==================== 查找操作 ====================
+
+    bool contains(const Key& key) const {
+        return shard_for(key).contains(key);
+    }
+
+    size_type count(const Key& key) const {
+        return shard_for(key).count(key);
+    }
+
+    // ==================== 修改操作 ====================
+
+    std::pair<bool, size_type> insert(const Key& key, const T& value) {
+        return shard_for(key).insert(key, value);
+    }
+
+    std::pair<bool, size_type> insert(const Key& key, T&& value) {
+        return shard_for(key).insert(key, std::move(value));
+    }
+
+    template <typename... Args>
+    std::pair<bool, size_type> emplace(const Key& key, Args&&... args) {
+        return shard_for(key).emplace(key, std::forward<Args>(args)...);
+    }
+
+    size_type erase(const Key& key) {
+        return shard_for(key).erase(key);
+    }
+
+    // ==================== 原地访问与原子读-改-写（仅锁定键所在分片） ====================
+
+    template <typename Func>
+    bool visit(const Key& key, Func func) const {
+        return shard_for(key).visit(key, std::move(func));
+    }
+
+    template <typename Func>
+    bool visit_mut(const Key& key, Func func) {
+        return shard_for(key).visit_mut(key, std::move(func));
+    }
+
+    template <typename Func>
+    bool compute_if_present(const Key& key, Func func) {
+        return shard_for(key).compute_if_present(key, std::move(func));
+    }
+
+    template <typename Factory>
+    bool compute_if_absent(const Key& key, Factory factory) {
+        return shard_for(key).compute_if_absent(key, std::move(factory));
+    }
+
+    template <typename Func>
+    bool merge(const Key& key, const T& value, Func func) {
+        return shard_for(key).merge(key, value, std::move(func));
+    }
+
+    // ==================== 批量操作（每个分片加锁一次） ====================
+
+    /**
+     * @brief 批量插入键值对：先按分片分组，再对每个涉及的分片加锁一次
+     * @note 需要前向迭代器（元素在分组后才被访问）
+     * @return 新插入的元素个数
+     */
+    template <typename ForwardIt>
+    size_type insert_bulk(ForwardIt first, ForwardIt last) {
+        std::array<std::vector<ForwardIt>, Shards> groups;
+        for (; first != last; ++first) {
+            groups[shard_index(first->first)].push_back(first);
+        }
+        size_type inserted = 0;
+        for (size_type i = 0; i < Shards; ++i) {
+            const auto& group = groups[i];
+            if (group.empty()) {
+                continue;
+            }
+            shards_[i].map.with_write_lock([&](auto& m) {
+                auto& raw = m.unsafe_ref();
+                raw.reserve(raw.size() + group.size());
+                for (const auto& it : group) {
+                    if (raw.insert(*it).second) {
+                        ++inserted;
+                    }
+                }
+            });
+        }
+        return inserted;
+    }
+
+    template <typename Range>
+    size_type insert_bulk(const Range& range) {
+        return insert_bulk(std::begin(range), std::end(range));
+    }
+
+    /**
+     * @brief 批量删除键（每个涉及的分片加锁一次）
+     *
+     * 分组时复制键：keys 的迭代器可能按值产出元素（代理区间），其地址在下一次迭代前即失效
+     * @return 实际删除的元素个数
+     */
+    template <typename KeyRange>
+    size_type erase_bulk(const KeyRange& keys) {
+        std::array<std::vector<Key>, Shards> groups;
+        for (const auto& key : keys) {
+            groups[shard_index(key)].push_back(key);
+        }
+        size_type erased = 0;
+        for (size_type i = 0; i < Shards; ++i) {
+            if (groups[i].empty()) {
+                continue;
+            }
+            shards_[i].map.with_write_lock([&](auto& m) {
+                for (const Key& key : groups[i]) {
+                    erased += m.unsafe_ref().erase(key);
+                }
+            });
+        }
+        return erased;
+    }
+
+    /**
+     * @brief 批量查找（每个涉及的分片加读锁一次），按 keys 的顺序输出值
+     *
+     * 与 erase_bulk 相同，分组时复制键
+     * @return 命中的键个数
+     */
+    template <typename KeyRange, typename OutputIt>
+    size_type get_many(const KeyRange& keys, OutputIt out, const T& default_value = T()) const {
+        std::array<std::vector<std::pair<Key, size_type>>, Shards> groups;
+        size_type count = 0;
+        for (const auto& key : keys) {
+            groups[shard_index(key)].emplace_back(key, count++);
+        }
+        std::vector<T> values(count, default_value);
+        size_type found = 0;
+        for (size_type i = 0; i < Shards; ++i) {
+            if (groups[i].empty()) {
+                continue;
+            }
+            shards_[i].map.with_read_lock([&](const auto& m) {
+                const auto& raw = m.unsafe_ref();
+                for (const auto& entry : groups[i]) {
+                    auto it = raw.find(entry.first);
+                    if (it != raw.end()) {
+                        values[entry.second] = it->second;
+                        ++found;
+                    }
+                }
+            });
+        }
+        std::move(values.begin(), values.end(), out);
+        return found;
+    }
+
+    // ==================== 锁竞争统计 ====================
+
+    /**
+     * @brief 以 name[0] ... name[Shards-1] 登记每个分片的锁统计，便于发现热点分片
+     * @note 未开启 TS_STL_ENABLE_LOCK_STATS 时为空操作
+     */
+    void register_lock_stats(const std::string& name) const {
+        for (size_type i = 0; i < Shards; ++i) {
+            shards_[i].map.register_lock_stats(name + "[" + std::to_string(i) + "]");
+        }
+    }
+
+    void reset_lock_stats() const {
+        for (const auto& s : shards_) {
+            s.map.reset_lock_stats();
+        }
+    }
+
+    // ==================== STL兼容性 ====================
+
+    /**
+     * @brief 合并所有分片，返回std::unordered_map拷贝
+     */
+    Container copy() const {
+        Container result;
+        result.reserve(size());
+        for (const auto& s : shards_) {
+            s.map.with_read_lock([&result](const auto& m) {
+                result.insert(m.unsafe_ref().begin(), m.unsafe_ref().end());
+            });
+        }
+        return result;
+    }
+
+    // ==================== 迭代和查询 ====================
+
+    /**
+     * @brief 对每个元素执行操作（逐分片持锁遍历）
+     */
+    template <typename Func>
+    void for_each(Func func) const {
+        for (const auto& s : shards_) {
+            s.map.for_each(func);
+        }
+    }
+
+    template <typename Predicate>
+    size_type count_if(Predicate pred) const {
+        size_type total = 0;
+        for (const auto& s : shards_) {
+            total += s.map.count_if(pred);
+        }
+        return total;
+    }
+
+    // ==================== 并行遍历（按分片分发） ====================
+    //
+    // 每个任务依次持有分配给它的分片的读锁顺序扫描，分片之间并行；回调约定与 for_each 相同，
+    // 并且会被多个线程同时调用。结果按分片顺序合并，不是全局原子快照。
+
+    template <typename Func>
+    void parallel_for_each(Func func, size_type max_threads = 0) const {
+        fan_out_shards(max_threads, [&func](size_type, const shard_type& m) { m.parallel_for_each(func, 1); });
+    }
+
+    template <typename Predicate>
+    size_type parallel_count_if(Predicate pred, size_type max_threads = 0) const {
+        std::array<size_type, Shards> counts{};
+        fan_out_shards(max_threads, [&](size_type i, const shard_type& m) { counts[i] = m.parallel_count_if(pred, 1); });
+        size_type total = 0;
+        for (size_type c : counts) {
+            total += c;
+        }
+        return total;
+    }
+
+    template <typename U, typename Reduce, typename Combine, std::enable_if_t<!std::is_integral_v<Combine>, int> = 0>
+    U parallel_reduce(U identity, Reduce reduce, Combine combine, size_type max_threads = 0) const {
+        std::vector<U> partials(Shards, identity);
+        fan_out_shards(max_threads, [&](size_type i, const shard_type& m) {
+            partials[i] = m.parallel_reduce(identity, reduce, combine, 1);
+        });
+        U result = std::move(partials[0]);
+        for (size_type i = 1; i < Shards; ++i) {
+            result = combine(std::move(result), std::move(partials[i]));
+        }
+        return result;
+    }
+
+    template <typename U, typename BinaryOp>
+    U parallel_reduce(U identity, BinaryOp op, size_type max_threads = 0) const {
+        return parallel_reduce(std::move(identity), op, op, max_threads);
+    }
+
+    template <typename Func>
+    auto parallel_transform(Func func, size_type max_threads = 0) const {
+        using piece_type = decltype(std::declval<const shard_type&>().parallel_transform(func, 1));
+        std::array<piece_type, Shards> pieces;
+        fan_out_shards(max_threads, [&](size_type i, const shard_type& m) { pieces[i] = m.parallel_transform(func, 1); });
+        piece_type out;
+        size_type total = 0;
+        for (const auto& piece : pieces) {
+            total += piece.size();
+        }
+        out.reserve(total);
+        for (auto& piece : pieces) {
+            out.insert(out.end(), std::make_move_iterator(piece.begin()), std::make_move_iterator(piece.end()));
+        }
+        return out;
+    }
+};
+
+} // namespace ts_stl
+
+#endif // TS_SHARDED_UNORDERED_MAP_HPP
@@ -0,0 +1,880 @@
+#pragma once
+
+#ifndef TS_SIMD_HPP
+#define TS_SIMD_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+// 编译期选择指令集：AVX2 > SSE2 > NEON(AArch64) > 标量；定义 TS_STL_NO_SIMD 可强制使用标量实现。
+// 只依赖编译选项（例如 -mavx2 / -march=native），不做运行时 CPU 检测。
+#if !defined(TS_STL_NO_SIMD) && (defined(__GNUC__) || defined(__clang__))
+    #if defined(__AVX2__)
+        #include <immintrin.h>
+        #define TS_STL_SIMD_AVX2 1
+    #elif defined(__SSE2__)
+        #include <emmintrin.h>
+        #define TS_STL_SIMD_SSE2 1
+    #elif defined(__ARM_NEON) && defined(__aarch64__)
+        #include <arm_neon.h>
+        #define TS_STL_SIMD_NEON 1
+    #endif
+#endif
+
+#ifndef TS_STL_SIMD_AVX2
+    #define TS_STL_SIMD_AVX2 0
+#endif
+#ifndef TS_STL_SIMD_SSE2
+    #define TS_STL_SIMD_SSE2 0
+#endif
+#ifndef TS_STL_SIMD_NEON
+    #define TS_STL_SIMD_NEON 0
+#endif
+
+namespace ts_stl {
+
+namespace simd {
+
+/**
+ * @brief 编译期选中的指令集名称（"avx2" / "sse2" / "neon" / "scalar"）
+ */
+constexpr const char* isa_name() noexcept {
+#if TS_STL_SIMD_AVX2
+    return "avx2";
+#elif TS_STL_SIMD_SSE2
+    return "sse2";
+#elif TS_STL_SIMD_NEON
+    return "neon";
+#else
+    return "scalar";
+#endif
+}
+
+/**
+ * @brief sum() 的结果类型：有符号整数累加到 int64，无符号累加到 uint64，浮点累加到 double
+ */
+template <typename T>
+using sum_result_t = std::conditional_t<
+    std::is_floating_point_v<T>, std::conditional_t<(sizeof(T) > sizeof(double)), T, double>,
+    std::conditional_t<std::is_signed_v<T>, std::int64_t, std::uint64_t>>;
+
+} // namespace simd
+
+namespace detail {
+
+// 标量累加：整数按无符号运算（溢出时回绕而不是未定义行为），浮点直接相加
+template <typename T>
+simd::sum_result_t<T> scalar_accumulate(simd::sum_result_t<T> total, const T* first, const T* last) noexcept {
+    using result = simd::sum_result_t<T>;
+    if constexpr (std::is_integral_v<result>) {
+        using wide = std::make_unsigned_t<result>;
+        wide acc = static_cast<wide>(total);
+        for (; first != last; ++first) {
+            acc += static_cast<wide>(static_cast<result>(*first));
+        }
+        return static_cast<result>(acc);
+    } else {
+        for (; first != last; ++first) {
+            total += static_cast<result>(*first);
+        }
+        return total;
+    }
+}
+
+// 按位复制到等宽的整数类型，避免有/无符号转换告警
+template <typename To, typename From>
+To simd_bits(const From& value) noexcept {
+    static_assert(sizeof(To) == sizeof(From), "simd_bits requires equal sizes");
+    To out;
+    std::memcpy(&out, &value, sizeof(To));
+    return out;
+}
+
+/**
+ * @brief 每种元素类型的向量操作；enabled 为 false 时对应算法退回标量实现
+ *
+ * simd_ops：load / splat / match（逐 lane 相等比较，返回位掩码，每个 lane 占 bits_per_lane 位）、
+ *           count_add / count_drain（相等 lane 在计数寄存器中逐 lane 累加）
+ * simd_minmax：min / max / store，寄存器与 simd_ops 相同
+ * simd_sum：把一个寄存器累加到更宽的累加器，最后 reduce 为 simd::sum_result_t<T>
+ */
+template <typename T, typename = void>
+struct simd_ops {
+    static constexpr bool enabled = false;
+};
+
+template <typename T, typename = void>
+struct simd_minmax {
+    static constexpr bool enabled = false;
+};
+
+template <typename T, typename = void>
+struct simd_sum {
+    static constexpr bool enabled = false;
+};
+
+template <typename T>
+inline constexpr bool simd_element_v = std::is_arithmetic_v<T> && !std::is_same_v<T, bool>;
+
+template <std::size_t Size>
+using simd_lane_uint = std::conditional_t<Size == 1, std::uint8_t,
+                       std::conditional_t<Size == 2, std::uint16_t,
+                       std::conditional_t<Size == 4, std::uint32_t, std::uint64_t>>>;
+
+// 把按 Size 字节分 lane 的计数寄存器横向求和
+template <std::size_t Size, typename Reg>
+std::size_t simd_drain_lanes(const Reg& counter) noexcept {
+    simd_lane_uint<Size> lanes[sizeof(Reg) / Size];
+    std::memcpy(lanes, &counter, sizeof(Reg));
+    std::size_t total = 0;
+    for (auto lane : lanes) {
+        total += lane;
+    }
+    return total;
+}
+
+#if TS_STL_SIMD_AVX2 || TS_STL_SIMD_SSE2
+
+inline unsigned simd_ctz(unsigned bits) noexcept {
+    return static_cast<unsigned>(__builtin_ctz(bits));
+}
+
+#endif
+
+// ==================== AVX2（256 位） ====================
+
+#if TS_STL_SIMD_AVX2
+
+template <std::size_t Size>
+struct x86_int_eq;
+
+template <>
+struct x86_int_eq<1> {
+    static __m256i splat(std::int8_t v) noexcept { return _mm256_set1_epi8(v); }
+    static __m256i sub(__m256i a, __m256i b) noexcept { return _mm256_sub_epi8(a, b); }
+    static __m256i eq(__m256i a, __m256i b) noexcept { return _mm256_cmpeq_epi8(a, b); }
+};
+
+template <>
+struct x86_int_eq<2> {
+    static __m256i splat(std::int16_t v) noexcept { return _mm256_set1_epi16(v); }
+    static __m256i sub(__m256i a, __m256i b) noexcept { return _mm256_sub_epi16(a, b); }
+    static __m256i eq(__m256i a, __m256i b) noexcept { return _mm256_cmpeq_epi16(a, b); }
+};
+
+template <>
+struct x86_int_eq<4> {
+    static __m256i splat(std::int32_t v) noexcept { return _mm256_set1_epi32(v); }
+    static __m256i sub(__m256i a, __m256i b) noexcept { return _mm256_sub_epi32(a, b); }
+    static __m256i eq(__m256i a, __m256i b) noexcept { return _mm256_cmpeq_epi32(a, b); }
+};
+
+template <>
+struct x86_int_eq<8> {
+    static __m256i splat(std::int64_t v) noexcept { return _mm256_set1_epi64x(v); }
+    static __m256i sub(__m256i a, __m256i b) noexcept { return _mm256_sub_epi64(a, b); }
+    static __m256i eq(__m256i a, __m256i b) noexcept { return _mm256_cmpeq_epi64(a, b); }
+};
+
+// 字节粒度掩码：每个 lane 占 sizeof(T) 位
+template <typename T>
+struct simd_ops<T, std::enable_if_t<std::is_integral_v<T> && simd_element_v<T>>> {
+    static constexpr bool enabled = true;
+    using reg = __m256i;
+    static constexpr std::size_t lanes = 32 / sizeof(T);
+    static constexpr unsigned bits_per_lane = sizeof(T);
+    static constexpr unsigned full_mask = 0xFFFFFFFFu;
+    using bits_type = std::conditional_t<sizeof(T) == 1, std::int8_t,
+                      std::conditional_t<sizeof(T) == 2, std::int16_t,
+                      std::conditional_t<sizeof(T) == 4, std::int32_t, std::int64_t>>>;
+
+    static reg load(const T* p) noexcept { return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)); }
+    static reg splat(T v) noexcept { return x86_int_eq<sizeof(T)>::splat(simd_bits<bits_type>(v)); }
+    static unsigned match(reg a, reg b) noexcept {
+        return static_cast<unsigned>(_mm256_movemask_epi8(x86_int_eq<sizeof(T)>::eq(a, b)));
+    }
+
+    // 相等的 lane 为全 1（-1），相减即计数
+    using counter = __m256i;
+    static counter count_zero() noexcept { return _mm256_setzero_si256(); }
+    static counter count_add(counter c, reg a, reg b) noexcept {
+        return x86_int_eq<sizeof(T)>::sub(c, x86_int_eq<sizeof(T)>::eq(a, b));
+    }
+    static std::size_t count_drain(counter c) noexcept { return simd_drain_lanes<sizeof(T)>(c); }
+};
+
+template <>
+struct simd_ops<float> {
+    static constexpr bool enabled = true;
+    using reg = __m256;
+    static constexpr std::size_t lanes = 8;
+    static constexpr unsigned bits_per_lane = 1;
+    static constexpr unsigned full_mask = 0xFFu;
+
+    static reg load(const float* p) noexcept { return _mm256_loadu_ps(p); }
+    static reg splat(float v) noexcept { return _mm256_set1_ps(v); }
+    static unsigned match(reg a, reg b) noexcept {
+        return static_cast<unsigned>(_mm256_movemask_ps(_mm256_cmp_ps(a, b, _CMP_EQ_OQ)));
+    }
+
+    using counter = __m256i;
+    static counter count_zero() noexcept { return _mm256_setzero_si256(); }
+    static counter count_add(counter c, reg a, reg b) noexcept {
+        return _mm256_sub_epi32(c, _mm256_castps_si256(_mm256_cmp_ps(a, b, _CMP_EQ_OQ)));
+    }
+    static std::size_t count_drain(counter c) noexcept { return simd_drain_lanes<4>(c); }
+};
+
+template <>
+struct simd_ops<double> {
+    static constexpr bool enabled = true;
+    using reg = __m256d;
+    static constexpr std::size_t lanes = 4;
+    static constexpr unsigned bits_per_lane = 1;
+    static constexpr unsigned full_mask = 0xFu;
+
+    static reg load(const double* p) noexcept { return _mm256_loadu_pd(p); }
+    static reg splat(double v) noexcept { return _mm256_set1_pd(v); }
+    static unsigned match(reg a, reg b) noexcept {
+        return static_cast<unsigned>(_mm256_movemask_pd(_mm256_cmp_pd(a, b, _CMP_EQ_OQ)));
+    }
+
+    using counter = __m256i;
+    static counter count_zero() noexcept { return _mm256_setzero_si256(); }
+    static counter count_add(counter c, reg a, reg b) noexcept {
+        return _mm256_sub_epi64(c, _mm256_castpd_si256(_mm256_cmp_pd(a, b, _CMP_EQ_OQ)));
+    }
+    static std::size_t count_drain(counter c) noexcept { return simd_drain_lanes<8>(c); }
+};
+
+template <>
+struct simd_minmax<std::int32_t> {
+    static constexpr bool enabled = true;
+    using reg = __m256i;
+    static reg min(reg a, reg b) noexcept { return _mm256_min_epi32(a, b); }
+    static reg max(reg a, reg b) noexcept { return _mm256_max_epi32(a, b); }
+    static void store(std::int32_t* out, reg v) noexcept { _mm256_storeu_si256(reinterpret_cast<__m256i*>(out), v); }
+};
+
+template <>
+struct simd_minmax<std::uint32_t> {
+    static constexpr bool enabled = true;
+    using reg = __m256i;
+    static reg min(reg a, reg b) noexcept { return _mm256_min_epu32(a, b); }
+    static reg max(reg a, reg b) noexcept { return _mm256_max_epu32(a, b); }
+    static void store(std::uint32_t* out, reg v) noexcept { _mm256_storeu_si256(reinterpret_cast<__m256i*>(out), v); }
+};
+
+template <>
+struct simd_minmax<float> {
+    static constexpr bool enabled = true;
+    using reg = __m256;
+    static reg min(reg a, reg b) noexcept { return _mm256_min_ps(a, b); }
+    static reg max(reg a, reg b) noexcept { return _mm256_max_ps(a, b); }
+    static void store(float* out, reg v) noexcept { _mm256_storeu_ps(out, v); }
+};
+
+template <>
+struct simd_minmax<double> {
+    static constexpr bool enabled = true;
+    using reg = __m256d;
+    static reg min(reg a, reg b) noexcept { return _mm256_min_pd(a, b); }
+    static reg max(reg a, reg b) noexcept { return _mm256_max_pd(a, b); }
+    static void store(double* out, reg v) noexcept { _mm256_storeu_pd(out, v); }
+};
+
+template <>
+struct simd_sum<std::int32_t> {
+    static constexpr bool enabled = true;
+    using acc = __m256i;
+    static acc zero() noexcept { return _mm256_setzero_si256(); }
+    static acc add(acc a, __m256i v) noexcept {
+        a = _mm256_add_epi64(a, _mm256_cvtepi32_epi64(_mm256_castsi256_si128(v)));
+        return _mm256_add_epi64(a, _mm256_cvtepi32_epi64(_mm256_extracti128_si256(v, 1)));
+    }
+    static std::int64_t reduce(acc a) noexcept {
+        alignas(32) std::int64_t lanes[4];
+        _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), a);
+        return lanes[0] + lanes[1] + lanes[2] + lanes[3];
+    }
+};
+
+template <>
+struct simd_sum<std::uint32_t> {
+    static constexpr bool enabled = true;
+    using acc = __m256i;
+    static acc zero() noexcept { return _mm256_setzero_si256(); }
+    static acc add(acc a, __m256i v) noexcept {
+        a = _mm256_add_epi64(a, _mm256_cvtepu32_epi64(_mm256_castsi256_si128(v)));
+        return _mm256_add_epi64(a, _mm256_cvtepu32_epi64(_mm256_extracti128_si256(v, 1)));
+    }
+    static std::uint64_t reduce(acc a) noexcept {
+        alignas(32) std::uint64_t lanes[4];
+        _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), a);
+        return lanes[0] + lanes[1] + lanes[2] + lanes[3];
+    }
+};
+
+template <>
+struct simd_sum<float> {
+    static constexpr bool enabled = true;
+    using acc = __m256d;
+    static acc zero() noexcept { return _mm256_setzero_pd(); }
+    static acc add(acc a, __m256 v) noexcept {
+        a = _mm256_add_pd(a, _mm256_cvtps_pd(_mm256_castps256_ps128(v)));
+        return _mm256_add_pd(a, _mm256_cvtps_pd(_mm256_extractf128_ps(v, 1)));
+    }
+    static double reduce(acc a) noexcept {
+        alignas(32) double lanes[4];
+        _mm256_store_pd(lanes, a);
+        return (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]);
+    }
+};
+
+template <>
+struct simd_sum<double> {
+    static constexpr bool enabled = true;
+    using acc = __m256d;
+    static acc zero() noexcept { return _mm256_setzero_pd(); }
+    static acc add(acc a, __m256d v) noexcept { return _mm256_add_pd(a, v); }
+    static double reduce(acc a) noexcept {
+        alignas(32) double lanes[4];
+        _mm256_store_pd(lanes, a);
+        return (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]);
+    }
+};
+
+// ==================== SSE2（128 位，x86-64 基线） ====================
+
+#elif TS_STL_SIMD_SSE2
+
+template <std::size_t Size>
+struct x86_int_eq;
+
+template <>
+struct x86_int_eq<1> {
+    static __m128i splat(std::int8_t v) noexcept { return _mm_set1_epi8(v); }
+    static __m128i sub(__m128i a, __m128i b) noexcept { return _mm_sub_epi8(a, b); }
+    static __m128i eq(__m128i a, __m128i b) noexcept { return _mm_cmpeq_epi8(a, b); }
+};
+
+template <>
+struct x86_int_eq<2> {
+    static __m128i splat(std::int16_t v) noexcept { return _mm_set1_epi16(v); }
+    static __m128i sub(__m128i a, __m128i b) noexcept { return _mm_sub_epi16(a, b); }
+    static __m128i eq(__m128i a, __m128i b) noexcept { return _mm_cmpeq_epi16(a, b); }
+};
+
+template <>
+struct x86_int_eq<4> {
+    static __m128i splat(std::int32_t v) noexcept { return _mm_set1_epi32(v); }
+    static __m128i sub(__m128i a, __m128i b) noexcept { return _mm_sub_epi32(a, b); }
+    static __m128i eq(__m128i a, __m128i b) noexcept { return _mm_cmpeq_epi32(a, b); }
+};
+
+template <>
+struct x86_int_eq<8> {
+    static __m128i splat(std::int64_t v) noexcept { return _mm_set1_epi64x(v); }
+    static __m128i sub(__m128i a, __m128i b) noexcept { return _mm_sub_epi64(a, b); }
+    // SSE2 没有 64 位相等比较：两个 32 位半字都相等才算相等
+    static __m128i eq(__m128i a, __m128i b) noexcept {
+        __m128i e = _mm_cmpeq_epi32(a, b);
+        return _mm_and_si128(e, _mm_shuffle_epi32(e, _MM_SHUFFLE(2, 3, 0, 1)));
+    }
+};
+
+template <typename T>
+struct simd_ops<T, std::enable_if_t<std::is_integral_v<T> && simd_element_v<T>>> {
+    static constexpr bool enabled = true;
+    using reg = __m128i;
+    static constexpr std::size_t lanes = 16 / sizeof(T);
+    static constexpr unsigned bits_per_lane = sizeof(T);
+    static constexpr unsigned full_mask = 0xFFFFu;
+    using bits_type = std::conditional_t<sizeof(T) == 1, std::int8_t,
+                      std::conditional_t<sizeof(T) == 2, std::int16_t,
+                      std::conditional_t<sizeof(T) == 4, std::int32_t, std::int64_t>>>;
+
+    static reg load(const T* p) noexcept { return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p)); }
+    static reg splat(T v) noexcept { return x86_int_eq<sizeof(T)>::splat(simd_bits<bits_type>(v)); }
+    static unsigned match(reg a, reg b) noexcept {
+        return static_cast<unsigned>(_mm_movemask_epi8(x86_int_eq<sizeof(T)>::eq(a, b)));
+    }
+
+    // 相等的 lane 为全 1（-1），相减即计数
+    using counter = __m128i;
+    static counter count_zero() noexcept { return _mm_setzero_si128(); }
+    static counter count_add(counter c, reg a, reg b) noexcept {
+        return x86_int_eq<sizeof(T)>::sub(c, x86_int_eq<sizeof(T)>::eq(a, b));
+    }
+    static std::size_t count_drain(counter c) noexcept { return simd_drain_lanes<sizeof(T)>(c); }
+};
+
+template <>
+struct simd_ops<float> {
+    static constexpr bool enabled = true;
+    using reg = __m128;
+    static constexpr std::size_t lanes = 4;
+    static constexpr unsigned bits_per_lane = 1;
+    static constexpr unsigned full_mask = 0xFu;
+
+    static reg load(const float* p) noexcept { return _mm_loadu_ps(p); }
+    static reg splat(float v) noexcept { return _mm_set1_ps(v); }
+    static unsigned match(reg a, reg b) noexcept { return static_cast<unsigned>(_mm_movemask_ps(_mm_cmpeq_ps(a, b))); }
+
+    using counter = __m128i;
+    static counter count_zero() noexcept { return _mm_setzero_si128(); }
+    static counter count_add(counter c, reg a, reg b) noexcept {
+        return _mm_sub_epi32(c, _mm_castps_si128(_mm_cmpeq_ps(a, b)));
+    }
+    static std::size_t count_drain(counter c) noexcept { return simd_drain_lanes<4>(c); }
+};
+
+template <>
+struct simd_ops<double> {
+    static constexpr bool enabled = true;
+    using reg = __m128d;
+    static constexpr std::size_t lanes = 2;
+    static constexpr unsigned bits_per_lane = 1;
+    static constexpr unsigned full_mask = 0x3u;
+
+    static reg load(const double* p) noexcept { return _mm_loadu_pd(p); }
+    static reg splat(double v) noexcept { return _mm_set1_pd(v); }
+    static unsigned match(reg a, reg b) noexcept { return static_cast<unsigned>(_mm_movemask_pd(_mm_cmpeq_pd(a, b))); }
+
+    using counter = __m128i;
+    static counter count_zero() noexcept { return _mm_setzero_si128(); }
+    static counter count_add(counter c, reg a, reg b) noexcept {
+        return _mm_sub_epi64(c, _mm_castpd_si128(_mm_cmpeq_pd(a, b)));
+    }
+    static std::size_t count_drain(counter c) noexcept { return simd_drain_lanes<8>(c); }
+};
+
+// SSE2 没有 32 位整数 min/max：用比较结果做按位选择
+template <>
+struct simd_minmax<std::int32_t> {
+    static constexpr bool enabled = true;
+    using reg = __m128i;
+    static reg select(reg mask, reg a, reg b) noexcept {
+        return _mm_or_si128(_mm_and_si128(mask, a), _mm_andnot_si128(mask, b));
+    }
+    static reg min(reg a, reg b) noexcept { return select(_mm_cmpgt_epi32(a, b), b, a); }
+    static reg max(reg a, reg b) noexcept { return select(_mm_cmpgt_epi32(a, b), a, b); }
+    static void store(std::int32_t* out, reg v) noexcept { _mm_storeu_si128(reinterpret_cast<__m128i*>(out), v); }
+};
+
+template <>
+struct simd_minmax<float> {
+    static constexpr bool enabled = true;
+    using reg = __m128;
+    static reg min(reg a, reg b) noexcept { return _mm_min_ps(a, b); }
+    static reg max(reg a, reg b) noexcept { return _mm_max_ps(a, b); }
+    static void store(float* out, reg v) noexcept { _mm_storeu_ps(out, v); }
+};
+
+template <>
+struct simd_minmax<double> {
+    static constexpr bool enabled = true;
+    using reg = __m128d;
+    static reg min(reg a, reg b) noexcept { return _mm_min_pd(a, b); }
+    static reg max(reg a, reg b) noexcept { return _mm_max_pd(a, b); }
+    static void store(double* out, reg v) noexcept { _mm_storeu_pd(out, v); }
+};
+
+template <>
+struct simd_sum<std::int32_t> {
+    static constexpr bool enabled = true;
+    using acc = __m128i;
+    static acc zero() noexcept { return _mm_setzero_si128(); }
+    // 与符号位交织，把 4 个 int32 扩展为两组 int64
+    static acc add(acc a, __m128i v) noexcept {
+        __m128i sign = _mm_srai_epi32(v, 31);
+        a = _mm_add_epi64(a, _mm_unpacklo_epi32(v, sign));
+        return _mm_add_epi64(a, _mm_unpackhi_epi32(v, sign));
+    }
+    static std::int64_t reduce(acc a) noexcept {
+        alignas(16) std::int64_t lanes[2];
+        _mm_store_si128(reinterpret_cast<__m128i*>(lanes), a);
+        return lanes[0] + lanes[1];
+    }
+};
+
+template <>
+struct simd_sum<std::uint32_t> {
+    static constexpr bool enabled = true;
+    using acc = __m128i;
+    static acc zero() noexcept { return _mm_setzero_si128(); }
+    static acc add(acc a, __m128i v) noexcept {
+        __m128i zero_hi = _mm_setzero_si128();
+        a = _mm_add_epi64(a, _mm_unpacklo_epi32(v, zero_hi));
+        return _mm_add_epi64(a, _mm_unpackhi_epi32(v, zero_hi));
+    }
+    static std::uint64_t reduce(acc a) noexcept {
+        alignas(16) std::uint64_t lanes[2];
+        _mm_store_si128(reinterpret_cast<__m128i*>(lanes), a);
+        return lanes[0] + lanes[1];
+    }
+};
+
+template <>
+struct simd_sum<float> {
+    static constexpr bool enabled = true;
+    using acc = __m128d;
+    static acc zero() noexcept { return _mm_setzero_pd(); }
+    static acc add(acc a, __m128 v) noexcept {
+        a = _mm_add_pd(a, _mm_cvtps_pd(v));
+        return _mm_add_pd(a, _mm_cvtps_pd(_mm_movehl_ps(v, v)));
+    }
+    static double reduce(acc a) noexcept {
+        alignas(16) double lanes[2];
+        _mm_store_pd(lanes, a);
+        return lanes[0] + lanes[1];
+    }
+};
+
+template <>
+struct simd_sum<double> {
+    static constexpr bool enabled = true;
+    using acc = __m128d;
+    static acc zero() noexcept { return _mm_setzero_pd(); }
+    static acc add(acc a, __m128d v) noexcept { return _mm_add_pd(a, v); }
+    static double reduce(acc a) noexcept {
+        alignas(16) double lanes[2];
+        _mm_store_pd(lanes, a);
+        return lanes[0] + lanes[1];
+    }
+};
+
+// ==================== NEON（AArch64，128 位） ====================
+
+#elif TS_STL_SIMD_NEON
+
+// 比较结果每个 lane 全 1，与 {1, 2, 4, 8} 相与后横向求和得到 4 位掩码
+inline unsigned neon_lane_bits(uint32x4_t eq) noexcept {
+    static const std::uint32_t weights[4] = {1u, 2u, 4u, 8u};
+    return vaddvq_u32(vandq_u32(eq, vld1q_u32(weights)));
+}
+
+inline unsigned simd_ctz(unsigned bits) noexcept {
+    return static_cast<unsigned>(__builtin_ctz(bits));
+}
+
+template <>
+struct simd_ops<std::int32_t> {
+    static constexpr bool enabled = true;
+    using reg = int32x4_t;
+    static constexpr std::size_t lanes = 4;
+    static constexpr unsigned bits_per_lane = 1;
+    static constexpr unsigned full_mask = 0xFu;
+
+    static reg load(const std::int32_t* p) noexcept { return vld1q_s32(p); }
+    static reg splat(std::int32_t v) noexcept { return vdupq_n_s32(v); }
+    static unsigned match(reg a, reg b) noexcept { return neon_lane_bits(vceqq_s32(a, b)); }
+
+    using counter = uint32x4_t;
+    static counter count_zero() noexcept { return vdupq_n_u32(0); }
+    static counter count_add(counter c, reg a, reg b) noexcept { return vsubq_u32(c, vceqq_s32(a, b)); }
+    static std::size_t count_drain(counter c) noexcept { return vaddvq_u32(c); }
+};
+
+template <>
+struct simd_ops<std::uint32_t> {
+    static constexpr bool enabled = true;
+    using reg = uint32x4_t;
+    static constexpr std::size_t lanes = 4;
+    static constexpr unsigned bits_per_lane = 1;
+    static constexpr unsigned full_mask = 0xFu;
+
+    static reg load(const std::uint32_t* p) noexcept { return vld1q_u32(p); }
+    static reg splat(std::uint32_t v) noexcept { return vdupq_n_u32(v); }
+    static unsigned match(reg a, reg b) noexcept { return neon_lane_bits(vceqq_u32(a, b)); }
+
+    using counter = uint32x4_t;
+    static counter count_zero() noexcept { return vdupq_n_u32(0); }
+    static counter count_add(counter c, reg a, reg b) noexcept { return vsubq_u32(c, vceqq_u32(a, b)); }
+    static std::size_t count_drain(counter c) noexcept { return vaddvq_u32(c); }
+};
+
+template <>
+struct simd_ops<float> {
+    static constexpr bool enabled = true;
+    using reg = float32x4_t;
+    static constexpr std::size_t lanes = 4;
+    static constexpr unsigned bits_per_lane = 1;
+    static constexpr unsigned full_mask = 0xFu;
+
+    static reg load(const float* p) noexcept { return vld1q_f32(p); }
+    static reg splat(float v) noexcept { return vdupq_n_f32(v); }
+    static unsigned match(reg a, reg b) noexcept { return neon_lane_bits(vceqq_f32(a, b)); }
+
+    using counter = uint32x4_t;
+    static counter count_zero() noexcept { return vdupq_n_u32(0); }
+    static counter count_add(counter c, reg a, reg b) noexcept { return vsubq_u32(c, vceqq_f32(a, b)); }
+    static std::size_t count_drain(counter c) noexcept { return vaddvq_u32(c); }
+};
+
+template <>
+struct simd_minmax<std::int32_t> {
+    static constexpr bool enabled = true;
+    using reg = int32x4_t;
+    static reg min(reg a, reg b) noexcept { return vminq_s32(a, b); }
+    static reg max(reg a, reg b) noexcept { return vmaxq_s32(a, b); }
+    static void store(std::int32_t* out, reg v) noexcept { vst1q_s32(out, v); }
+};
+
+template <>
+struct simd_minmax<std::uint32_t> {
+    static constexpr bool enabled = true;
+    using reg = uint32x4_t;
+    static reg min(reg a, reg b) noexcept { return vminq_u32(a, b); }
+    static reg max(reg a, reg b) noexcept { return vmaxq_u32(a, b); }
+    static void store(std::uint32_t* out, reg v) noexcept { vst1q_u32(out, v); }
+};
+
+template <>
+struct simd_minmax<float> {
+    static constexpr bool enabled = true;
+    using reg = float32x4_t;
+    static reg min(reg a, reg b) noexcept { return vminq_f32(a, b); }
+    static reg max(reg a, reg b) noexcept { return vmaxq_f32(a, b); }
+    static void store(float* out, reg v) noexcept { vst1q_f32(out, v); }
+};
+
+template <>
+struct simd_sum<std::int32_t> {
+    static constexpr bool enabled = true;
+    using acc = int64x2_t;
+    static acc zero() noexcept { return vdupq_n_s64(0); }
+    static acc add(acc a, int32x4_t v) noexcept { return vpadalq_s32(a, v); }
+    static std::int64_t reduce(acc a) noexcept { return vaddvq_s64(a); }
+};
+
+template <>
+struct simd_sum<std::uint32_t> {
+    static constexpr bool enabled = true;
+    using acc = uint64x2_t;
+    static acc zero() noexcept { return vdupq_n_u64(0); }
+    static acc add(acc a, uint32x4_t v) noexcept { return vpadalq_u32(a, v); }
+    static std::uint64_t reduce(acc a) noexcept { return vaddvq_u64(a); }
+};
+
+template <>
+struct simd_sum<float> {
+    static constexpr bool enabled = true;
+    using acc = float64x2_t;
+    static acc zero() noexcept { return vdupq_n_f64(0.0); }
+    static acc add(acc a, float32x4_t v) noexcept {
+        a = vaddq_f64(a, vcvt_f64_f32(vget_low_f32(v)));
+        return vaddq_f64(a, vcvt_high_f64_f32(v));
+    }
+    static double reduce(acc a) noexcept { return vaddvq_f64(a); }
+};
+
+#endif
+
+// ==================== 通用内核 ====================
+
+#if TS_STL_SIMD_AVX2 || TS_STL_SIMD_SSE2 || TS_STL_SIMD_NEON
+
+template <typename T>
+const T* simd_find(const T* first, const T* last, const T& value) noexcept {
+    using ops = simd_ops<T>;
+    const auto needle = ops::splat(value);
+    while (static_cast<std::size_t>(last - first) >= ops::lanes) {
+        unsigned bits = ops::match(ops::load(first), needle);
+        if (bits != 0) {
+            return first + simd_ctz(bits) / ops::bits_per_lane;
+        }
+        first += ops::lanes;
+    }
+    return std::find(first, last, value);
+}
+
+template <typename T>
+std::size_t simd_count(const T* first, const T* last, const T& value) noexcept {
+    using ops = simd_ops<T>;
+    const auto needle = ops::splat(value);
+    std::size_t total = 0;
+    std::size_t blocks = static_cast<std::size_t>(last - first) / ops::lanes;
+    while (blocks != 0) {
+        // 8 位 lane 的计数器最多累加 255 次，之后横向倒出
+        std::size_t batch = blocks < 255 ? blocks : 255;
+        blocks -= batch;
+        auto counter = ops::count_zero();
+        for (; batch != 0; --batch, first += ops::lanes) {
+            counter = ops::count_add(counter, ops::load(first), needle);
+        }
+        total += ops::count_drain(counter);
+    }
+    return total + static_cast<std::size_t>(std::count(first, last, value));
+}
+
+template <typename T>
+bool simd_equal(const T* a, const T* b, std::size_t n) noexcept {
+    using ops = simd_ops<T>;
+    std::size_t i = 0;
+    for (; n - i >= ops::lanes; i += ops::lanes) {
+        if (ops::match(ops::load(a + i), ops::load(b + i)) != ops::full_mask) {
+            return false;
+        }
+    }
+    return std::equal(a + i, a + n, b + i);
+}
+
+/**
+ * @brief 向量化求最小/最大值，再用 simd_find 定位第一次出现的位置（与 std::min_element 相同）
+ *
+ * 浮点数据中出现 NaN 时退回 std::min_element / std::max_element，保持其比较语义
+ */
+template <bool IsMin, typename T>
+const T* simd_extremum(const T* first, const T* last) noexcept {
+    using ops = simd_ops<T>;
+    using mm = simd_minmax<T>;
+    auto scalar = [first, last]() {
+        return IsMin ? std::min_element(first, last) : std::max_element(first, last);
+    };
+    if (static_cast<std::size_t>(last - first) < ops::lanes) {
+        return scalar();
+    }
+    auto acc = ops::load(first);
+    unsigned ordered = ops::full_mask;
+    if constexpr (std::is_floating_point_v<T>) {
+        ordered &= ops::match(acc, acc);
+    }
+    const T* p = first + ops::lanes;
+    for (; static_cast<std::size_t>(last - p) >= ops::lanes; p += ops::lanes) {
+        auto v = ops::load(p);
+        acc = IsMin ? mm::min(acc, v) : mm::max(acc, v);
+        if constexpr (std::is_floating_point_v<T>) {
+            ordered &= ops::match(v, v);
+        }
+    }
+    T lanes[ops::lanes];
+    mm::store(lanes, acc);
+    T best = lanes[0];
+    for (std::size_t i = 1; i < ops::lanes; ++i) {
+        best = IsMin ? std::min(best, lanes[i]) : std::max(best, lanes[i]);
+    }
+    for (; p != last; ++p) {
+        if constexpr (std::is_floating_point_v<T>) {
+            if (!(*p == *p)) {
+                return scalar();
+            }
+        }
+        best = IsMin ? std::min(best, *p) : std::max(best, *p);
+    }
+    if (ordered != ops::full_mask) {
+        return scalar();
+    }
+    return simd_find(first, last, best);
+}
+
+template <typename T>
+simd::sum_result_t<T> simd_accumulate(const T* first, const T* last) noexcept {
+    using ops = simd_ops<T>;
+    using sm = simd_sum<T>;
+    auto acc = sm::zero();
+    while (static_cast<std::size_t>(last - first) >= ops::lanes) {
+        acc = sm::add(acc, ops::load(first));
+        first += ops::lanes;
+    }
+    return scalar_accumulate(sm::reduce(acc), first, last);
+}
+
+#endif
+
+} // namespace detail
+
+namespace simd {
+
+/**
+ * @brief 元素类型 T 的 find / count / equal 是否有向量化实现
+ */
+template <typename T>
+inline constexpr bool is_accelerated_v = detail::simd_ops<T>::enabled;
+
+/**
+ * @brief 在 [first, last) 中查找第一个等于 value 的元素（语义同 std::find，浮点按 operator== 比较）
+ */
+template <typename T>
+const T* find(const T* first, const T* last, const T& value) noexcept {
+#if TS_STL_SIMD_AVX2 || TS_STL_SIMD_SSE2 || TS_STL_SIMD_NEON
+    if constexpr (detail::simd_ops<T>::enabled) {
+        return detail::simd_find(first, last, value);
+    }
+#endif
+    return std::find(first, last, value);
+}
+
+/**
+ * @brief 统计 [first, last) 中等于 value 的元素个数
+ */
+template <typename T>
+std::size_t count(const T* first, const T* last, const T& value) noexcept {
+#if TS_STL_SIMD_AVX2 || TS_STL_SIMD_SSE2 || TS_STL_SIMD_NEON
+    if constexpr (detail::simd_ops<T>::enabled) {
+        return detail::simd_count(first, last, value);
+    }
+#endif
+    return static_cast<std::size_t>(std::count(first, last, value));
+}
+
+/**
+ * @brief 逐元素比较 a[0, n) 与 b[0, n)（浮点按 operator== 比较，NaN 不等于自身）
+ */
+template <typename T>
+bool equal(const T* a, const T* b, std::size_t n) noexcept {
+#if TS_STL_SIMD_AVX2 || TS_STL_SIMD_SSE2 || TS_STL_SIMD_NEON
+    if constexpr (detail::simd_ops<T>::enabled) {
+        return detail::simd_equal(a, b, n);
+    }
+#endif
+    return std::equal(a, a + n, b);
+}
+
+/**
+ * @brief 第一个最小元素的位置，区间为空时返回 last（语义同 std::min_element）
+ */
+template <typename T>
+const T* min_element(const T* first, const T* last) noexcept {
+#if TS_STL_SIMD_AVX2 || TS_STL_SIMD_SSE2 || TS_STL_SIMD_NEON
+    if constexpr (detail::simd_ops<T>::enabled && detail::simd_minmax<T>::enabled) {
+        return detail::simd_extremum<true>(first, last);
+    }
+#endif
+    return std::min_element(first, last);
+}
+
+/**
+ * @brief 第一个最大元素的位置，区间为空时返回 last（语义同 std::max_element）
+ */
+template <typename T>
+const T* max_element(const T* first, const T* last) noexcept {
+#if TS_STL_SIMD_AVX2 || TS_STL_SIMD_SSE2 || TS_STL_SIMD_NEON
+    if constexpr (detail::simd_ops<T>::enabled && detail::simd_minmax<T>::enabled) {
+        return detail::simd_extremum<false>(first, last);
+    }
+#endif
+    return std::max_element(first, last);
+}
+
+/**
+ * @brief 求和，结果类型为 sum_result_t<T>（整数超出 64 位时回绕；浮点向量化时加法顺序与顺序累加不同）
+ */
+template <typename T>
+sum_result_t<T> sum(const T* first, const T* last) noexcept {
+#if TS_STL_SIMD_AVX2 || TS_STL_SIMD_SSE2 || TS_STL_SIMD_NEON
+    if constexpr (detail::simd_ops<T>::enabled && detail::simd_sum<T>::enabled) {
+        return detail::simd_accumulate(first, last);
+    }
+#endif
+    return detail::scalar_accumulate(sum_result_t<T>{}, first, last);
+}
+
+} // namespace simd
+
+} // namespace ts_stl
+
+#endif // TS_SIMD_HPP
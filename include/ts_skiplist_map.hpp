@@ -0,0 +1,767 @@
+#pragma once
+
+#ifndef TS_SKIPLIST_MAP_HPP
+#define TS_SKIPLIST_MAP_HPP
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <stdexcept>
+#include <thread>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "ts_stl_base.hpp"
+
+namespace ts_stl {
+
+namespace detail {
+
+/**
+ * @brief 当前线程所在的读侧临界区嵌套深度（所有 srcu_domain 共用）
+ */
+inline int& srcu_nesting() noexcept {
+    thread_local int depth = 0;
+    return depth;
+}
+
+/**
+ * @brief SRCU 风格的内存回收域
+ *
+ * 读者进入临界区时在当前纪元（0/1）的计数器上加一，退出时减一；计数器按线程分条并填充到
+ * 缓存行，读者之间不争用同一行。写者 synchronize() 翻转纪元并等待旧纪元计数归零，
+ * 此后翻转前摘下的节点不再被任何读者持有，可以安全释放。
+ */
+class srcu_domain {
+public:
+    static constexpr std::size_t stripes = 16;
+
+    class read_guard {
+    public:
+        read_guard(srcu_domain& domain, unsigned idx, std::size_t stripe) noexcept
+            : domain_(&domain), idx_(idx), stripe_(stripe) {
+            ++srcu_nesting();
+        }
+
+        read_guard(read_guard&& other) noexcept
+            : domain_(other.domain_), idx_(other.idx_), stripe_(other.stripe_) {
+            other.domain_ = nullptr;
+        }
+
+        read_guard(const read_guard&) = delete;
+        read_guard& operator=(const read_guard&) = delete;
+        read_guard& operator=(read_guard&&) = delete;
+
+        ~read_guard() {
+            if (domain_) {
+                domain_->counters_[idx_][stripe_].value.fetch_sub(1, std::memory_order_release);
+                --srcu_nesting();
+            }
+        }
+
+    private:
+        srcu_domain* domain_;
+        unsigned idx_;
+        std::size_t stripe_;
+    };
+
+    srcu_domain() = default;
+    srcu_domain(const srcu_domain&) = delete;
+    srcu_domain& operator=(const srcu_domain&) = delete;
+
+    /**
+     * @brief 进入读侧临界区；登记后再次确认纪元未变，保证登记的纪元一定会被写者等待
+     */
+    read_guard read() noexcept {
+        std::size_t stripe = thread_stripe();
+        for (;;) {
+            unsigned idx = epoch_.load() & 1u;
+            counters_[idx][stripe].value.fetch_add(1);
+            if ((epoch_.load() & 1u) == idx) {
+                return read_guard(*this, idx, stripe);
+            }
+            counters_[idx][stripe].value.fetch_sub(1, std::memory_order_release);
+        }
+    }
+
+    /**
+     * @brief 等待在调用前进入的所有读者退出
+     * @note 不得在本线程的读侧临界区内调用（会等待自己）
+     */
+    void synchronize() {
+        std::lock_guard<std::mutex> guard(sync_mutex_);
+        unsigned old_idx = epoch_.fetch_add(1) & 1u;
+        unsigned spins = 0;
+        while (readers(old_idx) != 0) {
+            if (++spins < 64) {
+                cpu_relax();
+            } else {
+                std::this_thread::yield();
+            }
+        }
+    }
+
+private:
+    struct alignas(cache_line_size) counter {
+        std::atomic<std::size_t> value{0};
+    };
+
+    counter counters_[2][stripes];
+    std::atomic<unsigned> epoch_{0};
+    std::mutex sync_mutex_;
+
+    static std::size_t thread_stripe() noexcept {
+        thread_local const std::size_t stripe =
+            mix_hash(std::hash<std::thread::id>{}(std::this_thread::get_id())) % stripes;
+        return stripe;
+    }
+
+    std::size_t readers(unsigned idx) const noexcept {
+        std::size_t total = 0;
+        for (const auto& c : counters_[idx]) {
+            total += c.value.load();
+        }
+        return total;
+    }
+};
+
+} // namespace detail
+
+/**
+ * @brief 并发跳表有序 Map（Lazy Skiplist，节点级加锁 + 无锁查找）
+ * @tparam Key 键类型
+ * @tparam T 值类型
+ * @tparam Compare 比较器（默认使用std::less）
+ *
+ * 与 mapMutex / mapRW 用一把锁保护整棵树不同：
+ * - contains 完全不加锁；get / visit 只锁目标节点（一个字节的自旋锁）读取值
+ * - insert / erase 只锁各层的前驱节点（自底向上、按键降序加锁，不会死锁），
+ *   不相邻的键上的写操作可以并行
+ * - for_each / range 按键升序遍历，不阻塞写者；遍历结果不是原子快照
+ *
+ * 删除的节点先标记、再逐层摘下，最后交给 SRCU 风格的回收域：
+ * 攒够一批后等待所有可能看到它们的读者退出再释放。
+ *
+ * 注意：
+ * - 回调（visit / for_each / range 的 func）在节点锁内执行，不得再访问同一个跳表
+ * - size() 为原子计数，在并发修改下仅是瞬时值
+ * - 不可复制不可移动，需要快照时使用 copy()
+ */
+template <typename Key, typename T, typename Compare = std::less<Key>>
+class skiplist_map {
+public:
+    using key_type = Key;
+    using mapped_type = T;
+    using value_type = std::pair<const Key, T>;
+    using size_type = std::size_t;
+
+    static constexpr int max_height = 20;
+
+private:
+    struct alignas(std::atomic<void*>) node {
+        mutable SpinLock lock;
+        std::atomic<bool> marked{false};
+        std::atomic<bool> fully_linked{false};
+        int height;
+        alignas(value_type) unsigned char storage[sizeof(value_type)];
+
+        explicit node(int h) noexcept : height(h) {
+            for (int i = 0; i < h; ++i) {
+                new (&next()[i]) std::atomic<node*>(nullptr);
+            }
+        }
+
+        // 各层后继指针紧跟在节点之后
+        std::atomic<node*>* next() noexcept {
+            return reinterpret_cast<std::atomic<node*>*>(this + 1);
+        }
+
+        value_type& kv() noexcept {
+            return *std::launder(reinterpret_cast<value_type*>(storage));
+        }
+
+        const Key& key() noexcept {
+            return kv().first;
+        }
+    };
+
+    static constexpr std::align_val_t node_alignment{alignof(node)};
+    static constexpr size_type reclaim_batch = 256;
+
+    node* head_;
+    Compare comp_;
+    std::atomic<int> height_{1};
+    std::atomic<size_type> size_{0};
+
+    mutable detail::srcu_domain domain_;
+    std::mutex retired_mutex_;
+    std::vector<node*> retired_;
+
+    // ==================== 节点分配 ====================
+
+    static node* allocate_node(int height) {
+        void* mem = ::operator new(sizeof(node) + sizeof(std::atomic<node*>) * static_cast<size_type>(height),
+                                   node_alignment);
+        return new (mem) node(height);
+    }
+
+    static void deallocate_node(node* n) noexcept {
+        n->~node();
+        ::operator delete(n, node_alignment);
+    }
+
+    template <typename K, typename... Args>
+    static node* create_node(int height, K&& key, Args&&... args) {
+        node* n = allocate_node(height);
+        try {
+            new (n->storage) value_type(std::piecewise_construct, std::forward_as_tuple(std::forward<K>(key)),
+                                        std::forward_as_tuple(std::forward<Args>(args)...));
+        } catch (...) {
+            deallocate_node(n);
+            throw;
+        }
+        return n;
+    }
+
+    static void destroy_node(node* n) noexcept {
+        n->kv().~value_type();
+        deallocate_node(n);
+    }
+
+    struct node_deleter {
+        void operator()(node* n) const noexcept { destroy_node(n); }
+    };
+
+    using node_holder = std::unique_ptr<node, node_deleter>;
+
+    // 层高服从 p = 1/4 的几何分布
+    static int random_height() noexcept {
+        thread_local std::uint64_t state =
+            detail::mix_hash(std::hash<std::thread::id>{}(std::this_thread::get_id())) | 1u;
+        state ^= state >> 12;
+        state ^= state << 25;
+        state ^= state >> 27;
+        std::uint64_t bits = state * 2685821657736338717ULL;
+        int height = 1;
+        while (height < max_height && (bits & 3u) == 0) {
+            ++height;
+            bits >>= 2;
+        }
+        return height;
+    }
+
+    // ==================== 查找 ====================
+
+    bool less(node* n, const Key& key) const {
+        return comp_(n->key(), key);
+    }
+
+    bool equal(node* n, const Key& key) const {
+        return !comp_(key, n->key());
+    }
+
+    /**
+     * @brief 自上而下查找各层前驱与后继（调用方处于读侧临界区）
+     * @return 找到键时返回其所在的最高层，否则返回 -1
+     */
+    int find(const Key& key, node** preds, node** succs, int top) const {
+        int found = -1;
+        node* pred = head_;
+        for (int level = top - 1; level >= 0; --level) {
+            node* curr = pred->next()[level].load(std::memory_order_acquire);
+            while (curr && less(curr, key)) {
+                pred = curr;
+                curr = pred->next()[level].load(std::memory_order_acquire);
+            }
+            if (found == -1 && curr && equal(curr, key)) {
+                found = level;
+            }
+            preds[level] = pred;
+            succs[level] = curr;
+        }
+        return found;
+    }
+
+    // 第一个键不小于 key 的节点（不要求前驱）
+    node* lower_bound_node(const Key& key) const {
+        node* pred = head_;
+        node* curr = nullptr;
+        for (int level = height_.load(std::memory_order_acquire) - 1; level >= 0; --level) {
+            curr = pred->next()[level].load(std::memory_order_acquire);
+            while (curr && less(curr, key)) {
+                pred = curr;
+                curr = pred->next()[level].load(std::memory_order_acquire);
+            }
+        }
+        return curr;
+    }
+
+    // 键存在且已完整插入、未被删除时返回节点
+    node* find_live(const Key& key) const {
+        node* preds[max_height];
+        node* succs[max_height];
+        int found = find(key, preds, succs, height_.load(std::memory_order_acquire));
+        if (found == -1) {
+            return nullptr;
+        }
+        node* n = succs[found];
+        if (!n->fully_linked.load(std::memory_order_acquire) || n->marked.load(std::memory_order_acquire)) {
+            return nullptr;
+        }
+        return n;
+    }
+
+    // 依次释放 preds[0, count) 中不同节点的锁
+    static void unlock_preds(node** preds, int count) noexcept {
+        node* prev = nullptr;
+        for (int level = 0; level < count; ++level) {
+            if (preds[level] != prev) {
+                preds[level]->lock.unlock();
+                prev = preds[level];
+            }
+        }
+    }
+
+    /**
+     * @brief 自底向上锁住 preds[0, top)，并校验前驱与后继均未删除、链接未改变
+     * @param locked 输出实际加锁到的层数（用于释放）
+     */
+    static bool lock_and_validate(node** preds, node** succs, int top, int& locked) noexcept {
+        node* prev = nullptr;
+        locked = 0;
+        for (int level = 0; level < top; ++level) {
+            node* pred = preds[level];
+            node* succ = succs[level];
+            if (pred != prev) {
+                pred->lock.lock();
+                prev = pred;
+            }
+            locked = level + 1;
+            bool valid = !pred->marked.load(std::memory_order_acquire) &&
+                         (succ == nullptr || !succ->marked.load(std::memory_order_acquire)) &&
+                         pred->next()[level].load(std::memory_order_acquire) == succ;
+            if (!valid) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // ==================== 插入与删除 ====================
+
+    /**
+     * @brief 插入新键；键已存在时对已有节点执行 on_exists(value_type&)（节点锁内）
+     * @return 是否插入了新元素
+     */
+    template <typename OnExists, typename K, typename... Args>
+    bool insert_impl(OnExists on_exists, K&& key, Args&&... args) {
+        auto section = domain_.read();
+        int top = random_height();
+        int current = height_.load(std::memory_order_acquire);
+        while (top > current && !height_.compare_exchange_weak(current, top, std::memory_order_acq_rel)) {
+        }
+        int search_top = top > current ? top : current;
+
+        node* preds[max_height];
+        node* succs[max_height];
+        // 新节点在链入之前由 node_holder 持有，on_exists 抛出异常时随之释放
+        node_holder fresh;
+        for (;;) {
+            // key 可能已被移动进新节点，之后的重试以节点中的键为准
+            int found = find(fresh ? fresh->key() : static_cast<const Key&>(key), preds, succs, search_top);
+            if (found != -1) {
+                node* existing = succs[found];
+                if (!existing->marked.load(std::memory_order_acquire)) {
+                    while (!existing->fully_linked.load(std::memory_order_acquire)) {
+                        cpu_relax();
+                    }
+                    std::lock_guard<SpinLock> guard(existing->lock);
+                    if (!existing->marked.load(std::memory_order_relaxed)) {
+                        on_exists(existing->kv());
+                        return false;
+                    }
+                }
+                // 旧节点正在被删除，等它摘下后重试
+                continue;
+            }
+            if (!fresh) {
+                fresh.reset(create_node(top, std::forward<K>(key), std::forward<Args>(args)...));
+            }
+            int locked = 0;
+            if (!lock_and_validate(preds, succs, top, locked)) {
+                unlock_preds(preds, locked);
+                continue;
+            }
+            for (int level = 0; level < top; ++level) {
+                fresh->next()[level].store(succs[level], std::memory_order_relaxed);
+            }
+            node* linked = fresh.release();
+            for (int level = 0; level < top; ++level) {
+                preds[level]->next()[level].store(linked, std::memory_order_release);
+            }
+            linked->fully_linked.store(true, std::memory_order_release);
+            size_.fetch_add(1, std::memory_order_relaxed);
+            unlock_preds(preds, top);
+            return true;
+        }
+    }
+
+    // 标记并摘下节点，返回被摘下的节点（键不存在时返回 nullptr）
+    node* unlink_impl(const Key& key) {
+        auto section = domain_.read();
+        node* preds[max_height];
+        node* succs[max_height];
+        node* victim = nullptr;
+        int top = 0;
+        for (;;) {
+            int found = find(key, preds, succs, height_.load(std::memory_order_acquire));
+            if (!victim) {
+                if (found == -1) {
+                    return nullptr;
+                }
+                node* candidate = succs[found];
+                if (!candidate->fully_linked.load(std::memory_order_acquire) ||
+                    candidate->marked.load(std::memory_order_acquire) || candidate->height - 1 != found) {
+                    return nullptr;
+                }
+                candidate->lock.lock();
+                if (candidate->marked.load(std::memory_order_relaxed)) {
+                    candidate->lock.unlock();
+                    return nullptr;
+                }
+                candidate->marked.store(true, std::memory_order_release);
+                victim = candidate;
+                top = victim->height;
+            }
+            int locked = 0;
+            bool valid = true;
+            {
+                node* prev = nullptr;
+                for (int level = 0; level < top; ++level) {
+                    node* pred = preds[level];
+                    if (pred != prev) {
+                        pred->lock.lock();
+                        prev = pred;
+                    }
+                    locked = level + 1;
+                    if (pred->marked.load(std::memory_order_acquire) ||
+                        pred->next()[level].load(std::memory_order_acquire) != victim) {
+                        valid = false;
+                        break;
+                    }
+                }
+            }
+            if (!valid) {
+                unlock_preds(preds, locked);
+                continue;
+            }
+            for (int level = top - 1; level >= 0; --level) {
+                preds[level]->next()[level].store(victim->next()[level].load(std::memory_order_relaxed),
+                                                  std::memory_order_release);
+            }
+            size_.fetch_sub(1, std::memory_order_relaxed);
+            victim->lock.unlock();
+            unlock_preds(preds, top);
+            return victim;
+        }
+    }
+
+    // ==================== 内存回收 ====================
+
+    void retire(node* n) {
+        bool full = false;
+        {
+            std::lock_guard<std::mutex> guard(retired_mutex_);
+            retired_.push_back(n);
+            full = retired_.size() >= reclaim_batch;
+        }
+        // 在读侧临界区内（例如 for_each 回调里）等待读者会等到自己，留给之后的写者回收
+        if (full && detail::srcu_nesting() == 0) {
+            reclaim();
+        }
+    }
+
+    void reclaim() {
+        std::vector<node*> batch;
+        {
+            std::lock_guard<std::mutex> guard(retired_mutex_);
+            batch.swap(retired_);
+        }
+        if (batch.empty()) {
+            return;
+        }
+        domain_.synchronize();
+        for (node* n : batch) {
+            destroy_node(n);
+        }
+    }
+
+    // ==================== 有序遍历 ====================
+
+    /**
+     * @brief 从 first 开始按序访问已完整插入且未删除的节点，直到 in_range 不成立或 visit 返回 false
+     */
+    template <typename InRange, typename Visit>
+    size_type scan(node* first, InRange in_range, Visit visit) const {
+        size_type visited = 0;
+        for (node* n = first; n && in_range(n); n = n->next()[0].load(std::memory_order_acquire)) {
+            if (!n->fully_linked.load(std::memory_order_acquire)) {
+                continue;
+            }
+            std::lock_guard<SpinLock> guard(n->lock);
+            if (n->marked.load(std::memory_order_relaxed)) {
+                continue;
+            }
+            ++visited;
+            const value_type& kv = n->kv();
+            if (!detail::invoke_continue(visit, kv.first, kv.second)) {
+                break;
+            }
+        }
+        return visited;
+    }
+
+public:
+    // ==================== 构造函数 ====================
+
+    skiplist_map() : skiplist_map(Compare()) {}
+
+    explicit skiplist_map(const Compare& comp) : head_(allocate_node(max_height)), comp_(comp) {}
+
+    template <typename InputIt>
+    skiplist_map(InputIt first, InputIt last) : skiplist_map() {
+        for (; first != last; ++first) {
+            insert(first->first, first->second);
+        }
+    }
+
+    skiplist_map(const skiplist_map&) = delete;
+    skiplist_map& operator=(const skiplist_map&) = delete;
+
+    ~skiplist_map() {
+        node* n = head_->next()[0].load(std::memory_order_relaxed);
+        while (n) {
+            node* next = n->next()[0].load(std::memory_order_relaxed);
+            destroy_node(n);
+            n = next;
+        }
+        for (node* r : retired_) {
+            destroy_node(r);
+        }
+        deallocate_node(head_);
+    }
+
+    // ==================== 元素访问 ====================
+
+    /**
+     * @brief 获取指定键的值，如果不存在返回默认值（只锁目标节点）
+     */
+    T get(const Key& key, const T& default_value = T()) const {
+        auto section = domain_.read();
+        node* n = find_live(key);
+        if (n) {
+            std::lock_guard<SpinLock> guard(n->lock);
+            if (!n->marked.load(std::memory_order_relaxed)) {
+                return n->kv().second;
+            }
+        }
+        return default_value;
+    }
+
+    T at(const Key& key) const {
+        auto section = domain_.read();
+        node* n = find_live(key);
+        if (n) {
+            std::lock_guard<SpinLock> guard(n->lock);
+            if (!n->marked.load(std::memory_order_relaxed)) {
+                return n->kv().second;
+            }
+        }
+        throw std::out_of_range("skiplist_map::at");
+    }
+
+    /**
+     * @brief 插入或覆盖指定键的值
+     */
+    void set(const Key& key, const T& value) {
+        insert_impl([&value](value_type& kv) { kv.second = value; }, key, value);
+    }
+
+    /**
+     * @brief 在节点锁内对键对应的值执行 func(const T&)
+     * @return 键存在时返回 true
+     */
+    template <typename Func>
+    bool visit(const Key& key, Func func) const {
+        auto section = domain_.read();
+        node* n = find_live(key);
+        if (!n) {
+            return false;
+        }
+        std::lock_guard<SpinLock> guard(n->lock);
+        if (n->marked.load(std::memory_order_relaxed)) {
+            return false;
+        }
+        func(static_cast<const T&>(n->kv().second));
+        return true;
+    }
+
+    /**
+     * @brief 在节点锁内对键对应的值执行 func(T&)，原地修改
+     * @return 键存在时返回 true
+     */
+    template <typename Func>
+    bool visit_mut(const Key& key, Func func) {
+        auto section = domain_.read();
+        node* n = find_live(key);
+        if (!n) {
+            return false;
+        }
+        std::lock_guard<SpinLock> guard(n->lock);
+        if (n->marked.load(std::memory_order_relaxed)) {
+            return false;
+        }
+        func(n->kv().second);
+        return true;
+    }
+
+    // ==================== 容量管理 ====================
+
+    size_type size() const noexcept {
+        return size_.load(std::memory_order_relaxed);
+    }
+
+    bool empty() const noexcept {
+        return size() == 0;
+    }
+
+    /**
+     * @brief 逐个删除所有元素（并发插入的元素可能保留）
+     */
+    void clear() {
+        std::vector<Key> keys;
+        for_each([&keys](const Key& key, const T&) { keys.push_back(key); });
+        for (const auto& key : keys) {
+            erase(key);
+        }
+    }
+
+    // ==================== 查找操作 ====================
+
+    /**
+     * @brief 查找指定键（不加任何锁）
+     */
+    bool contains(const Key& key) const {
+        auto section = domain_.read();
+        return find_live(key) != nullptr;
+    }
+
+    size_type count(const Key& key) const {
+        return contains(key) ? 1 : 0;
+    }
+
+    // ==================== 修改操作 ====================
+
+    /**
+     * @brief 插入键值对
+     * @return 是否插入了新元素，键已存在时返回 false 且原值保持不变
+     */
+    bool insert(const Key& key, const T& value) {
+        return insert_impl([](value_type&) {}, key, value);
+    }
+
+    bool insert(const Key& key, T&& value) {
+        return insert_impl([](value_type&) {}, key, std::move(value));
+    }
+
+    /**
+     * @brief 原地构造并插入（键已存在时返回 false）
+     */
+    template <typename... Args>
+    bool emplace(const Key& key, Args&&... args) {
+        return insert_impl([](value_type&) {}, key, std::forward<Args>(args)...);
+    }
+
+    /**
+     * @brief 键不存在时插入 value，否则在节点锁内执行 func(T& existing, const T& value) 合并
+     * @return 是否插入了新元素
+     */
+    template <typename Func>
+    bool merge(const Key& key, const T& value, Func func) {
+        return insert_impl([&](value_type& kv) { func(kv.second, value); }, key, value);
+    }
+
+    /**
+     * @brief 移除指定键
+     */
+    size_type erase(const Key& key) {
+        node* victim = unlink_impl(key);
+        if (!victim) {
+            return 0;
+        }
+        retire(victim);
+        return 1;
+    }
+
+    // ==================== 迭代和查询（有序） ====================
+
+    /**
+     * @brief 按键升序对每个元素执行 func(const Key&, const T&)，不阻塞写者
+     */
+    template <typename Func>
+    void for_each(Func func) const {
+        auto section = domain_.read();
+        scan(head_->next()[0].load(std::memory_order_acquire), [](node*) { return true; },
+             [&func](const Key& key, const T& value) { func(key, value); });
+    }
+
+    /**
+     * @brief 按键升序对 [lo, hi) 内的元素执行 func(const Key&, const T&)
+     *
+     * func 返回 bool 时，返回 false 即停止扫描
+     * @return 访问的元素个数
+     */
+    template <typename Func>
+    size_type range(const Key& lo, const Key& hi, Func func) const {
+        auto section = domain_.read();
+        return scan(lower_bound_node(lo), [this, &hi](node* n) { return less(n, hi); }, func);
+    }
+
+    /**
+     * @brief 把 [lo, hi) 内至多 limit 个元素按键升序写入 out
+     * @return 写入的元素个数
+     */
+    template <typename OutputIt>
+    size_type collect_range(const Key& lo, const Key& hi, OutputIt out,
+                            size_type limit = std::numeric_limits<size_type>::max()) const {
+        if (limit == 0) {
+            return 0;
+        }
+        size_type written = 0;
+        range(lo, hi, [&](const Key& key, const T& value) {
+            *out = std::pair<Key, T>(key, value);
+            ++out;
+            return ++written < limit;
+        });
+        return written;
+    }
+
+    /**
+     * @brief 复制为 std::map（逐节点读取，不是原子快照）
+     */
+    std::map<Key, T, Compare> copy() const {
+        std::map<Key, T, Compare> out(comp_);
+        for_each([&out](const Key& key, const T& value) { out.emplace_hint(out.end(), key, value); });
+        return out;
+    }
+};
+
+} // namespace ts_stl
+
+#endif // TS_SKIPLIST_MAP_HPP
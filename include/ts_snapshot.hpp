@@ -0,0 +1,250 @@
+#pragma once
+
+#ifndef TS_SNAPSHOT_HPP
+#define TS_SNAPSHOT_HPP
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <utility>
+
+#include "ts_stl_base.hpp"
+
+namespace ts_stl {
+
+/**
+ * @brief 写时复制（RCU 风格）快照容器
+ * @tparam Container 被保护的标准容器类型（如 std::map、std::unordered_map）
+ *
+ * 当前版本以 shared_ptr<const Container> 原子发布：
+ * - 读者取得某个不可变版本后无需任何锁，可在其上任意遍历
+ * - 写者在写锁内复制当前版本、修改副本、再原子发布（clone-modify-publish）
+ * - 旧版本在最后一个持有者释放后自动回收（引用计数即宽限期）
+ *
+ * 高频读取请使用 reader()：读者句柄缓存当前版本，只在版本号变化时才重新加载，
+ * 稳态下每次读取只有一次对只读缓存行的原子加载，不修改任何共享状态。
+ *
+ * 适合读取极多、整体重建较少的查找表（路由表、配置表等）。
+ */
+template <typename Container>
+class snapshot {
+public:
+    using container_type = Container;
+    using value_type = typename Container::value_type;
+    using size_type = typename Container::size_type;
+    using pointer = std::shared_ptr<const Container>;
+
+private:
+#if defined(__cpp_lib_atomic_shared_ptr)
+    std::atomic<pointer> current_;
+
+    pointer load_current() const noexcept {
+        return current_.load(std::memory_order_acquire);
+    }
+
+    void store_current(pointer p) noexcept {
+        current_.store(std::move(p), std::memory_order_release);
+    }
+#else
+    pointer current_;
+
+    pointer load_current() const noexcept {
+        return std::atomic_load_explicit(&current_, std::memory_order_acquire);
+    }
+
+    void store_current(pointer p) noexcept {
+        std::atomic_store_explicit(&current_, std::move(p), std::memory_order_release);
+    }
+#endif
+
+    // 版本号与写锁放在独立缓存行，写者加锁不干扰读者读取版本号
+    alignas(cache_line_size) std::atomic<std::uint64_t> version_{0};
+    alignas(cache_line_size) mutable std::mutex writer_mutex_;
+
+    void publish(pointer p) {
+        store_current(std::move(p));
+        version_.fetch_add(1, std::memory_order_release);
+    }
+
+public:
+    /**
+     * @brief 读者句柄：缓存当前版本，仅在发布新版本后刷新
+     *
+     * 每个句柄只应由一个线程使用；句柄存活期间其持有的版本不会被回收。
+     */
+    class reader {
+    public:
+        explicit reader(const snapshot& owner)
+            : owner_(&owner),
+              version_(owner.version_.load(std::memory_order_acquire)),
+              data_(owner.load_current()) {}
+
+        /**
+         * @brief 获取最新版本的只读引用（在下次调用前保持有效）
+         */
+        const Container& get() {
+            std::uint64_t v = owner_->version_.load(std::memory_order_acquire);
+            if (v != version_) {
+                data_ = owner_->load_current();
+                version_ = v;
+            }
+            return *data_;
+        }
+
+        const Container& operator*() {
+            return get();
+        }
+
+        const Container* operator->() {
+            return &get();
+        }
+
+    private:
+        const snapshot* owner_;
+        std::uint64_t version_;
+        pointer data_;
+    };
+
+    // ==================== 构造函数 ====================
+
+    snapshot() : current_(std::make_shared<const Container>()) {}
+
+    explicit snapshot(Container initial)
+        : current_(std::make_shared<const Container>(std::move(initial))) {}
+
+    template <typename InputIt>
+    snapshot(InputIt first, InputIt last)
+        : current_(std::make_shared<const Container>(first, last)) {}
+
+    // 读者句柄持有指向本对象的指针，快照不可复制不可移动
+    snapshot(const snapshot&) = delete;
+    snapshot& operator=(const snapshot&) = delete;
+
+    // ==================== 读接口（无锁） ====================
+
+    /**
+     * @brief 获取当前版本（引用计数保证在持有期间不被回收）
+     */
+    pointer load() const noexcept {
+        return load_current();
+    }
+
+    /**
+     * @brief 创建读者句柄
+     */
+    reader get_reader() const {
+        return reader(*this);
+    }
+
+    /**
+     * @brief 在当前版本上执行只读操作
+     */
+    template <typename Func>
+    auto read(Func func) const {
+        pointer p = load_current();
+        return func(*p);
+    }
+
+    size_type size() const {
+        return load_current()->size();
+    }
+
+    bool empty() const {
+        return load_current()->empty();
+    }
+
+    template <typename Func>
+    void for_each(Func func) const {
+        pointer p = load_current();
+        for (const auto& item : *p) {
+            func(item);
+        }
+    }
+
+    template <typename Predicate>
+    std::optional<value_type> find_if(Predicate pred) const {
+        pointer p = load_current();
+        for (const auto& item : *p) {
+            if (pred(item)) {
+                return item;
+            }
+        }
+        return std::nullopt;
+    }
+
+    template <typename Predicate>
+    size_type count_if(Predicate pred) const {
+        pointer p = load_current();
+        size_type n = 0;
+        for (const auto& item : *p) {
+            if (pred(item)) {
+                ++n;
+            }
+        }
+        return n;
+    }
+
+    /**
+     * @brief 关联容器查找（仅适用于带 find 的容器）
+     */
+    template <typename Key>
+    bool contains(const Key& key) const {
+        pointer p = load_current();
+        return p->find(key) != p->end();
+    }
+
+    /**
+     * @brief 关联容器按键取值，不存在时返回默认值（仅适用于 map 类容器）
+     */
+    template <typename Key>
+    typename Container::mapped_type get(const Key& key,
+                                        const typename Container::mapped_type& default_value =
+                                            typename Container::mapped_type()) const {
+        pointer p = load_current();
+        auto it = p->find(key);
+        return it != p->end() ? it->second : default_value;
+    }
+
+    /**
+     * @brief 已发布的版本数
+     */
+    std::uint64_t version() const noexcept {
+        return version_.load(std::memory_order_acquire);
+    }
+
+    // ==================== 写接口（复制-修改-发布） ====================
+
+    /**
+     * @brief 复制当前版本，在副本上执行 func(Container&) 后发布
+     *
+     * 写者之间互斥；读者在发布前后分别看到完整的旧版本或新版本。
+     */
+    template <typename Func>
+    void update(Func func) {
+        std::lock_guard<std::mutex> lock(writer_mutex_);
+        auto next = std::make_shared<Container>(*load_current());
+        func(*next);
+        publish(std::move(next));
+    }
+
+    /**
+     * @brief 直接发布一个全新的版本（整体重建）
+     */
+    void store(Container replacement) {
+        std::lock_guard<std::mutex> lock(writer_mutex_);
+        publish(std::make_shared<const Container>(std::move(replacement)));
+    }
+
+    /**
+     * @brief 发布空容器
+     */
+    void clear() {
+        store(Container());
+    }
+};
+
+} // namespace ts_stl
+
+#endif // TS_SNAPSHOT_HPP
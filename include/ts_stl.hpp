@@ -6,14 +6,32 @@
 // 包含基础组件（锁和容器基类）
 #include "ts_stl_base.hpp"
 
+#include <string>
+
 // 包含具体容器实现
 #include "ts_vector.hpp"
+#include "ts_concurrent_vector.hpp"
 #include "ts_list.hpp"
+#include "ts_concurrent_list.hpp"
 #include "ts_map.hpp"
+#include "ts_skiplist_map.hpp"
 #include "ts_unordered_map.hpp"
 #include "ts_set.hpp"
 #include "ts_unordered_set.hpp"
 #include "ts_deque.hpp"
+#include "ts_sharded_unordered_map.hpp"
+#include "ts_lru_cache.hpp"
+#include "ts_array_of.hpp"
+#include "ts_flat_unordered_map.hpp"
+#include "ts_incremental_unordered_map.hpp"
+#include "ts_flat_map.hpp"
+#include "ts_blocking_queue.hpp"
+#include "ts_priority_queue.hpp"
+#include "ts_ring_buffer.hpp"
+#include "ts_seqlock.hpp"
+#include "ts_snapshot.hpp"
+#include "ts_persist.hpp"
+#include "ts_pmr.hpp"
 
 namespace ts_stl {
 
@@ -33,10 +51,22 @@ using vectorRW = vector<T, LockPolicy::ReadWrite>;
 template <typename T>
 using vectorSpinLock = vector<T, LockPolicy::SpinLock>;
 
+// 使用自适应锁（自旋退避后休眠）的线程安全vector
+template <typename T>
+using vectorAdaptive = vector<T, LockPolicy::Adaptive>;
+
+// 使用排号锁（FIFO 公平）的线程安全vector
+template <typename T>
+using vectorTicket = vector<T, LockPolicy::Ticket>;
+
 // 使用无锁策略的线程安全vector（极限性能，需要外部同步）
 template <typename T>
 using vectorLockFree = vector<T, LockPolicy::LockFree>;
 
+// 只追加的分段并发vector（push_back / grow_by 以原子 fetch_add 预留槽位，不加锁）
+template <typename T>
+using vectorConcurrent = concurrent_vector<T>;
+
 // 使用互斥锁的线程安全list
 template <typename T>
 using listMutex = list<T, LockPolicy::Mutex>;
@@ -45,10 +75,22 @@ using listMutex = list<T, LockPolicy::Mutex>;
 template <typename T>
 using listSpinLock = list<T, LockPolicy::SpinLock>;
 
+// 使用自适应锁（自旋退避后休眠）的线程安全list
+template <typename T>
+using listAdaptive = list<T, LockPolicy::Adaptive>;
+
+// 使用排号锁（FIFO 公平）的线程安全list
+template <typename T>
+using listTicket = list<T, LockPolicy::Ticket>;
+
 // 使用无锁策略的线程安全list（极限性能，需要外部同步）
 template <typename T>
 using listLockFree = list<T, LockPolicy::LockFree>;
 
+// 每个节点一把自旋锁的细粒度list（队首/队尾并发操作互不阻塞）
+template <typename T>
+using listConcurrent = concurrent_list<T, LockPolicy::SpinLock>;
+
 #if TS_STL_SUPPORT_RW_LOCK
 // 使用读写锁的线程安全list（仅C++17及以上）
 template <typename T>
@@ -71,10 +113,22 @@ using mapRW = map<Key, T, Compare, LockPolicy::ReadWrite>;
 template <typename Key, typename T, typename Compare = std::less<Key>>
 using mapSpinLock = map<Key, T, Compare, LockPolicy::SpinLock>;
 
+// 使用自适应锁（自旋退避后休眠）的线程安全map
+template <typename Key, typename T, typename Compare = std::less<Key>>
+using mapAdaptive = map<Key, T, Compare, LockPolicy::Adaptive>;
+
+// 使用排号锁（FIFO 公平）的线程安全map
+template <typename Key, typename T, typename Compare = std::less<Key>>
+using mapTicket = map<Key, T, Compare, LockPolicy::Ticket>;
+
 // 使用无锁策略的线程安全map（极限性能，需要外部同步）
 template <typename Key, typename T, typename Compare = std::less<Key>>
 using mapLockFree = map<Key, T, Compare, LockPolicy::LockFree>;
 
+// 节点级加锁的并发跳表map（写操作随核数扩展，查找不加锁）
+template <typename Key, typename T, typename Compare = std::less<Key>>
+using mapConcurrent = skiplist_map<Key, T, Compare>;
+
 // ==================== Unordered Map 类型别名 ====================
 
 // 使用互斥锁的线程安全unordered_map
@@ -91,10 +145,186 @@ using unordered_mapRW = unordered_map<Key, T, Hash, KeyEqual, LockPolicy::ReadWr
 template <typename Key, typename T, typename Hash = std::hash<Key>, typename KeyEqual = std::equal_to<Key>>
 using unordered_mapSpinLock = unordered_map<Key, T, Hash, KeyEqual, LockPolicy::SpinLock>;
 
+// 使用自适应锁（自旋退避后休眠）的线程安全unordered_map
+template <typename Key, typename T, typename Hash = std::hash<Key>, typename KeyEqual = std::equal_to<Key>>
+using unordered_mapAdaptive = unordered_map<Key, T, Hash, KeyEqual, LockPolicy::Adaptive>;
+
+// 使用排号锁（FIFO 公平）的线程安全unordered_map
+template <typename Key, typename T, typename Hash = std::hash<Key>, typename KeyEqual = std::equal_to<Key>>
+using unordered_mapTicket = unordered_map<Key, T, Hash, KeyEqual, LockPolicy::Ticket>;
+
 // 使用无锁策略的线程安全unordered_map（极限性能，需要外部同步）
 template <typename Key, typename T, typename Hash = std::hash<Key>, typename KeyEqual = std::equal_to<Key>>
 using unordered_mapLockFree = unordered_map<Key, T, Hash, KeyEqual, LockPolicy::LockFree>;
 
+// ==================== Sharded Unordered Map 类型别名 ====================
+
+// 每个分片使用互斥锁的分片unordered_map（写密集场景）
+template <typename Key, typename T, std::size_t Shards = 16, typename Hash = std::hash<Key>, typename KeyEqual = std::equal_to<Key>>
+using sharded_unordered_mapMutex = sharded_unordered_map<Key, T, Shards, Hash, KeyEqual, LockPolicy::Mutex>;
+
+#if TS_STL_SUPPORT_RW_LOCK
+// 每个分片使用读写锁的分片unordered_map（仅C++17及以上）
+template <typename Key, typename T, std::size_t Shards = 16, typename Hash = std::hash<Key>, typename KeyEqual = std::equal_to<Key>>
+using sharded_unordered_mapRW = sharded_unordered_map<Key, T, Shards, Hash, KeyEqual, LockPolicy::ReadWrite>;
+#endif
+
+// 每个分片使用自旋锁的分片unordered_map
+template <typename Key, typename T, std::size_t Shards = 16, typename Hash = std::hash<Key>, typename KeyEqual = std::equal_to<Key>>
+using sharded_unordered_mapSpinLock = sharded_unordered_map<Key, T, Shards, Hash, KeyEqual, LockPolicy::SpinLock>;
+
+// 每个分片使用自适应锁（自旋退避后休眠）的分片unordered_map
+template <typename Key, typename T, std::size_t Shards = 16, typename Hash = std::hash<Key>, typename KeyEqual = std::equal_to<Key>>
+using sharded_unordered_mapAdaptive = sharded_unordered_map<Key, T, Shards, Hash, KeyEqual, LockPolicy::Adaptive>;
+
+// 每个分片使用排号锁（FIFO 公平）的分片unordered_map
+template <typename Key, typename T, std::size_t Shards = 16, typename Hash = std::hash<Key>, typename KeyEqual = std::equal_to<Key>>
+using sharded_unordered_mapTicket = sharded_unordered_map<Key, T, Shards, Hash, KeyEqual, LockPolicy::Ticket>;
+
+// ==================== LRU Cache 类型别名 ====================
+
+#if TS_STL_SUPPORT_RW_LOCK
+// 每个分片使用读写锁的LRU/TTL缓存（命中在读锁内并行）
+template <typename Key, typename V, std::size_t Shards = 8, typename Hash = std::hash<Key>, typename KeyEqual = std::equal_to<Key>>
+using lru_cacheRW = lru_cache<Key, V, Shards, Hash, KeyEqual, LockPolicy::ReadWrite>;
+#endif
+
+// 每个分片使用互斥锁的LRU/TTL缓存
+template <typename Key, typename V, std::size_t Shards = 8, typename Hash = std::hash<Key>, typename KeyEqual = std::equal_to<Key>>
+using lru_cacheMutex = lru_cache<Key, V, Shards, Hash, KeyEqual, LockPolicy::Mutex>;
+
+// 每个分片使用自旋锁的LRU/TTL缓存（临界区很短，适合核数充足的场景）
+template <typename Key, typename V, std::size_t Shards = 8, typename Hash = std::hash<Key>, typename KeyEqual = std::equal_to<Key>>
+using lru_cacheSpinLock = lru_cache<Key, V, Shards, Hash, KeyEqual, LockPolicy::SpinLock>;
+
+// ==================== Flat Unordered Map 类型别名 ====================
+
+// 使用互斥锁、开放寻址扁平哈希表的unordered_map
+template <typename Key, typename T, typename Hash = std::hash<Key>, typename KeyEqual = std::equal_to<Key>>
+using flat_unordered_mapMutex = flat_unordered_map<Key, T, Hash, KeyEqual, LockPolicy::Mutex>;
+
+#if TS_STL_SUPPORT_RW_LOCK
+// 使用读写锁、开放寻址扁平哈希表的unordered_map（仅C++17及以上）
+template <typename Key, typename T, typename Hash = std::hash<Key>, typename KeyEqual = std::equal_to<Key>>
+using flat_unordered_mapRW = flat_unordered_map<Key, T, Hash, KeyEqual, LockPolicy::ReadWrite>;
+#endif
+
+// 使用自旋锁、开放寻址扁平哈希表的unordered_map
+template <typename Key, typename T, typename Hash = std::hash<Key>, typename KeyEqual = std::equal_to<Key>>
+using flat_unordered_mapSpinLock = flat_unordered_map<Key, T, Hash, KeyEqual, LockPolicy::SpinLock>;
+
+// 使用自适应锁（自旋退避后休眠）、开放寻址扁平哈希表的unordered_map
+template <typename Key, typename T, typename Hash = std::hash<Key>, typename KeyEqual = std::equal_to<Key>>
+using flat_unordered_mapAdaptive = flat_unordered_map<Key, T, Hash, KeyEqual, LockPolicy::Adaptive>;
+
+// 使用排号锁（FIFO 公平）、开放寻址扁平哈希表的unordered_map
+template <typename Key, typename T, typename Hash = std::hash<Key>, typename KeyEqual = std::equal_to<Key>>
+using flat_unordered_mapTicket = flat_unordered_map<Key, T, Hash, KeyEqual, LockPolicy::Ticket>;
+
+// 使用无锁策略、开放寻址扁平哈希表的unordered_map（极限性能，需要外部同步）
+template <typename Key, typename T, typename Hash = std::hash<Key>, typename KeyEqual = std::equal_to<Key>>
+using flat_unordered_mapLockFree = flat_unordered_map<Key, T, Hash, KeyEqual, LockPolicy::LockFree>;
+
+// ==================== Incremental Unordered Map / Set 类型别名 ====================
+
+// 使用互斥锁、渐进式扩容（每次修改迁移少量旧桶）的unordered_map
+template <typename Key, typename T, typename Hash = std::hash<Key>, typename KeyEqual = std::equal_to<Key>>
+using incremental_unordered_mapMutex = incremental_unordered_map<Key, T, Hash, KeyEqual, LockPolicy::Mutex>;
+
+#if TS_STL_SUPPORT_RW_LOCK
+// 使用读写锁、渐进式扩容的unordered_map（仅C++17及以上）
+template <typename Key, typename T, typename Hash = std::hash<Key>, typename KeyEqual = std::equal_to<Key>>
+using incremental_unordered_mapRW = incremental_unordered_map<Key, T, Hash, KeyEqual, LockPolicy::ReadWrite>;
+#endif
+
+// 使用自旋锁、渐进式扩容的unordered_map
+template <typename Key, typename T, typename Hash = std::hash<Key>, typename KeyEqual = std::equal_to<Key>>
+using incremental_unordered_mapSpinLock = incremental_unordered_map<Key, T, Hash, KeyEqual, LockPolicy::SpinLock>;
+
+// 使用自适应锁（自旋退避后休眠）、渐进式扩容的unordered_map
+template <typename Key, typename T, typename Hash = std::hash<Key>, typename KeyEqual = std::equal_to<Key>>
+using incremental_unordered_mapAdaptive = incremental_unordered_map<Key, T, Hash, KeyEqual, LockPolicy::Adaptive>;
+
+// 使用排号锁（FIFO 公平）、渐进式扩容的unordered_map
+template <typename Key, typename T, typename Hash = std::hash<Key>, typename KeyEqual = std::equal_to<Key>>
+using incremental_unordered_mapTicket = incremental_unordered_map<Key, T, Hash, KeyEqual, LockPolicy::Ticket>;
+
+// 使用无锁策略、渐进式扩容的unordered_map（极限性能，需要外部同步）
+template <typename Key, typename T, typename Hash = std::hash<Key>, typename KeyEqual = std::equal_to<Key>>
+using incremental_unordered_mapLockFree = incremental_unordered_map<Key, T, Hash, KeyEqual, LockPolicy::LockFree>;
+
+// 使用互斥锁、渐进式扩容的unordered_set
+template <typename Key, typename Hash = std::hash<Key>, typename KeyEqual = std::equal_to<Key>>
+using incremental_unordered_setMutex = incremental_unordered_set<Key, Hash, KeyEqual, LockPolicy::Mutex>;
+
+#if TS_STL_SUPPORT_RW_LOCK
+// 使用读写锁、渐进式扩容的unordered_set（仅C++17及以上）
+template <typename Key, typename Hash = std::hash<Key>, typename KeyEqual = std::equal_to<Key>>
+using incremental_unordered_setRW = incremental_unordered_set<Key, Hash, KeyEqual, LockPolicy::ReadWrite>;
+#endif
+
+// 使用自旋锁、渐进式扩容的unordered_set
+template <typename Key, typename Hash = std::hash<Key>, typename KeyEqual = std::equal_to<Key>>
+using incremental_unordered_setSpinLock = incremental_unordered_set<Key, Hash, KeyEqual, LockPolicy::SpinLock>;
+
+// 使用无锁策略、渐进式扩容的unordered_set（极限性能，需要外部同步）
+template <typename Key, typename Hash = std::hash<Key>, typename KeyEqual = std::equal_to<Key>>
+using incremental_unordered_setLockFree = incremental_unordered_set<Key, Hash, KeyEqual, LockPolicy::LockFree>;
+
+// ==================== Flat Map / Flat Set 类型别名 ====================
+
+// 使用互斥锁、有序 vector 存储的map
+template <typename Key, typename T, typename Compare = std::less<Key>>
+using flat_mapMutex = flat_map<Key, T, Compare, LockPolicy::Mutex>;
+
+#if TS_STL_SUPPORT_RW_LOCK
+// 使用读写锁、有序 vector 存储的map（读多写少首选，仅C++17及以上）
+template <typename Key, typename T, typename Compare = std::less<Key>>
+using flat_mapRW = flat_map<Key, T, Compare, LockPolicy::ReadWrite>;
+#endif
+
+// 使用自旋锁、有序 vector 存储的map
+template <typename Key, typename T, typename Compare = std::less<Key>>
+using flat_mapSpinLock = flat_map<Key, T, Compare, LockPolicy::SpinLock>;
+
+// 使用自适应锁（自旋退避后休眠）、有序 vector 存储的map
+template <typename Key, typename T, typename Compare = std::less<Key>>
+using flat_mapAdaptive = flat_map<Key, T, Compare, LockPolicy::Adaptive>;
+
+// 使用排号锁（FIFO 公平）、有序 vector 存储的map
+template <typename Key, typename T, typename Compare = std::less<Key>>
+using flat_mapTicket = flat_map<Key, T, Compare, LockPolicy::Ticket>;
+
+// 使用无锁策略、有序 vector 存储的map（极限性能，需要外部同步）
+template <typename Key, typename T, typename Compare = std::less<Key>>
+using flat_mapLockFree = flat_map<Key, T, Compare, LockPolicy::LockFree>;
+
+// 使用互斥锁、有序 vector 存储的set
+template <typename Key, typename Compare = std::less<Key>>
+using flat_setMutex = flat_set<Key, Compare, LockPolicy::Mutex>;
+
+#if TS_STL_SUPPORT_RW_LOCK
+// 使用读写锁、有序 vector 存储的set（仅C++17及以上）
+template <typename Key, typename Compare = std::less<Key>>
+using flat_setRW = flat_set<Key, Compare, LockPolicy::ReadWrite>;
+#endif
+
+// 使用自旋锁、有序 vector 存储的set
+template <typename Key, typename Compare = std::less<Key>>
+using flat_setSpinLock = flat_set<Key, Compare, LockPolicy::SpinLock>;
+
+// 使用自适应锁（自旋退避后休眠）、有序 vector 存储的set
+template <typename Key, typename Compare = std::less<Key>>
+using flat_setAdaptive = flat_set<Key, Compare, LockPolicy::Adaptive>;
+
+// 使用排号锁（FIFO 公平）、有序 vector 存储的set
+template <typename Key, typename Compare = std::less<Key>>
+using flat_setTicket = flat_set<Key, Compare, LockPolicy::Ticket>;
+
+// 使用无锁策略、有序 vector 存储的set（极限性能，需要外部同步）
+template <typename Key, typename Compare = std::less<Key>>
+using flat_setLockFree = flat_set<Key, Compare, LockPolicy::LockFree>;
+
 // ==================== Set 类型别名 ====================
 
 // 使用互斥锁的线程安全set
@@ -111,6 +341,14 @@ using setRW = set<Key, Compare, LockPolicy::ReadWrite>;
 template <typename Key, typename Compare = std::less<Key>>
 using setSpinLock = set<Key, Compare, LockPolicy::SpinLock>;
 
+// 使用自适应锁（自旋退避后休眠）的线程安全set
+template <typename Key, typename Compare = std::less<Key>>
+using setAdaptive = set<Key, Compare, LockPolicy::Adaptive>;
+
+// 使用排号锁（FIFO 公平）的线程安全set
+template <typename Key, typename Compare = std::less<Key>>
+using setTicket = set<Key, Compare, LockPolicy::Ticket>;
+
 // 使用无锁策略的线程安全set（极限性能，需要外部同步）
 template <typename Key, typename Compare = std::less<Key>>
 using setLockFree = set<Key, Compare, LockPolicy::LockFree>;
@@ -131,6 +369,14 @@ using unordered_setRW = unordered_set<Key, Hash, KeyEqual, LockPolicy::ReadWrite
 template <typename Key, typename Hash = std::hash<Key>, typename KeyEqual = std::equal_to<Key>>
 using unordered_setSpinLock = unordered_set<Key, Hash, KeyEqual, LockPolicy::SpinLock>;
 
+// 使用自适应锁（自旋退避后休眠）的线程安全unordered_set
+template <typename Key, typename Hash = std::hash<Key>, typename KeyEqual = std::equal_to<Key>>
+using unordered_setAdaptive = unordered_set<Key, Hash, KeyEqual, LockPolicy::Adaptive>;
+
+// 使用排号锁（FIFO 公平）的线程安全unordered_set
+template <typename Key, typename Hash = std::hash<Key>, typename KeyEqual = std::equal_to<Key>>
+using unordered_setTicket = unordered_set<Key, Hash, KeyEqual, LockPolicy::Ticket>;
+
 // 使用无锁策略的线程安全unordered_set（极限性能，需要外部同步）
 template <typename Key, typename Hash = std::hash<Key>, typename KeyEqual = std::equal_to<Key>>
 using unordered_setLockFree = unordered_set<Key, Hash, KeyEqual, LockPolicy::LockFree>;
@@ -151,10 +397,148 @@ using dequeRW = deque<T, LockPolicy::ReadWrite>;
 template <typename T>
 using dequeSpinLock = deque<T, LockPolicy::SpinLock>;
 
+// 使用自适应锁（自旋退避后休眠）的线程安全deque
+template <typename T>
+using dequeAdaptive = deque<T, LockPolicy::Adaptive>;
+
+// 使用排号锁（FIFO 公平）的线程安全deque
+template <typename T>
+using dequeTicket = deque<T, LockPolicy::Ticket>;
+
 // 使用无锁策略的线程安全deque（极限性能，需要外部同步）
 template <typename T>
 using dequeLockFree = deque<T, LockPolicy::LockFree>;
 
+// ==================== 字符串键容器别名（支持 std::string_view 异构查找） ====================
+
+// 有序：使用 std::less<>，查找接受 std::string_view / const char*
+template <typename T, LockPolicy Policy = LockPolicy::Mutex>
+using string_map = map<std::string, T, std::less<>, Policy>;
+
+// 有序 vector：同样使用 std::less<>
+template <typename T, LockPolicy Policy = LockPolicy::Mutex>
+using string_flat_map = flat_map<std::string, T, std::less<>, Policy>;
+
+// 无序：使用 string_hash + std::equal_to<>（异构查找需要 C++20 标准库支持）
+template <typename T, LockPolicy Policy = LockPolicy::Mutex>
+using string_unordered_map = unordered_map<std::string, T, string_hash, std::equal_to<>, Policy>;
+
+// 扁平哈希表：自身支持异构查找，C++17 即可使用 std::string_view 查找
+template <typename T, LockPolicy Policy = LockPolicy::Mutex>
+using string_flat_unordered_map = flat_unordered_map<std::string, T, string_hash, std::equal_to<>, Policy>;
+
+// ==================== Blocking Queue 类型别名 ====================
+
+// 使用互斥锁 + condition_variable 的阻塞队列
+template <typename T>
+using blocking_queueMutex = blocking_queue<T, LockPolicy::Mutex>;
+
+// 使用自旋锁 + condition_variable_any 的阻塞队列
+template <typename T>
+using blocking_queueSpinLock = blocking_queue<T, LockPolicy::SpinLock>;
+
+// 使用自适应锁（自旋退避后休眠） + condition_variable_any 的阻塞队列
+template <typename T>
+using blocking_queueAdaptive = blocking_queue<T, LockPolicy::Adaptive>;
+
+// 使用排号锁（FIFO 公平） + condition_variable_any 的阻塞队列
+template <typename T>
+using blocking_queueTicket = blocking_queue<T, LockPolicy::Ticket>;
+
+// ==================== Priority Queue 类型别名 ====================
+
+// 使用互斥锁的优先队列（严格顺序）
+template <typename T, typename Compare = std::less<T>>
+using priority_queueMutex = priority_queue<T, Compare, LockPolicy::Mutex>;
+
+// 使用自旋锁的优先队列
+template <typename T, typename Compare = std::less<T>>
+using priority_queueSpinLock = priority_queue<T, Compare, LockPolicy::SpinLock>;
+
+// 使用自适应锁的优先队列
+template <typename T, typename Compare = std::less<T>>
+using priority_queueAdaptive = priority_queue<T, Compare, LockPolicy::Adaptive>;
+
+// 使用排号锁（FIFO 公平）的优先队列
+template <typename T, typename Compare = std::less<T>>
+using priority_queueTicket = priority_queue<T, Compare, LockPolicy::Ticket>;
+
+// 无锁版本的优先队列（单线程或外部同步）
+template <typename T, typename Compare = std::less<T>>
+using priority_queueLockFree = priority_queue<T, Compare, LockPolicy::LockFree>;
+
+// 松弛优先队列（多个堆，出队取随机两个堆中较优的堆顶），每个堆使用互斥锁
+template <typename T, typename Compare = std::less<T>>
+using multi_priority_queueMutex = multi_priority_queue<T, Compare, LockPolicy::Mutex>;
+
+// 松弛优先队列，每个堆使用自旋锁
+template <typename T, typename Compare = std::less<T>>
+using multi_priority_queueSpinLock = multi_priority_queue<T, Compare, LockPolicy::SpinLock>;
+
+// 松弛优先队列，每个堆使用自适应锁（线程数超过核数时仍然稳定）
+template <typename T, typename Compare = std::less<T>>
+using multi_priority_queueAdaptive = multi_priority_queue<T, Compare, LockPolicy::Adaptive>;
+
+// 松弛优先队列，每个堆使用排号锁（FIFO 公平）
+template <typename T, typename Compare = std::less<T>>
+using multi_priority_queueTicket = multi_priority_queue<T, Compare, LockPolicy::Ticket>;
+
+// ==================== Ring Buffer 类型别名 ====================
+
+// 单生产者单消费者无锁环形缓冲区
+template <typename T>
+using ring_bufferSPSC = spsc_ring_buffer<T>;
+
+// 多生产者多消费者无锁环形缓冲区
+template <typename T>
+using ring_bufferMPMC = mpmc_ring_buffer<T>;
+
+// ==================== Snapshot 类型别名 ====================
+
+// 写时复制的有序 map 快照（读无锁）
+template <typename Key, typename T, typename Compare = std::less<Key>>
+using snapshot_map = snapshot<std::map<Key, T, Compare>>;
+
+// 写时复制的 unordered_map 快照（读无锁）
+template <typename Key, typename T, typename Hash = std::hash<Key>, typename KeyEqual = std::equal_to<Key>>
+using snapshot_unordered_map = snapshot<std::unordered_map<Key, T, Hash, KeyEqual>>;
+
+// ==================== 读偏向锁类型别名（仅C++17及以上） ====================
+
+#if TS_STL_SUPPORT_RW_LOCK
+// 读偏向锁的vector（读者只写本线程的槽，适合读线程很多、写很少的场景）
+template <typename T>
+using vectorReaderBiased = vector<T, LockPolicy::ReaderBiased>;
+
+// 读偏向锁的map
+template <typename Key, typename T, typename Compare = std::less<Key>>
+using mapReaderBiased = map<Key, T, Compare, LockPolicy::ReaderBiased>;
+
+// 读偏向锁的unordered_map（get_or_insert 命中时只持有读锁，未命中时经可升级读锁插入）
+template <typename Key, typename T, typename Hash = std::hash<Key>, typename KeyEqual = std::equal_to<Key>>
+using unordered_mapReaderBiased = unordered_map<Key, T, Hash, KeyEqual, LockPolicy::ReaderBiased>;
+#endif
+
+// ==================== 协程锁类型别名（仅C++20及以上） ====================
+
+#if TS_STL_SUPPORT_COROUTINES
+// 可 co_await 加锁的vector（async_write_lock / async_read_lock 挂起协程而不阻塞线程）
+template <typename T>
+using vectorAsync = vector<T, LockPolicy::Async>;
+
+// 可 co_await 加锁的deque
+template <typename T>
+using dequeAsync = deque<T, LockPolicy::Async>;
+
+// 可 co_await 加锁的map
+template <typename Key, typename T, typename Compare = std::less<Key>>
+using mapAsync = map<Key, T, Compare, LockPolicy::Async>;
+
+// 可 co_await 加锁的unordered_map
+template <typename Key, typename T, typename Hash = std::hash<Key>, typename KeyEqual = std::equal_to<Key>>
+using unordered_mapAsync = unordered_map<Key, T, Hash, KeyEqual, LockPolicy::Async>;
+#endif
+
 // ==================== 兼容性别名 - 与旧API保持兼容 ====================
 
 template <typename T, LockPolicy Policy = LockPolicy::Mutex>
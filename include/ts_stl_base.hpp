@@ -8,6 +8,17 @@
 #include <stdexcept>
 #include <algorithm>
 #include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <iterator>
+#include <thread>
+#include <type_traits>
+#include <utility>
 
 // C++ 版本检查
 #if __cplusplus < 201703L
@@ -22,18 +33,84 @@
     #define TS_STL_SUPPORT_RW_LOCK 0
 #endif
 
+// 条件编译：C++20 协程可用时启用 co_await 加锁接口（LockPolicy::Async），定义 TS_STL_NO_COROUTINES 可关闭
+#if defined(__cpp_impl_coroutine) && __cpp_impl_coroutine >= 201902L && __has_include(<coroutine>) && \
+    !defined(TS_STL_NO_COROUTINES)
+    #define TS_STL_SUPPORT_COROUTINES 1
+#else
+    #define TS_STL_SUPPORT_COROUTINES 0
+#endif
+
+// 缓存行大小：用于对齐锁状态、分片等并发热点数据，避免伪共享
+#ifndef TS_STL_CACHE_LINE_SIZE
+    #define TS_STL_CACHE_LINE_SIZE 64
+#endif
+
+// 容器锁状态独占缓存行：锁与容器元数据（如 vector 的 begin/end 指针）分处不同缓存行，
+// 容器对象整体按缓存行对齐，相邻容器之间也不会伪共享；代价是每个容器多占 1~2 个缓存行
+#ifndef TS_STL_CACHE_ALIGNED_LOCKS
+    #define TS_STL_CACHE_ALIGNED_LOCKS 0
+#endif
+
+// 自适应锁的自旋预算上限（自旋轮数），超过后进入休眠
+#ifndef TS_STL_ADAPTIVE_SPIN_LIMIT
+    #define TS_STL_ADAPTIVE_SPIN_LIMIT 100
+#endif
+
+// 读偏向锁（LockPolicy::ReaderBiased）的读者槽数量：0 表示按硬件线程数取 2 的幂（最多 64），
+// 每个槽独占一个缓存行，线程数不超过槽数时读者之间不共享任何缓存行
+#ifndef TS_STL_READER_BIASED_SLOTS
+    #define TS_STL_READER_BIASED_SLOTS 0
+#endif
+
+// Linux 上自适应锁使用 futex 休眠/唤醒，其它平台退化为 yield 轮询
+#if defined(__linux__) && !defined(TS_STL_NO_FUTEX)
+    #include <linux/futex.h>
+    #include <sys/syscall.h>
+    #include <unistd.h>
+    #define TS_STL_HAS_FUTEX 1
+#else
+    #define TS_STL_HAS_FUTEX 0
+#endif
+
+#include "ts_parallel.hpp"
+#include "ts_lock_stats.hpp"
+
+#if TS_STL_SUPPORT_COROUTINES
+    #include "ts_async_lock.hpp"
+#endif
+
 namespace ts_stl {
 
+inline constexpr std::size_t cache_line_size = TS_STL_CACHE_LINE_SIZE;
+
 // 锁策略枚举
 enum class LockPolicy {
     Mutex,      // 互斥锁（所有C++版本都支持）
     SpinLock,   // 自旋锁（轻量级，适合短临界区）
     LockFree,   // 无锁（极限性能，需要单线程或外部同步）
+    Adaptive,   // 自适应锁（先自旋退避，再休眠；线程数超过核数时仍然稳定）
+    Ticket,     // 排号锁（FIFO 公平，适合核数充足、需要避免饥饿的场景）
 #if TS_STL_SUPPORT_RW_LOCK
-    ReadWrite   // 读写锁（仅C++17+支持）
+    ReadWrite,  // 读写锁（仅C++17+支持）
+    ReaderBiased,  // 读偏向读写锁（仅C++17+支持）：读者只写本线程的槽，写者撤销偏向后等待读者排空；支持可升级读锁
+#endif
+#if TS_STL_SUPPORT_COROUTINES
+    Async,      // 协程读写锁（仅C++20+支持）：同步接口阻塞，co_await async_write_lock()/async_read_lock() 挂起协程
 #endif
 };
 
+/**
+ * @brief 自旋等待时的 CPU 提示（x86 pause / ARM yield），降低忙等待的功耗与流水线冲刷
+ */
+inline void cpu_relax() noexcept {
+#if defined(__x86_64__) || defined(__i386__)
+    asm volatile("pause");
+#elif defined(__aarch64__)
+    asm volatile("yield");
+#endif
+}
+
 /**
  * @brief 简单的自旋锁实现 - 适合短临界区
  * 
@@ -58,57 +135,558 @@ public:
     SpinLock& operator=(SpinLock&&) = delete;
 
     void lock() {
-        while (flag_.test_and_set(std::memory_order_acquire)) {
-            // 忙等待，直到获得锁
-            // 可以添加 pause 指令来减轻 CPU 压力
-            #ifdef __x86_64__
-                asm volatile("pause");
-            #elif defined(__aarch64__)
-                asm volatile("yield");
-            #endif
+        // test-and-test-and-set：等待期间只读本地缓存行，锁释放后才尝试写，避免缓存行来回失效
+        while (locked_.exchange(true, std::memory_order_acquire)) {
+            while (locked_.load(std::memory_order_relaxed)) {
+                cpu_relax();
+            }
         }
     }
 
     void unlock() {
-        flag_.clear(std::memory_order_release);
+        locked_.store(false, std::memory_order_release);
+    }
+
+    bool try_lock() {
+        return !locked_.load(std::memory_order_relaxed) &&
+               !locked_.exchange(true, std::memory_order_acquire);
+    }
+
+private:
+    std::atomic<bool> locked_{false};
+};
+
+namespace detail {
+
+/**
+ * @brief 是否只有一个硬件线程：此时自旋不可能等到持有者释放锁，应立即让出 CPU
+ */
+inline bool single_hardware_thread() noexcept {
+    static const bool single = std::thread::hardware_concurrency() <= 1;
+    return single;
+}
+
+/**
+ * @brief 指数退避：每轮等待的 pause 次数翻倍，直到上限
+ */
+class exponential_backoff {
+public:
+    void pause() noexcept {
+        for (std::uint32_t i = 0; i < count_; ++i) {
+            cpu_relax();
+        }
+        if (count_ < max_pauses) {
+            count_ <<= 1;
+        }
+    }
+
+private:
+    static constexpr std::uint32_t max_pauses = 16;
+    std::uint32_t count_ = 1;
+};
+
+/**
+ * @brief 在 word 仍等于 expected 时休眠，直到被 futex_wake_one 唤醒（允许虚假唤醒）
+ */
+inline void futex_wait(std::atomic<std::uint32_t>& word, std::uint32_t expected) noexcept {
+#if TS_STL_HAS_FUTEX
+    static_assert(sizeof(std::atomic<std::uint32_t>) == sizeof(std::uint32_t),
+                  "futex word must be a plain 32-bit integer");
+    syscall(SYS_futex, reinterpret_cast<std::uint32_t*>(&word), FUTEX_WAIT_PRIVATE, expected,
+            nullptr, nullptr, 0);
+#else
+    (void)word;
+    (void)expected;
+    std::this_thread::yield();
+#endif
+}
+
+/**
+ * @brief 唤醒一个在 word 上休眠的线程
+ */
+inline void futex_wake_one(std::atomic<std::uint32_t>& word) noexcept {
+#if TS_STL_HAS_FUTEX
+    syscall(SYS_futex, reinterpret_cast<std::uint32_t*>(&word), FUTEX_WAKE_PRIVATE, 1,
+            nullptr, nullptr, 0);
+#else
+    (void)word;
+#endif
+}
+
+} // namespace detail
+
+/**
+ * @brief 自适应互斥锁 - 先自旋退避，超过预算后休眠
+ *
+ * 状态字：0 = 未加锁，1 = 已加锁且无人休眠，2 = 已加锁且可能有线程休眠。
+ * - 无竞争时 lock/unlock 各一次原子操作，不进入内核
+ * - 竞争时先做 test-and-test-and-set + 指数退避；自旋轮数上限随历史成功自旋的轮数
+ *   自适应调整（最多 TS_STL_ADAPTIVE_SPIN_LIMIT），自旋总是失败时预算会逐渐缩小
+ * - 超过预算后在 Linux 上用 futex 休眠，其它平台 yield；单核机器上跳过自旋
+ *
+ * 与 SpinLock 相比，线程数超过核数时不会让等待者把持有者挤出 CPU；
+ * 与 std::mutex 相比，短临界区的交接通常在自旋阶段完成，不需要系统调用。
+ */
+class AdaptiveMutex {
+public:
+    AdaptiveMutex() = default;
+
+    // 不可复制不可移动
+    AdaptiveMutex(const AdaptiveMutex&) = delete;
+    AdaptiveMutex& operator=(const AdaptiveMutex&) = delete;
+    AdaptiveMutex(AdaptiveMutex&&) = delete;
+    AdaptiveMutex& operator=(AdaptiveMutex&&) = delete;
+
+    void lock() noexcept {
+        std::uint32_t expected = unlocked;
+        if (!state_.compare_exchange_strong(expected, locked, std::memory_order_acquire,
+                                            std::memory_order_relaxed)) {
+            lock_slow();
+        }
+    }
+
+    void unlock() noexcept {
+        if (state_.exchange(unlocked, std::memory_order_release) == contended) {
+            detail::futex_wake_one(state_);
+        }
+    }
+
+    bool try_lock() noexcept {
+        std::uint32_t expected = unlocked;
+        return state_.load(std::memory_order_relaxed) == unlocked &&
+               state_.compare_exchange_strong(expected, locked, std::memory_order_acquire,
+                                              std::memory_order_relaxed);
+    }
+
+private:
+    static constexpr std::uint32_t unlocked = 0;
+    static constexpr std::uint32_t locked = 1;
+    static constexpr std::uint32_t contended = 2;
+    static constexpr std::uint32_t max_spins = TS_STL_ADAPTIVE_SPIN_LIMIT;
+
+    void lock_slow() noexcept {
+        if (!detail::single_hardware_thread() && spin()) {
+            return;
+        }
+        // 标记为 contended 后休眠；醒来重新抢锁时也保持 contended，保证 unlock 不会漏唤醒
+        while (state_.exchange(contended, std::memory_order_acquire) != unlocked) {
+            detail::futex_wait(state_, contended);
+        }
+    }
+
+    // 在预算内自旋抢锁；返回是否成功
+    bool spin() noexcept {
+        const std::uint32_t estimate = spin_estimate_.load(std::memory_order_relaxed);
+        const std::uint32_t budget = std::min(max_spins, estimate * 2 + 10);
+        detail::exponential_backoff backoff;
+        for (std::uint32_t spins = 1; spins <= budget; ++spins) {
+            backoff.pause();
+            std::uint32_t expected = unlocked;
+            if (state_.load(std::memory_order_relaxed) == unlocked &&
+                state_.compare_exchange_weak(expected, locked, std::memory_order_acquire,
+                                             std::memory_order_relaxed)) {
+                // 估计值向本次实际自旋轮数靠拢（1/8 步长）
+                std::uint32_t updated = spins >= estimate ? estimate + (spins - estimate) / 8
+                                                          : estimate - (estimate - spins) / 8;
+                spin_estimate_.store(updated, std::memory_order_relaxed);
+                return true;
+            }
+        }
+        // 整个预算都没等到锁：缩小预算，更早进入休眠
+        spin_estimate_.store(estimate / 2, std::memory_order_relaxed);
+        return false;
+    }
+
+    std::atomic<std::uint32_t> state_{unlocked};
+    std::atomic<std::uint32_t> spin_estimate_{max_spins / 2};
+};
+
+/**
+ * @brief 排号锁（ticket lock）- 按到达顺序 FIFO 授予锁
+ *
+ * 每个等待者取一个号，等待"正在服务"的号等于自己的号。
+ * - 严格公平，不会饥饿；lock/unlock 各一次原子操作
+ * - 等待时按前面排队的人数成比例退避，排队较长或单核时改为 yield
+ *
+ * 注意：严格 FIFO 意味着下一个号的持有者被调度出去时，后面所有人都要等它，
+ * 线程数超过核数时请优先使用 AdaptiveMutex。
+ */
+class TicketLock {
+public:
+    TicketLock() = default;
+
+    // 不可复制不可移动
+    TicketLock(const TicketLock&) = delete;
+    TicketLock& operator=(const TicketLock&) = delete;
+    TicketLock(TicketLock&&) = delete;
+    TicketLock& operator=(TicketLock&&) = delete;
+
+    void lock() noexcept {
+        const std::uint32_t ticket = next_.fetch_add(1, std::memory_order_relaxed);
+        std::uint32_t rounds = 0;
+        for (;;) {
+            const std::uint32_t serving = serving_.load(std::memory_order_acquire);
+            if (serving == ticket) {
+                return;
+            }
+            const std::uint32_t ahead = ticket - serving;
+            if (detail::single_hardware_thread() || ahead > max_spinning_ahead ||
+                ++rounds > max_spin_rounds) {
+                std::this_thread::yield();
+                continue;
+            }
+            for (std::uint32_t i = 0; i < ahead * pauses_per_waiter; ++i) {
+                cpu_relax();
+            }
+        }
+    }
+
+    void unlock() noexcept {
+        // 只有持有者会修改 serving_，普通的 load + store 即可
+        serving_.store(serving_.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+    }
+
+    bool try_lock() noexcept {
+        std::uint32_t serving = serving_.load(std::memory_order_acquire);
+        std::uint32_t expected = serving;
+        return next_.compare_exchange_strong(expected, serving + 1, std::memory_order_acquire,
+                                             std::memory_order_relaxed);
+    }
+
+private:
+    static constexpr std::uint32_t pauses_per_waiter = 8;
+    static constexpr std::uint32_t max_spinning_ahead = 8;
+    static constexpr std::uint32_t max_spin_rounds = 1024;
+
+    std::atomic<std::uint32_t> next_{0};
+    std::atomic<std::uint32_t> serving_{0};
+};
+
+#if TS_STL_SUPPORT_RW_LOCK
+namespace detail {
+
+/**
+ * @brief 读者槽：每个槽独占一个缓存行
+ */
+struct alignas(cache_line_size) reader_slot {
+    std::atomic<std::uint32_t> readers{0};
+};
+
+/**
+ * @brief 当前线程固定的读者槽编号（线程首次调用时按到达顺序分配，之后不变）
+ */
+inline std::size_t reader_slot_index() noexcept {
+    static std::atomic<std::size_t> next{0};
+    thread_local const std::size_t index = next.fetch_add(1, std::memory_order_relaxed);
+    return index;
+}
+
+/**
+ * @brief 读者槽数量：TS_STL_READER_BIASED_SLOTS，为 0 时取不小于硬件线程数的 2 的幂（最多 64）
+ */
+inline std::size_t reader_slot_count() noexcept {
+    static const std::size_t count = [] {
+        std::size_t wanted = TS_STL_READER_BIASED_SLOTS;
+        if (wanted == 0) {
+            wanted = std::min<std::size_t>(std::max(1u, std::thread::hardware_concurrency()), 64);
+        }
+        std::size_t n = 1;
+        while (n < wanted) {
+            n <<= 1;
+        }
+        return n;
+    }();
+    return count;
+}
+
+} // namespace detail
+
+/**
+ * @brief 读偏向读写锁（BRAVO 风格）- 读者只修改本线程的槽，写者撤销偏向后等待读者排空
+ *
+ * - 读者：偏向开启时在本线程的槽上计数并复查偏向标志，全程不触碰共享缓存行；
+ *   偏向关闭时经由内部 std::shared_mutex 登记到槽上后立即释放它，
+ *   因此所有读者都以"槽计数"持有读锁，unlock_shared() 无需知道走的是哪条路径
+ * - 写者：取得内部锁后关闭偏向，等待所有槽归零；撤销耗时的若干倍时间内保持偏向关闭，
+ *   写多的阶段读者退回 shared_mutex 路径，避免每次写入都扫描全部槽
+ * - 可升级读锁：lock_upgrade() 与写者、其它升级者互斥，但不阻塞普通读者；
+ *   unlock_upgrade_and_lock() 原子地升级为写锁（期间不会有其它写者插入）
+ *
+ * 代价：每把锁占用 槽数 × 缓存行 的堆内存，写锁需要扫描全部槽。
+ * 适合读远多于写、读线程很多的场景；写频繁时请使用 LockPolicy::ReadWrite。
+ * 满足 Lockable / SharedLockable，可直接配合 std::unique_lock / std::shared_lock。
+ */
+class ReaderBiasedMutex {
+    using clock = std::chrono::steady_clock;
+
+public:
+    ReaderBiasedMutex()
+        : slot_mask_(detail::reader_slot_count() - 1),
+          slots_(new detail::reader_slot[detail::reader_slot_count()]) {}
+
+    // 不可复制不可移动
+    ReaderBiasedMutex(const ReaderBiasedMutex&) = delete;
+    ReaderBiasedMutex& operator=(const ReaderBiasedMutex&) = delete;
+    ReaderBiasedMutex(ReaderBiasedMutex&&) = delete;
+    ReaderBiasedMutex& operator=(ReaderBiasedMutex&&) = delete;
+
+    // ==================== 共享（读）锁 ====================
+
+    void lock_shared() {
+        std::atomic<std::uint32_t>& slot = my_slot();
+        if (try_fast_read(slot)) {
+            return;
+        }
+        gate_.lock_shared();
+        enter_slow_read(slot);
+    }
+
+    bool try_lock_shared() {
+        std::atomic<std::uint32_t>& slot = my_slot();
+        if (try_fast_read(slot)) {
+            return true;
+        }
+        if (!gate_.try_lock_shared()) {
+            return false;
+        }
+        enter_slow_read(slot);
+        return true;
+    }
+
+    void unlock_shared() noexcept {
+        my_slot().fetch_sub(1, std::memory_order_release);
+    }
+
+    // ==================== 独占（写）锁 ====================
+
+    void lock() {
+        upgrade_.lock();
+        gate_.lock();
+        revoke_and_drain();
     }
 
     bool try_lock() {
-        return !flag_.test_and_set(std::memory_order_acquire);
+        if (!upgrade_.try_lock()) {
+            return false;
+        }
+        if (!gate_.try_lock()) {
+            upgrade_.unlock();
+            return false;
+        }
+        const bool was_biased = bias_.load(std::memory_order_relaxed);
+        bias_.store(false, std::memory_order_seq_cst);
+        if (!readers_drained()) {
+            if (was_biased) {
+                bias_.store(true, std::memory_order_release);
+            }
+            gate_.unlock();
+            upgrade_.unlock();
+            return false;
+        }
+        return true;
+    }
+
+    void unlock() {
+        gate_.unlock();
+        upgrade_.unlock();
+    }
+
+    // ==================== 可升级读锁 ====================
+
+    /**
+     * @brief 获取可升级读锁：可以读取，与写者/其它升级者互斥，不阻塞普通读者
+     */
+    void lock_upgrade() {
+        upgrade_.lock();
+    }
+
+    bool try_lock_upgrade() {
+        return upgrade_.try_lock();
+    }
+
+    void unlock_upgrade() {
+        upgrade_.unlock();
+    }
+
+    /**
+     * @brief 可升级读锁 -> 写锁：等待当前读者离开，期间不会有其它写者获得锁
+     */
+    void unlock_upgrade_and_lock() {
+        gate_.lock();
+        revoke_and_drain();
+    }
+
+    /**
+     * @brief 写锁 -> 可升级读锁：放行普通读者，保留对写者的排斥
+     */
+    void unlock_and_lock_upgrade() {
+        gate_.unlock();
+    }
+
+    /**
+     * @brief 当前是否处于读偏向状态（供测试与诊断）
+     */
+    bool reader_biased() const noexcept {
+        return bias_.load(std::memory_order_relaxed);
+    }
+
+private:
+    // 撤销偏向后，在撤销耗时的这么多倍时间内保持偏向关闭（BRAVO 论文取 9）
+    static constexpr clock::rep inhibit_multiplier = 9;
+    static constexpr std::uint32_t drain_spins = 64;
+
+    std::atomic<std::uint32_t>& my_slot() const noexcept {
+        return slots_[detail::reader_slot_index() & slot_mask_].readers;
+    }
+
+    bool try_fast_read(std::atomic<std::uint32_t>& slot) noexcept {
+        if (!bias_.load(std::memory_order_acquire)) {
+            return false;
+        }
+        // 先登记再复查：与写者"先关偏向再扫描槽"构成 Dekker 式配对，两者至少一方能看到对方
+        slot.fetch_add(1, std::memory_order_seq_cst);
+        if (bias_.load(std::memory_order_seq_cst)) {
+            return true;
+        }
+        slot.fetch_sub(1, std::memory_order_release);
+        return false;
+    }
+
+    // 调用方持有 gate_ 的共享锁：登记到槽上后立即释放，写者取得 gate_ 后一定能看到这次登记
+    void enter_slow_read(std::atomic<std::uint32_t>& slot) {
+        slot.fetch_add(1, std::memory_order_relaxed);
+        if (!bias_.load(std::memory_order_relaxed) &&
+            clock::now().time_since_epoch().count() >= inhibit_until_.load(std::memory_order_relaxed)) {
+            bias_.store(true, std::memory_order_release);
+        }
+        gate_.unlock_shared();
+    }
+
+    // 调用方持有 gate_ 的独占锁
+    void revoke_and_drain() {
+        if (!bias_.load(std::memory_order_relaxed)) {
+            wait_for_readers();
+            return;
+        }
+        bias_.store(false, std::memory_order_seq_cst);
+        const clock::time_point start = clock::now();
+        wait_for_readers();
+        const clock::time_point end = clock::now();
+        inhibit_until_.store(end.time_since_epoch().count() + (end - start).count() * inhibit_multiplier,
+                             std::memory_order_relaxed);
+    }
+
+    bool readers_drained() const noexcept {
+        for (std::size_t i = 0; i <= slot_mask_; ++i) {
+            if (slots_[i].readers.load(std::memory_order_seq_cst) != 0) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    void wait_for_readers() const noexcept {
+        for (std::size_t i = 0; i <= slot_mask_; ++i) {
+            std::uint32_t spins = 0;
+            while (slots_[i].readers.load(std::memory_order_seq_cst) != 0) {
+                if (detail::single_hardware_thread() || ++spins > drain_spins) {
+                    std::this_thread::yield();
+                } else {
+                    cpu_relax();
+                }
+            }
+        }
+    }
+
+    std::atomic<bool> bias_{true};
+    std::atomic<clock::rep> inhibit_until_{0};
+    const std::size_t slot_mask_;
+    std::unique_ptr<detail::reader_slot[]> slots_;
+    std::shared_mutex gate_;  // 偏向关闭时的读者路径，以及写者之间的互斥
+    std::mutex upgrade_;      // 写者与可升级读者之间的互斥
+};
+
+/**
+ * @brief ReaderBiasedMutex 的可升级读锁守卫
+ *
+ * 构造时获取可升级读锁；upgrade() 升级为写锁，downgrade() 降回可升级读锁；
+ * 析构时按当前状态释放。典型用法是"先查后插"：命中时不阻塞任何读者，未命中时才升级。
+ */
+template <typename Mutex>
+class upgrade_guard {
+public:
+    explicit upgrade_guard(Mutex& mutex) : mutex_(mutex) {
+        mutex_.lock_upgrade();
+    }
+
+    ~upgrade_guard() {
+        if (exclusive_) {
+            mutex_.unlock();
+        } else {
+            mutex_.unlock_upgrade();
+        }
+    }
+
+    upgrade_guard(const upgrade_guard&) = delete;
+    upgrade_guard& operator=(const upgrade_guard&) = delete;
+
+    void upgrade() {
+        if (!exclusive_) {
+            mutex_.unlock_upgrade_and_lock();
+            exclusive_ = true;
+        }
+    }
+
+    void downgrade() {
+        if (exclusive_) {
+            mutex_.unlock_and_lock_upgrade();
+            exclusive_ = false;
+        }
+    }
+
+    bool exclusive() const noexcept {
+        return exclusive_;
     }
 
 private:
-    std::atomic_flag flag_ = ATOMIC_FLAG_INIT;
+    Mutex& mutex_;
+    bool exclusive_ = false;
 };
+#endif
 
 /**
  * @brief 自旋锁的 unique_lock 兼容包装
+ *
+ * 提供 lock()/unlock()/owns_lock()，可配合 std::condition_variable_any 使用
  */
 class SpinLockGuard {
 public:
-    explicit SpinLockGuard(SpinLock& lock) : lock_(lock) {
-        lock_.lock();
+    explicit SpinLockGuard(SpinLock& lock) : lock_(&lock) {
+        lock_->lock();
         owns_lock_ = true;
     }
 
     ~SpinLockGuard() {
         if (owns_lock_) {
-            lock_.unlock();
+            lock_->unlock();
         }
     }
 
     // 移动语义
     SpinLockGuard(SpinLockGuard&& other) noexcept 
         : lock_(other.lock_), owns_lock_(other.owns_lock_) {
+        other.lock_ = nullptr;
         other.owns_lock_ = false;
     }
 
     SpinLockGuard& operator=(SpinLockGuard&& other) noexcept {
         if (this != &other) {
             if (owns_lock_) {
-                lock_.unlock();
+                lock_->unlock();
             }
+            lock_ = other.lock_;
             owns_lock_ = other.owns_lock_;
+            other.lock_ = nullptr;
             other.owns_lock_ = false;
         }
         return *this;
@@ -118,11 +696,47 @@ public:
     SpinLockGuard(const SpinLockGuard&) = delete;
     SpinLockGuard& operator=(const SpinLockGuard&) = delete;
 
+    // 与 std::unique_lock 一致：被移走的守卫上加锁、重复加锁或未持有时解锁都抛出 std::system_error
+    void lock() {
+        if (lock_ == nullptr) {
+            throw std::system_error(std::make_error_code(std::errc::operation_not_permitted),
+                                    "SpinLockGuard::lock: no associated lock");
+        }
+        if (owns_lock_) {
+            throw std::system_error(std::make_error_code(std::errc::resource_deadlock_would_occur),
+                                    "SpinLockGuard::lock: already owned");
+        }
+        lock_->lock();
+        owns_lock_ = true;
+    }
+
+    void unlock() {
+        if (!owns_lock_) {
+            throw std::system_error(std::make_error_code(std::errc::operation_not_permitted),
+                                    "SpinLockGuard::unlock: not owned");
+        }
+        lock_->unlock();
+        owns_lock_ = false;
+    }
+
+    bool owns_lock() const noexcept {
+        return owns_lock_;
+    }
+
 private:
-    SpinLock& lock_;
+    SpinLock* lock_;
     bool owns_lock_ = false;
 };
 
+/**
+ * @brief 空互斥量 - 无锁策略的锁状态（不占用任何同步资源）
+ */
+struct NullMutex {
+    void lock() noexcept {}
+    void unlock() noexcept {}
+    bool try_lock() noexcept { return true; }
+};
+
 /**
  * @brief 空锁守卫 - 无锁策略
  * 
@@ -137,6 +751,8 @@ private:
 class NullLockGuard {
 public:
     NullLockGuard() = default;
+
+    explicit NullLockGuard(NullMutex&) noexcept {}
     
     // 移动语义（空实现）
     NullLockGuard(NullLockGuard&&) noexcept {}
@@ -148,157 +764,476 @@ public:
     // 不可复制
     NullLockGuard(const NullLockGuard&) = delete;
     NullLockGuard& operator=(const NullLockGuard&) = delete;
+
+    void lock() noexcept {}
+    void unlock() noexcept {}
+    bool owns_lock() const noexcept { return true; }
 };
 
 /**
- * @brief 统一的锁守卫类型 - 支持多种锁机制
+ * @brief 锁策略特征 - 在编译期为每种 LockPolicy 选定锁类型和守卫类型
+ *
+ * - mutex_type：内嵌在容器中的锁对象
+ * - write_guard：独占访问时使用的守卫
+ * - read_guard：只读访问时使用的守卫（非读写锁策略下与 write_guard 相同）
  */
-class UnifiedLockGuard {
-public:
-    // 用于 std::mutex
-    UnifiedLockGuard(std::unique_lock<std::mutex>&& lock) 
-        : spinlock_(nullptr), lock_type_(0), mutex_lock_(std::move(lock)) {}
-    
-    // 用于 SpinLock
-    UnifiedLockGuard(SpinLock& lock) 
-        : spinlock_(&lock), lock_type_(1) {
-        spinlock_->lock();
-    }
+template <LockPolicy Policy>
+struct lock_traits;
+
+template <>
+struct lock_traits<LockPolicy::Mutex> {
+    using mutex_type = std::mutex;
+    using write_guard = std::unique_lock<std::mutex>;
+    using read_guard = std::unique_lock<std::mutex>;
+};
 
-    // 用于 NullLockGuard (无锁)
-    UnifiedLockGuard(NullLockGuard&&) 
-        : spinlock_(nullptr), lock_type_(3) {}
+template <>
+struct lock_traits<LockPolicy::SpinLock> {
+    using mutex_type = SpinLock;
+    using write_guard = SpinLockGuard;
+    using read_guard = SpinLockGuard;
+};
+
+template <>
+struct lock_traits<LockPolicy::LockFree> {
+    using mutex_type = NullMutex;
+    using write_guard = NullLockGuard;
+    using read_guard = NullLockGuard;
+};
+
+template <>
+struct lock_traits<LockPolicy::Adaptive> {
+    using mutex_type = AdaptiveMutex;
+    using write_guard = std::unique_lock<AdaptiveMutex>;
+    using read_guard = std::unique_lock<AdaptiveMutex>;
+};
+
+template <>
+struct lock_traits<LockPolicy::Ticket> {
+    using mutex_type = TicketLock;
+    using write_guard = std::unique_lock<TicketLock>;
+    using read_guard = std::unique_lock<TicketLock>;
+};
 
 #if TS_STL_SUPPORT_RW_LOCK
-    // 用于 shared_mutex 写锁
-    UnifiedLockGuard(std::unique_lock<std::shared_mutex>&& lock)
-        : spinlock_(nullptr), lock_type_(2), rw_lock_(std::move(lock)) {}
+template <>
+struct lock_traits<LockPolicy::ReadWrite> {
+    using mutex_type = std::shared_mutex;
+    using write_guard = std::unique_lock<std::shared_mutex>;
+    using read_guard = std::shared_lock<std::shared_mutex>;
+};
+
+template <>
+struct lock_traits<LockPolicy::ReaderBiased> {
+    using mutex_type = ReaderBiasedMutex;
+    using write_guard = std::unique_lock<ReaderBiasedMutex>;
+    using read_guard = std::shared_lock<ReaderBiasedMutex>;
+};
 #endif
 
-    ~UnifiedLockGuard() {
-        if (lock_type_ == 1 && spinlock_) {
-            spinlock_->unlock();
+#if TS_STL_SUPPORT_COROUTINES
+template <>
+struct lock_traits<LockPolicy::Async> {
+    using mutex_type = async_shared_mutex;
+    using write_guard = std::unique_lock<async_shared_mutex>;
+    using read_guard = std::shared_lock<async_shared_mutex>;
+};
+#endif
+
+/**
+ * @brief 锁包装器 - 以内联方式持有策略对应的锁对象
+ *
+ * 锁类型与守卫类型完全在编译期确定：没有堆分配、没有运行时分支，
+ * 守卫即对底层锁的一次 lock/unlock。
+ * 例如 LockGuard<LockPolicy::SpinLock> 只占用一个字节的锁状态；
+ * 定义 TS_STL_CACHE_ALIGNED_LOCKS=1 时（LockFree 除外）锁对象独占一个缓存行。
+ */
+namespace detail {
+
+/**
+ * @brief LockGuard 的统计存储：未开启统计时为空基类，不占空间
+ */
+template <bool Enabled>
+struct lock_stats_storage {
+    lock_stats* stats() const noexcept { return nullptr; }
+};
+
+template <>
+struct lock_stats_storage<true> {
+    lock_stats* stats() const noexcept { return &stats_; }
+
+    mutable lock_stats stats_;
+};
+
+} // namespace detail
+
+template <LockPolicy Policy>
+class LockGuard : private detail::lock_stats_storage<TS_STL_ENABLE_LOCK_STATS && Policy != LockPolicy::LockFree> {
+    using stats_storage = detail::lock_stats_storage<TS_STL_ENABLE_LOCK_STATS && Policy != LockPolicy::LockFree>;
+
+public:
+    using mutex_type = typename lock_traits<Policy>::mutex_type;
+
+    // 开启 TS_STL_ENABLE_LOCK_STATS 时，加锁策略的守卫换成带统计的 instrumented_guard
+    static constexpr bool instrumented = TS_STL_ENABLE_LOCK_STATS && Policy != LockPolicy::LockFree;
+    static constexpr bool shared_reads = !std::is_same_v<typename lock_traits<Policy>::write_guard,
+                                                         typename lock_traits<Policy>::read_guard>;
+
+    using write_guard = std::conditional_t<instrumented, detail::instrumented_guard<mutex_type, false>,
+                                           typename lock_traits<Policy>::write_guard>;
+    using read_guard = std::conditional_t<instrumented, detail::instrumented_guard<mutex_type, shared_reads>,
+                                          typename lock_traits<Policy>::read_guard>;
+
+    LockGuard() = default;
+
+    // 锁对象不可复制不可移动
+    LockGuard(const LockGuard&) = delete;
+    LockGuard& operator=(const LockGuard&) = delete;
+
+    // 获取写锁（独占）
+    write_guard write_lock() const {
+        if constexpr (instrumented) {
+            return write_guard(mutex_, *stats());
+        } else {
+            return write_guard(mutex_);
         }
     }
 
-    // 移动语义
-    UnifiedLockGuard(UnifiedLockGuard&& other) noexcept 
-        : spinlock_(other.spinlock_), lock_type_(other.lock_type_) {
-        if (other.lock_type_ == 0) {
-            mutex_lock_ = std::move(other.mutex_lock_);
-        }
-#if TS_STL_SUPPORT_RW_LOCK
-        else if (other.lock_type_ == 2) {
-            rw_lock_ = std::move(other.rw_lock_);
-        }
-#endif
-        other.spinlock_ = nullptr;
-        other.lock_type_ = -1;
+    // 获取互斥锁
+    write_guard lock() const {
+        return write_lock();
     }
 
-    UnifiedLockGuard& operator=(UnifiedLockGuard&& other) noexcept {
-        if (this != &other) {
-            this->~UnifiedLockGuard();
-            spinlock_ = other.spinlock_;
-            lock_type_ = other.lock_type_;
-            if (other.lock_type_ == 0) {
-                mutex_lock_ = std::move(other.mutex_lock_);
-            }
-#if TS_STL_SUPPORT_RW_LOCK
-            else if (other.lock_type_ == 2) {
-                rw_lock_ = std::move(other.rw_lock_);
-            }
-#endif
-            other.spinlock_ = nullptr;
-            other.lock_type_ = -1;
+    // 获取读锁（读写锁策略下为共享锁，其它策略下等同于写锁）
+    read_guard read_lock() const {
+        if constexpr (instrumented) {
+            return read_guard(mutex_, *stats());
+        } else {
+            return read_guard(mutex_);
         }
-        return *this;
     }
 
-    // 不可复制
-    UnifiedLockGuard(const UnifiedLockGuard&) = delete;
-    UnifiedLockGuard& operator=(const UnifiedLockGuard&) = delete;
+    // 底层锁对象（供条件变量等需要直接访问锁的场景使用）
+    mutex_type& native_handle() const noexcept {
+        return mutex_;
+    }
+
+    static constexpr LockPolicy policy() noexcept { return Policy; }
+
+    // 锁竞争统计（未开启 TS_STL_ENABLE_LOCK_STATS 或 LockFree 策略时为 nullptr）
+    using stats_storage::stats;
 
 private:
-    SpinLock* spinlock_;
-    int lock_type_;
-    std::unique_lock<std::mutex> mutex_lock_;
+    static constexpr std::size_t lock_alignment =
+        TS_STL_CACHE_ALIGNED_LOCKS && Policy != LockPolicy::LockFree ? cache_line_size : alignof(mutex_type);
 
-#if TS_STL_SUPPORT_RW_LOCK
-    std::unique_lock<std::shared_mutex> rw_lock_;
-#endif
+    alignas(lock_alignment) mutable mutex_type mutex_;
 };
 
 /**
- * @brief 锁包装器 - 统一处理互斥锁、自旋锁和读写锁
+ * @brief 按缓存行对齐并填充的包装：每个对象独占完整的缓存行，数组中相邻元素不会伪共享
+ *
+ * 通过 value / get() / * / -> 访问被包装的对象；in_place 构造时参数转发给 T 的构造函数。
  */
-class LockGuard {
-public:
-    explicit LockGuard(LockPolicy policy = LockPolicy::Mutex) 
-        : policy_(policy) {
-        if (policy == LockPolicy::Mutex) {
-            mutex_ = std::make_unique<std::mutex>();
-        }
-        else if (policy == LockPolicy::SpinLock) {
-            spinlock_ = std::make_unique<SpinLock>();
-        }
-#if TS_STL_SUPPORT_RW_LOCK
-        else if (policy == LockPolicy::ReadWrite) {
-            shared_mutex_ = std::make_unique<std::shared_mutex>();
-        }
-#endif
+template <typename T>
+struct alignas(cache_line_size) cache_aligned {
+    T value;
+
+    cache_aligned() = default;
+
+    template <typename... Args>
+    explicit cache_aligned(std::in_place_t, Args&&... args) : value(std::forward<Args>(args)...) {}
+
+    T& get() noexcept { return value; }
+    const T& get() const noexcept { return value; }
+
+    T& operator*() noexcept { return value; }
+    const T& operator*() const noexcept { return value; }
+
+    T* operator->() noexcept { return &value; }
+    const T* operator->() const noexcept { return &value; }
+};
+
+namespace detail {
+
+/**
+ * @brief 对用户哈希值做二次混合，避免低质量哈希（如整数恒等哈希）的高低位分布不均
+ */
+inline std::size_t mix_hash(std::size_t h) noexcept {
+    std::uint64_t x = static_cast<std::uint64_t>(h);
+    x ^= x >> 33;
+    x *= 0xff51afd7ed558ccdULL;
+    x ^= x >> 33;
+    return static_cast<std::size_t>(x);
+}
+
+/**
+ * @brief 批量操作的元素个数提示：前向迭代器返回区间长度，单趟迭代器返回 0
+ */
+template <typename InputIt>
+std::size_t bulk_size_hint(InputIt first, InputIt last) {
+    using category = typename std::iterator_traits<InputIt>::iterator_category;
+    if constexpr (std::is_base_of_v<std::forward_iterator_tag, category>) {
+        return static_cast<std::size_t>(std::distance(first, last));
+    } else {
+        return 0;
     }
+}
 
-    // 获取写锁 - 返回 UnifiedLockGuard 以支持不同锁类型
-    UnifiedLockGuard write_lock() const {
-        if (policy_ == LockPolicy::Mutex) {
-            return UnifiedLockGuard(std::unique_lock<std::mutex>(*mutex_));
-        }
-        else if (policy_ == LockPolicy::SpinLock) {
-            return UnifiedLockGuard(*spinlock_);
+/**
+ * @brief 检测比较器/哈希函数是否声明了 is_transparent（支持异构查找）
+ */
+template <typename F, typename = void>
+struct is_transparent : std::false_type {};
+
+template <typename F>
+struct is_transparent<F, std::void_t<typename F::is_transparent>> : std::true_type {};
+
+/**
+ * @brief 仅当所有函数对象都是透明的时候启用异构查找重载
+ */
+template <typename... Fs>
+using enable_if_transparent_t = std::enable_if_t<(is_transparent<Fs>::value && ...), int>;
+
+/**
+ * @brief 调用遍历回调：回调返回 bool 时以其结果决定是否继续，返回 void 时总是继续
+ */
+template <typename Func, typename... Args>
+bool invoke_continue(Func& func, Args&&... args) {
+    if constexpr (std::is_same_v<std::invoke_result_t<Func&, Args...>, void>) {
+        func(std::forward<Args>(args)...);
+        return true;
+    } else {
+        return static_cast<bool>(func(std::forward<Args>(args)...));
+    }
+}
+
+/**
+ * @brief 有序区间扫描：从 first 开始依次访问满足 in_range 的元素，visit 返回 false 时提前结束
+ * @return 访问的元素个数
+ */
+template <typename Iter, typename InRange, typename Visit>
+std::size_t scan_while(Iter first, Iter last, InRange in_range, Visit visit) {
+    std::size_t visited = 0;
+    for (; first != last && in_range(*first); ++first) {
+        ++visited;
+        if (!visit(*first)) {
+            break;
         }
-        else if (policy_ == LockPolicy::LockFree) {
-            return UnifiedLockGuard(NullLockGuard());
+    }
+    return visited;
+}
+
+/**
+ * @brief 字符串类键是否以 prefix 开头
+ */
+template <typename Key>
+bool key_has_prefix(const Key& key, const Key& prefix) {
+    return key.size() >= prefix.size() && key.compare(0, prefix.size(), prefix) == 0;
+}
+
+// ==================== 整体转移与节点迁移辅助 ====================
+
+/**
+ * @brief 容器的分配器是否总是相等（没有 allocator_type 的扁平容器视为相等）
+ */
+template <typename C, typename = void>
+struct allocator_always_equal : std::true_type {};
+
+template <typename C>
+struct allocator_always_equal<C, std::void_t<typename C::allocator_type>>
+    : std::allocator_traits<typename C::allocator_type>::is_always_equal {};
+
+/**
+ * @brief 两个容器的内存能否直接交换/拼接：分配器总是相等，或运行时比较相等（如同一 pmr 内存资源）
+ */
+template <typename A, typename B>
+bool same_allocator(const A& a, const B& b) {
+    if constexpr (allocator_always_equal<A>::value && allocator_always_equal<B>::value) {
+        (void)a;
+        (void)b;
+        return true;
+    } else {
+        return a.get_allocator() == b.get_allocator();
+    }
+}
+
+/**
+ * @brief 逐个把 from 的元素移动到 to 的末尾，然后清空 from（分配器不相等时的回退路径）
+ */
+template <typename From, typename To>
+void move_elements(From& from, To& to) {
+    for (auto& elem : from) {
+        to.insert(to.end(), std::move(elem));
+    }
+    from.clear();
+}
+
+/**
+ * @brief 交换两个同类型容器的内容
+ *
+ * 分配器相等时为 O(1) 的 swap；否则各自保留原分配器，元素逐个移动，
+ * 保证节点始终由分配它的内存资源释放。
+ */
+template <typename C>
+void swap_contents(C& data, C& other) {
+    if constexpr (allocator_always_equal<C>::value) {
+        data.swap(other);
+    } else {
+        if (data.get_allocator() == other.get_allocator()) {
+            data.swap(other);
+            return;
         }
-#if TS_STL_SUPPORT_RW_LOCK
-        throw std::logic_error("Cannot acquire write_lock on ReadWrite policy");
-#else
-        throw std::logic_error("ReadWrite lock is not supported in this C++ version");
-#endif
+        C incoming(data.get_allocator());
+        move_elements(other, incoming);
+        move_elements(data, other);
+        data.swap(incoming);
     }
+}
 
-    // 获取互斥锁
-    UnifiedLockGuard lock() const {
-        return write_lock();
+/**
+ * @brief 检测容器是否提供 acquire_write_guard()（LockFree 特化没有）
+ */
+template <typename C, typename = void>
+struct has_write_guard : std::false_type {};
+
+template <typename C>
+struct has_write_guard<C, std::void_t<decltype(std::declval<const C&>().acquire_write_guard())>>
+    : std::true_type {};
+
+template <typename C>
+auto transfer_lock(const C& c) {
+    if constexpr (has_write_guard<C>::value) {
+        return c.acquire_write_guard();
+    } else {
+        (void)c;
+        return NullLockGuard();
     }
-    
-#if TS_STL_SUPPORT_RW_LOCK
-    // 获取读锁（只在读写锁时有效）
-    std::shared_lock<std::shared_mutex> read_lock() const {
-        if (policy_ == LockPolicy::ReadWrite) {
-            return std::shared_lock<std::shared_mutex>(*shared_mutex_);
+}
+
+/**
+ * @brief 取得底层标准容器：LockFree 特化为 get_unsafe()，加锁容器为 unsafe_ref()
+ */
+template <typename C, typename = void>
+struct has_get_unsafe : std::false_type {};
+
+template <typename C>
+struct has_get_unsafe<C, std::void_t<decltype(std::declval<C&>().get_unsafe())>> : std::true_type {};
+
+template <typename C>
+auto& raw_container(C& c) {
+    if constexpr (has_get_unsafe<C>::value) {
+        return c.get_unsafe();
+    } else {
+        return c.unsafe_ref();
+    }
+}
+
+/**
+ * @brief 按对象地址顺序对两个容器加写锁后执行 func()，两个方向同时迁移也不会死锁
+ */
+template <typename A, typename B, typename Func>
+decltype(auto) with_both_locked(const A& a, const B& b, Func func) {
+    if (std::less<const void*>()(static_cast<const void*>(&a), static_cast<const void*>(&b))) {
+        [[maybe_unused]] auto first = transfer_lock(a);
+        [[maybe_unused]] auto second = transfer_lock(b);
+        return func();
+    }
+    [[maybe_unused]] auto first = transfer_lock(b);
+    [[maybe_unused]] auto second = transfer_lock(a);
+    return func();
+}
+
+template <typename T>
+struct is_pair : std::false_type {};
+
+template <typename First, typename Second>
+struct is_pair<std::pair<First, Second>> : std::true_type {};
+
+/**
+ * @brief 标准容器的 key 部分：键值对取 first，集合元素取其本身
+ */
+template <typename Value>
+const auto& element_key(const Value& value) {
+    if constexpr (is_pair<Value>::value) {
+        return value.first;
+    } else {
+        return value;
+    }
+}
+
+/**
+ * @brief 把 source 中 target 没有的键迁移到 target，返回迁移的元素个数
+ *
+ * 分配器相等时使用 C++17 的节点 merge，只改指针不重新分配；
+ * 否则逐个移动元素并从 source 删除，键已存在的元素留在 source 中（与 std merge 语义一致）。
+ */
+template <typename Target, typename Source>
+std::size_t merge_nodes(Target& target, Source& source) {
+    const std::size_t before = target.size();
+    if (same_allocator(target, source)) {
+        target.merge(source);
+    } else {
+        for (auto it = source.begin(); it != source.end();) {
+            if (target.find(element_key(*it)) == target.end()) {
+                target.insert(std::move(*it));
+                it = source.erase(it);
+            } else {
+                ++it;
+            }
         }
-        throw std::logic_error("Cannot acquire read_lock on Mutex policy");
     }
+    return target.size() - before;
+}
 
-    // 获取互斥锁的写锁（用于读写锁）
-    std::unique_lock<std::shared_mutex> unique_lock_rw() const {
-        if (policy_ == LockPolicy::ReadWrite) {
-            return std::unique_lock<std::shared_mutex>(*shared_mutex_);
+/**
+ * @brief 插入节点句柄；分配器不相等时退化为按值插入。插入失败时节点仍归调用方所有
+ */
+template <typename C, typename Node>
+bool insert_node_handle(C& data, Node& node) {
+    if (node.empty()) {
+        return false;
+    }
+    if (same_allocator(data, node)) {
+        auto result = data.insert(std::move(node));
+        if (!result.inserted) {
+            node = std::move(result.node);
         }
-        throw std::logic_error("Cannot acquire unique_lock_rw on Mutex policy");
+        return result.inserted;
     }
-#endif
+    bool inserted = false;
+    if constexpr (is_pair<typename C::value_type>::value) {
+        if (data.find(node.key()) == data.end()) {
+            data.emplace(std::move(node.key()), std::move(node.mapped()));
+            inserted = true;
+        }
+    } else {
+        if (data.find(node.value()) == data.end()) {
+            data.insert(std::move(node.value()));
+            inserted = true;
+        }
+    }
+    if (inserted) {
+        node = Node();
+    }
+    return inserted;
+}
 
-    LockPolicy policy() const { return policy_; }
+} // namespace detail
 
-private:
-    LockPolicy policy_;
-    std::unique_ptr<std::mutex> mutex_;
-    std::unique_ptr<SpinLock> spinlock_;
-#if TS_STL_SUPPORT_RW_LOCK
-    std::unique_ptr<std::shared_mutex> shared_mutex_;
-#endif
+// ==================== 异构查找辅助 ====================
+
+/**
+ * @brief 透明的字符串哈希：std::string、std::string_view、const char* 得到相同哈希值
+ *
+ * 与 std::equal_to<> 搭配用于 unordered 容器，查找时无需构造临时 std::string
+ */
+struct string_hash {
+    using is_transparent = void;
+
+    std::size_t operator()(std::string_view value) const noexcept {
+        return std::hash<std::string_view>{}(value);
+    }
 };
 
 /**
@@ -312,7 +1247,7 @@ private:
 template <typename Derived, typename T, LockPolicy Policy>
 class container_mixin {
 protected:
-    LockGuard lock_guard_;
+    LockGuard<Policy> lock_guard_;
 
     // CRTP：获取派生类引用
     Derived& derived() {
@@ -323,45 +1258,22 @@ protected:
         return static_cast<const Derived&>(*this);
     }
 
-    // 获取写锁
+    // 获取写锁（守卫类型由 lock_traits<Policy> 在编译期确定）
     auto acquire_write_lock() const {
-        if constexpr (Policy == LockPolicy::Mutex) {
-            return lock_guard_.lock();
-        }
-        else if constexpr (Policy == LockPolicy::SpinLock) {
-            return lock_guard_.lock();
-        }
-        else if constexpr (Policy == LockPolicy::LockFree) {
-            return lock_guard_.lock();  // 返回空锁守卫
-        }
-#if TS_STL_SUPPORT_RW_LOCK
-        else if constexpr (Policy == LockPolicy::ReadWrite) {
-            return lock_guard_.unique_lock_rw();
-        }
-#endif
+        return lock_guard_.write_lock();
     }
 
     // 获取读锁
     auto acquire_read_lock() const {
-        if constexpr (Policy == LockPolicy::LockFree) {
-            return lock_guard_.lock();  // 返回空锁守卫
-        }
-        else if constexpr (Policy == LockPolicy::SpinLock) {
-            return lock_guard_.lock();
-        }
-#if TS_STL_SUPPORT_RW_LOCK
-        else if constexpr (Policy == LockPolicy::ReadWrite) {
-            return lock_guard_.read_lock();
-        }
-#endif
-        else {
-            return lock_guard_.lock();
-        }
+        return lock_guard_.read_lock();
     }
 
-public:
-    container_mixin() : lock_guard_(Policy) {}
+    container_mixin() = default;
+
+    // CRTP 基类不用于多态删除，析构函数保持非虚以避免每个容器携带虚表指针
+    ~container_mixin() = default;
 
+public:
     // ==================== 通用线程不安全接口 ====================
 
     auto unsafe_size() const {
@@ -392,6 +1304,38 @@ public:
     }
 #endif
 
+#if TS_STL_SUPPORT_RW_LOCK
+    /**
+     * @brief 获取可升级读锁（仅 LockPolicy::ReaderBiased）：持有期间可以读取，普通读者不受影响，
+     *        需要修改时调用 upgrade() 升级为写锁；持有期间通过 unsafe_* 接口访问容器
+     * @note 持有普通读锁的线程不能再获取可升级读锁并升级（会等待自己的读锁释放）；不计入锁竞争统计
+     */
+    template <LockPolicy P = Policy, std::enable_if_t<P == LockPolicy::ReaderBiased, int> = 0>
+    upgrade_guard<ReaderBiasedMutex> acquire_upgrade_guard() const {
+        return upgrade_guard<ReaderBiasedMutex>(lock_guard_.native_handle());
+    }
+#endif
+
+#if TS_STL_SUPPORT_COROUTINES
+    /**
+     * @brief co_await 获取写锁（仅 LockPolicy::Async）：锁被占用时挂起协程而不阻塞线程，
+     *        得到 std::unique_lock 守卫，持有期间通过 unsafe_* 接口访问容器
+     * @note 异步获取不计入锁竞争统计
+     */
+    template <LockPolicy P = Policy, std::enable_if_t<P == LockPolicy::Async, int> = 0>
+    auto async_write_lock() const {
+        return lock_guard_.native_handle().lock_async();
+    }
+
+    /**
+     * @brief co_await 获取读锁（仅 LockPolicy::Async），得到 std::shared_lock 守卫
+     */
+    template <LockPolicy P = Policy, std::enable_if_t<P == LockPolicy::Async, int> = 0>
+    auto async_read_lock() const {
+        return lock_guard_.native_handle().lock_shared_async();
+    }
+#endif
+
     template <typename Func>
     void with_write_lock(Func func) const {
         auto guard = acquire_write_lock();
@@ -406,6 +1350,34 @@ public:
     }
 #endif
 
+    // ==================== 锁竞争统计 ====================
+
+    /**
+     * @brief 以 name 登记本容器的锁统计，之后可通过 lock_stats_registry::instance().dump() 输出
+     * @note 未开启 TS_STL_ENABLE_LOCK_STATS 时为空操作
+     */
+    void register_lock_stats(std::string name) const {
+        if (lock_stats* stats = lock_guard_.stats()) {
+            lock_stats_registry::instance().add(std::move(name), *stats);
+        }
+    }
+
+    /**
+     * @brief 本容器锁统计的快照（未开启统计时全部为 0）
+     */
+    lock_stats_snapshot lock_statistics() const {
+        if (const lock_stats* stats = lock_guard_.stats()) {
+            return stats->snapshot();
+        }
+        return {};
+    }
+
+    void reset_lock_stats() const {
+        if (lock_stats* stats = lock_guard_.stats()) {
+            stats->reset();
+        }
+    }
+
     // ==================== 通用迭代和查询接口 ====================
 
     template <typename Func>
@@ -438,7 +1410,82 @@ public:
         return derived().data_;
     }
 
-    virtual ~container_mixin() = default;
+    // ==================== 整体取出（单次写锁） ====================
+
+    /**
+     * @brief 在一次写锁内取走全部元素，容器变为空
+     *
+     * 代替 copy() + clear()：分配器相等时只交换内部指针，O(1) 且不复制元素，
+     * 元素原有的缓冲区/节点随返回值一并带走。使用独立 pmr 内存资源的容器（如 pooled）
+     * 则在锁内逐个移动元素，返回的容器使用默认内存资源。
+     */
+    auto drain() {
+        typename Derived::Container out;
+        auto guard = acquire_write_lock();
+        detail::swap_contents(derived().data_, out);
+        return out;
+    }
+
+    /**
+     * @brief 在一次写锁内把容器内容与 other 交换：other 得到原有元素，容器得到 other 原有的元素
+     *
+     * 传入已 clear() 的缓冲区即可复用其容量（双缓冲），交换本身 O(1)，规则同 drain()
+     */
+    template <typename D = Derived>
+    void swap_out(typename D::Container& other) {
+        auto guard = acquire_write_lock();
+        detail::swap_contents(derived().data_, other);
+    }
+
+    // ==================== 并行遍历接口（读锁只获取一次，区间切分到多个线程） ====================
+    //
+    // 回调的参数约定与容器的 for_each 相同（键值对容器为 (key, value)），并且会被多个线程同时调用；
+    // 回调内不得访问同一个容器。max_threads 为 0 时使用硬件线程数，元素较少时直接在调用线程执行。
+
+    template <typename Func>
+    void parallel_for_each(Func func, std::size_t max_threads = 0) const {
+        auto guard = acquire_read_lock();
+        const auto& data = derived().data_;
+        ts_stl::parallel_for_each(data.begin(), data.end(),
+                                  [&func](const auto& elem) { detail::apply_element(func, elem); }, max_threads);
+    }
+
+    template <typename Predicate>
+    auto parallel_count_if(Predicate pred, std::size_t max_threads = 0) const {
+        auto guard = acquire_read_lock();
+        const auto& data = derived().data_;
+        return static_cast<decltype(data.size())>(ts_stl::parallel_count_if(
+            data.begin(), data.end(),
+            [&pred](const auto& elem) { return static_cast<bool>(detail::apply_element(pred, elem)); }, max_threads));
+    }
+
+    /**
+     * @brief 并行归约：每段从 identity 开始执行 acc = reduce(acc, elem)（键值对容器为 reduce(acc, key, value)），
+     *        各段结果按顺序用 combine 合并
+     */
+    template <typename U, typename Reduce, typename Combine, std::enable_if_t<!std::is_integral_v<Combine>, int> = 0>
+    U parallel_reduce(U identity, Reduce reduce, Combine combine, std::size_t max_threads = 0) const {
+        auto guard = acquire_read_lock();
+        const auto& data = derived().data_;
+        return ts_stl::parallel_reduce(data.begin(), data.end(), std::move(identity), reduce, combine, max_threads);
+    }
+
+    template <typename U, typename BinaryOp>
+    U parallel_reduce(U identity, BinaryOp op, std::size_t max_threads = 0) const {
+        return parallel_reduce(std::move(identity), op, op, max_threads);
+    }
+
+    /**
+     * @brief 并行地对每个元素执行 func，按容器顺序返回结果 std::vector
+     */
+    template <typename Func>
+    auto parallel_transform(Func func, std::size_t max_threads = 0) const {
+        auto guard = acquire_read_lock();
+        const auto& data = derived().data_;
+        return ts_stl::parallel_transform(
+            data.begin(), data.end(), [&func](const auto& elem) { return detail::apply_element(func, elem); },
+            max_threads);
+    }
 };
 
 } // namespace ts_stl
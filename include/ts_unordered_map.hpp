@@ -16,43 +16,54 @@ namespace ts_stl {
  * @tparam Hash 哈希函数（默认使用std::hash）
  * @tparam KeyEqual 键相等比较器（默认使用std::equal_to）
  * @tparam Policy 锁策略（默认使用互斥锁）
+ * @tparam Allocator 底层标准容器使用的分配器（默认使用std::allocator）
  */
-template <typename Key, typename T, typename Hash = std::hash<Key>, typename KeyEqual = std::equal_to<Key>, LockPolicy Policy = LockPolicy::Mutex>
-class unordered_map : public container_mixin<unordered_map<Key, T, Hash, KeyEqual, Policy>, std::pair<const Key, T>, Policy> {
+template <typename Key, typename T, typename Hash = std::hash<Key>, typename KeyEqual = std::equal_to<Key>, LockPolicy Policy = LockPolicy::Mutex,
+          typename Allocator = std::allocator<std::pair<const Key, T>>>
+class unordered_map : public container_mixin<unordered_map<Key, T, Hash, KeyEqual, Policy, Allocator>, std::pair<const Key, T>, Policy> {
 private:
-    friend class container_mixin<unordered_map<Key, T, Hash, KeyEqual, Policy>, std::pair<const Key, T>, Policy>;
+    friend class container_mixin<unordered_map<Key, T, Hash, KeyEqual, Policy, Allocator>, std::pair<const Key, T>, Policy>;
 
-    std::unordered_map<Key, T, Hash, KeyEqual> data_;
+    std::unordered_map<Key, T, Hash, KeyEqual, Allocator> data_;
 
-    using Base = container_mixin<unordered_map<Key, T, Hash, KeyEqual, Policy>, std::pair<const Key, T>, Policy>;
+    using Base = container_mixin<unordered_map<Key, T, Hash, KeyEqual, Policy, Allocator>, std::pair<const Key, T>, Policy>;
     using Base::acquire_write_lock;
     using Base::acquire_read_lock;
 
 public:
     // 为基类提供必要的类型信息
-    using Container = std::unordered_map<Key, T, Hash, KeyEqual>;
+    using Container = std::unordered_map<Key, T, Hash, KeyEqual, Allocator>;
     
     using key_type = Key;
     using mapped_type = T;
     using value_type = std::pair<const Key, T>;
-    using size_type = typename std::unordered_map<Key, T, Hash, KeyEqual>::size_type;
-    using iterator = typename std::unordered_map<Key, T, Hash, KeyEqual>::iterator;
-    using const_iterator = typename std::unordered_map<Key, T, Hash, KeyEqual>::const_iterator;
+    using allocator_type = Allocator;
+    using size_type = typename std::unordered_map<Key, T, Hash, KeyEqual, Allocator>::size_type;
+    using iterator = typename std::unordered_map<Key, T, Hash, KeyEqual, Allocator>::iterator;
+    using const_iterator = typename std::unordered_map<Key, T, Hash, KeyEqual, Allocator>::const_iterator;
+    using node_type = typename std::unordered_map<Key, T, Hash, KeyEqual, Allocator>::node_type;
 
     // ==================== 构造函数 ====================
 
     unordered_map() : Base() {}
 
+    /**
+     * @brief 使用指定分配器构造（如 std::pmr::polymorphic_allocator）
+     */
+    explicit unordered_map(const Allocator& alloc) : Base(), data_(alloc) {}
+
+    unordered_map(size_type bucket_count, const Allocator& alloc) : Base(), data_(bucket_count, alloc) {}
+
     explicit unordered_map(size_type bucket_count) : Base() {
-        data_ = std::unordered_map<Key, T, Hash, KeyEqual>(bucket_count);
+        data_ = std::unordered_map<Key, T, Hash, KeyEqual, Allocator>(bucket_count);
     }
 
     unordered_map(size_type bucket_count, const Hash& hash) : Base() {
-        data_ = std::unordered_map<Key, T, Hash, KeyEqual>(bucket_count, hash);
+        data_ = std::unordered_map<Key, T, Hash, KeyEqual, Allocator>(bucket_count, hash);
     }
 
     unordered_map(size_type bucket_count, const Hash& hash, const KeyEqual& equal) : Base() {
-        data_ = std::unordered_map<Key, T, Hash, KeyEqual>(bucket_count, hash, equal);
+        data_ = std::unordered_map<Key, T, Hash, KeyEqual, Allocator>(bucket_count, hash, equal);
     }
 
     template <typename InputIt>
@@ -224,6 +235,56 @@ public:
         return data_.count(key);
     }
 
+#if defined(__cpp_lib_generic_unordered_lookup)
+    // ==================== 异构查找（透明比较器） ====================
+
+    /**
+     * @brief 以任意可与 Key 比较的类型查找（需要 Hash 与 KeyEqual 都声明 is_transparent，
+     *        如 string_hash + std::equal_to<>；依赖 C++20 的无序容器异构查找）
+     */
+    template <typename K, typename H = Hash, typename E = KeyEqual, detail::enable_if_transparent_t<H, E> = 0>
+    bool contains(const K& key) const {
+        auto guard = acquire_read_lock();
+        return data_.find(key) != data_.end();
+    }
+
+    template <typename K, typename H = Hash, typename E = KeyEqual, detail::enable_if_transparent_t<H, E> = 0>
+    size_type count(const K& key) const {
+        auto guard = acquire_read_lock();
+        return data_.count(key);
+    }
+
+    template <typename K, typename H = Hash, typename E = KeyEqual, detail::enable_if_transparent_t<H, E> = 0>
+    T get(const K& key, const T& default_value = T()) const {
+        auto guard = acquire_read_lock();
+        auto it = data_.find(key);
+        if (it != data_.end()) {
+            return it->second;
+        }
+        return default_value;
+    }
+
+    template <typename K, typename H = Hash, typename E = KeyEqual, detail::enable_if_transparent_t<H, E> = 0>
+    T at(const K& key) const {
+        auto guard = acquire_read_lock();
+        auto it = data_.find(key);
+        if (it == data_.end()) {
+            throw std::out_of_range("unordered_map::at");
+        }
+        return it->second;
+    }
+
+    template <typename K, typename H = Hash, typename E = KeyEqual, detail::enable_if_transparent_t<H, E> = 0>
+    T& at(const K& key) {
+        auto guard = acquire_write_lock();
+        auto it = data_.find(key);
+        if (it == data_.end()) {
+            throw std::out_of_range("unordered_map::at");
+        }
+        return it->second;
+    }
+#endif
+
     // ==================== 修改操作 ====================
 
     /**
@@ -278,19 +339,259 @@ public:
         data_.erase(first, last);
     }
 
+    // ==================== 节点迁移（C++17 extract / merge） ====================
+
+    /**
+     * @brief 在写锁内摘下键对应的节点，键不存在时返回空节点
+     *
+     * 节点句柄持有元素本身，插入另一个分配器相同的容器时不复制、不重新分配
+     */
+    node_type extract(const Key& key) {
+        auto guard = acquire_write_lock();
+        return data_.extract(key);
+    }
+
+    /**
+     * @brief 在写锁内插入 extract() 得到的节点
+     * @return 插入成功返回 true，节点被容器接管；键已存在时返回 false，节点仍归调用方所有
+     * @note 分配器不相等（不同 pmr 内存资源）时退化为按值移动插入
+     */
+    bool insert_node(node_type& node) {
+        auto guard = acquire_write_lock();
+        return detail::insert_node_handle(data_, node);
+    }
+
+    bool insert_node(node_type&& node) {
+        return insert_node(node);
+    }
+
+    /**
+     * @brief 把 source 中本容器没有的键迁移过来（如热数据层迁往冷数据层），source 可以使用任意锁策略
+     * @return 迁移的元素个数；键已存在的元素留在 source 中
+     *
+     * 两个容器按地址顺序同时加写锁，反方向并发迁移不会死锁。
+     * 分配器相等时只重新链接节点，不分配内存；否则逐个移动元素。
+     */
+    template <typename Hash2, typename KeyEqual2, LockPolicy SourcePolicy>
+    size_type merge_from(unordered_map<Key, T, Hash2, KeyEqual2, SourcePolicy, Allocator>& source) {
+        if (static_cast<const void*>(&source) == static_cast<const void*>(this)) {
+            return 0;
+        }
+        return detail::with_both_locked(*this, source, [&] {
+            return static_cast<size_type>(detail::merge_nodes(data_, detail::raw_container(source)));
+        });
+    }
+
+    // ==================== 原地访问与原子读-改-写 ====================
+
+    /**
+     * @brief 在读锁内对键对应的值执行 func(const T&)，不复制值
+     * @return 键存在时返回 true
+     */
+    template <typename Func>
+    bool visit(const Key& key, Func func) const {
+        auto guard = acquire_read_lock();
+        auto it = data_.find(key);
+        if (it == data_.end()) {
+            return false;
+        }
+        func(static_cast<const T&>(it->second));
+        return true;
+    }
+
+    /**
+     * @brief 在写锁内对键对应的值执行 func(T&)，原地修改
+     * @return 键存在时返回 true
+     */
+    template <typename Func>
+    bool visit_mut(const Key& key, Func func) {
+        auto guard = acquire_write_lock();
+        auto it = data_.find(key);
+        if (it == data_.end()) {
+            return false;
+        }
+        func(it->second);
+        return true;
+    }
+
+    /**
+     * @brief 键存在时在写锁内执行 func(T&)；若 func 返回 bool 且为 false，则删除该元素
+     * @return 调用前键是否存在
+     */
+    template <typename Func>
+    bool compute_if_present(const Key& key, Func func) {
+        auto guard = acquire_write_lock();
+        auto it = data_.find(key);
+        if (it == data_.end()) {
+            return false;
+        }
+        if constexpr (std::is_same_v<std::invoke_result_t<Func&, T&>, void>) {
+            func(it->second);
+        } else {
+            if (!func(it->second)) {
+                data_.erase(it);
+            }
+        }
+        return true;
+    }
+
+    /**
+     * @brief 键不存在时在写锁内以 factory() 的结果插入（键存在时 factory 不会被调用）
+     * @return 是否插入了新元素
+     */
+    template <typename Factory>
+    bool compute_if_absent(const Key& key, Factory factory) {
+#if TS_STL_SUPPORT_RW_LOCK
+        if constexpr (Policy == LockPolicy::ReaderBiased) {
+            // 命中时只持有读锁；未命中时在可升级读锁内复查并调用 factory()，插入时才升级为写锁
+            if (contains(key)) {
+                return false;
+            }
+            auto guard = this->acquire_upgrade_guard();
+            if (data_.find(key) != data_.end()) {
+                return false;
+            }
+            T value = factory();
+            guard.upgrade();
+            data_.emplace(key, std::move(value));
+            return true;
+        }
+#endif
+        auto guard = acquire_write_lock();
+        if (data_.find(key) != data_.end()) {
+            return false;
+        }
+        data_.emplace(key, factory());
+        return true;
+    }
+
+    /**
+     * @brief 返回键对应值的拷贝；键不存在时先以 factory() 的结果插入（operator[] 式的"先查后插"）
+     *
+     * 支持共享读的策略下先在读锁内查找，命中时不获取写锁。
+     * LockPolicy::ReaderBiased 下未命中时经可升级读锁复查并调用 factory()，
+     * 只在真正插入时短暂升级为写锁，期间普通读者不受影响；其它策略未命中时在写锁内复查并插入。
+     */
+    template <typename Factory>
+    T get_or_insert(const Key& key, Factory factory) {
+        if constexpr (LockGuard<Policy>::shared_reads) {
+            auto guard = acquire_read_lock();
+            auto it = data_.find(key);
+            if (it != data_.end()) {
+                return it->second;
+            }
+        }
+#if TS_STL_SUPPORT_RW_LOCK
+        if constexpr (Policy == LockPolicy::ReaderBiased) {
+            auto guard = this->acquire_upgrade_guard();
+            auto it = data_.find(key);
+            if (it != data_.end()) {
+                return it->second;
+            }
+            T value = factory();
+            guard.upgrade();
+            return data_.emplace(key, std::move(value)).first->second;
+        }
+#endif
+        auto guard = acquire_write_lock();
+        auto it = data_.find(key);
+        if (it == data_.end()) {
+            it = data_.emplace(key, factory()).first;
+        }
+        return it->second;
+    }
+
+    /**
+     * @brief 键不存在时插入 value，否则在写锁内执行 func(T& existing, const T& value) 合并
+     * @return 是否插入了新元素
+     */
+    template <typename Func>
+    bool merge(const Key& key, const T& value, Func func) {
+        auto guard = acquire_write_lock();
+        auto result = data_.try_emplace(key, value);
+        if (!result.second) {
+            func(result.first->second, value);
+        }
+        return result.second;
+    }
+
+    // ==================== 批量操作（单次加锁） ====================
+
+    /**
+     * @brief 批量插入键值对（只加锁一次，并按批量大小预先 reserve），已存在的键保持不变
+     * @return 新插入的元素个数
+     */
+    template <typename InputIt>
+    size_type insert_bulk(InputIt first, InputIt last) {
+        auto guard = acquire_write_lock();
+        data_.reserve(data_.size() + detail::bulk_size_hint(first, last));
+        size_type inserted = 0;
+        for (; first != last; ++first) {
+            if (data_.insert(*first).second) {
+                ++inserted;
+            }
+        }
+        return inserted;
+    }
+
+    template <typename Range>
+    size_type insert_bulk(const Range& range) {
+        return insert_bulk(std::begin(range), std::end(range));
+    }
+
+    /**
+     * @brief 批量删除键（只加锁一次）
+     * @return 实际删除的元素个数
+     */
+    template <typename InputIt>
+    size_type erase_bulk(InputIt first, InputIt last) {
+        auto guard = acquire_write_lock();
+        size_type erased = 0;
+        for (; first != last; ++first) {
+            erased += data_.erase(*first);
+        }
+        return erased;
+    }
+
+    template <typename KeyRange>
+    size_type erase_bulk(const KeyRange& keys) {
+        return erase_bulk(std::begin(keys), std::end(keys));
+    }
+
+    /**
+     * @brief 批量查找（只加锁一次），按 keys 的顺序输出值，不存在的键输出 default_value
+     * @return 命中的键个数
+     */
+    template <typename KeyRange, typename OutputIt>
+    size_type get_many(const KeyRange& keys, OutputIt out, const T& default_value = T()) const {
+        auto guard = acquire_read_lock();
+        size_type found = 0;
+        for (const auto& key : keys) {
+            auto it = data_.find(key);
+            if (it != data_.end()) {
+                *out = it->second;
+                ++found;
+            } else {
+                *out = default_value;
+            }
+            ++out;
+        }
+        return found;
+    }
+
     // ==================== STL兼容性 ====================
 
     /**
      * @brief 隐式转换到std::unordered_map
      */
-    operator const std::unordered_map<Key, T, Hash, KeyEqual>&() const {
+    operator const std::unordered_map<Key, T, Hash, KeyEqual, Allocator>&() const {
         return data_;
     }
 
     /**
      * @brief 获取内部unordered_map的拷贝
      */
-    std::unordered_map<Key, T, Hash, KeyEqual> copy() const {
+    std::unordered_map<Key, T, Hash, KeyEqual, Allocator> copy() const {
         auto guard = acquire_read_lock();
         return data_;
     }
@@ -298,10 +599,17 @@ public:
     /**
      * @brief 获取内部unordered_map的引用
      */
-    const std::unordered_map<Key, T, Hash, KeyEqual>& ref() const {
+    const std::unordered_map<Key, T, Hash, KeyEqual, Allocator>& ref() const {
         return data_;
     }
 
+    /**
+     * @brief 获取底层容器的分配器
+     */
+    allocator_type get_allocator() const noexcept {
+        return data_.get_allocator();
+    }
+
     // ==================== 迭代和查询 ====================
 
     /**
@@ -351,11 +659,11 @@ public:
     /**
      * @brief 获取内部unordered_map的非const引用（线程不安全）
      */
-    std::unordered_map<Key, T, Hash, KeyEqual>& unsafe_ref() {
+    std::unordered_map<Key, T, Hash, KeyEqual, Allocator>& unsafe_ref() {
         return data_;
     }
 
-    const std::unordered_map<Key, T, Hash, KeyEqual>& unsafe_ref() const {
+    const std::unordered_map<Key, T, Hash, KeyEqual, Allocator>& unsafe_ref() const {
         return data_;
     }
 
@@ -453,24 +761,30 @@ public:
 /**
  * @brief Unordered Map 的 LockFree 特化版本 - 为极限性能优化
  */
-template <typename Key, typename T, typename Hash, typename KeyEqual>
-class unordered_map<Key, T, Hash, KeyEqual, LockPolicy::LockFree> {
+template <typename Key, typename T, typename Hash, typename KeyEqual, typename Allocator>
+class unordered_map<Key, T, Hash, KeyEqual, LockPolicy::LockFree, Allocator> {
 private:
-    std::unordered_map<Key, T, Hash, KeyEqual> data_;
+    std::unordered_map<Key, T, Hash, KeyEqual, Allocator> data_;
 
 public:
     // 类型定义
     using key_type = Key;
     using mapped_type = T;
     using value_type = std::pair<const Key, T>;
-    using size_type = typename std::unordered_map<Key, T, Hash, KeyEqual>::size_type;
-    using iterator = typename std::unordered_map<Key, T, Hash, KeyEqual>::iterator;
-    using const_iterator = typename std::unordered_map<Key, T, Hash, KeyEqual>::const_iterator;
+    using allocator_type = Allocator;
+    using size_type = typename std::unordered_map<Key, T, Hash, KeyEqual, Allocator>::size_type;
+    using iterator = typename std::unordered_map<Key, T, Hash, KeyEqual, Allocator>::iterator;
+    using const_iterator = typename std::unordered_map<Key, T, Hash, KeyEqual, Allocator>::const_iterator;
+    using node_type = typename std::unordered_map<Key, T, Hash, KeyEqual, Allocator>::node_type;
 
     // ==================== 构造函数 ====================
 
     unordered_map() = default;
 
+    explicit unordered_map(const Allocator& alloc) : data_(alloc) {}
+
+    unordered_map(size_type bucket_count, const Allocator& alloc) : data_(bucket_count, alloc) {}
+
     explicit unordered_map(size_type bucket_count) : data_(bucket_count) {}
 
     unordered_map(size_type bucket_count, const Hash& hash) : data_(bucket_count, hash) {}
@@ -559,6 +873,45 @@ public:
         return data_.count(key);
     }
 
+#if defined(__cpp_lib_generic_unordered_lookup)
+    template <typename K, typename H = Hash, typename E = KeyEqual, detail::enable_if_transparent_t<H, E> = 0>
+    bool contains(const K& key) const {
+        return data_.find(key) != data_.end();
+    }
+
+    template <typename K, typename H = Hash, typename E = KeyEqual, detail::enable_if_transparent_t<H, E> = 0>
+    size_type count(const K& key) const {
+        return data_.count(key);
+    }
+
+    template <typename K, typename H = Hash, typename E = KeyEqual, detail::enable_if_transparent_t<H, E> = 0>
+    T get(const K& key, const T& default_value = T()) const {
+        auto it = data_.find(key);
+        if (it != data_.end()) {
+            return it->second;
+        }
+        return default_value;
+    }
+
+    template <typename K, typename H = Hash, typename E = KeyEqual, detail::enable_if_transparent_t<H, E> = 0>
+    T at(const K& key) const {
+        auto it = data_.find(key);
+        if (it == data_.end()) {
+            throw std::out_of_range("unordered_map::at");
+        }
+        return it->second;
+    }
+
+    template <typename K, typename H = Hash, typename E = KeyEqual, detail::enable_if_transparent_t<H, E> = 0>
+    T& at(const K& key) {
+        auto it = data_.find(key);
+        if (it == data_.end()) {
+            throw std::out_of_range("unordered_map::at");
+        }
+        return it->second;
+    }
+#endif
+
     // ==================== 修改操作（零开销） ====================
 
     std::pair<bool, size_type> insert(const Key& key, const T& value) {
@@ -581,6 +934,162 @@ public:
         return data_.erase(key);
     }
 
+    node_type extract(const Key& key) {
+        return data_.extract(key);
+    }
+
+    bool insert_node(node_type& node) {
+        return detail::insert_node_handle(data_, node);
+    }
+
+    bool insert_node(node_type&& node) {
+        return insert_node(node);
+    }
+
+    template <typename Hash2, typename KeyEqual2, LockPolicy SourcePolicy>
+    size_type merge_from(unordered_map<Key, T, Hash2, KeyEqual2, SourcePolicy, Allocator>& source) {
+        if (static_cast<const void*>(&source) == static_cast<const void*>(this)) {
+            return 0;
+        }
+        return detail::with_both_locked(*this, source, [&] {
+            return static_cast<size_type>(detail::merge_nodes(data_, detail::raw_container(source)));
+        });
+    }
+
+    std::unordered_map<Key, T, Hash, KeyEqual, Allocator> drain() {
+        std::unordered_map<Key, T, Hash, KeyEqual, Allocator> out;
+        detail::swap_contents(data_, out);
+        return out;
+    }
+
+    void swap_out(std::unordered_map<Key, T, Hash, KeyEqual, Allocator>& other) {
+        detail::swap_contents(data_, other);
+    }
+
+    template <typename Func>
+    bool visit(const Key& key, Func func) const {
+        auto it = data_.find(key);
+        if (it == data_.end()) {
+            return false;
+        }
+        func(static_cast<const T&>(it->second));
+        return true;
+    }
+
+    template <typename Func>
+    bool visit_mut(const Key& key, Func func) {
+        auto it = data_.find(key);
+        if (it == data_.end()) {
+            return false;
+        }
+        func(it->second);
+        return true;
+    }
+
+    template <typename Func>
+    bool compute_if_present(const Key& key, Func func) {
+        auto it = data_.find(key);
+        if (it == data_.end()) {
+            return false;
+        }
+        if constexpr (std::is_same_v<std::invoke_result_t<Func&, T&>, void>) {
+            func(it->second);
+        } else {
+            if (!func(it->second)) {
+                data_.erase(it);
+            }
+        }
+        return true;
+    }
+
+    template <typename Factory>
+    bool compute_if_absent(const Key& key, Factory factory) {
+        if (data_.find(key) != data_.end()) {
+            return false;
+        }
+        data_.emplace(key, factory());
+        return true;
+    }
+
+    template <typename Factory>
+    T get_or_insert(const Key& key, Factory factory) {
+        auto it = data_.find(key);
+        if (it == data_.end()) {
+            it = data_.emplace(key, factory()).first;
+        }
+        return it->second;
+    }
+
+    template <typename Func>
+    bool merge(const Key& key, const T& value, Func func) {
+        auto result = data_.try_emplace(key, value);
+        if (!result.second) {
+            func(result.first->second, value);
+        }
+        return result.second;
+    }
+
+    // ==================== 批量操作（零开销） ====================
+
+    /**
+     * @brief 批量插入键值对（按批量大小预先 reserve），已存在的键保持不变
+     * @return 新插入的元素个数
+     */
+    template <typename InputIt>
+    size_type insert_bulk(InputIt first, InputIt last) {
+        data_.reserve(data_.size() + detail::bulk_size_hint(first, last));
+        size_type inserted = 0;
+        for (; first != last; ++first) {
+            if (data_.insert(*first).second) {
+                ++inserted;
+            }
+        }
+        return inserted;
+    }
+
+    template <typename Range>
+    size_type insert_bulk(const Range& range) {
+        return insert_bulk(std::begin(range), std::end(range));
+    }
+
+    /**
+     * @brief 批量删除键
+     * @return 实际删除的元素个数
+     */
+    template <typename InputIt>
+    size_type erase_bulk(InputIt first, InputIt last) {
+        size_type erased = 0;
+        for (; first != last; ++first) {
+            erased += data_.erase(*first);
+        }
+        return erased;
+    }
+
+    template <typename KeyRange>
+    size_type erase_bulk(const KeyRange& keys) {
+        return erase_bulk(std::begin(keys), std::end(keys));
+    }
+
+    /**
+     * @brief 批量查找，按 keys 的顺序输出值，不存在的键输出 default_value
+     * @return 命中的键个数
+     */
+    template <typename KeyRange, typename OutputIt>
+    size_type get_many(const KeyRange& keys, OutputIt out, const T& default_value = T()) const {
+        size_type found = 0;
+        for (const auto& key : keys) {
+            auto it = data_.find(key);
+            if (it != data_.end()) {
+                *out = it->second;
+                ++found;
+            } else {
+                *out = default_value;
+            }
+            ++out;
+        }
+        return found;
+    }
+
     // ==================== 迭代器（零开销） ====================
 
     iterator begin() noexcept {
@@ -609,21 +1118,25 @@ public:
 
     // ==================== 转换操作 ====================
 
-    operator std::unordered_map<Key, T, Hash, KeyEqual>&() noexcept {
+    operator std::unordered_map<Key, T, Hash, KeyEqual, Allocator>&() noexcept {
         return data_;
     }
 
-    operator const std::unordered_map<Key, T, Hash, KeyEqual>&() const noexcept {
+    operator const std::unordered_map<Key, T, Hash, KeyEqual, Allocator>&() const noexcept {
         return data_;
     }
 
-    std::unordered_map<Key, T, Hash, KeyEqual>& get_unsafe() noexcept {
+    std::unordered_map<Key, T, Hash, KeyEqual, Allocator>& get_unsafe() noexcept {
         return data_;
     }
 
-    const std::unordered_map<Key, T, Hash, KeyEqual>& get_unsafe() const noexcept {
+    const std::unordered_map<Key, T, Hash, KeyEqual, Allocator>& get_unsafe() const noexcept {
         return data_;
     }
+
+    allocator_type get_allocator() const noexcept {
+        return data_.get_allocator();
+    }
 };
 
 } // namespace ts_stl
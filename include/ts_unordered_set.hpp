@@ -16,38 +16,45 @@ namespace ts_stl {
  * @tparam KeyEqual 键相等比较器（默认使用std::equal_to）
  * @tparam Policy 锁策略（默认使用互斥锁）
  */
-template <typename Key, typename Hash = std::hash<Key>, typename KeyEqual = std::equal_to<Key>, LockPolicy Policy = LockPolicy::Mutex>
-class unordered_set : public container_mixin<unordered_set<Key, Hash, KeyEqual, Policy>, Key, Policy> {
+template <typename Key, typename Hash = std::hash<Key>, typename KeyEqual = std::equal_to<Key>, LockPolicy Policy = LockPolicy::Mutex,
+          typename Allocator = std::allocator<Key>>
+class unordered_set : public container_mixin<unordered_set<Key, Hash, KeyEqual, Policy, Allocator>, Key, Policy> {
 private:
-    friend class container_mixin<unordered_set<Key, Hash, KeyEqual, Policy>, Key, Policy>;
+    friend class container_mixin<unordered_set<Key, Hash, KeyEqual, Policy, Allocator>, Key, Policy>;
 
-    std::unordered_set<Key, Hash, KeyEqual> data_;
+    std::unordered_set<Key, Hash, KeyEqual, Allocator> data_;
 
-    using Base = container_mixin<unordered_set<Key, Hash, KeyEqual, Policy>, Key, Policy>;
+    using Base = container_mixin<unordered_set<Key, Hash, KeyEqual, Policy, Allocator>, Key, Policy>;
     using Base::acquire_write_lock;
     using Base::acquire_read_lock;
 
 public:
-    using Container = std::unordered_set<Key, Hash, KeyEqual>;
+    using Container = std::unordered_set<Key, Hash, KeyEqual, Allocator>;
     using value_type = Key;
-    using size_type = typename std::unordered_set<Key, Hash, KeyEqual>::size_type;
-    using iterator = typename std::unordered_set<Key, Hash, KeyEqual>::iterator;
-    using const_iterator = typename std::unordered_set<Key, Hash, KeyEqual>::const_iterator;
+    using allocator_type = Allocator;
+    using size_type = typename std::unordered_set<Key, Hash, KeyEqual, Allocator>::size_type;
+    using iterator = typename std::unordered_set<Key, Hash, KeyEqual, Allocator>::iterator;
+    using const_iterator = typename std::unordered_set<Key, Hash, KeyEqual, Allocator>::const_iterator;
+    using node_type = typename std::unordered_set<Key, Hash, KeyEqual, Allocator>::node_type;
 
     // ==================== 构造函数 ====================
 
     unordered_set() : Base() {}
 
+    explicit unordered_set(const Allocator& alloc) : Base(), data_(alloc) {}
+
+    unordered_set(size_type bucket_count, const Allocator& alloc) : Base(), data_(bucket_count, alloc) {}
+
     explicit unordered_set(size_type bucket_count) : Base() {
-        data_ = std::unordered_set<Key, Hash, KeyEqual>(bucket_count);
+        data_ = std::unordered_set<Key, Hash, KeyEqual, Allocator>(bucket_count);
     }
 
     unordered_set(size_type bucket_count, const Hash& hash) : Base() {
-        data_ = std::unordered_set<Key, Hash, KeyEqual>(bucket_count, hash);
+        data_ = std::unordered_set<Key, Hash, KeyEqual, Allocator>(bucket_count, hash);
     }
 
     unordered_set(size_type bucket_count, const Hash& hash, const KeyEqual& equal) : Base() {
-        data_ = std::unordered_set<Key, Hash, KeyEqual>(bucket_count, hash, equal);
+        data_ = std::unordered_set<Key, Hash, KeyEqual, Allocator>(bucket_count, hash, equal);
     }
 
     template <typename InputIt>
@@ -140,6 +147,26 @@ public:
         return data_.count(key);
     }
 
+#if defined(__cpp_lib_generic_unordered_lookup)
+    // ==================== 异构查找（透明比较器） ====================
+
+    /**
+     * @brief 以任意可与 Key 比较的类型查找（需要 Hash 与 KeyEqual 都声明 is_transparent，
+     *        如 string_hash + std::equal_to<>；依赖 C++20 的无序容器异构查找）
+     */
+    template <typename K, typename H = Hash, typename E = KeyEqual, detail::enable_if_transparent_t<H, E> = 0>
+    bool contains(const K& key) const {
+        auto guard = acquire_read_lock();
+        return data_.find(key) != data_.end();
+    }
+
+    template <typename K, typename H = Hash, typename E = KeyEqual, detail::enable_if_transparent_t<H, E> = 0>
+    size_type count(const K& key) const {
+        auto guard = acquire_read_lock();
+        return data_.count(key);
+    }
+#endif
+
     // ==================== 修改操作 ====================
 
     std::pair<iterator, bool> insert(const Key& key) {
@@ -173,21 +200,114 @@ public:
         data_.erase(first, last);
     }
 
+    // ==================== 节点迁移（C++17 extract / merge） ====================
+
+    /**
+     * @brief 在写锁内摘下键对应的节点，键不存在时返回空节点
+     *
+     * 节点句柄持有元素本身，插入另一个分配器相同的容器时不复制、不重新分配
+     */
+    node_type extract(const Key& key) {
+        auto guard = acquire_write_lock();
+        return data_.extract(key);
+    }
+
+    /**
+     * @brief 在写锁内插入 extract() 得到的节点
+     * @return 插入成功返回 true，节点被容器接管；键已存在时返回 false，节点仍归调用方所有
+     * @note 分配器不相等（不同 pmr 内存资源）时退化为按值移动插入
+     */
+    bool insert_node(node_type& node) {
+        auto guard = acquire_write_lock();
+        return detail::insert_node_handle(data_, node);
+    }
+
+    bool insert_node(node_type&& node) {
+        return insert_node(node);
+    }
+
+    /**
+     * @brief 把 source 中本容器没有的键迁移过来（如热数据层迁往冷数据层），source 可以使用任意锁策略
+     * @return 迁移的元素个数；键已存在的元素留在 source 中
+     *
+     * 两个容器按地址顺序同时加写锁，反方向并发迁移不会死锁。
+     * 分配器相等时只重新链接节点，不分配内存；否则逐个移动元素。
+     */
+    template <typename Hash2, typename KeyEqual2, LockPolicy SourcePolicy>
+    size_type merge_from(unordered_set<Key, Hash2, KeyEqual2, SourcePolicy, Allocator>& source) {
+        if (static_cast<const void*>(&source) == static_cast<const void*>(this)) {
+            return 0;
+        }
+        return detail::with_both_locked(*this, source, [&] {
+            return static_cast<size_type>(detail::merge_nodes(data_, detail::raw_container(source)));
+        });
+    }
+
+    // ==================== 批量操作（单次加锁） ====================
+
+    /**
+     * @brief 批量插入键（只加锁一次，并按批量大小预先 reserve），已存在的键保持不变
+     * @return 新插入的元素个数
+     */
+    template <typename InputIt>
+    size_type insert_bulk(InputIt first, InputIt last) {
+        auto guard = acquire_write_lock();
+        data_.reserve(data_.size() + detail::bulk_size_hint(first, last));
+        size_type inserted = 0;
+        for (; first != last; ++first) {
+            if (data_.insert(*first).second) {
+                ++inserted;
+            }
+        }
+        return inserted;
+    }
+
+    template <typename Range>
+    size_type insert_bulk(const Range& range) {
+        return insert_bulk(std::begin(range), std::end(range));
+    }
+
+    /**
+     * @brief 批量删除键（只加锁一次）
+     * @return 实际删除的元素个数
+     */
+    template <typename InputIt>
+    size_type erase_bulk(InputIt first, InputIt last) {
+        auto guard = acquire_write_lock();
+        size_type erased = 0;
+        for (; first != last; ++first) {
+            erased += data_.erase(*first);
+        }
+        return erased;
+    }
+
+    template <typename KeyRange>
+    size_type erase_bulk(const KeyRange& keys) {
+        return erase_bulk(std::begin(keys), std::end(keys));
+    }
+
     // ==================== STL兼容性 ====================
 
-    operator const std::unordered_set<Key, Hash, KeyEqual>&() const {
+    operator const std::unordered_set<Key, Hash, KeyEqual, Allocator>&() const {
         return data_;
     }
 
-    std::unordered_set<Key, Hash, KeyEqual> copy() const {
+    std::unordered_set<Key, Hash, KeyEqual, Allocator> copy() const {
         auto guard = acquire_read_lock();
         return data_;
     }
 
-    const std::unordered_set<Key, Hash, KeyEqual>& ref() const {
+    const std::unordered_set<Key, Hash, KeyEqual, Allocator>& ref() const {
         return data_;
     }
 
+    /**
+     * @brief 获取底层容器的分配器
+     */
+    allocator_type get_allocator() const noexcept {
+        return data_.get_allocator();
+    }
+
     // ==================== 迭代和查询 ====================
 
     template <typename Func>
@@ -212,11 +332,11 @@ public:
 
     // ==================== 线程不安全接口 ====================
 
-    std::unordered_set<Key, Hash, KeyEqual>& unsafe_ref() {
+    std::unordered_set<Key, Hash, KeyEqual, Allocator>& unsafe_ref() {
         return data_;
     }
 
-    const std::unordered_set<Key, Hash, KeyEqual>& unsafe_ref() const {
+    const std::unordered_set<Key, Hash, KeyEqual, Allocator>& unsafe_ref() const {
         return data_;
     }
 
@@ -269,19 +389,25 @@ public:
 
 // ==================== Unordered Set 的 LockFree 特化版本 ====================
 
-template <typename Key, typename Hash, typename KeyEqual>
-class unordered_set<Key, Hash, KeyEqual, LockPolicy::LockFree> {
+template <typename Key, typename Hash, typename KeyEqual, typename Allocator>
+class unordered_set<Key, Hash, KeyEqual, LockPolicy::LockFree, Allocator> {
 private:
-    std::unordered_set<Key, Hash, KeyEqual> data_;
+    std::unordered_set<Key, Hash, KeyEqual, Allocator> data_;
 
 public:
     using value_type = Key;
-    using size_type = typename std::unordered_set<Key, Hash, KeyEqual>::size_type;
-    using iterator = typename std::unordered_set<Key, Hash, KeyEqual>::iterator;
-    using const_iterator = typename std::unordered_set<Key, Hash, KeyEqual>::const_iterator;
+    using allocator_type = Allocator;
+    using size_type = typename std::unordered_set<Key, Hash, KeyEqual, Allocator>::size_type;
+    using iterator = typename std::unordered_set<Key, Hash, KeyEqual, Allocator>::iterator;
+    using const_iterator = typename std::unordered_set<Key, Hash, KeyEqual, Allocator>::const_iterator;
+    using node_type = typename std::unordered_set<Key, Hash, KeyEqual, Allocator>::node_type;
 
     unordered_set() = default;
 
+    explicit unordered_set(const Allocator& alloc) : data_(alloc) {}
+
+    unordered_set(size_type bucket_count, const Allocator& alloc) : data_(bucket_count, alloc) {}
+
     explicit unordered_set(size_type bucket_count) : data_(bucket_count) {}
 
     unordered_set(size_type bucket_count, const Hash& hash) : data_(bucket_count, hash) {}
@@ -341,6 +467,18 @@ public:
         return data_.count(key);
     }
 
+#if defined(__cpp_lib_generic_unordered_lookup)
+    template <typename K, typename H = Hash, typename E = KeyEqual, detail::enable_if_transparent_t<H, E> = 0>
+    bool contains(const K& key) const {
+        return data_.find(key) != data_.end();
+    }
+
+    template <typename K, typename H = Hash, typename E = KeyEqual, detail::enable_if_transparent_t<H, E> = 0>
+    size_type count(const K& key) const {
+        return data_.count(key);
+    }
+#endif
+
     std::pair<iterator, bool> insert(const Key& key) {
         return data_.insert(key);
     }
@@ -358,21 +496,96 @@ public:
         return data_.erase(key);
     }
 
-    operator std::unordered_set<Key, Hash, KeyEqual>&() noexcept {
+    node_type extract(const Key& key) {
+        return data_.extract(key);
+    }
+
+    bool insert_node(node_type& node) {
+        return detail::insert_node_handle(data_, node);
+    }
+
+    bool insert_node(node_type&& node) {
+        return insert_node(node);
+    }
+
+    /**
+     * @brief 批量插入键（按批量大小预先 reserve），已存在的键保持不变
+     * @return 新插入的元素个数
+     */
+    template <typename InputIt>
+    size_type insert_bulk(InputIt first, InputIt last) {
+        data_.reserve(data_.size() + detail::bulk_size_hint(first, last));
+        size_type inserted = 0;
+        for (; first != last; ++first) {
+            if (data_.insert(*first).second) {
+                ++inserted;
+            }
+        }
+        return inserted;
+    }
+
+    template <typename Range>
+    size_type insert_bulk(const Range& range) {
+        return insert_bulk(std::begin(range), std::end(range));
+    }
+
+    /**
+     * @brief 批量删除键
+     * @return 实际删除的元素个数
+     */
+    template <typename InputIt>
+    size_type erase_bulk(InputIt first, InputIt last) {
+        size_type erased = 0;
+        for (; first != last; ++first) {
+            erased += data_.erase(*first);
+        }
+        return erased;
+    }
+
+    template <typename KeyRange>
+    size_type erase_bulk(const KeyRange& keys) {
+        return erase_bulk(std::begin(keys), std::end(keys));
+    }
+
+    template <typename Hash2, typename KeyEqual2, LockPolicy SourcePolicy>
+    size_type merge_from(unordered_set<Key, Hash2, KeyEqual2, SourcePolicy, Allocator>& source) {
+        if (static_cast<const void*>(&source) == static_cast<const void*>(this)) {
+            return 0;
+        }
+        return detail::with_both_locked(*this, source, [&] {
+            return static_cast<size_type>(detail::merge_nodes(data_, detail::raw_container(source)));
+        });
+    }
+
+    std::unordered_set<Key, Hash, KeyEqual, Allocator> drain() {
+        std::unordered_set<Key, Hash, KeyEqual, Allocator> out;
+        detail::swap_contents(data_, out);
+        return out;
+    }
+
+    void swap_out(std::unordered_set<Key, Hash, KeyEqual, Allocator>& other) {
+        detail::swap_contents(data_, other);
+    }
+
+    operator std::unordered_set<Key, Hash, KeyEqual, Allocator>&() noexcept {
         return data_;
     }
 
-    operator const std::unordered_set<Key, Hash, KeyEqual>&() const noexcept {
+    operator const std::unordered_set<Key, Hash, KeyEqual, Allocator>&() const noexcept {
         return data_;
     }
 
-    std::unordered_set<Key, Hash, KeyEqual>& get_unsafe() noexcept {
+    std::unordered_set<Key, Hash, KeyEqual, Allocator>& get_unsafe() noexcept {
         return data_;
     }
 
-    const std::unordered_set<Key, Hash, KeyEqual>& get_unsafe() const noexcept {
+    const std::unordered_set<Key, Hash, KeyEqual, Allocator>& get_unsafe() const noexcept {
         return data_;
     }
+
+    allocator_type get_allocator() const noexcept {
+        return data_.get_allocator();
+    }
 };
 
 } // namespace ts_stl
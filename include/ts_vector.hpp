@@ -6,11 +6,47 @@
 #include <vector>
 #include <stdexcept>
 #include <algorithm>
+#include <optional>
 
 #include "ts_stl_base.hpp"
+#include "ts_simd.hpp"
 
 namespace ts_stl {
 
+namespace detail {
+
+// 算术元素类型走 ts_simd.hpp 的向量化内核，其它类型使用标准算法
+
+template <typename T>
+typename std::vector<T>::const_iterator vector_find(const std::vector<T>& data, const T& value) {
+    if constexpr (simd::is_accelerated_v<T>) {
+        const T* base = data.data();
+        return data.begin() + (simd::find(base, base + data.size(), value) - base);
+    } else {
+        return std::find(data.begin(), data.end(), value);
+    }
+}
+
+template <typename T>
+typename std::vector<T>::size_type vector_count(const std::vector<T>& data, const T& value) {
+    if constexpr (simd::is_accelerated_v<T>) {
+        return simd::count(data.data(), data.data() + data.size(), value);
+    } else {
+        return static_cast<typename std::vector<T>::size_type>(std::count(data.begin(), data.end(), value));
+    }
+}
+
+template <typename T>
+bool vector_equal(const std::vector<T>& a, const std::vector<T>& b) {
+    if constexpr (simd::is_accelerated_v<T>) {
+        return a.size() == b.size() && simd::equal(a.data(), b.data(), a.size());
+    } else {
+        return a == b;
+    }
+}
+
+} // namespace detail
+
 /**
  * @brief 线程安全的Vector代理类
  * @tparam T 元素类型
@@ -306,6 +342,43 @@ public:
         return data_.erase(first, last);
     }
 
+    // ==================== 批量操作（单次加锁） ====================
+
+    /**
+     * @brief 批量追加区间内的元素到末尾（只加锁一次）
+     */
+    template <typename InputIt>
+    void push_back_range(InputIt first, InputIt last) {
+        auto guard = acquire_write_lock();
+        data_.insert(data_.end(), first, last);
+    }
+
+    template <typename Range>
+    void push_back_range(const Range& range) {
+        push_back_range(std::begin(range), std::end(range));
+    }
+
+    /**
+     * @brief 批量按下标读取，越界的下标输出 default_value（只加锁一次）
+     * @return 有效下标的个数
+     */
+    template <typename IndexRange, typename OutputIt>
+    size_type get_many(const IndexRange& indices, OutputIt out, const T& default_value = T()) const {
+        auto guard = acquire_read_lock();
+        size_type found = 0;
+        for (const auto& index : indices) {
+            auto pos = static_cast<size_type>(index);
+            if (pos < data_.size()) {
+                *out = data_[pos];
+                ++found;
+            } else {
+                *out = default_value;
+            }
+            ++out;
+        }
+        return found;
+    }
+
     // ==================== STL兼容性 ====================
 
     /**
@@ -377,14 +450,52 @@ public:
      */
     bool contains(const T& value) const {
         auto guard = acquire_read_lock();
-        return std::find(data_.begin(), data_.end(), value) != data_.end();
+        return detail::vector_find(data_, value) != data_.end();
+    }
+
+    /**
+     * @brief 统计等于 value 的元素个数（算术类型使用 SIMD 内核，缩短读锁持有时间）
+     */
+    size_type count(const T& value) const {
+        auto guard = acquire_read_lock();
+        return detail::vector_count(data_, value);
+    }
+
+    /**
+     * @brief 最小值 / 最大值，容器为空时返回 std::nullopt（仅算术类型）
+     */
+    template <typename U = T, std::enable_if_t<detail::simd_element_v<U>, int> = 0>
+    std::optional<T> min_value() const {
+        auto guard = acquire_read_lock();
+        if (data_.empty()) {
+            return std::nullopt;
+        }
+        return *simd::min_element(data_.data(), data_.data() + data_.size());
+    }
+
+    template <typename U = T, std::enable_if_t<detail::simd_element_v<U>, int> = 0>
+    std::optional<T> max_value() const {
+        auto guard = acquire_read_lock();
+        if (data_.empty()) {
+            return std::nullopt;
+        }
+        return *simd::max_element(data_.data(), data_.data() + data_.size());
+    }
+
+    /**
+     * @brief 元素之和，整数累加到 64 位，浮点累加到 double（仅算术类型）
+     */
+    template <typename U = T, std::enable_if_t<detail::simd_element_v<U>, int> = 0>
+    simd::sum_result_t<T> sum() const {
+        auto guard = acquire_read_lock();
+        return simd::sum(data_.data(), data_.data() + data_.size());
     }
 
     // ==================== 比较操作 ====================
 
     bool operator==(const vector& other) const {
         auto guard = acquire_read_lock();
-        return data_ == other.data_;
+        return detail::vector_equal(data_, other.data_);
     }
 
     bool operator!=(const vector& other) const {
@@ -674,6 +785,16 @@ public:
         data_.clear();
     }
 
+    std::vector<T> drain() noexcept {
+        std::vector<T> out;
+        data_.swap(out);
+        return out;
+    }
+
+    void swap_out(std::vector<T>& other) noexcept {
+        data_.swap(other);
+    }
+
     // ==================== 修改操作（零开销） ====================
 
     void push_back(const_reference value) {
@@ -709,18 +830,74 @@ public:
         return data_.erase(first, last);
     }
 
+    // ==================== 批量操作（零开销） ====================
+
+    /**
+     * @brief 批量追加区间内的元素到末尾
+     */
+    template <typename InputIt>
+    void push_back_range(InputIt first, InputIt last) {
+        data_.insert(data_.end(), first, last);
+    }
+
+    template <typename Range>
+    void push_back_range(const Range& range) {
+        push_back_range(std::begin(range), std::end(range));
+    }
+
+    /**
+     * @brief 批量按下标读取，越界的下标输出 default_value
+     * @return 有效下标的个数
+     */
+    template <typename IndexRange, typename OutputIt>
+    size_type get_many(const IndexRange& indices, OutputIt out, const T& default_value = T()) const {
+        size_type found = 0;
+        for (const auto& index : indices) {
+            auto pos = static_cast<size_type>(index);
+            if (pos < data_.size()) {
+                *out = data_[pos];
+                ++found;
+            } else {
+                *out = default_value;
+            }
+            ++out;
+        }
+        return found;
+    }
+
     // ==================== 查询操作（零开销） ====================
 
     iterator find(const_reference value) {
-        return std::find(data_.begin(), data_.end(), value);
+        return data_.begin() + (detail::vector_find(data_, value) - data_.cbegin());
     }
 
     const_iterator find(const_reference value) const {
-        return std::find(data_.cbegin(), data_.cend(), value);
+        return detail::vector_find(data_, value);
     }
 
     size_type count(const_reference value) const {
-        return std::count(data_.cbegin(), data_.cend(), value);
+        return detail::vector_count(data_, value);
+    }
+
+    template <typename U = T, std::enable_if_t<detail::simd_element_v<U>, int> = 0>
+    std::optional<T> min_value() const {
+        if (data_.empty()) {
+            return std::nullopt;
+        }
+        return *simd::min_element(data_.data(), data_.data() + data_.size());
+    }
+
+    template <typename U = T, std::enable_if_t<detail::simd_element_v<U>, int> = 0>
+    std::optional<T> max_value() const {
+        if (data_.empty()) {
+            return std::nullopt;
+        }
+        return *simd::max_element(data_.data(), data_.data() + data_.size());
+    }
+
+    template <typename U = T, std::enable_if_t<detail::simd_element_v<U>, int> = 0>
+    simd::sum_result_t<T> sum() const {
+        return simd::sum(data_.data(), data_.data() + data_.size());
     }
 
     // ==================== 迭代器（零开销） ====================
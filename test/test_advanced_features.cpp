@@ -2,7 +2,15 @@
 #include <iostream>
 #include <thread>
 #include <vector>
+#include <algorithm>
+#include <atomic>
 #include <cassert>
+#include <cstdint>
+#include <mutex>
+#include <shared_mutex>
+#include <system_error>
+#include <type_traits>
+#include <utility>
 
 using namespace ts_stl;
 
@@ -198,6 +206,606 @@ void test_performance_comparison() {
     assert(vec.unsafe_size() == 200);
 }
 
+// ==================== 测试: 编译期锁存储 ====================
+void test_inline_lock_storage() {
+    std::cout << "\n=== Test: Inline Lock Storage ===" << std::endl;
+
+    // 锁对象内嵌在容器中，没有额外的堆分配和虚表指针
+#if !TS_STL_CACHE_ALIGNED_LOCKS && !TS_STL_ENABLE_LOCK_STATS
+    static_assert(sizeof(LockGuard<LockPolicy::SpinLock>) == sizeof(SpinLock),
+                  "SpinLock policy should store exactly one SpinLock");
+    static_assert(sizeof(LockGuard<LockPolicy::Mutex>) == sizeof(std::mutex),
+                  "Mutex policy should store exactly one std::mutex");
+    static_assert(sizeof(vectorSpinLock<int>) <= sizeof(std::vector<int>) + alignof(std::vector<int>),
+                  "vectorSpinLock should only add padded lock state");
+#elif TS_STL_CACHE_ALIGNED_LOCKS && !TS_STL_ENABLE_LOCK_STATS
+    static_assert(alignof(LockGuard<LockPolicy::SpinLock>) == cache_line_size,
+                  "Aligned layout should give the lock its own cache line");
+    static_assert(sizeof(vectorSpinLock<int>) == 2 * cache_line_size,
+                  "Aligned layout should keep vector metadata off the lock's cache line");
+#endif
+
+    // 守卫类型在编译期确定
+#if !TS_STL_ENABLE_LOCK_STATS
+    static_assert(std::is_same_v<LockGuard<LockPolicy::SpinLock>::write_guard, SpinLockGuard>,
+                  "SpinLock policy should use SpinLockGuard");
+#endif
+#if TS_STL_SUPPORT_RW_LOCK && !TS_STL_ENABLE_LOCK_STATS
+    static_assert(std::is_same_v<LockGuard<LockPolicy::ReadWrite>::read_guard,
+                                 std::shared_lock<std::shared_mutex>>,
+                  "ReadWrite policy should use shared_lock for reads");
+#endif
+    std::cout << "✓ Lock state is embedded inline" << std::endl;
+
+    // 守卫可以转移所有权
+    vectorSpinLock<int> vec;
+    {
+        auto guard = vec.acquire_write_guard();
+        auto moved = std::move(guard);
+        assert(moved.owns_lock());
+        assert(!guard.owns_lock());
+        vec.unsafe_push_back(1);
+    }
+    vec.push_back(2);
+    assert(vec.size() == 2);
+
+    // 被移走的守卫与 std::unique_lock 一样报告错误，而不是解引用空指针
+    SpinLock spin;
+    SpinLockGuard owner(spin);
+    SpinLockGuard taken = std::move(owner);
+    int errors = 0;
+    try {
+        owner.lock();
+    } catch (const std::system_error&) {
+        ++errors;
+    }
+    try {
+        owner.unlock();
+    } catch (const std::system_error&) {
+        ++errors;
+    }
+    try {
+        taken.lock();
+    } catch (const std::system_error&) {
+        ++errors;
+    }
+    assert(errors == 3 && taken.owns_lock());
+    taken.unlock();
+    assert(spin.try_lock());
+    spin.unlock();
+    std::cout << "✓ Guards are movable and release exactly once" << std::endl;
+}
+
+// ==================== 测试: 自适应锁与排号锁 ====================
+template <typename Lock>
+void check_exclusive_lock(const char* name) {
+    Lock lock;
+    assert(lock.try_lock());
+    assert(!lock.try_lock());
+    lock.unlock();
+
+    // 线程数超过核数，验证超额订阅下的互斥与唤醒
+    const unsigned hw = std::max(1u, std::thread::hardware_concurrency());
+    const int threads = static_cast<int>(hw * 2 + 2);
+    const int iterations = 2000;
+    long counter = 0;
+    std::vector<std::thread> workers;
+    for (int t = 0; t < threads; ++t) {
+        workers.emplace_back([&lock, &counter, iterations]() {
+            for (int i = 0; i < iterations; ++i) {
+                std::lock_guard<Lock> guard(lock);
+                ++counter;
+            }
+        });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    assert(counter == static_cast<long>(threads) * iterations);
+    assert(lock.try_lock());
+    lock.unlock();
+    std::cout << "✓ " << name << " is exclusive under oversubscription" << std::endl;
+}
+
+void test_adaptive_and_ticket_locks() {
+    std::cout << "\n=== Test: Adaptive and Ticket Locks ===" << std::endl;
+
+    check_exclusive_lock<SpinLock>("SpinLock");
+    check_exclusive_lock<AdaptiveMutex>("AdaptiveMutex");
+    check_exclusive_lock<TicketLock>("TicketLock");
+
+    static_assert(std::is_same_v<LockGuard<LockPolicy::Adaptive>::mutex_type, AdaptiveMutex>,
+                  "Adaptive policy should store an AdaptiveMutex");
+    static_assert(std::is_same_v<lock_traits<LockPolicy::Ticket>::write_guard,
+                                 std::unique_lock<TicketLock>>,
+                  "Ticket policy should use unique_lock<TicketLock>");
+
+    // 容器与阻塞队列可直接使用新策略
+    vectorAdaptive<int> vec;
+    vectorTicket<int> fair;
+    std::vector<std::thread> workers;
+    for (int t = 0; t < 4; ++t) {
+        workers.emplace_back([&vec, &fair, t]() {
+            for (int i = 0; i < 500; ++i) {
+                vec.push_back(t * 500 + i);
+                fair.push_back(i);
+            }
+        });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    assert(vec.size() == 2000);
+    assert(fair.size() == 2000);
+
+    blocking_queueAdaptive<int> queue(4);
+    std::thread producer([&queue]() {
+        for (int i = 0; i < 100; ++i) {
+            queue.push_back(i);
+        }
+        queue.close();
+    });
+    int received = 0;
+    int value = 0;
+    while (queue.wait_pop_front(value)) {
+        assert(value == received);
+        ++received;
+    }
+    producer.join();
+    assert(received == 100);
+
+    concurrent_list<int, LockPolicy::Adaptive> list;
+    list.push_back(1);
+    list.push_front(0);
+    assert(list.size() == 2);
+
+    // 每个 Adaptive 别名都有对应的 Ticket 别名
+    mapTicket<int, int> fair_map;
+    unordered_mapTicket<int, int> fair_hash;
+    sharded_unordered_mapTicket<int, int> fair_sharded;
+    flat_unordered_mapTicket<int, int> fair_flat;
+    incremental_unordered_mapTicket<int, int> fair_incremental;
+    fair_map.insert(1, 1);
+    fair_hash.insert(1, 1);
+    fair_sharded.insert(1, 1);
+    fair_flat.insert(1, 1);
+    fair_incremental.insert(1, 1);
+    assert(fair_map.size() + fair_hash.size() + fair_sharded.size() + fair_flat.size() + fair_incremental.size() == 5);
+    setTicket<int> fair_set;
+    unordered_setTicket<int> fair_uset;
+    flat_setTicket<int> fair_flat_set;
+    flat_mapTicket<int, int> fair_flat_map;
+    listTicket<int> fair_list;
+    dequeTicket<int> fair_deque;
+    fair_set.insert(1);
+    fair_uset.insert(1);
+    fair_flat_set.insert(1);
+    fair_flat_map.insert(1, 1);
+    fair_list.push_back(1);
+    fair_deque.push_back(1);
+    assert(fair_set.size() + fair_uset.size() + fair_flat_set.size() + fair_flat_map.size() + fair_list.size() +
+               fair_deque.size() == 6);
+    blocking_queueTicket<int> fair_queue(2);
+    fair_queue.push_back(7);
+    assert(fair_queue.wait_pop_front(value) && value == 7);
+    priority_queueTicket<int> fair_heap;
+    multi_priority_queueTicket<int> fair_multi;
+    fair_heap.push(3);
+    fair_multi.push(4);
+    assert(fair_heap.try_pop(value) && value == 3);
+    assert(fair_multi.try_pop(value) && value == 4);
+    std::cout << "✓ Containers work with Adaptive and Ticket policies" << std::endl;
+}
+
+// ==================== 测试: 缓存行对齐与伪共享防护 ====================
+void test_cache_aligned_layout() {
+    std::cout << "\n=== Test: Cache-Aligned Layout ===" << std::endl;
+
+    static_assert(alignof(cache_aligned<vectorSpinLock<int>>) == cache_line_size,
+                  "cache_aligned should align to a cache line");
+    static_assert(sizeof(cache_aligned<char>) == cache_line_size,
+                  "cache_aligned should pad to a full cache line");
+    static_assert(sizeof(LockGuard<LockPolicy::LockFree>) == 1,
+                  "LockFree policy should never be padded");
+
+    cache_aligned<vectorMutex<int>> single(std::in_place, 3, 7);
+    assert(single->size() == 3);
+    assert((*single).front() == 7);
+
+    // 相邻容器位于不同缓存行
+    array_of<vectorSpinLock<int>, 4> bins;
+    for (std::size_t i = 0; i + 1 < bins.size(); ++i) {
+        auto a = reinterpret_cast<std::uintptr_t>(&bins[i]);
+        auto b = reinterpret_cast<std::uintptr_t>(&bins[i + 1]);
+        assert(a % cache_line_size == 0);
+        assert(b - a >= cache_line_size);
+    }
+    bool threw = false;
+    try {
+        bins.at(4);
+    } catch (const std::out_of_range&) {
+        threw = true;
+    }
+    assert(threw);
+
+    // 每个线程写自己的分箱
+    std::vector<std::thread> workers;
+    for (int t = 0; t < 8; ++t) {
+        workers.emplace_back([&bins, t]() {
+            auto& bin = bins.local();
+            for (int i = 0; i < 1000; ++i) {
+                bin.push_back(t);
+            }
+        });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    assert(bins.total_size() == 8000);
+    std::size_t visited = 0;
+    bins.for_each([&visited](const vectorSpinLock<int>& bin) { visited += bin.size(); });
+    assert(visited == 8000);
+    std::cout << "✓ array_of pads each container to its own cache line" << std::endl;
+}
+
+// ==================== 测试: 锁竞争统计 ====================
+void test_lock_statistics() {
+    std::cout << "\n=== Test: Lock Statistics ===" << std::endl;
+
+    vectorMutex<int> vec;
+    vec.register_lock_stats("test.vec");
+    for (int i = 0; i < 100; ++i) {
+        vec.push_back(i);
+    }
+    vec.reset_lock_stats();
+
+    std::vector<std::thread> workers;
+    for (int t = 0; t < 4; ++t) {
+        workers.emplace_back([&vec]() {
+            for (int i = 0; i < 250; ++i) {
+                vec.push_back(i);
+            }
+        });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    vec.size();
+    lock_stats_snapshot stats = vec.lock_statistics();
+
+    // 统计守卫与 std::unique_lock 一样拒绝重复加锁和未持有时解锁
+    {
+        std::mutex m;
+        lock_stats guard_stats;
+        detail::instrumented_guard<std::mutex, false> owner(m, guard_stats);
+        int errors = 0;
+        try {
+            owner.lock();
+        } catch (const std::system_error&) {
+            ++errors;
+        }
+        auto taken = std::move(owner);
+        try {
+            owner.unlock();
+        } catch (const std::system_error&) {
+            ++errors;
+        }
+        try {
+            owner.lock();
+        } catch (const std::system_error&) {
+            ++errors;
+        }
+        taken.unlock();
+        try {
+            taken.unlock();
+        } catch (const std::system_error&) {
+            ++errors;
+        }
+        assert(errors == 4 && !taken.owns_lock());
+        assert(m.try_lock());
+        m.unlock();
+        assert(guard_stats.snapshot().acquisitions == 1);
+    }
+
+#if TS_STL_ENABLE_LOCK_STATS
+    assert(stats.acquisitions == 1001);
+    assert(stats.shared_acquisitions == 0);
+    assert(stats.contended <= stats.acquisitions);
+    std::uint64_t held = 0;
+    for (std::uint64_t count : stats.hold_histogram) {
+        held += count;
+    }
+    assert(held == 1001);
+    assert(stats.hold_percentile_ns(1.0) >= stats.hold_percentile_ns(0.5));
+
+#if TS_STL_SUPPORT_RW_LOCK
+    // 读写锁区分读/写加锁次数
+    {
+        vectorRW<int> rw(10, 1);
+        rw.register_lock_stats("test.rw");
+        rw.reset_lock_stats();
+        for (int i = 0; i < 9; ++i) {
+            rw.size();
+        }
+        rw.push_back(2);
+        auto rw_stats = rw.lock_statistics();
+        assert(rw_stats.shared_acquisitions == 9);
+        assert(rw_stats.acquisitions == 1);
+        assert(rw_stats.read_ratio() > 0.89 && rw_stats.read_ratio() < 0.91);
+
+        auto all = lock_stats_registry::instance().snapshot();
+        assert(all.size() >= 2);
+        assert(std::is_sorted(all.begin(), all.end(),
+                              [](const auto& a, const auto& b) { return a.name < b.name; }));
+        lock_stats_registry::instance().dump(std::cout);
+    }
+    // 容器析构后自动注销
+    for (const auto& entry : lock_stats_registry::instance().snapshot()) {
+        assert(entry.name != "test.rw");
+    }
+#endif
+
+    // 阻塞队列在开启统计后改用 condition_variable_any
+    blocking_queueMutex<int> queue;
+    queue.register_lock_stats("test.queue");
+    std::thread consumer([&queue]() {
+        int value = 0;
+        while (queue.wait_pop_front(value)) {
+        }
+    });
+    for (int i = 0; i < 100; ++i) {
+        queue.push_back(i);
+    }
+    queue.close();
+    consumer.join();
+    assert(queue.lock_statistics().acquisitions >= 101);
+    std::cout << "✓ Lock statistics record acquisitions, waits and holds" << std::endl;
+#else
+    assert(stats.total_acquisitions() == 0);
+    assert(LockGuard<LockPolicy::Mutex>{}.stats() == nullptr);
+    std::cout << "✓ Lock statistics compile to no-ops when disabled" << std::endl;
+#endif
+}
+
+// ==================== 测试: 协程锁（C++20） ====================
+#if TS_STL_SUPPORT_COROUTINES
+// 立即开始执行、结束时自行销毁的协程
+struct detached_task {
+    struct promise_type {
+        detached_task get_return_object() noexcept { return {}; }
+        std::suspend_never initial_suspend() noexcept { return {}; }
+        std::suspend_never final_suspend() noexcept { return {}; }
+        void return_void() noexcept {}
+        void unhandled_exception() { std::terminate(); }
+    };
+};
+
+// 手动触发的事件：co_await 时挂起，set() 时在当前线程恢复
+struct manual_event {
+    std::coroutine_handle<> waiter;
+
+    bool await_ready() const noexcept { return false; }
+    void await_suspend(std::coroutine_handle<> handle) noexcept { waiter = handle; }
+    void await_resume() const noexcept {}
+
+    void set() { std::exchange(waiter, nullptr).resume(); }
+};
+
+detached_task hold_write_lock(vectorAsync<int>& vec, manual_event& release, std::vector<int>& trace) {
+    auto guard = co_await vec.async_write_lock();
+    trace.push_back(1);
+    co_await release;
+    vec.unsafe_ref().push_back(1);
+    trace.push_back(2);
+}
+
+detached_task append_async(vectorAsync<int>& vec, int value, std::vector<int>& trace) {
+    auto guard = co_await vec.async_write_lock();
+    vec.unsafe_ref().push_back(value);
+    trace.push_back(value);
+}
+
+detached_task hold_read_lock(const vectorAsync<int>& vec, int& inside, manual_event& release) {
+    auto guard = co_await vec.async_read_lock();
+    ++inside;
+    co_await release;
+    --inside;
+}
+
+detached_task increment_async(unordered_mapAsync<int, long>& counts, int key) {
+    auto guard = co_await counts.async_write_lock();
+    ++counts.unsafe_ref()[key];
+}
+
+void test_async_locks() {
+    std::cout << "\n=== Test: Coroutine Locks ===" << std::endl;
+
+    static_assert(std::is_same_v<lock_traits<LockPolicy::Async>::read_guard,
+                                 std::shared_lock<async_shared_mutex>>,
+                  "Async policy should use shared_lock<async_shared_mutex> for reads");
+
+    // 单线程：持锁协程挂起期间，后来的协程排队挂起而不是阻塞线程
+    vectorAsync<int> vec;
+    manual_event release;
+    std::vector<int> trace;
+    hold_write_lock(vec, release, trace);
+    append_async(vec, 10, trace);
+    append_async(vec, 20, trace);
+    assert(trace == std::vector<int>{1});
+    release.set();
+    assert((trace == std::vector<int>{1, 2, 10, 20}));
+    assert(vec.size() == 3 && vec[0] == 1);
+
+    // 读锁共享；排队的写者之后到来的读者排在写者之后
+    manual_event first_reader;
+    manual_event second_reader;
+    manual_event late_reader;
+    int inside = 0;
+    int late_inside = 0;
+    hold_read_lock(vec, inside, first_reader);
+    hold_read_lock(vec, inside, second_reader);
+    assert(inside == 2);
+    append_async(vec, 30, trace);
+    hold_read_lock(vec, late_inside, late_reader);
+    assert(trace.back() == 20 && late_inside == 0);
+    first_reader.set();
+    assert(trace.back() == 20);
+    second_reader.set();
+    assert(trace.back() == 30 && late_inside == 1);
+    late_reader.set();
+    assert(inside == 0 && late_inside == 0);
+
+    // 多线程：协程获取与同步接口混用
+    unordered_mapAsync<int, long> counts;
+    std::vector<std::thread> workers;
+    for (int t = 0; t < 4; ++t) {
+        workers.emplace_back([&counts, t]() {
+            for (int i = 0; i < 2000; ++i) {
+                if (t % 2 == 0) {
+                    increment_async(counts, i % 16);
+                } else {
+                    counts.merge(i % 16, 1L, [](long& e, const long& v) { e += v; });
+                }
+            }
+        });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    long total = 0;
+    counts.for_each([&total](const int&, const long& v) { total += v; });
+    assert(total == 8000 && counts.size() == 16);
+    std::cout << "✓ co_await async_write_lock / async_read_lock suspend instead of blocking" << std::endl;
+}
+#endif
+
+#if TS_STL_SUPPORT_RW_LOCK
+// ==================== 测试: 读偏向锁与可升级读锁 ====================
+template <typename Func>
+bool from_other_thread(Func func) {
+    bool result = false;
+    std::thread([&result, &func]() { result = func(); }).join();
+    return result;
+}
+
+void test_reader_biased_locks() {
+    std::cout << "\n=== Test: Reader-Biased Locks ===" << std::endl;
+
+    check_exclusive_lock<ReaderBiasedMutex>("ReaderBiasedMutex");
+    static_assert(std::is_same_v<lock_traits<LockPolicy::ReaderBiased>::read_guard,
+                                 std::shared_lock<ReaderBiasedMutex>>,
+                  "ReaderBiased policy should use shared_lock for reads");
+
+    ReaderBiasedMutex lock;
+    assert(lock.reader_biased());
+    {
+        // 多个读者可同时持有；读者存在时写者拿不到锁
+        std::shared_lock<ReaderBiasedMutex> reader(lock);
+        assert(from_other_thread([&lock]() {
+            std::shared_lock<ReaderBiasedMutex> other(lock, std::try_to_lock);
+            return other.owns_lock();
+        }));
+        assert(from_other_thread([&lock]() { return !lock.try_lock(); }));
+        assert(lock.reader_biased());
+    }
+    {
+        // 写者撤销偏向；持有写锁时读者被挡住
+        std::unique_lock<ReaderBiasedMutex> writer(lock);
+        assert(!lock.reader_biased());
+        assert(from_other_thread([&lock]() { return !lock.try_lock_shared(); }));
+    }
+
+    // 可升级读锁：不阻塞读者，排斥写者与其它升级者；升级后排斥读者，降级后放行
+    {
+        upgrade_guard<ReaderBiasedMutex> upgradable(lock);
+        assert(from_other_thread([&lock]() {
+            std::shared_lock<ReaderBiasedMutex> other(lock, std::try_to_lock);
+            return other.owns_lock();
+        }));
+        assert(from_other_thread([&lock]() { return !lock.try_lock() && !lock.try_lock_upgrade(); }));
+        upgradable.upgrade();
+        assert(upgradable.exclusive());
+        assert(from_other_thread([&lock]() { return !lock.try_lock_shared(); }));
+        upgradable.downgrade();
+        assert(from_other_thread([&lock]() {
+            std::shared_lock<ReaderBiasedMutex> other(lock, std::try_to_lock);
+            return other.owns_lock();
+        }));
+        upgradable.upgrade();
+    }
+    assert(lock.try_lock());
+    lock.unlock();
+
+    // 并发读写：读者永远看到一致的一对值
+    vectorReaderBiased<long> pair(2, 0);
+    std::atomic<bool> stop{false};
+    std::atomic<long> torn{0};
+    std::vector<std::thread> readers;
+    for (int t = 0; t < 6; ++t) {
+        readers.emplace_back([&]() {
+            while (!stop.load(std::memory_order_relaxed)) {
+                pair.with_read_lock([&torn](const auto& v) {
+                    if (v.unsafe_ref()[0] != v.unsafe_ref()[1]) {
+                        ++torn;
+                    }
+                });
+            }
+        });
+    }
+    for (long i = 1; i <= 2000; ++i) {
+        pair.with_write_lock([i](auto& v) {
+            v.unsafe_ref()[0] = i;
+            v.unsafe_ref()[1] = i;
+        });
+    }
+    stop = true;
+    for (auto& reader : readers) {
+        reader.join();
+    }
+    assert(torn == 0);
+    assert(pair.get(0) == 2000 && pair.get(1) == 2000);
+    std::cout << "✓ ReaderBiasedMutex shares reads, revokes bias for writers and supports upgrades" << std::endl;
+
+    // get_or_insert / compute_if_absent：每个键的 factory 只被调用一次
+    unordered_mapReaderBiased<int, int> cache;
+    std::atomic<int> factory_calls{0};
+    std::vector<std::thread> workers;
+    for (int t = 0; t < 8; ++t) {
+        workers.emplace_back([&cache, &factory_calls, t]() {
+            for (int i = 0; i < 1000; ++i) {
+                const int key = (i * 7 + t) % 100;
+                const int value = cache.get_or_insert(key, [&factory_calls, key]() {
+                    ++factory_calls;
+                    return key * 10;
+                });
+                assert(value == key * 10);
+            }
+        });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    assert(factory_calls == 100 && cache.size() == 100);
+    assert(!cache.compute_if_absent(5, []() { return -1; }));
+    assert(cache.compute_if_absent(500, []() { return 5000; }));
+    assert(cache.get(500) == 5000);
+    {
+        auto upgradable = cache.acquire_upgrade_guard();
+        assert(cache.unsafe_ref().count(500) == 1);
+        upgradable.upgrade();
+        cache.unsafe_ref().erase(500);
+    }
+    assert(!cache.contains(500));
+
+    unordered_mapRW<int, int> rw;
+    assert(rw.get_or_insert(1, []() { return 11; }) == 11);
+    assert(rw.get_or_insert(1, []() { return 12; }) == 11);
+    unordered_map<int, int, std::hash<int>, std::equal_to<int>, LockPolicy::LockFree> lf;
+    assert(lf.get_or_insert(2, []() { return 22; }) == 22);
+    std::cout << "✓ get_or_insert takes only a read lock on hits and upgrades on misses" << std::endl;
+}
+#endif
+
 // ==================== 主测试函数 ====================
 int main() {
     std::cout << "========================================" << std::endl;
@@ -222,6 +830,16 @@ int main() {
 
         test_complex_scenarios();
         test_performance_comparison();
+        test_inline_lock_storage();
+        test_adaptive_and_ticket_locks();
+        test_cache_aligned_layout();
+        test_lock_statistics();
+#if TS_STL_SUPPORT_RW_LOCK
+        test_reader_biased_locks();
+#endif
+#if TS_STL_SUPPORT_COROUTINES
+        test_async_locks();
+#endif
 
         std::cout << "\n========================================" << std::endl;
         std::cout << "✅ All advanced tests passed!" << std::endl;
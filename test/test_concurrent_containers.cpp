@@ -0,0 +1,680 @@
+#include <iostream>
+#include <cassert>
+#include <thread>
+#include <atomic>
+#include <string>
+#include <vector>
+#include <iterator>
+#include <stdexcept>
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <optional>
+#include <chrono>
+#include "ts_stl.hpp"
+
+using namespace ts_stl;
+
+// ==================== SPSC Ring Buffer 测试 ====================
+void test_spsc_ring_buffer_basic() {
+    std::cout << "Testing SPSC Ring Buffer..." << std::endl;
+
+    ring_bufferSPSC<int> rb(5);
+    assert(rb.capacity() == 8);
+    assert(rb.empty());
+
+    for (int i = 0; i < 8; ++i) {
+        assert(rb.try_push(i));
+    }
+    assert(!rb.try_push(100));
+    assert(rb.size() == 8);
+
+    int value = -1;
+    assert(rb.try_pop(value) && value == 0);
+    assert(rb.try_push(8));
+
+    // 批量取出
+    std::vector<int> out;
+    assert(rb.try_pop_n(std::back_inserter(out), 16) == 8);
+    for (int i = 0; i < 8; ++i) {
+        assert(out[static_cast<size_t>(i)] == i + 1);
+    }
+    assert(!rb.try_pop(value));
+
+    // 批量写入受剩余空间限制
+    std::vector<int> in{1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+    assert(rb.try_push_n(in.begin(), in.size()) == 8);
+    assert(rb.size() == 8);
+
+    std::cout << "✓ SPSC Ring Buffer tests passed" << std::endl;
+}
+
+void test_spsc_ring_buffer_concurrent() {
+    std::cout << "Testing concurrent SPSC Ring Buffer operations..." << std::endl;
+
+    constexpr int ITEMS = 200000;
+    ring_bufferSPSC<int> rb(64);
+    bool ordered = true;
+
+    std::thread consumer([&]() {
+        int expected = 0;
+        int batch[16];
+        while (expected < ITEMS) {
+            size_t n = rb.try_pop_n(batch, 16);
+            for (size_t i = 0; i < n; ++i) {
+                if (batch[i] != expected++) {
+                    ordered = false;
+                }
+            }
+            if (n == 0) {
+                std::this_thread::yield();
+            }
+        }
+    });
+
+    for (int i = 0; i < ITEMS; ++i) {
+        while (!rb.try_push(i)) {
+            std::this_thread::yield();
+        }
+    }
+    consumer.join();
+
+    assert(ordered);
+    assert(rb.empty());
+    std::cout << "✓ Concurrent SPSC Ring Buffer tests passed" << std::endl;
+}
+
+// ==================== MPMC Ring Buffer 测试 ====================
+void test_mpmc_ring_buffer_basic() {
+    std::cout << "Testing MPMC Ring Buffer..." << std::endl;
+
+    ring_bufferMPMC<std::string> rb(1);
+    assert(rb.capacity() == 2);
+    assert(rb.try_emplace(3, 'a'));
+    assert(rb.try_push("b"));
+    assert(!rb.try_push("c"));
+
+    std::string value;
+    assert(rb.try_pop(value) && value == "aaa");
+    assert(rb.try_pop(value) && value == "b");
+    assert(!rb.try_pop(value));
+
+    // 析构时销毁剩余元素
+    {
+        ring_bufferMPMC<std::string> leftover(4);
+        leftover.try_push(std::string(64, 'x'));
+        leftover.try_push(std::string(64, 'y'));
+    }
+
+    std::cout << "✓ MPMC Ring Buffer tests passed" << std::endl;
+}
+
+// 拷贝构造 / 赋值在 armed 时抛异常，移动构造不抛异常
+struct throwing_payload {
+    static inline bool armed = false;
+    int value = 0;
+
+    explicit throwing_payload(int v) : value(v) {}
+    throwing_payload(const throwing_payload& other) : value(other.value) {
+        if (armed) {
+            throw std::runtime_error("copy");
+        }
+    }
+    throwing_payload(throwing_payload&& other) noexcept : value(other.value) {}
+    throwing_payload& operator=(const throwing_payload& other) {
+        if (armed) {
+            throw std::runtime_error("copy assign");
+        }
+        value = other.value;
+        return *this;
+    }
+    throwing_payload& operator=(throwing_payload&& other) {
+        if (armed) {
+            throw std::runtime_error("move assign");
+        }
+        value = other.value;
+        return *this;
+    }
+};
+
+// 第 throw_at 次赋值时抛异常的输出迭代器
+struct throwing_output {
+    std::vector<int>* sink;
+    int throw_at;
+
+    throwing_output& operator*() { return *this; }
+    throwing_output& operator++() { return *this; }
+    throwing_output& operator++(int) { return *this; }
+    throwing_output& operator=(const throwing_payload& p) {
+        if (static_cast<int>(sink->size()) == throw_at) {
+            throw std::runtime_error("output");
+        }
+        sink->push_back(p.value);
+        return *this;
+    }
+};
+
+void test_ring_buffer_exception_safety() {
+    std::cout << "Testing Ring Buffer exception safety..." << std::endl;
+
+    // SPSC：批量取出中途抛异常时，已取出的元素不会被再次读取或重复销毁
+    {
+        ring_bufferSPSC<throwing_payload> rb(8);
+        for (int i = 0; i < 4; ++i) {
+            assert(rb.try_emplace(i));
+        }
+        std::vector<int> got;
+        bool thrown = false;
+        try {
+            rb.try_pop_n(throwing_output{&got, 2}, 4);
+        } catch (const std::runtime_error&) {
+            thrown = true;
+        }
+        assert(thrown && (got == std::vector<int>{0, 1}));
+        assert(rb.size() == 2);
+        got.clear();
+        assert(rb.try_pop_n(throwing_output{&got, -1}, 4) == 2);
+        assert((got == std::vector<int>{2, 3}));
+    }
+
+    // MPMC：构造抛异常时不占用槽位；赋值抛异常时丢弃该元素但槽位照常释放
+    {
+        ring_bufferMPMC<throwing_payload> rb(2);
+        throwing_payload source(7);
+        throwing_payload::armed = true;
+        bool thrown = false;
+        try {
+            rb.try_push(source);
+        } catch (const std::runtime_error&) {
+            thrown = true;
+        }
+        assert(thrown && rb.empty());
+        throwing_payload::armed = false;
+        assert(rb.try_push(source) && rb.try_emplace(8));
+
+        throwing_payload out(0);
+        throwing_payload::armed = true;
+        thrown = false;
+        try {
+            rb.try_pop(out);
+        } catch (const std::runtime_error&) {
+            thrown = true;
+        }
+        throwing_payload::armed = false;
+        assert(thrown && rb.size() == 1);
+        assert(rb.try_pop(out) && out.value == 8);
+        for (int round = 0; round < 4; ++round) {
+            assert(rb.try_emplace(round) && rb.try_pop(out) && out.value == round);
+        }
+        assert(!rb.try_pop(out));
+
+        std::vector<int> got;
+        assert(rb.try_emplace(1) && rb.try_emplace(2));
+        assert(rb.try_pop_n(throwing_output{&got, -1}, 4) == 2 && (got == std::vector<int>{1, 2}));
+    }
+
+    std::cout << "✓ Ring Buffer exception safety tests passed" << std::endl;
+}
+
+void test_mpmc_ring_buffer_concurrent() {
+    std::cout << "Testing concurrent MPMC Ring Buffer operations..." << std::endl;
+
+    constexpr int PRODUCERS = 4;
+    constexpr int CONSUMERS = 4;
+    constexpr int ITEMS_PER_PRODUCER = 50000;
+    constexpr int TOTAL = PRODUCERS * ITEMS_PER_PRODUCER;
+
+    ring_bufferMPMC<int> rb(128);
+    std::atomic<long long> sum{0};
+    std::atomic<int> received{0};
+
+    std::vector<std::thread> threads;
+    for (int c = 0; c < CONSUMERS; ++c) {
+        threads.emplace_back([&]() {
+            int batch[8];
+            while (received.load() < TOTAL) {
+                size_t n = rb.try_pop_n(batch, 8);
+                long long local = 0;
+                for (size_t i = 0; i < n; ++i) {
+                    local += batch[i];
+                }
+                sum += local;
+                received += static_cast<int>(n);
+                if (n == 0) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+    for (int p = 0; p < PRODUCERS; ++p) {
+        threads.emplace_back([&rb, p]() {
+            for (int i = 0; i < ITEMS_PER_PRODUCER; ++i) {
+                while (!rb.try_push(p * ITEMS_PER_PRODUCER + i)) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+    for (auto& t : threads) {
+        t.join();
+    }
+
+    assert(received == TOTAL);
+    assert(sum == static_cast<long long>(TOTAL - 1) * TOTAL / 2);
+    assert(rb.empty());
+    std::cout << "✓ Concurrent MPMC Ring Buffer tests passed" << std::endl;
+}
+
+// ==================== SeqLock 测试 ====================
+struct Quote {
+    long long bid;
+    long long ask;
+    long long version;
+};
+
+void test_seqlock_basic() {
+    std::cout << "Testing SeqLock..." << std::endl;
+
+    seqlock<Quote> q(Quote{1, 2, 0});
+    assert(q.load().bid == 1 && q.load().ask == 2);
+    assert(q.version() == 0);
+
+    q.store(Quote{3, 4, 1});
+    q.update([](Quote& v) { v.ask += 10; });
+    Quote current = q;
+    assert(current.bid == 3 && current.ask == 14);
+    assert(q.version() == 2);
+
+    seqlock_array<int, 4> arr;
+    assert(arr.size() == 4);
+    arr.set(1, 42);
+    arr.set(10, 7);  // 越界写入被忽略
+    assert(arr[1] == 42);
+    assert(arr.get(10, -1) == -1);
+    arr.update(1, [](int& v) { ++v; });
+    assert(arr.at(1) == 43);
+    bool thrown = false;
+    try {
+        arr.at(4);
+    } catch (const std::out_of_range&) {
+        thrown = true;
+    }
+    assert(thrown);
+
+    std::cout << "✓ SeqLock tests passed" << std::endl;
+}
+
+void test_seqlock_concurrent() {
+    std::cout << "Testing concurrent SeqLock operations..." << std::endl;
+
+    // 写者始终保持 ask == bid + 1，读者不应看到撕裂值
+    seqlock<Quote> q(Quote{0, 1, 0});
+    std::atomic<bool> done{false};
+    std::atomic<bool> torn{false};
+
+    std::vector<std::thread> readers;
+    for (int r = 0; r < 4; ++r) {
+        readers.emplace_back([&]() {
+            long long last_version = 0;
+            while (!done.load()) {
+                Quote v = q.load();
+                if (v.ask != v.bid + 1 || v.version < last_version) {
+                    torn = true;
+                }
+                last_version = v.version;
+            }
+        });
+    }
+    std::thread writer([&]() {
+        for (long long i = 1; i <= 20000; ++i) {
+            q.store(Quote{i * 3, i * 3 + 1, i});
+        }
+        done = true;
+    });
+    writer.join();
+    for (auto& t : readers) {
+        t.join();
+    }
+
+    assert(!torn);
+    assert(q.load().version == 20000);
+    std::cout << "✓ Concurrent SeqLock tests passed" << std::endl;
+}
+
+// ==================== Snapshot 测试 ====================
+void test_snapshot_basic() {
+    std::cout << "Testing Snapshot..." << std::endl;
+
+    snapshot_map<std::string, int> routes;
+    assert(routes.empty());
+    assert(routes.version() == 0);
+
+    routes.update([](auto& m) {
+        m["a"] = 1;
+        m["b"] = 2;
+    });
+    assert(routes.size() == 2);
+    assert(routes.contains("a"));
+    assert(routes.get("b") == 2);
+    assert(routes.get("zzz", -1) == -1);
+    assert(routes.version() == 1);
+
+    // 已取得的旧版本在更新后保持不变
+    auto old_version = routes.load();
+    routes.update([](auto& m) { m.erase("a"); });
+    assert(old_version->size() == 2);
+    assert(routes.size() == 1);
+
+    auto found = routes.find_if([](const auto& kv) { return kv.second == 2; });
+    assert(found && found->first == "b");
+    assert(routes.count_if([](const auto& kv) { return kv.second > 5; }) == 0);
+
+    // 读者句柄只在发布新版本后刷新
+    auto reader = routes.get_reader();
+    const auto* before = &reader.get();
+    assert(&reader.get() == before);
+    routes.store({{"x", 10}});
+    assert(reader->size() == 1 && reader->at("x") == 10);
+
+    routes.clear();
+    assert(routes.empty());
+
+    std::cout << "✓ Snapshot tests passed" << std::endl;
+}
+
+void test_snapshot_concurrent() {
+    std::cout << "Testing concurrent Snapshot operations..." << std::endl;
+
+    // 写者每次发布都保持所有值之和为 0，读者在任何版本上都应看到一致结果
+    snapshot_unordered_map<int, int> table;
+    table.update([](auto& m) {
+        for (int i = 0; i < 64; ++i) {
+            m[i] = 0;
+        }
+    });
+    std::atomic<bool> done{false};
+    std::atomic<bool> inconsistent{false};
+
+    std::vector<std::thread> readers;
+    for (int r = 0; r < 4; ++r) {
+        readers.emplace_back([&]() {
+            auto reader = table.get_reader();
+            while (!done.load()) {
+                int sum = 0;
+                for (const auto& kv : reader.get()) {
+                    sum += kv.second;
+                }
+                if (sum != 0 || reader->size() != 64) {
+                    inconsistent = true;
+                }
+            }
+        });
+    }
+    std::thread writer([&]() {
+        for (int i = 0; i < 2000; ++i) {
+            table.update([i](auto& m) {
+                m[i % 64] += 1;
+                m[(i + 1) % 64] -= 1;
+            });
+        }
+        done = true;
+    });
+    writer.join();
+    for (auto& t : readers) {
+        t.join();
+    }
+
+    assert(!inconsistent);
+    assert(table.version() == 2001);
+    std::cout << "✓ Concurrent Snapshot tests passed" << std::endl;
+}
+
+// ==================== 持久化快照测试 ====================
+struct Record {
+    std::uint64_t id;
+    double score;
+    std::int32_t flags;
+};
+
+void test_persistent_snapshot() {
+    std::cout << "Testing persistent snapshots..." << std::endl;
+
+    const std::string dir = std::filesystem::temp_directory_path().string();
+    const std::string vec_path = dir + "/ts_stl_test_vector.snap";
+    const std::string map_path = dir + "/ts_stl_test_map.snap";
+
+    // 顺序容器：保存、批量加载、直接映射
+    vectorRW<Record> records;
+    for (std::uint64_t i = 0; i < 1000; ++i) {
+        records.push_back(Record{i, static_cast<double>(i) * 0.5, static_cast<std::int32_t>(i % 7)});
+    }
+    save_snapshot(records, vec_path);
+
+    vectorMutex<Record> loaded;
+    loaded.push_back(Record{99999, 0, 0});
+    load_snapshot(loaded, vec_path);
+    assert(loaded.size() == 1000);
+    assert(loaded.at(999).id == 999 && loaded.at(10).score == 5.0);
+
+    mapped_vector<Record> view = map_snapshot<vectorRW<Record>>(vec_path);
+    assert(view.size() == 1000 && view[500].flags == 500 % 7);
+    dequeLockFree<Record> dq;
+    load_snapshot(dq, vec_path);
+    assert(dq.size() == 1000);
+
+    // 键值容器：文件内按 key 排序，映射视图二分查找
+    unordered_mapRW<std::uint64_t, Record> table;
+    for (std::uint64_t i = 0; i < 5000; ++i) {
+        table.insert(i * 3, Record{i, 1.0, 0});
+    }
+    save_snapshot(table, map_path);
+
+    unordered_mapMutex<std::uint64_t, Record> restored;
+    load_snapshot(restored, map_path);
+    assert(restored.size() == 5000 && restored.at(2997).id == 999);
+
+    mapped_map<std::uint64_t, Record> index = map_snapshot<unordered_mapRW<std::uint64_t, Record>>(map_path);
+    assert(index.size() == 5000);
+    assert(index.find(3 * 4321)->id == 4321);
+    assert(index.find(1) == nullptr && !index.contains(14999) && index.contains(14997));
+    assert(std::is_sorted(index.begin(), index.end(),
+                          [](const auto& a, const auto& b) { return a.key < b.key; }));
+    bool threw = false;
+    try {
+        index.at(2);
+    } catch (const std::out_of_range&) {
+        threw = true;
+    }
+    assert(threw);
+
+    flat_mapSpinLock<std::uint64_t, Record> flat;
+    load_snapshot(flat, map_path);
+    assert(flat.size() == 5000);
+
+    // 从 RCU 快照保存，不阻塞写者
+    snapshot_map<int, int> routes;
+    routes.update([](auto& m) {
+        for (int i = 0; i < 100; ++i) {
+            m[i] = -i;
+        }
+    });
+    save_snapshot(routes, map_path);
+    mapMutex<int, int> ordered;
+    load_snapshot(ordered, map_path);
+    assert(ordered.size() == 100 && ordered.at(42) == -42);
+
+    // 记录的填充字节写为 0，相同内容得到相同文件（有序容器直接写出，无序容器排序后写出）
+    using padded_record = snapshot_entry<std::uint8_t, std::uint64_t>;
+    static_assert(sizeof(padded_record) == 16, "uint8_t key should be followed by padding");
+    auto check_zero_padding = [&map_path](auto& container) {
+        for (int i = 0; i < 50; ++i) {
+            container.insert(static_cast<std::uint8_t>(i), static_cast<std::uint64_t>(i) * 1000);
+        }
+        save_snapshot(container, map_path);
+        std::vector<unsigned char> bytes(64 + 50 * sizeof(padded_record));
+        std::FILE* file = std::fopen(map_path.c_str(), "rb");
+        assert(file != nullptr);
+        assert(std::fread(bytes.data(), 1, bytes.size(), file) == bytes.size());
+        assert(std::fgetc(file) == EOF);
+        std::fclose(file);
+        for (std::size_t i = 0; i < 50; ++i) {
+            const unsigned char* rec = bytes.data() + 64 + i * sizeof(padded_record);
+            assert(rec[0] == i);
+            assert(std::all_of(rec + 1, rec + offsetof(padded_record, value),
+                               [](unsigned char b) { return b == 0; }));
+        }
+    };
+    mapMutex<std::uint8_t, std::uint64_t> padded;
+    check_zero_padding(padded);
+    unordered_mapMutex<std::uint8_t, std::uint64_t> padded_hash;
+    check_zero_padding(padded_hash);
+
+    // 格式/布局不符时抛出 snapshot_error
+    threw = false;
+    try {
+        mapped_vector<std::uint64_t> wrong(vec_path);
+    } catch (const snapshot_error&) {
+        threw = true;
+    }
+    assert(threw);
+    threw = false;
+    try {
+        load_snapshot(loaded, map_path);
+    } catch (const snapshot_error&) {
+        threw = true;
+    }
+    assert(threw && loaded.size() == 1000);
+    threw = false;
+    try {
+        mapped_vector<Record> missing(dir + "/ts_stl_test_missing.snap");
+    } catch (const snapshot_error&) {
+        threw = true;
+    }
+    assert(threw);
+
+    std::remove(vec_path.c_str());
+    std::remove(map_path.c_str());
+    std::cout << "✓ Persistent snapshot tests passed" << std::endl;
+}
+
+// ==================== LRU Cache 测试 ====================
+void test_lru_cache_basic() {
+    std::cout << "Testing LRU cache..." << std::endl;
+
+    // 单分片便于验证淘汰顺序
+    lru_cache<int, std::string, 1> cache(3);
+    assert(cache.capacity() == 3 && cache.empty());
+    assert(cache.put(1, "one"));
+    assert(cache.put(2, "two"));
+    assert(cache.put(3, "three"));
+    assert(!cache.put(3, "THREE"));
+    assert(cache.get(3) == std::optional<std::string>("THREE"));
+    assert(!cache.get(42).has_value());
+
+    // 1 被访问过，满时优先淘汰未访问的 2
+    assert(cache.get(1).has_value());
+    cache.put(4, "four");
+    assert(cache.size() == 3);
+    assert(!cache.contains(2) && cache.contains(1) && cache.contains(4));
+
+    size_t length = 0;
+    assert(cache.visit(1, [&length](const std::string& v) { length = v.size(); }) && length == 3);
+    assert(cache.erase(1) == 1 && cache.erase(1) == 0);
+
+    auto stats = cache.stats();
+    assert(stats.hits == 3 && stats.misses == 1);
+    assert(stats.insertions == 4 && stats.evictions == 1);
+    assert(stats.hit_ratio() > 0.7);
+    cache.reset_stats();
+    assert(cache.stats().hits == 0);
+
+    int calls = 0;
+    auto compute = [&calls]() {
+        ++calls;
+        return std::string("computed");
+    };
+    assert(cache.get_or_compute(7, compute) == "computed");
+    assert(cache.get_or_compute(7, compute) == "computed" && calls == 1);
+
+    bool thrown = false;
+    try {
+        lru_cache<int, int> empty(0);
+    } catch (const std::invalid_argument&) {
+        thrown = true;
+    }
+    assert(thrown);
+
+    // TTL：默认存活时间与逐条覆盖
+    lru_cacheMutex<int, int> ttl(64, std::chrono::milliseconds(20));
+    ttl.put(1, 10);
+    ttl.put(2, 20, std::chrono::hours(1));
+    ttl.put(3, 30, std::chrono::steady_clock::duration::zero());
+    assert(ttl.get(1) == std::optional<int>(10));
+    std::this_thread::sleep_for(std::chrono::milliseconds(40));
+    assert(!ttl.get(1).has_value() && !ttl.contains(1));
+    assert(ttl.get(2) == std::optional<int>(20) && ttl.get(3) == std::optional<int>(30));
+    assert(ttl.size() == 3);
+    assert(ttl.purge_expired() == 1 && ttl.size() == 2);
+    assert(ttl.stats().expirations == 1);
+    ttl.clear();
+    assert(ttl.empty());
+
+    std::cout << "✓ LRU cache basic tests passed" << std::endl;
+}
+
+void test_lru_cache_concurrent() {
+    std::cout << "Testing LRU cache concurrent access..." << std::endl;
+
+    lru_cache<int, int> cache(1024);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([&cache, t]() {
+            for (int i = 0; i < 20000; ++i) {
+                int key = (i * 31 + t) % 4096;
+                if (auto v = cache.get(key)) {
+                    assert(*v == key * 2);
+                } else {
+                    cache.put(key, key * 2);
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    assert(cache.size() <= cache.capacity());
+    auto stats = cache.stats();
+    assert(stats.hits + stats.misses == 80000);
+    assert(stats.insertions - stats.evictions == cache.size());
+    cache.for_each([](const int& k, const int& v) { assert(v == k * 2); });
+
+    std::cout << "✓ LRU cache concurrent tests passed" << std::endl;
+}
+
+int main() {
+    std::cout << "Testing concurrent containers: Ring Buffer, SeqLock, Snapshot, LRU Cache" << std::endl;
+    std::cout << "=========================================" << std::endl;
+
+    try {
+        test_spsc_ring_buffer_basic();
+        test_spsc_ring_buffer_concurrent();
+        test_mpmc_ring_buffer_basic();
+        test_mpmc_ring_buffer_concurrent();
+        test_ring_buffer_exception_safety();
+        test_seqlock_basic();
+        test_seqlock_concurrent();
+        test_snapshot_basic();
+        test_snapshot_concurrent();
+        test_persistent_snapshot();
+        test_lru_cache_basic();
+        test_lru_cache_concurrent();
+
+        std::cout << "\n✓ All tests passed!" << std::endl;
+        return 0;
+    } catch (const std::exception& e) {
+        std::cerr << "✗ Test failed: " << e.what() << std::endl;
+        return 1;
+    }
+}
@@ -1,6 +1,12 @@
+#include <algorithm>
 #include <iostream>
 #include <cassert>
 #include <thread>
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <iterator>
+#include <vector>
 #include "ts_stl.hpp"
 
 using namespace ts_stl;
@@ -118,6 +124,373 @@ void test_concurrent_deque() {
     std::cout << "✓ Concurrent Deque tests passed" << std::endl;
 }
 
+// ==================== 批量操作测试 ====================
+void test_bulk_operations() {
+    std::cout << "Testing bulk operations..." << std::endl;
+    
+    std::vector<int> batch{5, 3, 1, 3, 2};
+    
+    setMutex<int> s;
+    assert(s.insert_bulk(batch) == 4);
+    assert(s.erase_bulk(std::vector<int>{1, 9}) == 1);
+    assert(s.size() == 3);
+    
+    unordered_setMutex<int> us;
+    assert(us.insert_bulk(batch.begin(), batch.end()) == 4);
+    assert(us.erase_bulk(std::vector<int>{2, 3}) == 2);
+    assert(us.size() == 2);
+    
+    dequeMutex<int> dq;
+    dq.push_back_range(batch);
+    assert(dq.size() == 5 && dq.back() == 2);
+    std::vector<int> out;
+    assert(dq.get_many(std::vector<size_t>{0, 9}, std::back_inserter(out), -1) == 1);
+    assert((out == std::vector<int>{5, -1}));
+    
+    // LockFree 特化提供相同的批量接口
+    setLockFree<int> lf_s;
+    assert(lf_s.insert_bulk(batch) == 4);
+    assert(lf_s.erase_bulk(std::vector<int>{1, 9}) == 1 && lf_s.size() == 3);
+    unordered_setLockFree<int> lf_us;
+    assert(lf_us.insert_bulk(batch.begin(), batch.end()) == 4);
+    assert(lf_us.erase_bulk(std::vector<int>{2, 3}) == 2 && lf_us.size() == 2);
+    dequeLockFree<int> lf_dq;
+    lf_dq.push_back_range(batch);
+    out.clear();
+    assert(lf_dq.get_many(std::vector<size_t>{4, 5}, std::back_inserter(out), -1) == 1);
+    assert((out == std::vector<int>{2, -1}));
+    
+    std::cout << "✓ Bulk operations passed" << std::endl;
+}
+
+// ==================== Flat Set 测试 ====================
+void test_flat_set() {
+    std::cout << "Testing Flat Set..." << std::endl;
+    
+    flat_setMutex<int> s;
+    assert(s.insert(3).second);
+    assert(!s.insert(3).second);
+    assert(s.insert_bulk(std::vector<int>{5, 1, 4, 1}) == 3);
+    assert(s.size() == 4 && s.contains(4));
+    assert(s.erase_bulk(std::vector<int>{1, 2}) == 1);
+    
+    std::vector<int> seen;
+    assert(s.visit_range(3, 5, [&seen](const int* first, const int* last) { seen.assign(first, last); }) == 2);
+    assert((seen == std::vector<int>{3, 4}));
+    
+    flat_setLockFree<int> lf;
+    lf.assign(seen.begin(), seen.end());
+    auto span = lf.range_span(0, 100);
+    assert(span.second - span.first == 2 && *span.first == 3);
+    
+    std::cout << "✓ Flat Set tests passed" << std::endl;
+}
+
+// ==================== Set 区间查询测试 ====================
+void test_set_range_queries() {
+    std::cout << "Testing Set range queries..." << std::endl;
+    
+    setRW<int> s;
+    for (int i = 0; i < 10; ++i) {
+        s.insert(i * 3);
+    }
+    assert(s.lower_bound_key(4) == 6);
+    assert(!s.upper_bound_key(27));
+    
+    std::vector<int> out;
+    assert(s.range(3, 12, [&out](const int& v) { out.push_back(v); }) == 3);
+    assert((out == std::vector<int>{3, 6, 9}));
+    out.clear();
+    assert(s.collect_range(0, 100, std::back_inserter(out), 2) == 2);
+    assert((out == std::vector<int>{0, 3}));
+    
+    setMutex<std::string> words;
+    words.insert("apple");
+    words.insert("apply");
+    words.insert("banana");
+    std::vector<std::string> found;
+    assert(words.collect_prefix("app", std::back_inserter(found)) == 2);
+    assert(words.prefix_scan("b", [](const std::string&) { return false; }) == 1);
+    
+    setLockFree<int> lf;
+    lf.insert(1);
+    lf.insert(2);
+    assert(lf.range(2, 3, [](const int& v) { assert(v == 2); }) == 1);
+    
+    flat_setRW<int> flat;
+    flat.insert_bulk(s.copy());
+    assert(flat.range(3, 12, [](const int&) {}) == 3);
+    
+    std::cout << "✓ Set range query tests passed" << std::endl;
+}
+
+// ==================== Blocking Queue 测试 ====================
+void test_deque_try_pop() {
+    std::cout << "Testing Deque try_pop..." << std::endl;
+    
+    dequeMutex<int> dq;
+    int value = -1;
+    assert(!dq.try_pop_front(value));
+    assert(value == -1);
+    
+    dq.push_back(1);
+    dq.push_back(2);
+    assert(dq.try_pop_front(value) && value == 1);
+    assert(dq.try_pop_back(value) && value == 2);
+    assert(dq.empty());
+    
+    std::cout << "✓ Deque try_pop tests passed" << std::endl;
+}
+
+void test_blocking_queue() {
+    std::cout << "Testing Blocking Queue..." << std::endl;
+    
+    blocking_queueMutex<int> q(4);
+    assert(q.capacity() == 4);
+    int value = 0;
+    assert(!q.try_pop_front(value));
+    assert(!q.wait_pop_front_for(value, std::chrono::milliseconds(1)));
+    
+    // 容量上限
+    for (int i = 0; i < 4; ++i) {
+        assert(q.try_push_back(i));
+    }
+    assert(!q.try_push_back(99));
+    assert(!q.push_back_for(99, std::chrono::milliseconds(1)));
+    
+    // 批量取出
+    std::vector<int> out;
+    assert(q.pop_n(std::back_inserter(out), 3) == 3);
+    assert((out == std::vector<int>{0, 1, 2}));
+    assert(q.try_pop_front(value) && value == 3);
+    
+    // 关闭后唤醒等待者
+    std::thread waiter([&q]() {
+        int v = 0;
+        assert(!q.wait_pop_front(v));
+        (void)v;
+    });
+    q.close();
+    waiter.join();
+    assert(q.is_closed());
+    assert(!q.push_back(1));
+    
+    std::cout << "✓ Blocking Queue tests passed" << std::endl;
+}
+
+void test_concurrent_blocking_queue() {
+    std::cout << "Testing concurrent Blocking Queue operations..." << std::endl;
+    
+    blocking_queueSpinLock<int> q(16);
+    constexpr int PRODUCERS = 4;
+    constexpr int ITEMS_PER_PRODUCER = 500;
+    std::atomic<long long> sum{0};
+    std::atomic<int> received{0};
+    
+    std::vector<std::thread> consumers;
+    for (int c = 0; c < 3; ++c) {
+        consumers.emplace_back([&]() {
+            int v = 0;
+            while (q.wait_pop_front(v)) {
+                sum += v;
+                ++received;
+            }
+        });
+    }
+    
+    std::vector<std::thread> producers;
+    for (int p = 0; p < PRODUCERS; ++p) {
+        producers.emplace_back([&q, p]() {
+            for (int i = 0; i < ITEMS_PER_PRODUCER; ++i) {
+                q.push_back(p * ITEMS_PER_PRODUCER + i);
+            }
+        });
+    }
+    for (auto& t : producers) {
+        t.join();
+    }
+    q.close();
+    for (auto& t : consumers) {
+        t.join();
+    }
+    
+    constexpr int total = PRODUCERS * ITEMS_PER_PRODUCER;
+    assert(received == total);
+    assert(sum == static_cast<long long>(total - 1) * total / 2);
+    
+    std::cout << "✓ Concurrent Blocking Queue tests passed" << std::endl;
+}
+
+// ==================== Priority Queue 测试 ====================
+void test_priority_queue() {
+    std::cout << "Testing Priority Queue..." << std::endl;
+    
+    priority_queueMutex<int> pq{5, 1, 9, 3};
+    int value = 0;
+    assert(pq.size() == 4);
+    assert(pq.try_top(value) && value == 9);
+    assert(pq.try_pop(value) && value == 9);
+    
+    // 批量入队：少量追加逐个上浮，大量追加整体建堆
+    std::vector<int> more{7, 2};
+    assert(pq.push_bulk(more.begin(), more.end()) == 2);
+    assert(pq.push_bulk({10, 11, 12, 13, 14, 15, 16, 0}) == 8);
+    std::vector<int> top;
+    assert(pq.pop_n(std::back_inserter(top), 3) == 3);
+    assert((top == std::vector<int>{16, 15, 14}));
+    assert((pq.sorted_copy() == std::vector<int>{13, 12, 11, 10, 7, 5, 3, 2, 1, 0}));
+    
+    // 最小堆：只取出已到期的定时器
+    priority_queueSpinLock<int, std::greater<int>> timers;
+    for (int deadline : {30, 10, 20, 40}) {
+        timers.emplace(deadline);
+    }
+    const int now = 25;
+    assert(timers.try_pop_if(value, [now](int d) { return d <= now; }) && value == 10);
+    std::vector<int> expired;
+    assert(timers.pop_while(std::back_inserter(expired), [now](int d) { return d <= now; }) == 1);
+    assert((expired == std::vector<int>{20}));
+    assert(!timers.try_pop_if(value, [now](int d) { return d <= now; }));
+    assert(timers.size() == 2);
+    
+    // swap_out 换入的元素重新建堆；drain 取走全部
+    std::vector<int> buffer{1, 50, 4};
+    timers.swap_out(buffer);
+    assert(buffer.size() == 2);
+    assert(timers.try_pop(value) && value == 1);
+    assert(timers.drain().size() == 2 && timers.empty());
+    
+    priority_queueLockFree<int> lf;
+    lf.push(1);
+    lf.push(2);
+    assert(lf.try_pop(value) && value == 2);
+    assert(!pq.empty() && (pq.clear(), pq.empty()));
+    
+    // 不可默认构造的元素类型同样可以批量取出
+    struct job {
+        int priority;
+        explicit job(int p) : priority(p) {}
+        bool operator<(const job& other) const { return priority < other.priority; }
+    };
+    priority_queueMutex<job> jobs;
+    priority_queueLockFree<job> local_jobs;
+    multi_priority_queueMutex<job> relaxed_jobs(2);
+    for (int p : {3, 1, 2}) {
+        jobs.emplace(p);
+        local_jobs.emplace(p);
+        relaxed_jobs.emplace(p);
+    }
+    std::vector<job> popped;
+    assert(jobs.pop_while(std::back_inserter(popped), [](const job& j) { return j.priority > 1; }) == 2);
+    assert(jobs.pop_n(std::back_inserter(popped), 5) == 1);
+    assert(local_jobs.pop_n(std::back_inserter(popped), 5) == 3);
+    assert(local_jobs.pop_while(std::back_inserter(popped), [](const job&) { return true; }) == 0);
+    assert(relaxed_jobs.pop_n(std::back_inserter(popped), 5) == 3);
+    assert(popped.size() == 9 && popped[0].priority == 3 && popped[2].priority == 1);
+    
+    // 并发的 a = b 与 b = a 按地址顺序加锁，不会死锁
+    priority_queueMutex<int> a{1, 2, 3};
+    priority_queueMutex<int> b{4, 5};
+    std::thread forward([&]() {
+        for (int i = 0; i < 2000; ++i) {
+            a = b;
+        }
+    });
+    for (int i = 0; i < 2000; ++i) {
+        b = a;
+    }
+    forward.join();
+    assert(a.size() == b.size());
+    
+    std::cout << "✓ Priority Queue tests passed" << std::endl;
+}
+
+void test_concurrent_priority_queues() {
+    std::cout << "Testing concurrent Priority Queue operations..." << std::endl;
+    
+    constexpr int THREADS = 4;
+    constexpr int ITEMS_PER_THREAD = 2000;
+    constexpr long long EXPECTED = static_cast<long long>(THREADS) * ITEMS_PER_THREAD *
+                                   (THREADS * ITEMS_PER_THREAD - 1) / 2;
+    
+    // 严格优先队列：并发入队后按顺序取完
+    priority_queueAdaptive<int> strict;
+    std::vector<std::thread> threads;
+    for (int t = 0; t < THREADS; ++t) {
+        threads.emplace_back([&strict, t]() {
+            for (int i = 0; i < ITEMS_PER_THREAD; ++i) {
+                strict.push(t * ITEMS_PER_THREAD + i);
+            }
+        });
+    }
+    for (auto& th : threads) {
+        th.join();
+    }
+    threads.clear();
+    int previous = THREADS * ITEMS_PER_THREAD;
+    int value = 0;
+    while (strict.try_pop(value)) {
+        assert(value < previous);
+        previous = value;
+    }
+    assert(previous == 0);
+    
+    // 松弛优先队列：生产者与消费者并发，每个元素恰好取出一次
+    multi_priority_queueSpinLock<int> relaxed(8);
+    assert(relaxed.queue_count() == 8);
+    std::atomic<long long> sum{0};
+    std::atomic<int> received{0};
+    for (int t = 0; t < THREADS; ++t) {
+        threads.emplace_back([&relaxed, t]() {
+            std::vector<int> batch;
+            for (int i = 0; i < ITEMS_PER_THREAD; ++i) {
+                if (i % 2 == 0) {
+                    relaxed.push(t * ITEMS_PER_THREAD + i);
+                } else {
+                    batch.push_back(t * ITEMS_PER_THREAD + i);
+                }
+            }
+            relaxed.push_bulk(batch.begin(), batch.end());
+        });
+        threads.emplace_back([&]() {
+            int v = 0;
+            while (received.load() < THREADS * ITEMS_PER_THREAD) {
+                if (relaxed.try_pop(v)) {
+                    sum += v;
+                    ++received;
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+    for (auto& th : threads) {
+        th.join();
+    }
+    assert(sum == EXPECTED && relaxed.empty());
+    assert(!relaxed.try_pop(value));
+    
+    // 单线程下近似有序：大部分取出的元素接近当前最优
+    multi_priority_queueMutex<int> approx(4);
+    std::vector<int> keys(4000);
+    for (int i = 0; i < 4000; ++i) {
+        keys[static_cast<std::size_t>(i)] = (i * 7919) % 4000;
+    }
+    approx.push_bulk(keys.begin(), keys.end());
+    assert(approx.size() == 4000);
+    std::vector<int> first;
+    assert(approx.pop_n(std::back_inserter(first), 100) == 100);
+    int near_top = 0;
+    for (int v : first) {
+        near_top += v >= 3600 ? 1 : 0;
+    }
+    assert(near_top >= 90);
+    std::vector<int> rest = approx.drain();
+    assert(rest.size() == 3900 && std::is_sorted(rest.rbegin(), rest.rend()) && approx.empty());
+    
+    std::cout << "✓ concurrent Priority Queue tests passed" << std::endl;
+}
+
 int main() {
     std::cout << "Testing new containers: Set, Unordered Set, Deque" << std::endl;
     std::cout << "=========================================" << std::endl;
@@ -128,6 +501,14 @@ int main() {
         test_deque_basic();
         test_concurrent_set();
         test_concurrent_deque();
+        test_bulk_operations();
+        test_flat_set();
+        test_set_range_queries();
+        test_deque_try_pop();
+        test_blocking_queue();
+        test_concurrent_blocking_queue();
+        test_priority_queue();
+        test_concurrent_priority_queues();
         
         std::cout << "\n✓ All tests passed!" << std::endl;
         return 0;
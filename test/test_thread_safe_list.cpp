@@ -3,6 +3,8 @@
 #include <thread>
 #include <vector>
 #include <cassert>
+#include <atomic>
+#include <list>
 
 using namespace ts_stl;
 
@@ -267,6 +269,91 @@ void test_list_specific_operations() {
     std::cout << "✓ Implicit conversion works" << std::endl;
 }
 
+void test_list_bulk_operations() {
+    std::cout << "\n=== Test 11: List Bulk Operations ===" << std::endl;
+
+    list<int> list;
+    std::vector<int> batch{1, 2, 3};
+    list.push_back_range(batch);
+    list.push_back_range(batch.begin(), batch.end());
+    assert(list.size() == 6);
+    assert(list.back() == 3);
+    std::cout << "✓ push_back_range() works" << std::endl;
+}
+
+// ==================== 测试12: 细粒度并发链表 ====================
+void test_concurrent_list() {
+    std::cout << "\n=== Test 12: Concurrent List ===" << std::endl;
+
+    listConcurrent<int> cl{1, 2, 3};
+    cl.push_front(0);
+    cl.emplace_back(4);
+    assert(cl.size() == 5);
+    int value = -1;
+    assert(cl.try_front(value) && value == 0);
+    assert(cl.try_back(value) && value == 4);
+    assert(cl.try_pop_front(value) && value == 0);
+    assert(cl.try_pop_back(value) && value == 4);
+    assert(cl.contains(2) && !cl.contains(4));
+    cl.for_each_mut([](int& v) { v *= 10; });
+    std::list<int> snapshot = cl.copy();
+    assert((snapshot == std::list<int>{10, 20, 30}));
+    assert(cl.remove(20) == 1);
+    assert(cl.remove_if([](const int& v) { return v > 100; }) == 0);
+    cl.clear();
+    assert(cl.empty() && !cl.try_pop_back(value));
+    std::cout << "✓ push/pop/remove_if work" << std::endl;
+
+    // 生产者在两端插入，消费者在两端弹出，另一线程并发 remove_if
+    concurrent_list<long, LockPolicy::Mutex> shared;
+    constexpr long ITEMS = 5000;
+    std::atomic<long> sum{0};
+    std::atomic<long> taken{0};
+    std::atomic<bool> producing{true};
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 2; ++t) {
+        threads.emplace_back([&shared, t]() {
+            for (long i = 0; i < ITEMS; ++i) {
+                if (t == 0) {
+                    shared.push_back(i);
+                } else {
+                    shared.push_front(i);
+                }
+            }
+        });
+    }
+    for (int t = 0; t < 2; ++t) {
+        threads.emplace_back([&, t]() {
+            long v = 0;
+            while (producing || !shared.empty()) {
+                if (t == 0 ? shared.try_pop_front(v) : shared.try_pop_back(v)) {
+                    sum += v;
+                    ++taken;
+                }
+            }
+        });
+    }
+    threads.emplace_back([&]() {
+        while (producing) {
+            shared.remove_if([](const long& v) { return v < 0; });
+        }
+    });
+    threads[0].join();
+    threads[1].join();
+    producing = false;
+    for (size_t i = 2; i < threads.size(); ++i) {
+        threads[i].join();
+    }
+    long v = 0;
+    while (shared.try_pop_front(v)) {
+        sum += v;
+        ++taken;
+    }
+    assert(taken == 2 * ITEMS);
+    assert(sum == ITEMS * (ITEMS - 1));
+    std::cout << "✓ Concurrent push/pop at both ends: " << taken << " elements" << std::endl;
+}
+
 // ==================== 主测试函数 ====================
 int main() {
     std::cout << "========================================" << std::endl;
@@ -284,6 +371,8 @@ int main() {
         test_list_manual_lock();
         test_list_complex_types();
         test_list_specific_operations();
+        test_list_bulk_operations();
+        test_concurrent_list();
 
         std::cout << "\n========================================" << std::endl;
         std::cout << "✅ All list tests passed!" << std::endl;
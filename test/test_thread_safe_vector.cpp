@@ -2,7 +2,17 @@
 #include <iostream>
 #include <thread>
 #include <vector>
+#include <iterator>
 #include <cassert>
+#include <atomic>
+#include <functional>
+#include <stdexcept>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <deque>
+#include <string>
+#include <algorithm>
 
 using namespace ts_stl;
 
@@ -270,6 +280,287 @@ void test_lock_policies_comparison() {
               << std::endl;
 }
 
+// ==================== 测试11: 批量操作 ====================
+void test_bulk_operations() {
+    std::cout << "\n=== Test 11: Bulk Operations ===" << std::endl;
+
+    vectorMutex<int> vec;
+    std::vector<int> batch{1, 2, 3, 4, 5};
+    vec.push_back_range(batch);
+    vec.push_back_range(batch.begin(), batch.begin() + 2);
+    assert(vec.size() == 7);
+    assert(vec[5] == 1 && vec[6] == 2);
+
+    std::vector<int> out;
+    std::vector<size_t> indices{0, 4, 100};
+    assert(vec.get_many(indices, std::back_inserter(out), -1) == 2);
+    assert((out == std::vector<int>{1, 5, -1}));
+
+    // LockFree 特化提供相同的批量接口
+    vectorLockFree<int> lf;
+    lf.push_back_range(batch);
+    out.clear();
+    assert(lf.get_many(indices, std::back_inserter(out), -1) == 2);
+    assert((out == std::vector<int>{1, 5, -1}));
+    listLockFree<int> lst;
+    lst.push_back_range(batch.begin(), batch.begin() + 3);
+    assert(lst.size() == 3 && lst.back() == 3);
+    std::cout << "✓ push_back_range and get_many work with a single lock" << std::endl;
+}
+
+// ==================== 测试12: 并行遍历 ====================
+void test_parallel_algorithms() {
+    std::cout << "\n=== Test 12: Parallel Algorithms ===" << std::endl;
+
+    vectorRW<float> samples;
+    const size_t n = 100000;
+    samples.reserve(n);
+    for (size_t i = 0; i < n; ++i) {
+        samples.push_back(static_cast<float>(i % 100));
+    }
+
+    // 显式指定 4 个线程，区间足够大时会切成 4 段
+    double sum = samples.parallel_reduce(0.0, [](double acc, float x) { return acc + x; },
+                                         [](double a, double b) { return a + b; }, 4);
+    assert(sum == 49.5 * static_cast<double>(n));
+    assert(samples.parallel_reduce(0.0f, std::plus<>(), 4) == samples.parallel_reduce(0.0f, std::plus<>(), 1));
+    assert(samples.parallel_count_if([](float x) { return x >= 90.0f; }, 4) == n / 10);
+
+    std::atomic<size_t> visited{0};
+    samples.parallel_for_each([&visited](float) { visited.fetch_add(1, std::memory_order_relaxed); }, 4);
+    assert(visited.load() == n);
+
+    // 结果保持原顺序
+    auto doubled = samples.parallel_transform([](float x) { return static_cast<int>(x) * 2; }, 4);
+    assert(doubled.size() == n);
+    assert(doubled[0] == 0 && doubled[199] == 198 && doubled[n - 1] == 198);
+
+    // 回调抛出的异常在所有任务结束后重新抛出
+    bool thrown = false;
+    try {
+        samples.parallel_for_each([](float x) {
+            if (x == 99.0f) {
+                throw std::runtime_error("bad sample");
+            }
+        }, 4);
+    } catch (const std::runtime_error&) {
+        thrown = true;
+    }
+    assert(thrown);
+
+    // 小容器直接在调用线程执行
+    listMutex<int> small;
+    small.push_back(1);
+    small.push_back(2);
+    assert(small.parallel_reduce(0, std::plus<>()) == 3);
+    std::cout << "✓ parallel_reduce / count_if / for_each / transform split the range under one read lock" << std::endl;
+}
+
+// ==================== 测试13: 算术类型的向量化查询 ====================
+void test_simd_queries() {
+    std::cout << "\n=== Test 13: SIMD Queries (" << simd::isa_name() << ") ===" << std::endl;
+
+    vectorRW<int> ints;
+    for (int i = 0; i < 1003; ++i) {
+        ints.push_back(i % 17 - 8);
+    }
+    assert(ints.contains(8) && !ints.contains(9));
+    assert(ints.count(0) == 59);
+    assert(*ints.min_value() == -8 && *ints.max_value() == 8);
+    std::vector<int> snapshot = ints.to_vector();
+    assert(ints.sum() == std::accumulate(snapshot.begin(), snapshot.end(), std::int64_t{0}));
+    assert(vectorRW<int>().min_value() == std::nullopt);
+
+    // 浮点：-0.0 与 0.0 相等，NaN 不等于任何值
+    vectorMutex<float> floats;
+    for (int i = 0; i < 37; ++i) {
+        floats.push_back(static_cast<float>(i) * 0.5f);
+    }
+    floats.push_back(-0.0f);
+    assert(floats.contains(0.0f) && floats.count(-0.0f) == 2);
+    assert(!floats.contains(std::numeric_limits<float>::quiet_NaN()));
+    assert(*floats.max_value() == 18.0f);
+    assert(floats.sum() == 333.0);
+
+    vectorMutex<float> copy;
+    copy.push_back_range(floats.copy());
+    assert(copy == floats);
+    copy.set(36, 1.0f);
+    assert(copy != floats);
+
+    vectorLockFree<std::uint8_t> bytes;
+    for (int i = 0; i < 100; ++i) {
+        bytes.push_back(static_cast<std::uint8_t>(i));
+    }
+    assert(bytes.find(77) - bytes.begin() == 77);
+    assert(bytes.count(200) == 0);
+    assert(bytes.sum() == 4950u);
+    std::cout << "✓ contains / count / min_value / max_value / sum / operator== match scalar results" << std::endl;
+}
+
+void test_drain_and_swap_out() {
+    std::cout << "\n=== Test 14: Drain and Swap Out ===" << std::endl;
+
+    vectorMutex<int> buffer;
+    for (int i = 0; i < 1000; ++i) {
+        buffer.push_back(i);
+    }
+    const int* storage = buffer.unsafe_ref().data();
+
+    // drain 直接带走原有缓冲区，不复制元素
+    std::vector<int> batch = buffer.drain();
+    assert(batch.size() == 1000 && batch.data() == storage);
+    assert(buffer.empty());
+
+    // swap_out 复用调用方的缓冲区（双缓冲）
+    buffer.push_back(7);
+    batch.clear();
+    buffer.swap_out(batch);
+    assert(batch.size() == 1 && batch[0] == 7);
+    assert(buffer.empty() && buffer.capacity() >= 1000);
+
+    // 并发 push_back 与 drain：每个元素恰好被取出一次
+    vectorSpinLock<int> queue;
+    std::atomic<bool> done{false};
+    std::vector<std::thread> producers;
+    for (int t = 0; t < 4; ++t) {
+        producers.emplace_back([&queue, t]() {
+            for (int i = 0; i < 2000; ++i) {
+                queue.push_back(t * 2000 + i);
+            }
+        });
+    }
+    long long drained_sum = 0;
+    size_t drained = 0;
+    std::thread consumer([&]() {
+        std::vector<int> spare;
+        while (!done.load() || !queue.empty()) {
+            queue.swap_out(spare);
+            drained += spare.size();
+            drained_sum += std::accumulate(spare.begin(), spare.end(), 0LL);
+            spare.clear();
+        }
+    });
+    for (auto& producer : producers) {
+        producer.join();
+    }
+    done.store(true);
+    consumer.join();
+    assert(drained == 8000);
+    assert(drained_sum == 8000LL * 7999 / 2);
+
+    vectorLockFree<int> local;
+    local.push_back(1);
+    assert(local.drain().size() == 1 && local.empty());
+
+    dequeMutex<int> dq;
+    dq.push_back(1);
+    dq.push_front(0);
+    std::deque<int> taken = dq.drain();
+    assert(taken.size() == 2 && taken.front() == 0 && dq.empty());
+
+    blocking_queue<int> bounded(2);
+    bounded.push_back(1);
+    bounded.push_back(2);
+    std::thread blocked([&bounded]() { bounded.push_back(3); });
+    assert(bounded.drain().size() == 2);
+    blocked.join();
+    assert(bounded.size() == 1);
+    std::cout << "✓ drain / swap_out move contents out under one lock" << std::endl;
+}
+
+void test_concurrent_vector() {
+    std::cout << "\n=== Test 15: Concurrent Vector ===" << std::endl;
+
+    vectorConcurrent<std::string> log{"a", "b"};
+    assert(log.size() == 2 && log[1] == "b");
+    assert(log.push_back("c") == 2);
+    assert(log.emplace_back(3, 'd') == 3 && log.at(3) == "ddd");
+    const std::string* first = &log[0];
+    size_t start = log.grow_by(100, "x");
+    assert(start == 4 && log.size() == 104 && log[103] == "x");
+    assert(&log[0] == first);  // 扩容不移动已有元素
+    assert(log.capacity() >= log.size());
+
+    bool thrown = false;
+    try {
+        log.at(104);
+    } catch (const std::out_of_range&) {
+        thrown = true;
+    }
+    assert(thrown);
+
+    // 多个线程并发追加，读者同时扫描已完成前缀
+    concurrent_vector<std::uint64_t> events;
+    std::atomic<bool> done{false};
+    std::atomic<bool> prefix_ok{true};
+    std::thread reader([&]() {
+        size_t seen = 0;
+        while (!done.load() || seen < events.size()) {
+            seen = events.scan(seen, [&prefix_ok](const std::uint64_t& v) {
+                if ((v >> 32) >= 4 || (v & 0xffffffffu) >= 5000) {
+                    prefix_ok.store(false);
+                }
+            });
+        }
+    });
+    std::vector<std::thread> writers;
+    for (std::uint64_t t = 0; t < 4; ++t) {
+        writers.emplace_back([&events, t]() {
+            for (std::uint64_t i = 0; i < 5000; ++i) {
+                if (i % 100 == 0) {
+                    std::uint64_t batch[3] = {(t << 32) | i, (t << 32) | (i + 1), (t << 32) | (i + 2)};
+                    events.grow_by(std::begin(batch), std::end(batch));
+                    i += 2;
+                } else {
+                    events.push_back((t << 32) | i);
+                }
+            }
+        });
+    }
+    for (auto& writer : writers) {
+        writer.join();
+    }
+    done.store(true);
+    reader.join();
+    assert(prefix_ok.load());
+    assert(events.size() == 20000 && events.reserved_size() == 20000);
+
+    std::vector<std::uint64_t> all = events.to_std_vector();
+    std::sort(all.begin(), all.end());
+    for (std::uint64_t t = 0; t < 4; ++t) {
+        for (std::uint64_t i = 0; i < 5000; ++i) {
+            assert(all[t * 5000 + i] == ((t << 32) | i));
+        }
+    }
+
+    // 与 ts_stl::vector 互相转换
+    auto snapshot = events.to_vector<LockPolicy::SpinLock>();
+    assert(snapshot.size() == 20000);
+    vectorMutex<int> source;
+    source.push_back(1);
+    source.push_back(2);
+    concurrent_vector<int> from_vector(source);
+    assert(from_vector.size() == 2 && from_vector[1] == 2);
+
+    // 超出容量在预留之前失败，不留下挡住 size() 的空洞
+    thrown = false;
+    try {
+        from_vector.grow_by(from_vector.max_size(), 0);
+    } catch (const std::length_error&) {
+        thrown = true;
+    }
+    assert(thrown);
+    assert(from_vector.reserved_size() == 2);
+    assert(from_vector.push_back(3) == 2 && from_vector.size() == 3);
+
+    from_vector.reserve(1000);
+    assert(from_vector.capacity() >= 1000);
+    from_vector.clear();
+    assert(from_vector.empty() && from_vector.capacity() == 0);
+    std::cout << "✓ concurrent_vector appends without a global lock" << std::endl;
+}
+
 // ==================== 主测试函数 ====================
 int main() {
     std::cout << "========================================" << std::endl;
@@ -287,6 +578,11 @@ int main() {
         test_iteration_and_find();
         test_exception_handling();
         test_lock_policies_comparison();
+        test_bulk_operations();
+        test_parallel_algorithms();
+        test_simd_queries();
+        test_drain_and_swap_out();
+        test_concurrent_vector();
 
         std::cout << "\n========================================" << std::endl;
         std::cout << "✅ All tests passed!" << std::endl;
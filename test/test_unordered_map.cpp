@@ -1,7 +1,15 @@
 #include <cassert>
+#include <algorithm>
+#include <atomic>
 #include <iostream>
 #include <thread>
 #include <vector>
+#include <string>
+#include <string_view>
+#include <stdexcept>
+#include <iterator>
+#include <memory>
+#include <unordered_map>
 #include "ts_stl.hpp"
 
 using namespace ts_stl;
@@ -258,6 +266,995 @@ void test_manual_lock_control() {
     std::cout << "✓ Manual lock control passed" << std::endl;
 }
 
+// ==================== 分片版本测试 ====================
+void test_sharded_map() {
+    std::cout << "Testing sharded unordered map..." << std::endl;
+    
+    sharded_unordered_mapMutex<int, int, 8> map;
+    assert(map.shard_count() == 8);
+    assert(map.empty());
+    
+    const int NUM_THREADS = 8;
+    const int OPERATIONS_PER_THREAD = 200;
+    std::vector<std::thread> threads;
+    
+    // 并发写入不同键
+    for (int t = 0; t < NUM_THREADS; ++t) {
+        threads.emplace_back([&map, t]() {
+            for (int i = 0; i < OPERATIONS_PER_THREAD; ++i) {
+                int key = t * OPERATIONS_PER_THREAD + i;
+                map.insert(key, key * 2);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    
+    const int total = NUM_THREADS * OPERATIONS_PER_THREAD;
+    assert(map.size() == static_cast<size_t>(total));
+    assert(map.get(10) == 20);
+    assert(map.get(-1, -7) == -7);
+    
+    // 数据应分布到多个分片
+    size_t non_empty_shards = 0;
+    for (size_t i = 0; i < map.shard_count(); ++i) {
+        if (!map.shard(i).empty()) {
+            ++non_empty_shards;
+        }
+    }
+    assert(non_empty_shards > 1);
+    
+    // 聚合操作
+    long long sum = 0;
+    map.for_each([&sum](const auto&, const auto& value) {
+        sum += value;
+    });
+    assert(sum == static_cast<long long>(total - 1) * total);
+    
+    auto snapshot = map.copy();
+    assert(snapshot.size() == static_cast<size_t>(total));
+    assert(snapshot.at(100) == 200);
+    
+    assert(map.count_if([](const auto& key, const auto&) { return key < 100; }) == 100);
+    
+    map.set(0, 42);
+    assert(map.at(0) == 42);
+    assert(map.erase(0) == 1);
+    assert(!map.contains(0));
+    
+    map.clear();
+    assert(map.empty());
+    
+    std::cout << "✓ Sharded unordered map passed" << std::endl;
+}
+
+// 按值产出元素的区间（类似 std::views::iota），解引用得到的是临时对象
+struct counting_range {
+    struct iterator {
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = int;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = int;
+        
+        int current;
+        int operator*() const { return current; }
+        iterator& operator++() { ++current; return *this; }
+        bool operator!=(const iterator& other) const { return current != other.current; }
+        bool operator==(const iterator& other) const { return current == other.current; }
+    };
+    
+    int first;
+    int last;
+    iterator begin() const { return {first}; }
+    iterator end() const { return {last}; }
+};
+
+void test_bulk_operations() {
+    std::cout << "Testing bulk operations..." << std::endl;
+    
+    std::vector<std::pair<int, int>> batch;
+    for (int i = 0; i < 1000; ++i) {
+        batch.emplace_back(i, i * 3);
+    }
+    
+    unordered_mapMutex<int, int> map;
+    map.insert(0, -1);
+    assert(map.insert_bulk(batch) == 999);  // 已存在的键保持不变
+    assert(map.size() == 1000);
+    assert(map.get(0) == -1 && map.get(999) == 2997);
+    
+    std::vector<int> keys{1, 2, 5000};
+    std::vector<int> values;
+    assert(map.get_many(keys, std::back_inserter(values), -7) == 2);
+    assert((values == std::vector<int>{3, 6, -7}));
+    assert(map.erase_bulk(keys) == 2);
+    assert(map.size() == 998);
+    
+    mapMutex<int, int> ordered;
+    assert(ordered.insert_bulk(batch.begin(), batch.end()) == 1000);
+    values.clear();
+    assert(ordered.get_many(keys, std::back_inserter(values)) == 2);
+    assert((values == std::vector<int>{3, 6, 0}));
+    assert(ordered.erase_bulk(keys.begin(), keys.end()) == 2);
+    
+    // LockFree 特化提供相同的批量接口
+    unordered_mapLockFree<int, int> lf_map;
+    assert(lf_map.insert_bulk(batch) == 1000);
+    values.clear();
+    assert(lf_map.get_many(keys, std::back_inserter(values), -7) == 2);
+    assert((values == std::vector<int>{3, 6, -7}));
+    assert(lf_map.erase_bulk(keys) == 2 && lf_map.size() == 998);
+    mapLockFree<int, int> lf_ordered;
+    assert(lf_ordered.insert_bulk(batch.begin(), batch.end()) == 1000);
+    values.clear();
+    assert(lf_ordered.get_many(keys, std::back_inserter(values)) == 2);
+    assert((values == std::vector<int>{3, 6, 0}));
+    assert(lf_ordered.erase_bulk(keys.begin(), keys.end()) == 2);
+    
+    // 分片 map：按分片分组后每个分片只加锁一次，输出顺序与输入一致
+    sharded_unordered_mapMutex<int, int, 8> sharded;
+    assert(sharded.insert_bulk(batch) == 1000);
+    assert(sharded.size() == 1000);
+    values.clear();
+    assert(sharded.get_many(keys, std::back_inserter(values), -7) == 2);
+    assert((values == std::vector<int>{3, 6, -7}));
+    assert(sharded.erase_bulk(keys) == 2);
+    assert(sharded.size() == 998);
+    
+    // 迭代器按值产出键时，分组保存的是键的副本而不是临时对象的地址
+    values.clear();
+    assert(sharded.get_many(counting_range{10, 20}, std::back_inserter(values)) == 10);
+    for (int i = 0; i < 10; ++i) {
+        assert(values[static_cast<size_t>(i)] == (10 + i) * 3);
+    }
+    assert(sharded.erase_bulk(counting_range{10, 20}) == 10);
+    assert(sharded.size() == 988 && !sharded.contains(15) && sharded.contains(20));
+    
+    std::cout << "✓ Bulk operations passed" << std::endl;
+}
+
+void test_ordered_map_insert() {
+    std::cout << "Testing ordered map insert results..." << std::endl;
+    
+    mapMutex<int, std::string> map;
+    assert(map.insert(20, "b"));
+    assert(!map.insert(20, "ignored"));
+    assert(map.get(20) == "b");
+    assert(map.emplace(30, 3, 'c'));
+    assert(map.get(30) == "ccc");
+    
+    // 下标是显式的 O(n) 接口
+    auto indexed = map.insert_indexed(10, "a");
+    assert(indexed.first && indexed.second == 0);
+    assert(map.index_of(30) == 2u);
+    assert(!map.index_of(99).has_value());
+    
+    mapLockFree<int, int> lf;
+    assert(lf.insert(1, 1));
+    assert(!lf.insert(1, 2));
+    assert(lf.insert_indexed(0, 0).second == 0);
+    assert(lf.index_of(1) == 1u);
+    
+    // 右值重载：只能移动的值也可以按下标插入
+    mapLockFree<int, std::unique_ptr<int>> owned;
+    assert(owned.insert_indexed(2, std::make_unique<int>(2)).second == 0);
+    auto moved = owned.insert_indexed(1, std::make_unique<int>(1));
+    assert(moved.first && moved.second == 0 && *owned.at(2) == 2);
+    
+    std::cout << "✓ Ordered map insert results passed" << std::endl;
+}
+
+void test_heterogeneous_lookup() {
+    std::cout << "Testing heterogeneous lookup..." << std::endl;
+    
+    const std::string buffer = "GET alpha beta";
+    std::string_view alpha(buffer.data() + 4, 5);
+    
+    string_map<int> ordered;
+    ordered.insert("alpha", 1);
+    assert(ordered.contains(alpha));
+    assert(ordered.count(alpha) == 1);
+    assert(ordered.get(alpha) == 1);
+    assert(ordered.at(alpha) == 1);
+    assert(ordered.get(std::string_view("gamma"), -1) == -1);
+    bool thrown = false;
+    try {
+        ordered.at(std::string_view("gamma"));
+    } catch (const std::out_of_range&) {
+        thrown = true;
+    }
+    assert(thrown);
+    
+    setMutex<std::string, std::less<>> names;
+    names.insert("beta");
+    assert(names.contains(std::string_view("beta")));
+    assert(!names.contains("alpha"));
+    
+    string_unordered_map<int> hashed;
+    hashed.insert("alpha", 2);
+    assert(string_hash{}(alpha) == string_hash{}(std::string("alpha")));
+#if defined(__cpp_lib_generic_unordered_lookup)
+    assert(hashed.contains(alpha));
+    assert(hashed.count(alpha) == 1);
+    assert(hashed.get(alpha) == 2);
+    assert(hashed.at(alpha) == 2);
+    assert(hashed.get(std::string_view("gamma"), -1) == -1);
+    thrown = false;
+    try {
+        hashed.at(std::string_view("gamma"));
+    } catch (const std::out_of_range&) {
+        thrown = true;
+    }
+    assert(thrown);
+    
+    unordered_map<std::string, int, string_hash, std::equal_to<>, LockPolicy::LockFree> hashed_free;
+    hashed_free.insert("alpha", 3);
+    assert(hashed_free.contains(alpha));
+    assert(hashed_free.count(std::string_view("gamma")) == 0);
+    assert(hashed_free.get(alpha) == 3);
+    assert(hashed_free.at(alpha) == 3);
+    
+    unordered_setMutex<std::string, string_hash, std::equal_to<>> tags;
+    tags.insert("beta");
+    assert(tags.contains(std::string_view("beta")));
+    assert(tags.count(alpha) == 0);
+    
+    unordered_set<std::string, string_hash, std::equal_to<>, LockPolicy::LockFree> tags_free;
+    tags_free.insert("beta");
+    assert(tags_free.contains(std::string_view("beta")));
+    assert(tags_free.count(alpha) == 0);
+#else
+    assert(hashed.contains(std::string(alpha)));
+#endif
+    
+    std::cout << "✓ Heterogeneous lookup passed" << std::endl;
+}
+
+void test_in_place_access() {
+    std::cout << "Testing in-place access and read-modify-write..." << std::endl;
+    
+    unordered_mapMutex<int, std::vector<int>> map;
+    map.insert(1, std::vector<int>(512, 7));
+    
+    size_t seen = 0;
+    assert(map.visit(1, [&seen](const std::vector<int>& v) { seen = v.size(); }));
+    assert(seen == 512);
+    assert(!map.visit(2, [](const std::vector<int>&) { assert(false); }));
+    
+    assert(map.visit_mut(1, [](std::vector<int>& v) { v.push_back(8); }));
+    assert(map.visit(1, [](const auto& v) { assert(v.back() == 8); }));
+    
+    // compute_if_absent 只在键不存在时调用工厂函数
+    int factory_calls = 0;
+    auto factory = [&factory_calls]() { ++factory_calls; return std::vector<int>{1}; };
+    assert(map.compute_if_absent(2, factory));
+    assert(!map.compute_if_absent(2, factory));
+    assert(factory_calls == 1);
+    
+    // compute_if_present 返回 false 时删除元素
+    assert(map.compute_if_present(2, [](std::vector<int>& v) { v.clear(); }));
+    assert(map.contains(2));
+    assert(map.compute_if_present(2, [](std::vector<int>& v) { return !v.empty(); }));
+    assert(!map.contains(2));
+    assert(!map.compute_if_present(2, [](std::vector<int>&) { return true; }));
+    
+    // 并发 merge 计数
+    unordered_mapMutex<int, int> counters;
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([&counters]() {
+            for (int i = 0; i < 1000; ++i) {
+                counters.merge(i % 10, 1, [](int& existing, const int& add) { existing += add; });
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    for (int k = 0; k < 10; ++k) {
+        assert(counters.get(k) == 400);
+    }
+    
+    mapMutex<int, int> ordered;
+    assert(ordered.merge(1, 5, [](int& e, const int& v) { e += v; }));
+    assert(!ordered.merge(1, 5, [](int& e, const int& v) { e += v; }));
+    assert(ordered.visit(1, [](const int& v) { assert(v == 10); }));
+    
+    sharded_unordered_mapMutex<int, int, 4> sharded;
+    assert(sharded.compute_if_absent(3, []() { return 30; }));
+    assert(sharded.visit_mut(3, [](int& v) { ++v; }));
+    assert(sharded.get(3) == 31);
+    
+    unordered_mapLockFree<int, int> lf;
+    assert(lf.merge(1, 1, [](int& e, const int& v) { e += v; }));
+    assert(lf.compute_if_present(1, [](int&) { return false; }));
+    assert(!lf.contains(1));
+    
+    std::cout << "✓ In-place access passed" << std::endl;
+}
+
+#if TS_STL_SUPPORT_PMR
+// 统计经过的分配次数，用于确认节点确实来自指定的内存资源
+class counting_resource : public std::pmr::memory_resource {
+public:
+    size_t allocations = 0;
+
+private:
+    void* do_allocate(size_t bytes, size_t alignment) override {
+        ++allocations;
+        return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+    }
+    void do_deallocate(void* p, size_t bytes, size_t alignment) override {
+        std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+    }
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+        return this == &other;
+    }
+};
+#endif
+
+void test_custom_allocator() {
+    std::cout << "Testing custom allocators..." << std::endl;
+    
+    // 默认分配器可显式获取
+    mapMutex<int, int> plain;
+    std::allocator<std::pair<const int, int>> default_allocator;
+    assert(plain.get_allocator() == default_allocator);
+    
+#if TS_STL_SUPPORT_PMR
+    counting_resource upstream;
+    using pmr_pair_allocator = std::pmr::polymorphic_allocator<std::pair<const int, int>>;
+    pmr::unordered_map<int, int> um{pmr_pair_allocator(&upstream)};
+    um.insert(1, 10);
+    um.insert(2, 20);
+    assert(upstream.allocations > 0);
+    assert(um.get_allocator().resource() == &upstream);
+    
+    // copy() 得到的标准容器不再引用原内存资源
+    auto snapshot = um.copy();
+    assert(snapshot.get_allocator().resource() == std::pmr::get_default_resource());
+    assert(snapshot.size() == 2);
+    
+    // 每个容器独占节点池，并发插入由容器锁串行化
+    pooled<pmr::map<int, int>> ordered;
+    assert(ordered.get_allocator().resource() == ordered.resource());
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([&ordered, t]() {
+            for (int i = 0; i < 500; ++i) {
+                ordered.insert(t * 500 + i, i);
+                if (i % 3 == 0) {
+                    ordered.erase(t * 500 + i);
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    assert(ordered.size() == 4 * 333);
+    
+    pooled<pmr::set<std::string>> names(std::pmr::pool_options{16, 256});
+    names.insert("alpha");
+    names.insert(std::string(100, 'x'));
+    assert(names.size() == 2 && names.contains("alpha"));
+    
+    pooled<pmr::unordered_set<int, std::hash<int>, std::equal_to<int>, LockPolicy::SpinLock>> ids;
+    assert(ids.insert_bulk(std::vector<int>{1, 2, 3}) == 3);
+    
+    pooled<pmr::list<int>> items;
+    items.push_back(1);
+    items.push_front(0);
+    assert(items.size() == 2 && items.front() == 0);
+    
+    pmr::map<int, int, std::less<int>, LockPolicy::LockFree> lf{pmr_pair_allocator(&upstream)};
+    lf.insert(1, 1);
+    assert(lf.get_allocator().resource() == &upstream);
+#endif
+    
+    std::cout << "✓ Custom allocators passed" << std::endl;
+}
+
+void test_flat_unordered_map() {
+    std::cout << "Testing flat unordered map..." << std::endl;
+    
+    flat_unordered_mapMutex<int, std::string> map;
+    assert(map.empty() && map.bucket_count() == 0);
+    assert(map.insert(1, "one").first);
+    assert(!map.insert(1, "uno").first);
+    map[2] = "two";
+    map.set(3, "three");
+    assert(map.size() == 3);
+    assert(map.get(1) == "one");
+    assert(map.get(9, "none") == "none");
+    assert(map.at(2) == "two");
+    assert(map.erase(2) == 1 && !map.contains(2));
+    assert(map.visit_mut(3, [](std::string& v) { v += "!"; }));
+    assert(map.get(3) == "three!");
+    
+    bool thrown = false;
+    try {
+        map.at(42);
+    } catch (const std::out_of_range&) {
+        thrown = true;
+    }
+    assert(thrown);
+    
+    // 大量插入删除后与 std::unordered_map 对照
+    flat_unordered_mapSpinLock<int, int> flat;
+    std::unordered_map<int, int> expected;
+    for (int i = 0; i < 20000; ++i) {
+        int key = (i * 7919) % 5000;
+        if (i % 3 == 0) {
+            assert(flat.erase(key) == expected.erase(key));
+        } else {
+            flat.insert(key, i);
+            expected.insert({key, i});
+        }
+    }
+    assert(flat.size() == expected.size());
+    flat.for_each([&expected](const int& k, const int& v) { assert(expected.at(k) == v); });
+    assert(flat.load_factor() <= flat.max_load_factor());
+    
+    // 预留容量后插入不再扩容
+    flat_unordered_mapMutex<int, int> reserved;
+    reserved.reserve(1000);
+    size_t buckets = reserved.bucket_count();
+    for (int i = 0; i < 1000; ++i) {
+        reserved.insert(i, i);
+    }
+    assert(reserved.bucket_count() == buckets);
+    
+    // 并发写
+    flat_unordered_mapMutex<int, int> shared;
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([&shared, t]() {
+            for (int i = 0; i < 1000; ++i) {
+                shared.insert(t * 1000 + i, i);
+                shared.merge(-1, 1, [](int& e, const int& v) { e += v; });
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    assert(shared.size() == 4001);
+    assert(shared.get(-1) == 4000);
+    
+    // 透明哈希下以 string_view 查找，C++17 即可使用
+    string_flat_unordered_map<int> names;
+    names.insert("alpha", 1);
+    std::string_view key = "alpha";
+    assert(names.contains(key));
+    assert(names.get(key) == 1);
+    
+    flat_unordered_mapLockFree<int, int> lf;
+    lf[1] = 10;
+    lf.insert(2, 20);
+    int sum = 0;
+    for (const auto& kv : lf) {
+        sum += kv.second;
+    }
+    assert(sum == 30);
+    auto copy = lf.get_unsafe();
+    assert(copy.size() == 2 && copy.at(2) == 20);
+    
+    std::vector<std::pair<int, int>> batch{{2, 0}, {3, 30}, {4, 40}};
+    assert(lf.insert_bulk(batch) == 2 && lf.get(2) == 20);
+    std::vector<int> values;
+    assert(lf.get_many(std::vector<int>{1, 4, 9}, std::back_inserter(values), -1) == 2);
+    assert((values == std::vector<int>{10, 40, -1}));
+    assert(lf.erase_bulk(std::vector<int>{3, 9}) == 1 && lf.size() == 3);
+    
+    std::cout << "✓ Flat unordered map passed" << std::endl;
+}
+
+void test_flat_map() {
+    std::cout << "Testing flat map..." << std::endl;
+    
+    flat_mapMutex<int, std::string> map;
+    assert(map.insert(2, "two"));
+    assert(!map.insert(2, "deux"));
+    map[1] = "one";
+    map.set(3, "three");
+    assert(map.size() == 3);
+    assert(map.get(2) == "two");
+    assert(map.at(3) == "three");
+    assert(*map.index_of(3) == 2);
+    assert(map.insert_indexed(0, "zero").second == 0);
+    assert(map.upper_bound(3) == false);
+    
+    // 批量构建：只排序去重一次，重复键保留先出现的
+    flat_mapRW<int, int> table;
+    std::vector<std::pair<int, int>> batch;
+    for (int i = 0; i < 1000; ++i) {
+        batch.emplace_back((i * 7919) % 500, i);
+    }
+    assert(table.insert_bulk(batch) == 500);
+    assert(table.get(0) == 0);
+    assert(table.erase_bulk(std::vector<int>{499, 0, 1000}) == 2);
+    assert(table.size() == 498);
+    
+    // 区间查询：[lo, hi) 内的元素连续且有序
+    size_t n = table.visit_range(10, 20, [](const std::pair<int, int>* first, const std::pair<int, int>* last) {
+        for (int key = 10; first != last; ++first, ++key) {
+            assert(first->first == key);
+        }
+    });
+    assert(n == 10);
+    auto slice = table.copy_range(495, 1000);
+    assert(slice.size() == 4 && slice.front().first == 495);
+    assert(table.copy_range(20, 10).empty());
+    
+    // 整体替换
+    table.assign(std::vector<std::pair<int, int>>{{5, 50}, {4, 40}});
+    assert(table.size() == 2 && table.get(4) == 40);
+    
+    // 读者并发查找，写者批量插入
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([&table, t]() {
+            for (int i = 0; i < 500; ++i) {
+                if (t == 0) {
+                    table.insert(100 + i, i);
+                } else {
+                    assert(table.get(5) == 50);
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    assert(table.size() == 502);
+    
+    string_flat_map<int> names;
+    names.insert("alpha", 1);
+    std::string_view key = "alpha";
+    assert(names.contains(key) && names.get(key) == 1);
+    
+    flat_mapLockFree<int, int> lf(batch.begin(), batch.end());
+    auto span = lf.range_span(100, 110);
+    assert(span.second - span.first == 10 && span.first->first == 100);
+    int sum = 0;
+    for (const auto& kv : lf) {
+        sum += kv.first;
+    }
+    assert(sum == 499 * 500 / 2);
+    
+    std::cout << "✓ Flat map passed" << std::endl;
+}
+
+void test_map_range_queries() {
+    std::cout << "Testing map range queries..." << std::endl;
+    
+    mapRW<int, int> series;
+    for (int t = 0; t < 100; t += 10) {
+        series.insert(t, t * 2);
+    }
+    
+    auto entry = series.lower_bound_entry(15);
+    assert(entry && entry->first == 20 && entry->second == 40);
+    assert(series.upper_bound_entry(90) == std::nullopt);
+    assert(series.upper_bound_entry(20)->first == 30);
+    
+    // [lo, hi) 半开区间，只访问区间内的元素
+    int sum = 0;
+    assert(series.range(20, 50, [&sum](const int& k, const int&) { sum += k; }) == 3);
+    assert(sum == 20 + 30 + 40);
+    assert(series.range(50, 20, [](const int&, const int&) { assert(false); }) == 0);
+    
+    // 回调返回 false 时提前结束
+    size_t visited = series.range(0, 100, [](const int& k, const int&) { return k < 30; });
+    assert(visited == 4);
+    
+    std::vector<std::pair<int, int>> out;
+    assert(series.collect_range(0, 100, std::back_inserter(out), 3) == 3);
+    assert(out.size() == 3 && out.back().first == 20);
+    out.clear();
+    assert(series.collect_range(35, 1000, std::back_inserter(out)) == 6);
+    assert(series.collect_range(0, 100, std::back_inserter(out), 0) == 0);
+    
+    // 前缀扫描
+    string_map<int> index;
+    index.insert("cpu.user", 1);
+    index.insert("cpu.sys", 2);
+    index.insert("cpuset", 3);
+    index.insert("mem.free", 4);
+    std::vector<std::string> keys;
+    assert(index.prefix_scan("cpu.", [&keys](const std::string& k, const int&) { keys.push_back(k); }) == 2);
+    assert((keys == std::vector<std::string>{"cpu.sys", "cpu.user"}));
+    std::vector<std::pair<std::string, int>> hits;
+    assert(index.collect_prefix("cpu", std::back_inserter(hits), 10) == 3);
+    assert(index.collect_prefix("disk", std::back_inserter(hits)) == 0);
+    
+    mapLockFree<int, int> lf;
+    lf.insert(1, 1);
+    lf.insert(5, 5);
+    assert(lf.range(0, 10, [](const int&, const int&) {}) == 2);
+    assert(lf.lower_bound_entry(2)->first == 5);
+    
+    flat_mapRW<int, int> flat;
+    flat.insert_bulk(series.copy());
+    assert(flat.range(20, 50, [](const int&, const int&) {}) == 3);
+    assert(flat.upper_bound_entry(20)->first == 30);
+    
+    std::cout << "✓ Map range queries passed" << std::endl;
+}
+
+void test_skiplist_map() {
+    std::cout << "Testing skiplist map..." << std::endl;
+    
+    mapConcurrent<int, std::string> map;
+    assert(map.empty());
+    assert(map.insert(3, "three"));
+    assert(map.insert(1, "one"));
+    assert(!map.insert(1, "uno"));
+    assert(map.get(1) == "one");
+    map.set(1, "uno");
+    assert(map.get(1) == "uno");
+    assert(map.get(7, "none") == "none");
+    assert(map.contains(3) && map.count(2) == 0);
+    assert(map.visit_mut(3, [](std::string& v) { v += "!"; }));
+    assert(map.at(3) == "three!");
+    bool thrown = false;
+    try {
+        map.at(42);
+    } catch (const std::out_of_range&) {
+        thrown = true;
+    }
+    assert(thrown);
+    assert(map.erase(3) == 1 && map.erase(3) == 0);
+    assert(map.size() == 1);
+    
+    // 并发写入不相交的键，遍历始终有序
+    mapConcurrent<int, int> shared;
+    const int num_threads = 4;
+    const int per_thread = 2000;
+    std::vector<std::thread> threads;
+    for (int t = 0; t < num_threads; ++t) {
+        threads.emplace_back([&shared, t]() {
+            for (int i = 0; i < per_thread; ++i) {
+                int key = i * num_threads + t;
+                shared.insert(key, key);
+                if (key % 3 == 0) {
+                    shared.erase(key);
+                }
+                shared.merge(-1, 1, [](int& total, const int& add) { total += add; });
+            }
+        });
+    }
+    for (auto& th : threads) {
+        th.join();
+    }
+    assert(shared.get(-1) == num_threads * per_thread);
+    shared.erase(-1);
+    
+    size_t expected = 0;
+    for (int k = 0; k < num_threads * per_thread; ++k) {
+        expected += (k % 3 != 0) ? 1 : 0;
+    }
+    assert(shared.size() == expected);
+    int prev = -1;
+    size_t seen = 0;
+    shared.for_each([&](const int& k, const int& v) {
+        assert(k > prev && k == v && k % 3 != 0);
+        prev = k;
+        ++seen;
+    });
+    assert(seen == expected);
+    
+    // 有序区间
+    std::vector<std::pair<int, int>> out;
+    assert(shared.collect_range(10, 20, std::back_inserter(out)) == 7);
+    assert(out.front().first == 10 && out.back().first == 19);
+    assert(shared.range(0, 100, [](const int& k, const int&) { return k < 5; }) == 4);
+    assert(shared.copy().size() == expected);
+    
+    shared.clear();
+    assert(shared.empty());
+    
+    std::cout << "✓ Skiplist map passed" << std::endl;
+}
+
+void test_parallel_scans() {
+    std::cout << "Testing parallel scans..." << std::endl;
+    
+    sharded_unordered_mapMutex<int, int> sharded;
+    unordered_mapRW<int, int> plain;
+    const int n = 100000;
+    for (int i = 0; i < n; ++i) {
+        sharded.insert(i, i % 10);
+        plain.insert(i, i % 10);
+    }
+    
+    // 键值对容器的回调为 (key, value)，归约为 (acc, key, value)
+    auto add_value = [](long long acc, const int&, const int& v) { return acc + v; };
+    auto add = [](long long a, long long b) { return a + b; };
+    assert(sharded.parallel_reduce(0LL, add_value, add, 4) == 45LL * n / 10);
+    assert(plain.parallel_reduce(0LL, add_value, add, 4) == 45LL * n / 10);
+    assert(sharded.parallel_count_if([](const int&, const int& v) { return v == 0; }, 4) == n / 10);
+    assert(plain.parallel_count_if([](const int& k, const int&) { return k < 100; }, 4) == 100);
+    
+    std::atomic<long long> key_sum{0};
+    sharded.parallel_for_each([&key_sum](const int& k, const int&) { key_sum.fetch_add(k); }, 4);
+    assert(key_sum.load() == static_cast<long long>(n) * (n - 1) / 2);
+    
+    auto keys = sharded.parallel_transform([](const int& k, const int&) { return k; }, 4);
+    std::sort(keys.begin(), keys.end());
+    assert(keys.size() == static_cast<size_t>(n) && keys.front() == 0 && keys.back() == n - 1);
+    
+    // 有序 map 的 transform 保持键序
+    mapMutex<int, int> ordered;
+    for (int i = 0; i < n; ++i) {
+        ordered.insert(n - i, i);
+    }
+    auto ordered_keys = ordered.parallel_transform([](const int& k, const int&) { return k; }, 4);
+    assert(std::is_sorted(ordered_keys.begin(), ordered_keys.end()));
+    
+    std::cout << "✓ Parallel scans passed" << std::endl;
+}
+
+void test_node_migration() {
+    std::cout << "Testing node extract / merge..." << std::endl;
+    
+    // extract 得到的节点原样插入另一个容器，元素地址不变
+    unordered_mapMutex<int, std::string> hot;
+    unordered_mapMutex<int, std::string> cold;
+    hot.insert(1, "one");
+    const std::string* address = &hot.unsafe_ref().at(1);
+    auto node = hot.extract(1);
+    assert(!node.empty() && !hot.contains(1));
+    assert(cold.insert_node(node) && node.empty());
+    assert(&cold.unsafe_ref().at(1) == address);
+    assert(hot.extract(42).empty());
+    
+    // 键已存在时节点留给调用方
+    hot.insert(1, "uno");
+    auto duplicate = hot.extract(1);
+    assert(!cold.insert_node(duplicate) && !duplicate.empty());
+    assert(duplicate.mapped() == "uno");
+    
+    // merge_from：跨锁策略迁移，已存在的键留在源容器
+    mapMutex<int, int> tier0;
+    mapSpinLock<int, int> tier1;
+    for (int i = 0; i < 100; ++i) {
+        tier0.insert(i, i);
+    }
+    tier1.insert(5, -5);
+    assert(tier1.merge_from(tier0) == 99);
+    assert(tier0.size() == 1 && tier0.at(5) == 5);
+    assert(tier1.size() == 100 && tier1.at(5) == -5);
+    assert(tier1.merge_from(tier1) == 0);
+    
+    mapLockFree<int, int> scratch;
+    scratch.insert(1000, 1);
+    assert(tier1.merge_from(scratch) == 1 && scratch.empty());
+    
+    setMutex<int> s1;
+    unordered_setMutex<int> s2;
+    s1.insert(1);
+    s1.insert(2);
+    s2.insert(3);
+    assert(s1.insert_node(s1.extract(2)));
+    setAdaptive<int> s3;
+    assert(s3.merge_from(s1) == 2 && s1.empty());
+    unordered_setSpinLock<int> s4;
+    assert(s4.merge_from(s2) == 1 && s4.contains(3));
+    
+    // 两个方向同时迁移：按地址顺序加锁，不会死锁
+    unordered_mapMutex<int, int> a;
+    unordered_mapMutex<int, int> b;
+    for (int i = 0; i < 1000; ++i) {
+        a.insert(i, i);
+        b.insert(i + 1000, i);
+    }
+    std::thread forward([&]() {
+        for (int round = 0; round < 200; ++round) {
+            b.merge_from(a);
+        }
+    });
+    std::thread backward([&]() {
+        for (int round = 0; round < 200; ++round) {
+            a.merge_from(b);
+        }
+    });
+    forward.join();
+    backward.join();
+    assert(a.size() + b.size() == 2000);
+    
+    // drain 取走全部元素
+    auto drained = a.drain();
+    assert(a.empty() && drained.size() + b.size() == 2000);
+    
+#if TS_STL_SUPPORT_PMR
+    // 不同内存资源之间迁移：逐个移动，节点由各自的资源释放
+    counting_resource upstream;
+    using pmr_pair_allocator = std::pmr::polymorphic_allocator<std::pair<const int, int>>;
+    pmr::map<int, int> external{pmr_pair_allocator(&upstream)};
+    pooled<pmr::map<int, int>> pool_map;
+    for (int i = 0; i < 50; ++i) {
+        pool_map.insert(i, i);
+    }
+    assert(external.merge_from(pool_map) == 50 && pool_map.empty());
+    assert(external.get_allocator().resource() == &upstream);
+    assert(pool_map.merge_from(external) == 50);
+    
+    // 节点来自另一内存资源时按值移动插入，原节点在 pool_map 的锁内释放
+    external.insert(1000, 7);
+    auto foreign = external.extract(1000);
+    assert(pool_map.insert_node(foreign) && foreign.empty() && pool_map.contains(1000));
+    
+    auto pool_snapshot = pool_map.drain();
+    assert(pool_snapshot.size() == 51 && pool_map.empty());
+    assert(pool_snapshot.get_allocator().resource() == std::pmr::get_default_resource());
+#endif
+    
+    std::cout << "✓ Node extract / merge passed" << std::endl;
+}
+
+void test_incremental_rehash() {
+    std::cout << "Testing incremental rehash..." << std::endl;
+    
+    incremental_unordered_mapMutex<int, std::string> map;
+    assert(map.empty() && map.bucket_count() == 0 && !map.resize_in_progress());
+    assert(map.insert(1, "one"));
+    assert(!map.insert(1, "uno"));
+    map.set(1, "uno");
+    assert(map.get(1) == "uno" && map.get(9, "none") == "none");
+    assert(map.erase(1) == 1 && !map.contains(1));
+    bool thrown = false;
+    try {
+        map.at(42);
+    } catch (const std::out_of_range&) {
+        thrown = true;
+    }
+    assert(thrown);
+    
+    // 跨过装载因子后新旧两张表并存，迁移过程中查找、删除结果不变
+    incremental_unordered_mapMutex<int, int> grow;
+    grow.set_migrate_step(1);
+    bool observed_resize = false;
+    for (int i = 0; i < 5000; ++i) {
+        grow.insert(i, i * 2);
+        if (grow.resize_in_progress()) {
+            observed_resize = true;
+            auto stats = grow.resize_stats();
+            assert(stats.bucket_count == stats.old_bucket_count * 2);
+            assert(stats.migrated_buckets < stats.old_bucket_count);
+            assert(stats.progress() < 1.0);
+            for (int k = 0; k <= i; k += 97) {
+                assert(grow.get(k, -1) == k * 2);
+            }
+        }
+    }
+    assert(observed_resize);
+    assert(grow.size() == 5000);
+    for (int i = 0; i < 5000; i += 2) {
+        assert(grow.erase(i) == 1);
+    }
+    for (int i = 0; i < 5000; ++i) {
+        assert(grow.contains(i) == (i % 2 == 1));
+    }
+    
+    auto stats = grow.resize_stats();
+    assert(stats.resizes_started >= stats.resizes_completed && stats.resizes_completed > 0);
+    assert(stats.nodes_migrated > 0);
+    while (grow.rehash_step(64)) {
+    }
+    assert(!grow.resize_in_progress() && grow.resize_stats().progress() == 1.0);
+    
+    int sum = 0;
+    size_t visited = 0;
+    grow.for_each([&](const int& k, const int& v) {
+        assert(v == k * 2);
+        sum += k % 2;
+        ++visited;
+    });
+    assert(visited == 2500 && sum == 2500);
+    
+    // 迭代器在迁移中途也恰好遍历每个元素一次
+    incremental_unordered_mapLockFree<int, int> lf;
+    lf.set_migrate_step(1);
+    int n = 0;
+    while (!lf.resize_in_progress() || n < 40) {
+        lf.insert(n, n);
+        ++n;
+    }
+    size_t seen = 0;
+    for (const auto& kv : lf) {
+        assert(kv.first == kv.second);
+        ++seen;
+    }
+    assert(seen == lf.size());
+    
+    // find() 得到的迭代器从所在桶向后继续，扩容进行中也不会回头访问排在它前面的元素
+    auto check_find_tail = [&lf](int start) {
+        size_t tail = 0;
+        for (auto it = lf.find(start); it != lf.end(); ++it) {
+            ++tail;
+        }
+        size_t position = 0;
+        for (auto it = lf.begin(); it->first != start; ++it) {
+            ++position;
+        }
+        assert(position + tail == lf.size());
+    };
+    assert(lf.resize_in_progress());
+    for (int start : {0, 3, n / 2, n - 1}) {
+        check_find_tail(start);
+    }
+    lf.get_unsafe().finish_resize();
+    for (int start : {0, 3, n / 2, n - 1}) {
+        check_find_tail(start);
+    }
+    auto copy = lf.get_unsafe();
+    assert(copy.size() == lf.size() && copy.at(3) == 3);
+    
+    // reserve 同步完成扩容，之后插入不再扩容
+    incremental_unordered_mapMutex<int, int> reserved;
+    reserved.reserve(1000);
+    size_t buckets = reserved.bucket_count();
+    for (int i = 0; i < 1000; ++i) {
+        reserved.insert(i, i);
+    }
+    assert(reserved.bucket_count() == buckets && reserved.resize_stats().resizes_started == 0);
+    
+    // 并发写（迁移不能破坏其他线程的插入）
+    incremental_unordered_mapMutex<int, int> shared;
+    shared.set_migrate_step(2);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([&shared, t]() {
+            for (int i = 0; i < 2000; ++i) {
+                shared.insert(t * 2000 + i, i);
+                shared.visit_mut(t * 2000 + i / 2, [](int& v) { v += 0; });
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    assert(shared.size() == 8000);
+    assert(shared.count_if([](const int& k, const int& v) { return k % 2000 == v; }) == 8000);
+    
+    incremental_unordered_setMutex<std::string> set;
+    for (int i = 0; i < 300; ++i) {
+        assert(set.insert(std::to_string(i)));
+    }
+    assert(!set.insert("7") && set.size() == 300 && set.contains("299"));
+    assert(set.erase("7") == 1 && !set.contains("7"));
+    size_t visited_keys = 0;
+    set.for_each([&visited_keys](const std::string&) { ++visited_keys; });
+    assert(visited_keys == 299);
+    assert(set.count_if([](const std::string& k) { return k.size() == 1; }) == 9);
+    
+    incremental_unordered_setLockFree<int> lf_set;
+    lf_set.set_migrate_step(1);
+    int m = 0;
+    while (!lf_set.resize_in_progress() || m < 40) {
+        assert(lf_set.insert(m));
+        ++m;
+    }
+    size_t seen_keys = 0;
+    for (int k : lf_set) {
+        assert(k >= 0 && k < m);
+        ++seen_keys;
+    }
+    assert(seen_keys == lf_set.size() && lf_set.find(3) != lf_set.end());
+    std::vector<int> more{m, m + 1, 0};
+    assert(lf_set.insert_bulk(more) == 2);
+    assert(lf_set.count_if([](int k) { return k % 2 == 0; }) == static_cast<size_t>((m + 2 + 1) / 2));
+    std::vector<std::pair<int, int>> pairs{{n, n}, {0, 0}};
+    assert(lf.insert_bulk(pairs) == 1);
+    assert(lf.count_if([](const int& k, const int& v) { return k == v; }) == lf.size());
+    
+    std::cout << "✓ Incremental rehash passed" << std::endl;
+}
+
 int main() {
     std::cout << "Thread-Safe Unordered Map Unit Tests" << std::endl;
     std::cout << "====================================" << std::endl;
@@ -271,6 +1268,19 @@ int main() {
         test_lockfree_version();
         test_exception_safety();
         test_manual_lock_control();
+        test_sharded_map();
+        test_bulk_operations();
+        test_ordered_map_insert();
+        test_heterogeneous_lookup();
+        test_in_place_access();
+        test_custom_allocator();
+        test_flat_unordered_map();
+        test_flat_map();
+        test_map_range_queries();
+        test_skiplist_map();
+        test_parallel_scans();
+        test_node_migration();
+        test_incremental_rehash();
         
         std::cout << "\n✓ All tests passed successfully!" << std::endl;
         return 0;